@@ -301,6 +301,8 @@ void DefineGeometryOptimization(py::module m) {
           doc.IrisOptions.num_additional_constraint_infeasible_samples.doc)
       .def_readwrite("random_seed", &IrisOptions::random_seed,
           doc.IrisOptions.random_seed.doc)
+      .def_readwrite("num_threads", &IrisOptions::num_threads,
+          doc.IrisOptions.num_threads.doc)
       .def("__repr__", [](const IrisOptions& self) {
         return py::str(
             "IrisOptions("
@@ -312,7 +314,8 @@ void DefineGeometryOptimization(py::module m) {
             "enable_ibex={}, "
             "prog_with_additional_constraints {}, "
             "num_additional_constraint_infeasible_samples={}, "
-            "random_seed={}"
+            "random_seed={}, "
+            "num_threads={}"
             ")")
             .format(self.require_sample_point_is_contained,
                 self.iteration_limit, self.termination_threshold,
@@ -320,7 +323,7 @@ void DefineGeometryOptimization(py::module m) {
                 self.configuration_space_margin, self.enable_ibex,
                 self.prog_with_additional_constraints ? "is set" : "is not set",
                 self.num_additional_constraint_infeasible_samples,
-                self.random_seed);
+                self.random_seed, self.num_threads);
       });
 
   m.def("Iris", &Iris, py::arg("obstacles"), py::arg("sample"),
@@ -336,6 +339,12 @@ void DefineGeometryOptimization(py::module m) {
       py::arg("plant"), py::arg("context"), py::arg("options") = IrisOptions(),
       doc.IrisInConfigurationSpace.doc);
 
+  m.def("IrisInConfigurationSpaceFromSeeds",
+      &IrisInConfigurationSpaceFromSeeds, py::arg("plant"),
+      py::arg("root_context"), py::arg("seeds"),
+      py::arg("options") = IrisOptions(), py::arg("num_collision_samples") = 0,
+      doc.IrisInConfigurationSpaceFromSeeds.doc);
+
   // GraphOfConvexSetsOptions
   {
     const auto& cls_doc = doc.GraphOfConvexSetsOptions;
@@ -347,16 +356,37 @@ void DefineGeometryOptimization(py::module m) {
             cls_doc.convex_relaxation.doc)
         .def_readwrite("preprocessing",
             &GraphOfConvexSetsOptions::preprocessing, cls_doc.preprocessing.doc)
+        .def_readwrite("max_rounded_paths",
+            &GraphOfConvexSetsOptions::max_rounded_paths,
+            cls_doc.max_rounded_paths.doc)
+        .def_readwrite("max_rounding_trials",
+            &GraphOfConvexSetsOptions::max_rounding_trials,
+            cls_doc.max_rounding_trials.doc)
+        .def_readwrite("flow_tolerance",
+            &GraphOfConvexSetsOptions::flow_tolerance,
+            cls_doc.flow_tolerance.doc)
+        .def_readwrite("rounding_seed",
+            &GraphOfConvexSetsOptions::rounding_seed,
+            cls_doc.rounding_seed.doc)
+        .def_readwrite("num_threads", &GraphOfConvexSetsOptions::num_threads,
+            cls_doc.num_threads.doc)
         .def("__repr__", [](const GraphOfConvexSetsOptions& self) {
           return py::str(
               "GraphOfConvexSetsOptions("
               "convex_relaxation={}, "
               "preprocessing={}, "
+              "max_rounded_paths={}, "
+              "max_rounding_trials={}, "
+              "flow_tolerance={}, "
+              "rounding_seed={}, "
+              "num_threads={}, "
               "solver={}, "
               "solver_options={}, "
               ")")
-              .format(self.convex_relaxation, self.preprocessing, self.solver,
-                  self.solver_options);
+              .format(self.convex_relaxation, self.preprocessing,
+                  self.max_rounded_paths, self.max_rounding_trials,
+                  self.flow_tolerance, self.rounding_seed, self.num_threads,
+                  self.solver, self.solver_options);
         });
 
     DefReadWriteKeepAlive(&gcs_options, "solver",
@@ -113,6 +113,10 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("StartRecording", &Class::StartRecording,
             py::arg("set_transforms_while_recording") = true,
             py_rvp::reference_internal, cls_doc.StartRecording.doc)
+        .def("StartRecordingToFile", &Class::StartRecordingToFile,
+            py::arg("filename"),
+            py::arg("set_transforms_while_recording") = true,
+            cls_doc.StartRecordingToFile.doc)
         .def("StopRecording", &Class::StopRecording, cls_doc.StopRecording.doc)
         .def("PublishRecording", &Class::PublishRecording,
             cls_doc.PublishRecording.doc)
@@ -252,6 +256,9 @@ void DoScalarIndependentDefinitions(py::module m) {
             py::overload_cast<std::string_view,
                 const Eigen::Ref<const Eigen::Matrix4d>&>(&Class::SetTransform),
             py::arg("path"), py::arg("matrix"), cls_doc.SetTransform.doc_matrix)
+        .def("SetTransforms", &Class::SetTransforms, py::arg("paths"),
+            py::arg("X_ParentPaths"), py::arg("tolerance") = 0.0,
+            py::arg("use_float32") = false, cls_doc.SetTransforms.doc)
         .def("Delete", &Class::Delete, py::arg("path") = "", cls_doc.Delete.doc)
         .def("SetRealtimeRate", &Class::SetRealtimeRate, py::arg("rate"),
             cls_doc.SetRealtimeRate.doc)
@@ -272,6 +279,8 @@ void DoScalarIndependentDefinitions(py::module m) {
             cls_doc.SetProperty.doc_vector_double)
         .def("SetAnimation", &Class::SetAnimation, py::arg("animation"),
             +cls_doc.SetAnimation.doc)
+        .def("PlayRecording", &Class::PlayRecording, py::arg("filename"),
+            cls_doc.PlayRecording.doc)
         .def("AddButton", &Class::AddButton, py::arg("name"),
             cls_doc.AddButton.doc)
         .def("GetButtonClicks", &Class::GetButtonClicks, py::arg("name"),
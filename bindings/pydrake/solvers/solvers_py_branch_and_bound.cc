@@ -53,7 +53,10 @@ void DefineSolversBranchAndBound(py::module m) {
               return self.GetSolution(mip_vars, nth_best_solution);
             },
             py::arg("mip_vars"), py::arg("nth_best_solution") = 0,
-            cls_doc.GetSolution.doc_2args_constEigenMatrixBase_int);
+            cls_doc.GetSolution.doc_2args_constEigenMatrixBase_int)
+        .def("set_num_threads", &Class::set_num_threads,
+            py::arg("num_threads"), cls_doc.set_num_threads.doc)
+        .def("num_threads", &Class::num_threads, cls_doc.num_threads.doc);
   }
 }
 
@@ -374,6 +374,8 @@ void BindSolverInterfaceAndFlags(py::module m) {
           "enabled", &SolverInterface::enabled, doc.SolverInterface.enabled.doc)
       .def("solver_id", &SolverInterface::solver_id,
           doc.SolverInterface.solver_id.doc)
+      .def("is_thread_safe", &SolverInterface::is_thread_safe,
+          doc.SolverInterface.is_thread_safe.doc)
       .def(
           "AreProgramAttributesSatisfied",
           [](const SolverInterface& self,
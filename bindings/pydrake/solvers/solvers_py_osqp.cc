@@ -20,6 +20,14 @@ void DefineSolversOsqp(py::module m) {
       .def(py::init<>(), doc.OsqpSolver.ctor.doc)
       .def_static("id", &OsqpSolver::id, doc.OsqpSolver.id.doc);
 
+  py::class_<PersistentOsqpSolver, SolverInterface>(
+      m, "PersistentOsqpSolver", doc.PersistentOsqpSolver.doc)
+      .def(py::init<>(), doc.PersistentOsqpSolver.ctor.doc)
+      .def("reused_workspace", &PersistentOsqpSolver::reused_workspace,
+          doc.PersistentOsqpSolver.reused_workspace.doc)
+      .def("Reset", &PersistentOsqpSolver::Reset,
+          doc.PersistentOsqpSolver.Reset.doc);
+
   py::class_<OsqpSolverDetails>(
       m, "OsqpSolverDetails", doc.OsqpSolverDetails.doc)
       .def_readonly(
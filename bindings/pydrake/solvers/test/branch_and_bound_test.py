@@ -24,3 +24,18 @@ class TestMixedIntegerBranchAndBound(unittest.TestCase):
         self.assertAlmostEqual(dut.GetSolution(x[0], 0), 1.)
         self.assertAlmostEqual(dut.GetSolution(x[0], 1), 1.)
         np.testing.assert_allclose(dut.GetSolution(x, 0), [1., 0.], atol=1e-12)
+
+    def test_num_threads(self):
+        prog = mp.MathematicalProgram()
+        x = prog.NewContinuousVariables(2)
+        b = prog.NewBinaryVariables(2)
+        prog.AddLinearConstraint(x[0] + 2 * x[1] + b[0] == 2.)
+        prog.AddLinearConstraint(x[0] - 3.1 * b[1] >= 1)
+        prog.AddQuadraticCost(x[0] * x[0])
+
+        dut = bnb.MixedIntegerBranchAndBound(prog, OsqpSolver().solver_id())
+        self.assertEqual(dut.num_threads(), 1)
+        dut.set_num_threads(num_threads=2)
+        self.assertEqual(dut.num_threads(), 2)
+        self.assertEqual(dut.Solve(), mp.SolutionResult.kSolutionFound)
+        self.assertAlmostEqual(dut.GetOptimalCost(), 1.)
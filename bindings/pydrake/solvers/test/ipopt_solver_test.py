@@ -24,6 +24,7 @@ class TestIpoptSolver(unittest.TestCase):
         self.assertTrue(solver.available())
         self.assertTrue(solver.enabled())
         self.assertEqual(solver.solver_id().name(), "IPOPT")
+        self.assertFalse(solver.is_thread_safe())
         self.assertEqual(solver.SolverName(), "IPOPT")
         self.assertEqual(solver.solver_type(), mp.SolverType.kIpopt)
         result = solver.Solve(prog, None, None)
@@ -168,6 +168,7 @@ class TestMathematicalProgram(unittest.TestCase):
         self.assertEqual(solver_id.name(), "Linear system")
         solver = mp.MakeSolver(solver_id)
         self.assertEqual(solver.solver_id().name(), "Linear system")
+        self.assertTrue(solver.is_thread_safe())
         self.assertTrue(solver.AreProgramAttributesSatisfied(prog))
         self.assertEqual(solver.ExplainUnsatisfiedProgramAttributes(prog), "")
         result = solver.Solve(prog)
@@ -1,7 +1,7 @@
 import unittest
 import numpy as np
 from pydrake.solvers import mathematicalprogram as mp
-from pydrake.solvers.osqp import OsqpSolver
+from pydrake.solvers.osqp import OsqpSolver, PersistentOsqpSolver
 
 
 class TestOsqpSolver(unittest.TestCase):
@@ -26,6 +26,25 @@ class TestOsqpSolver(unittest.TestCase):
         np.testing.assert_allclose(result.GetDualSolution(constraint1), [1.])
         np.testing.assert_allclose(result.GetDualSolution(constraint2), [1.])
 
+    def test_persistent_osqp_solver(self):
+        prog = mp.MathematicalProgram()
+        x = prog.NewContinuousVariables(2, "x")
+        constraint = prog.AddLinearConstraint(x[0] + x[1] >= 1)
+        prog.AddQuadraticCost(np.eye(2), np.zeros(2), x)
+        solver = PersistentOsqpSolver()
+        self.assertEqual(solver.solver_id(), OsqpSolver.id())
+        result = solver.Solve(prog, None, None)
+        self.assertTrue(result.is_success())
+        self.assertFalse(solver.reused_workspace())
+        constraint.evaluator().UpdateLowerBound([2.])
+        result = solver.Solve(prog, None, None)
+        self.assertTrue(result.is_success())
+        self.assertTrue(solver.reused_workspace())
+        np.testing.assert_allclose(
+            result.GetSolution(x), [1., 1.], atol=1e-6)
+        solver.Reset()
+        self.assertFalse(solver.reused_workspace())
+
     def unavailable(self):
         """Per the BUILD file, this test is only run when OSQP is disabled."""
         solver = OsqpSolver()
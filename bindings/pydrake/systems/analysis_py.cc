@@ -189,6 +189,10 @@ PYBIND11_MODULE(analysis, m) {
         .def("set_publish_at_initialization",
             &Simulator<T>::set_publish_at_initialization, py::arg("publish"),
             doc.Simulator.set_publish_at_initialization.doc)
+        .def("set_profiling_enabled", &Simulator<T>::set_profiling_enabled,
+            py::arg("enabled"), doc.Simulator.set_profiling_enabled.doc)
+        .def("get_profiling_enabled", &Simulator<T>::get_profiling_enabled,
+            doc.Simulator.get_profiling_enabled.doc)
         .def("set_target_realtime_rate",
             &Simulator<T>::set_target_realtime_rate, py::arg("realtime_rate"),
             doc.Simulator.set_target_realtime_rate.doc)
@@ -251,6 +251,12 @@ PYBIND11_MODULE(primitives, m) {
             doc.MultilayerPerceptron.layers.doc)
         .def("activation_type", &MultilayerPerceptron<T>::activation_type,
             py::arg("layer"), doc.MultilayerPerceptron.activation_type.doc)
+        .def("set_num_batch_threads",
+            &MultilayerPerceptron<T>::set_num_batch_threads,
+            py::arg("num_threads"),
+            doc.MultilayerPerceptron.set_num_batch_threads.doc)
+        .def("num_batch_threads", &MultilayerPerceptron<T>::num_batch_threads,
+            doc.MultilayerPerceptron.num_batch_threads.doc)
         .def("GetParameters", &MultilayerPerceptron<T>::GetParameters,
             py::arg("context"),
             py::keep_alive<0, 2>() /* return keeps context alive */,
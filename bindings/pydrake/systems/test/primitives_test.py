@@ -510,6 +510,9 @@ class TestGeneral(unittest.TestCase):
         self.assertEqual(mlp.layers(), [1, 2, 3])
         self.assertEqual(mlp.activation_type(layer=0),
                          PerceptronActivationType.kReLU)
+        self.assertEqual(mlp.num_batch_threads(), 1)
+        mlp.set_num_batch_threads(num_threads=2)
+        self.assertEqual(mlp.num_batch_threads(), 2)
         self.assertEqual(len(mlp.GetParameters(context=context)),
                          mlp.num_parameters())
         mlp.SetWeights(context=context, layer=0, W=np.array([[1], [2]]))
@@ -357,6 +357,7 @@ class TestGeometryOptimization(unittest.TestCase):
         options.termination_threshold = 0.1
         options.relative_termination_threshold = 0.01
         options.random_seed = 1314
+        options.num_threads = 2
         self.assertNotIn("object at 0x", repr(options))
         region = mut.Iris(
             obstacles=obstacles, sample=[2, 3.4, 5],
@@ -408,11 +409,27 @@ class TestGeometryOptimization(unittest.TestCase):
         self.assertEqual(region.ambient_dimension(), 1)
         self.assertTrue(region.PointInSet([1.0]))
         self.assertFalse(region.PointInSet([3.0]))
+        regions = mut.IrisInConfigurationSpaceFromSeeds(
+            plant=plant, root_context=context,
+            seeds=[[-1.0, 0.0, 1.0]], options=options)
+        self.assertEqual(len(regions), 3)
+        for region in regions:
+            self.assertIsInstance(region, mut.HPolyhedron)
+            self.assertTrue(region.PointInSet([1.0]))
+        regions = mut.IrisInConfigurationSpaceFromSeeds(
+            plant=plant, root_context=context, seeds=[[0.0]],
+            options=options, num_collision_samples=10)
+        self.assertEqual(len(regions), 1)
 
     def test_graph_of_convex_sets(self):
         options = mut.GraphOfConvexSetsOptions()
         options.convex_relaxation = True
         options.preprocessing = False
+        options.max_rounded_paths = 2
+        options.max_rounding_trials = 10
+        options.flow_tolerance = 1e-6
+        options.rounding_seed = 1
+        options.num_threads = 2
         options.solver = ClpSolver()
         options.solver_options = SolverOptions()
         self.assertIn("convex_relaxation", repr(options))
@@ -1,6 +1,7 @@
 import pydrake.geometry as mut
 
 import copy
+import os
 import unittest
 
 import numpy as np
@@ -106,6 +107,9 @@ class TestGeometryVisualizers(unittest.TestCase):
                           rgba=mut.Rgba(.5, .5, .5))
         meshcat.SetTransform(path="/test/box", X_ParentPath=RigidTransform())
         meshcat.SetTransform(path="/test/box", matrix=np.eye(4))
+        meshcat.SetTransforms(paths=["/test/box"],
+                              X_ParentPaths=[RigidTransform()],
+                              tolerance=1e-6, use_float32=True)
         self.assertTrue(meshcat.HasPath("/test/box"))
         cloud = PointCloud(4)
         cloud.mutable_xyzs()[:] = np.zeros((3, 4))
@@ -235,6 +239,11 @@ class TestGeometryVisualizers(unittest.TestCase):
         vis.StopRecording()
         vis.PublishRecording()
         vis.DeleteRecording()
+        filename = os.path.join(os.environ["TEST_TMPDIR"], "vis.drake_rec")
+        vis.StartRecordingToFile(filename=filename,
+                                 set_transforms_while_recording=False)
+        vis.StopRecording()
+        meshcat.PlayRecording(filename=filename)
 
         builder = DiagramBuilder_[T]()
         scene_graph = builder.AddSystem(mut.SceneGraph_[T]())
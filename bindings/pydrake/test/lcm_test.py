@@ -30,6 +30,7 @@ class TestLcm(unittest.TestCase):
         dut.lcm_url = "memq://123"
         dut.channel_suffix = "_foo"
         dut.defer_initialization = True
+        dut.receive_thread = True
         instance = DrakeLcm(params=dut)
         self.assertTrue(instance.get_lcm_url(), "memq://123")
         self.assertIn("lcm_url", repr(dut))
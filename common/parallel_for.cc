@@ -0,0 +1,43 @@
+#include "drake/common/parallel_for.h"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <vector>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace internal {
+
+int CalcNumParallelThreads(int num_threads, int num_indices) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  return std::max(1, std::min(num_threads, num_indices));
+}
+
+void RunOnThreads(int num_threads, const std::function<void(int)>& run) {
+  std::vector<std::future<void>> helpers;
+  for (int k = 1; k < num_threads; ++k) {
+    helpers.push_back(std::async(std::launch::async, run, k));
+  }
+  std::exception_ptr error;
+  try {
+    run(0);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  // Wait for every helper (even if one of them threw) before rethrowing, since
+  // they refer to the caller's data.
+  for (std::future<void>& helper : helpers) {
+    helper.wait();
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+  for (std::future<void>& helper : helpers) {
+    helper.get();
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+/** @file
+Provides helpers that run the iterations of a loop on several threads. */
+
+namespace drake {
+namespace internal {
+
+/* (Internal use only) Returns the number of threads that DynamicParallelFor()
+and StaticParallelFor() use for `num_indices` indices when asked for
+`num_threads`: at most one per index, but always at least one.
+@throws std::exception if num_threads < 1. */
+int CalcNumParallelThreads(int num_threads, int num_indices);
+
+/* (Internal use only) Calls run(thread_num) for each thread_num in
+[0, num_threads), where thread 0 is the calling thread and the others are
+started with std::async. Once every thread has finished, rethrows the exception
+of the lowest-numbered thread that threw, if any. */
+void RunOnThreads(int num_threads, const std::function<void(int)>& run);
+
+/* (Internal use only) Calls `body(thread_num, index)` once for every `index` in
+[0, num_indices), using CalcNumParallelThreads(num_threads, num_indices)
+threads. Each thread repeatedly claims the next unclaimed index, so the indices
+are shared well even when their costs differ, but which thread gets which
+index varies from run to run.
+
+The calling thread is thread 0 and also processes indices; the others are
+numbered 1, 2, and so on, so that `thread_num` can select per-thread scratch
+data. With only one thread, the calls are made on the calling thread in index
+order, and nothing is allocated.
+
+If `body` throws, its thread stops claiming indices (the other threads carry
+on). Once every thread has finished, the exception of the lowest-numbered
+thread that threw is rethrown. */
+template <typename Body>
+void DynamicParallelFor(int num_threads, int num_indices, const Body& body) {
+  num_threads = CalcNumParallelThreads(num_threads, num_indices);
+  if (num_threads == 1) {
+    for (int i = 0; i < num_indices; ++i) {
+      body(0, i);
+    }
+    return;
+  }
+  std::atomic<int> next{0};
+  RunOnThreads(num_threads, [&body, &next, num_indices](int thread_num) {
+    for (int i = next++; i < num_indices; i = next++) {
+      body(thread_num, i);
+    }
+  });
+}
+
+/* (Internal use only) Like DynamicParallelFor(), except that the indices are
+split into runs of consecutive indices, one run per thread, with thread k
+processing the k'th run in index order. Which thread processes an index thus
+depends only on the number of threads and indices, e.g., so that sums of
+per-thread partial results are reproducible. */
+template <typename Body>
+void StaticParallelFor(int num_threads, int num_indices, const Body& body) {
+  num_threads = CalcNumParallelThreads(num_threads, num_indices);
+  if (num_threads == 1) {
+    for (int i = 0; i < num_indices; ++i) {
+      body(0, i);
+    }
+    return;
+  }
+  RunOnThreads(num_threads, [&body, num_threads, num_indices](int thread_num) {
+    // Use 64 bits, so that the products cannot overflow.
+    const int begin = int64_t{thread_num} * num_indices / num_threads;
+    const int end = int64_t{thread_num + 1} * num_indices / num_threads;
+    for (int i = begin; i < end; ++i) {
+      body(thread_num, i);
+    }
+  });
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -1,5 +1,9 @@
 #include "drake/common/symbolic/codegen.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 
@@ -300,5 +304,400 @@ std::string CodeGen(
   return oss.str();
 }
 
+enum class CompiledExpressions::Op : uint8_t {
+  kConstant,    // out = coeff
+  kScale,       // out = coeff * a
+  kAddScaled,   // out = a + coeff * b
+  kMul,         // out = a * b
+  kDiv,         // out = a / b
+  kSquare,      // out = a * a
+  kPow,         // out = pow(a, b)
+  kAbs,
+  kLog,
+  kExp,
+  kSqrt,
+  kSin,
+  kCos,
+  kTan,
+  kAsin,
+  kAcos,
+  kAtan,
+  kAtan2,       // out = atan2(a, b)
+  kSinh,
+  kCosh,
+  kTanh,
+  kMin,         // out = min(a, b)
+  kMax,         // out = max(a, b)
+  kCeil,
+  kFloor,
+  kSelect,      // out = (c != 0) ? a : b
+  // The Boolean ops produce 1.0 for true and 0.0 for false.
+  kEqualTo,     // out = (a == b)
+  kNotEqualTo,  // out = (a != b)
+  kGreater,     // out = (a > b)
+  kGreaterEq,   // out = (a >= b)
+  kLess,        // out = (a < b)
+  kLessEq,      // out = (a <= b)
+  kAnd,         // out = (a != 0) && (b != 0)
+  kOr,          // out = (a != 0) || (b != 0)
+  kNot,         // out = (a == 0)
+  kIsnan,       // out = isnan(a)
+};
+
+// Lowers expressions into the instructions of a CompiledExpressions. Each
+// Visit method emits the instructions for its expression (or formula) and
+// returns the register holding the result.
+class CompiledExpressions::Compiler {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Compiler)
+
+  Compiler(const vector<Variable>& parameters, CompiledExpressions* program)
+      : program_(program) {
+    for (vector<Variable>::size_type i = 0; i < parameters.size(); ++i) {
+      id_to_register_.emplace(parameters[i].get_id(), i);
+    }
+    program_->num_parameters_ = static_cast<int>(parameters.size());
+    program_->num_registers_ = program_->num_parameters_;
+  }
+
+  int Compile(const Expression& e) {
+    if (is_nan(e)) {
+      return EmitConstant(std::numeric_limits<double>::quiet_NaN());
+    }
+    const auto it = cache_.find(e);
+    if (it != cache_.end()) {
+      return it->second;
+    }
+    const int result = VisitExpression<int>(this, e);
+    cache_.emplace(e, result);
+    return result;
+  }
+
+  int VisitVariable(const Expression& e) {
+    const Variable& v{get_variable(e)};
+    const auto it{id_to_register_.find(v.get_id())};
+    if (it == id_to_register_.end()) {
+      throw runtime_error("Variable index is not found.");
+    }
+    return it->second;
+  }
+
+  int VisitConstant(const Expression& e) {
+    return EmitConstant(get_constant_value(e));
+  }
+
+  int VisitAddition(const Expression& e) {
+    const double c{get_constant_in_addition(e)};
+    int result = (c != 0.0) ? EmitConstant(c) : -1;
+    for (const auto& [e_i, c_i] : get_expr_to_coeff_map_in_addition(e)) {
+      const int r_i = Compile(e_i);
+      if (result < 0) {
+        result = (c_i == 1.0) ? r_i : Emit(Op::kScale, r_i, 0, 0, c_i);
+      } else {
+        result = Emit(Op::kAddScaled, result, r_i, 0, c_i);
+      }
+    }
+    return result;
+  }
+
+  int VisitMultiplication(const Expression& e) {
+    const double c{get_constant_in_multiplication(e)};
+    int result = -1;
+    for (const auto& [base, exponent] :
+         get_base_to_exponent_map_in_multiplication(e)) {
+      const int r_i = CompilePow(base, exponent);
+      result = (result < 0) ? r_i : Emit(Op::kMul, result, r_i);
+    }
+    if (c != 1.0) {
+      result = Emit(Op::kScale, result, 0, 0, c);
+    }
+    return result;
+  }
+
+  int VisitPow(const Expression& e) {
+    return CompilePow(get_first_argument(e), get_second_argument(e));
+  }
+
+  int VisitDivision(const Expression& e) { return VisitBinary(Op::kDiv, e); }
+  int VisitAbs(const Expression& e) { return VisitUnary(Op::kAbs, e); }
+  int VisitLog(const Expression& e) { return VisitUnary(Op::kLog, e); }
+  int VisitExp(const Expression& e) { return VisitUnary(Op::kExp, e); }
+  int VisitSqrt(const Expression& e) { return VisitUnary(Op::kSqrt, e); }
+  int VisitSin(const Expression& e) { return VisitUnary(Op::kSin, e); }
+  int VisitCos(const Expression& e) { return VisitUnary(Op::kCos, e); }
+  int VisitTan(const Expression& e) { return VisitUnary(Op::kTan, e); }
+  int VisitAsin(const Expression& e) { return VisitUnary(Op::kAsin, e); }
+  int VisitAcos(const Expression& e) { return VisitUnary(Op::kAcos, e); }
+  int VisitAtan(const Expression& e) { return VisitUnary(Op::kAtan, e); }
+  int VisitAtan2(const Expression& e) { return VisitBinary(Op::kAtan2, e); }
+  int VisitSinh(const Expression& e) { return VisitUnary(Op::kSinh, e); }
+  int VisitCosh(const Expression& e) { return VisitUnary(Op::kCosh, e); }
+  int VisitTanh(const Expression& e) { return VisitUnary(Op::kTanh, e); }
+  int VisitMin(const Expression& e) { return VisitBinary(Op::kMin, e); }
+  int VisitMax(const Expression& e) { return VisitBinary(Op::kMax, e); }
+  int VisitCeil(const Expression& e) { return VisitUnary(Op::kCeil, e); }
+  int VisitFloor(const Expression& e) { return VisitUnary(Op::kFloor, e); }
+
+  int VisitIfThenElse(const Expression& e) {
+    const int condition = VisitFormula<int>(this, get_conditional_formula(e));
+    const int then_result = Compile(get_then_expression(e));
+    const int else_result = Compile(get_else_expression(e));
+    return Emit(Op::kSelect, then_result, else_result, condition);
+  }
+
+  int VisitUninterpretedFunction(const Expression&) {
+    throw runtime_error(
+        "CompiledExpressions does not support uninterpreted functions.");
+  }
+
+  int VisitFalse(const Formula&) { return EmitConstant(0.0); }
+  int VisitTrue(const Formula&) { return EmitConstant(1.0); }
+  int VisitVariable(const Formula&) {
+    throw runtime_error(
+        "CompiledExpressions does not support Boolean variables.");
+  }
+  int VisitEqualTo(const Formula& f) {
+    return VisitRelational(Op::kEqualTo, f);
+  }
+  int VisitNotEqualTo(const Formula& f) {
+    return VisitRelational(Op::kNotEqualTo, f);
+  }
+  int VisitGreaterThan(const Formula& f) {
+    return VisitRelational(Op::kGreater, f);
+  }
+  int VisitGreaterThanOrEqualTo(const Formula& f) {
+    return VisitRelational(Op::kGreaterEq, f);
+  }
+  int VisitLessThan(const Formula& f) {
+    return VisitRelational(Op::kLess, f);
+  }
+  int VisitLessThanOrEqualTo(const Formula& f) {
+    return VisitRelational(Op::kLessEq, f);
+  }
+  int VisitConjunction(const Formula& f) {
+    return VisitNary(Op::kAnd, f);
+  }
+  int VisitDisjunction(const Formula& f) {
+    return VisitNary(Op::kOr, f);
+  }
+  int VisitNegation(const Formula& f) {
+    return Emit(Op::kNot, VisitFormula<int>(this, get_operand(f)));
+  }
+  int VisitForall(const Formula&) {
+    throw runtime_error(
+        "CompiledExpressions does not support universal quantifiers.");
+  }
+  int VisitIsnan(const Formula& f) {
+    return Emit(Op::kIsnan, Compile(get_unary_expression(f)));
+  }
+  int VisitPositiveSemidefinite(const Formula&) {
+    throw runtime_error(
+        "CompiledExpressions does not support positive-semidefinite "
+        "formulas.");
+  }
+
+ private:
+  int Emit(Op op, int a = 0, int b = 0, int c = 0, double coeff = 0.0) {
+    const int out = program_->num_registers_++;
+    program_->instructions_.push_back(Instruction{op, out, a, b, c, coeff});
+    return out;
+  }
+
+  int EmitConstant(double value) {
+    return Emit(Op::kConstant, 0, 0, 0, value);
+  }
+
+  int CompilePow(const Expression& base, const Expression& exponent) {
+    if (is_one(exponent)) {
+      return Compile(base);
+    }
+    if (is_constant(exponent, 2.0)) {
+      return Emit(Op::kSquare, Compile(base));
+    }
+    return Emit(Op::kPow, Compile(base), Compile(exponent));
+  }
+
+  int VisitUnary(Op op, const Expression& e) {
+    return Emit(op, Compile(get_argument(e)));
+  }
+
+  int VisitBinary(Op op, const Expression& e) {
+    return Emit(op, Compile(get_first_argument(e)),
+                Compile(get_second_argument(e)));
+  }
+
+  int VisitRelational(Op op, const Formula& f) {
+    return Emit(op, Compile(get_lhs_expression(f)),
+                Compile(get_rhs_expression(f)));
+  }
+
+  int VisitNary(Op op, const Formula& f) {
+    int result = -1;
+    for (const Formula& operand : get_operands(f)) {
+      const int r_i = VisitFormula<int>(this, operand);
+      result = (result < 0) ? r_i : Emit(op, result, r_i);
+    }
+    return result;
+  }
+
+  CompiledExpressions* const program_;
+  std::unordered_map<Variable::Id, int> id_to_register_;
+  // Maps each compiled subexpression to the register holding its value.
+  std::unordered_map<Expression, int> cache_;
+};
+
+CompiledExpressions::CompiledExpressions(
+    const vector<Variable>& parameters,
+    const Eigen::Ref<const VectorX<Expression>>& expressions) {
+  Compiler compiler(parameters, this);
+  outputs_.reserve(expressions.size());
+  output_num_instructions_.reserve(expressions.size());
+  for (int i = 0; i < expressions.size(); ++i) {
+    outputs_.push_back(compiler.Compile(expressions(i)));
+    output_num_instructions_.push_back(num_instructions());
+  }
+}
+
+void CompiledExpressions::Evaluate(const Eigen::Ref<const Eigen::VectorXd>& p,
+                                   EigenPtr<Eigen::VectorXd> y) const {
+  DRAKE_THROW_UNLESS(p.size() == num_parameters_);
+  DRAKE_THROW_UNLESS(y != nullptr && y->size() <= num_outputs());
+  const int num_y = y->size();
+  if (num_y == 0) {
+    return;
+  }
+  // Small programs use registers on the stack, so that an evaluation does not
+  // allocate.
+  constexpr int kNumStackRegisters = 256;
+  std::array<double, kNumStackRegisters> stack_registers;
+  std::vector<double> heap_registers;
+  double* r = stack_registers.data();
+  if (num_registers_ > kNumStackRegisters) {
+    heap_registers.resize(num_registers_);
+    r = heap_registers.data();
+  }
+  for (int i = 0; i < num_parameters_; ++i) {
+    r[i] = p[i];
+  }
+  const int num_instructions = output_num_instructions_[num_y - 1];
+  for (int k = 0; k < num_instructions; ++k) {
+    const Instruction& inst = instructions_[k];
+    double& out = r[inst.out];
+    switch (inst.op) {
+      case Op::kConstant:
+        out = inst.coeff;
+        break;
+      case Op::kScale:
+        out = inst.coeff * r[inst.a];
+        break;
+      case Op::kAddScaled:
+        out = r[inst.a] + inst.coeff * r[inst.b];
+        break;
+      case Op::kMul:
+        out = r[inst.a] * r[inst.b];
+        break;
+      case Op::kDiv:
+        out = r[inst.a] / r[inst.b];
+        break;
+      case Op::kSquare:
+        out = r[inst.a] * r[inst.a];
+        break;
+      case Op::kPow:
+        out = std::pow(r[inst.a], r[inst.b]);
+        break;
+      case Op::kAbs:
+        out = std::abs(r[inst.a]);
+        break;
+      case Op::kLog:
+        out = std::log(r[inst.a]);
+        break;
+      case Op::kExp:
+        out = std::exp(r[inst.a]);
+        break;
+      case Op::kSqrt:
+        out = std::sqrt(r[inst.a]);
+        break;
+      case Op::kSin:
+        out = std::sin(r[inst.a]);
+        break;
+      case Op::kCos:
+        out = std::cos(r[inst.a]);
+        break;
+      case Op::kTan:
+        out = std::tan(r[inst.a]);
+        break;
+      case Op::kAsin:
+        out = std::asin(r[inst.a]);
+        break;
+      case Op::kAcos:
+        out = std::acos(r[inst.a]);
+        break;
+      case Op::kAtan:
+        out = std::atan(r[inst.a]);
+        break;
+      case Op::kAtan2:
+        out = std::atan2(r[inst.a], r[inst.b]);
+        break;
+      case Op::kSinh:
+        out = std::sinh(r[inst.a]);
+        break;
+      case Op::kCosh:
+        out = std::cosh(r[inst.a]);
+        break;
+      case Op::kTanh:
+        out = std::tanh(r[inst.a]);
+        break;
+      case Op::kMin:
+        out = std::min(r[inst.a], r[inst.b]);
+        break;
+      case Op::kMax:
+        out = std::max(r[inst.a], r[inst.b]);
+        break;
+      case Op::kCeil:
+        out = std::ceil(r[inst.a]);
+        break;
+      case Op::kFloor:
+        out = std::floor(r[inst.a]);
+        break;
+      case Op::kSelect:
+        out = (r[inst.c] != 0.0) ? r[inst.a] : r[inst.b];
+        break;
+      case Op::kEqualTo:
+        out = (r[inst.a] == r[inst.b]);
+        break;
+      case Op::kNotEqualTo:
+        out = (r[inst.a] != r[inst.b]);
+        break;
+      case Op::kGreater:
+        out = (r[inst.a] > r[inst.b]);
+        break;
+      case Op::kGreaterEq:
+        out = (r[inst.a] >= r[inst.b]);
+        break;
+      case Op::kLess:
+        out = (r[inst.a] < r[inst.b]);
+        break;
+      case Op::kLessEq:
+        out = (r[inst.a] <= r[inst.b]);
+        break;
+      case Op::kAnd:
+        out = (r[inst.a] != 0.0) && (r[inst.b] != 0.0);
+        break;
+      case Op::kOr:
+        out = (r[inst.a] != 0.0) || (r[inst.b] != 0.0);
+        break;
+      case Op::kNot:
+        out = (r[inst.a] == 0.0);
+        break;
+      case Op::kIsnan:
+        out = std::isnan(r[inst.a]);
+        break;
+    }
+  }
+  for (int i = 0; i < num_y; ++i) {
+    (*y)[i] = r[outputs_[i]];
+  }
+}
+
 }  // namespace symbolic
 }  // namespace drake
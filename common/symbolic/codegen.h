@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -9,6 +10,7 @@
 #include <Eigen/Sparse>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
 #include "drake/common/symbolic/expression.h"
 
 namespace drake {
@@ -332,5 +334,81 @@ std::string CodeGen(
         M);
 /// @} End of codegen group.
 
+/// A vector of symbolic expressions compiled into a flat, register-based
+/// straight-line program, which evaluates the expressions for given values of
+/// their parameters without walking the expression trees. This is an in-process
+/// alternative to CodeGen for repeated numerical evaluation (e.g., inside an
+/// optimization solver) that does not require a C compiler.
+///
+/// The program is built by a visitor in the same manner as CodeGenVisitor.
+/// Structurally-equal subexpressions (within one expression or across the
+/// vector) are evaluated only once.
+///
+/// Unlike Expression::Evaluate, evaluation follows IEEE floating-point
+/// semantics: division by zero or a NaN result does not throw. Both branches
+/// of an if-then-else expression are evaluated, and the result of the branch
+/// selected by the condition is used.
+class CompiledExpressions {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CompiledExpressions)
+
+  /// Compiles @p expressions. The vector of variables @p parameters provides
+  /// the ordering of the symbolic variables, in the same manner as CodeGen.
+  ///
+  /// @throws std::exception if @p expressions include a variable which is not
+  /// in @p parameters, an uninterpreted function, or an if-then-else
+  /// expression whose condition includes a Boolean variable, a universal
+  /// quantifier, or a positive-semidefinite formula.
+  CompiledExpressions(const std::vector<Variable>& parameters,
+                      const Eigen::Ref<const VectorX<Expression>>& expressions);
+
+  /// Returns the number of parameters.
+  int num_parameters() const { return num_parameters_; }
+
+  /// Returns the number of compiled expressions.
+  int num_outputs() const { return static_cast<int>(outputs_.size()); }
+
+  /// Returns the number of instructions of the compiled program.
+  int num_instructions() const {
+    return static_cast<int>(instructions_.size());
+  }
+
+  /// Evaluates the first `y->size()` compiled expressions using the values of
+  /// the parameters @p p, and writes the results to @p y. Only the instructions
+  /// which those expressions need are run, so that, e.g., the values of some
+  /// functions can be evaluated without their derivatives when both were
+  /// compiled together, with the values first.
+  /// @pre `p.size() == num_parameters()` and `y->size() <= num_outputs()`.
+  void Evaluate(const Eigen::Ref<const Eigen::VectorXd>& p,
+                EigenPtr<Eigen::VectorXd> y) const;
+
+ private:
+  // The visitor which lowers the expressions into instructions.
+  class Compiler;
+
+  enum class Op : uint8_t;
+
+  // Computes `registers[out] = op(registers[a], registers[b], registers[c])`,
+  // where `coeff` is an additional constant operand for some ops.
+  struct Instruction {
+    Op op{};
+    int out{};
+    int a{};
+    int b{};
+    int c{};
+    double coeff{};
+  };
+
+  // The registers are laid out as the parameters, followed by the results of
+  // the instructions.
+  int num_parameters_{};
+  int num_registers_{};
+  std::vector<Instruction> instructions_;
+  // The register holding the value of each expression.
+  std::vector<int> outputs_;
+  // The number of leading instructions that compute expressions [0, i].
+  std::vector<int> output_num_instructions_;
+};
+
 }  // namespace symbolic
 }  // namespace drake
@@ -1,9 +1,12 @@
 #include "drake/common/symbolic/decompose.h"
 
+#include <algorithm>
 #include <map>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fmt/ostream.h>
@@ -271,6 +274,14 @@ void DecomposeQuadraticPolynomial(
 void DecomposeAffineExpressions(const Eigen::Ref<const VectorX<Expression>>& v,
                                 Eigen::MatrixXd* A, Eigen::VectorXd* b,
                                 VectorX<Variable>* vars) {
+  Eigen::SparseMatrix<double> A_sparse;
+  if (DecomposeAffineExpressions(v, &A_sparse, b, vars)) {
+    *A = A_sparse;
+    return;
+  }
+  // Some element of v is not affine. The code below throws an error which
+  // reports it.
+
   // 0. Setup map_var_to_index and var_vec.
   std::unordered_map<Variable::Id, int> map_var_to_index;
   std::tie(*vars, map_var_to_index) = ExtractVariablesFromExpression(v);
@@ -287,6 +298,123 @@ void DecomposeAffineExpressions(const Eigen::Ref<const VectorX<Expression>>& v,
   }
 }
 
+namespace {
+// Adds the terms of `scale * e` to `terms` (as pairs of a variable and its
+// coefficient, possibly repeated) and to `constant`, if `e` is written as a
+// (nested) sum of constant multiples of variables. Otherwise returns false,
+// although `e` might still be affine after expansion.
+bool AddAffineTerms(const Expression& e, double scale,
+                    std::vector<std::pair<Variable, double>>* terms,
+                    double* constant) {
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+      *constant += scale * get_constant_value(e);
+      return true;
+    case ExpressionKind::Var:
+      terms->emplace_back(get_variable(e), scale);
+      return true;
+    case ExpressionKind::Add:
+      *constant += scale * get_constant_in_addition(e);
+      for (const auto& [e_i, c_i] : get_expr_to_coeff_map_in_addition(e)) {
+        if (!AddAffineTerms(e_i, scale * c_i, terms, constant)) {
+          return false;
+        }
+      }
+      return true;
+    case ExpressionKind::Mul: {
+      const auto& base_to_exponent_map =
+          get_base_to_exponent_map_in_multiplication(e);
+      if (base_to_exponent_map.size() != 1 ||
+          !is_one(base_to_exponent_map.begin()->second)) {
+        return false;
+      }
+      return AddAffineTerms(base_to_exponent_map.begin()->first,
+                            scale * get_constant_in_multiplication(e), terms,
+                            constant);
+    }
+    default:
+      return false;
+  }
+}
+
+// Adds the terms of `e` to `terms` and `constant` using symbolic::Polynomial.
+// Returns false if `e` is not affine.
+bool AddAffinePolynomialTerms(const Expression& e,
+                              std::vector<std::pair<Variable, double>>* terms,
+                              double* constant) {
+  if (!e.is_polynomial()) {
+    return false;
+  }
+  const Polynomial p{e};
+  if (p.TotalDegree() > 1) {
+    return false;
+  }
+  for (const auto& [monomial, coeff] : p.monomial_to_coefficient_map()) {
+    if (monomial.total_degree() == 0) {
+      *constant += get_constant_value(coeff);
+    } else {
+      terms->emplace_back(monomial.get_powers().begin()->first,
+                          get_constant_value(coeff));
+    }
+  }
+  // The variables which cancel out in the expansion are still reported, as in
+  // ExtractVariablesFromExpression.
+  for (const Variable& var : e.GetVariables()) {
+    terms->emplace_back(var, 0.0);
+  }
+  return true;
+}
+}  // namespace
+
+bool DecomposeAffineExpressions(
+    const Eigen::Ref<const VectorX<Expression>>& v,
+    Eigen::SparseMatrix<double>* A, Eigen::VectorXd* b,
+    VectorX<Variable>* vars) {
+  DRAKE_DEMAND(A != nullptr && b != nullptr && vars != nullptr);
+  std::vector<Variable> var_vec;
+  std::unordered_map<Variable::Id, int> map_var_to_index;
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve(v.size());
+  std::vector<std::pair<Variable, double>> terms;
+  b->resize(v.size());
+  for (int i = 0; i < v.size(); ++i) {
+    terms.clear();
+    double constant = 0;
+    if (!AddAffineTerms(v(i), 1.0, &terms, &constant)) {
+      terms.clear();
+      constant = 0;
+      if (!AddAffinePolynomialTerms(v(i), &terms, &constant)) {
+        return false;
+      }
+    }
+    (*b)(i) = constant;
+    // Sorting by ID merges the repeated variables, and appends the new
+    // variables in the same order as ExtractVariablesFromExpression.
+    std::sort(terms.begin(), terms.end(), [](const auto& t1, const auto& t2) {
+      return t1.first.get_id() < t2.first.get_id();
+    });
+    for (size_t k = 0; k < terms.size();) {
+      const Variable& var = terms[k].first;
+      double coeff = 0;
+      for (; k < terms.size() && terms[k].first.get_id() == var.get_id(); ++k) {
+        coeff += terms[k].second;
+      }
+      const auto [it, is_new] =
+          map_var_to_index.emplace(var.get_id(), var_vec.size());
+      if (is_new) {
+        var_vec.push_back(var);
+      }
+      if (coeff != 0) {
+        triplets.emplace_back(i, it->second, coeff);
+      }
+    }
+  }
+  *vars = Eigen::Map<VectorX<Variable>>(var_vec.data(), var_vec.size());
+  A->resize(v.size(), var_vec.size());
+  A->setFromTriplets(triplets.begin(), triplets.end());
+  return true;
+}
+
 int DecomposeAffineExpression(
     const symbolic::Expression& e,
     const std::unordered_map<symbolic::Variable::Id, int>& map_var_to_index,
@@ -5,6 +5,8 @@
 #include <unordered_map>
 #include <utility>
 
+#include <Eigen/SparseCore>
+
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic/expression.h"
@@ -104,6 +106,25 @@ void DecomposeAffineExpressions(
     const Eigen::Ref<const VectorX<symbolic::Expression>>& v,
     Eigen::MatrixXd* A, Eigen::VectorXd* b, VectorX<Variable>* vars);
 
+/** Given a vector of expressions v, decomposes it to \f$ v = A vars + b \f$
+with a sparse A, if every element of v is affine. This is intended for large
+vectors of expressions: the elements which are written as (nested) sums of
+constant multiples of variables are decomposed by walking their structure,
+without constructing a symbolic::Polynomial or a dense row of A for each of
+them. The remaining elements fall back to symbolic::Polynomial.
+
+@param[in] v A vector of expressions.
+@param[out] A The sparse matrix containing the linear coefficients.
+@param[out] b The vector containing all the constant terms.
+@param[out] vars All variables, in the same order as
+ExtractVariablesFromExpression(v).
+@returns true if every element of @p v is affine. Otherwise, returns false and
+the values of @p A, @p b, and @p vars are unspecified. */
+[[nodiscard]] bool DecomposeAffineExpressions(
+    const Eigen::Ref<const VectorX<symbolic::Expression>>& v,
+    Eigen::SparseMatrix<double>* A, Eigen::VectorXd* b,
+    VectorX<Variable>* vars);
+
 /** Decomposes an affine combination @p e = c0 + c1 * v1 + ... cn * vn into the
 following:
 
@@ -1,5 +1,6 @@
 #include "drake/common/symbolic/codegen.h"
 
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -414,6 +415,98 @@ TEST_F(SymbolicCodeGenTest, SparseMatrixColMajorExampleUsingEigenMap) {
   EXPECT_EQ(m_double.coeff(2, 5), 2.0 /* y */);
 }
 
+// Checks that the compiled expressions evaluate to the same values as
+// Expression::Evaluate.
+TEST_F(SymbolicCodeGenTest, CompiledExpressionsEvaluate) {
+  const vector<Variable> parameters{x_, y_, z_, w_};
+  VectorX<Expression> e(12);
+  // clang-format off
+  e << 3.0,
+       x_,
+       2.0 + 3.0 * x_ - y_ + 0.5 * z_,
+       -2.0 * x_ * pow(y_, 2) * pow(z_, w_),
+       x_ / y_ + pow(x_ + y_, 3.5),
+       abs(x_) + log(y_) + exp(z_) + sqrt(w_),
+       sin(x_) + cos(y_) + tan(z_) + asin(0.3 * w_) + acos(0.2 * x_),
+       atan(x_) + atan2(y_, z_) + sinh(w_) + cosh(x_) + tanh(y_),
+       min(x_, y_) + max(z_, w_) + ceil(x_) + floor(z_),
+       if_then_else(x_ > y_ && z_ <= w_, x_, y_),
+       if_then_else(x_ == y_ || !(z_ != w_) || x_ < y_, z_, w_),
+       if_then_else(x_ >= 0.0, sin(x_), cos(x_));
+  // clang-format on
+  const CompiledExpressions compiled(parameters, e);
+  EXPECT_EQ(compiled.num_parameters(), 4);
+  EXPECT_EQ(compiled.num_outputs(), 12);
+
+  for (const Eigen::Vector4d& p : {Eigen::Vector4d(1.5, 2.0, 3.2, 0.7),
+                                   Eigen::Vector4d(-0.5, 1.0, 2.0, 2.0),
+                                   Eigen::Vector4d(2.0, 2.0, 0.1, 0.5)}) {
+    Environment env;
+    for (int i = 0; i < 4; ++i) {
+      env.insert(parameters[i], p[i]);
+    }
+    Eigen::VectorXd y(12);
+    compiled.Evaluate(p, &y);
+    for (int i = 0; i < e.size(); ++i) {
+      EXPECT_NEAR(y[i], e[i].Evaluate(env), 1e-14) << e[i];
+    }
+  }
+}
+
+// Checks that common subexpressions are evaluated only once.
+TEST_F(SymbolicCodeGenTest, CompiledExpressionsCommonSubexpressions) {
+  const Expression s = sin(x_ * y_);
+  const Vector2<Expression> e(s + cos(s), 2.0 * s);
+  const CompiledExpressions compiled({x_, y_}, e);
+  // x * y, sin, cos, add, and scale.
+  EXPECT_EQ(compiled.num_instructions(), 5);
+  Eigen::VectorXd y(2);
+  compiled.Evaluate(Eigen::Vector2d(0.3, 2.0), &y);
+  EXPECT_NEAR(y[0], std::sin(0.6) + std::cos(std::sin(0.6)), 1e-15);
+  EXPECT_NEAR(y[1], 2.0 * std::sin(0.6), 1e-15);
+}
+
+// Checks that the leading expressions can be evaluated on their own.
+TEST_F(SymbolicCodeGenTest, CompiledExpressionsHead) {
+  const Vector3<Expression> e(x_ * y_, sin(x_ * y_), cos(x_));
+  const CompiledExpressions compiled({x_, y_}, e);
+  Eigen::VectorXd y(2);
+  compiled.Evaluate(Eigen::Vector2d(0.3, 2.0), &y);
+  EXPECT_EQ(y[0], 0.6);
+  EXPECT_NEAR(y[1], std::sin(0.6), 1e-15);
+  Eigen::VectorXd none(0);
+  EXPECT_NO_THROW(compiled.Evaluate(Eigen::Vector2d(0.3, 2.0), &none));
+}
+
+// Unlike Expression::Evaluate, the compiled expressions follow IEEE semantics,
+// e.g., for the (NaN) derivative of abs at zero.
+TEST_F(SymbolicCodeGenTest, CompiledExpressionsNaN) {
+  const Vector2<Expression> e(abs(x_).Differentiate(x_), 1.0 / x_);
+  const CompiledExpressions compiled({x_}, e);
+  Eigen::VectorXd y(2);
+  compiled.Evaluate(Eigen::VectorXd::Constant(1, -2.0), &y);
+  EXPECT_EQ(y[0], -1.0);
+  EXPECT_EQ(y[1], -0.5);
+  compiled.Evaluate(Eigen::VectorXd::Zero(1), &y);
+  EXPECT_TRUE(std::isnan(y[0]));
+  EXPECT_TRUE(std::isinf(y[1]));
+}
+
+TEST_F(SymbolicCodeGenTest, CompiledExpressionsErrors) {
+  EXPECT_THROW(CompiledExpressions({x_}, Vector1<Expression>(x_ + y_)),
+               std::runtime_error);
+  const Expression f = uninterpreted_function("f", {x_});
+  EXPECT_THROW(CompiledExpressions({x_}, Vector1<Expression>(f)),
+               std::runtime_error);
+
+  const CompiledExpressions compiled({x_, y_}, Vector1<Expression>(x_ * y_));
+  Eigen::VectorXd y(1);
+  EXPECT_THROW(compiled.Evaluate(Eigen::Vector3d::Zero(), &y), std::exception);
+  Eigen::VectorXd too_many(2);
+  EXPECT_THROW(compiled.Evaluate(Eigen::Vector2d::Zero(), &too_many),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
@@ -393,6 +393,46 @@ GTEST_TEST(SymbolicExtraction, DecomposeAffineExpression) {
   }
 }
 
+GTEST_TEST(SymbolicExtraction, DecomposeAffineExpressionsSparse) {
+  const Variable x("x");
+  const Variable y("y");
+  const Variable z("z");
+  const Variable w("w");
+
+  Vector4<Expression> v;
+  // clang-format off
+  v << 2 * x + 3 * (y - 2 * z) + 1,
+       -z,
+       4.0,
+       // This is affine only after the expansion.
+       x * (y + 1) - x * y + w;
+  // clang-format on
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd b;
+  VectorX<Variable> vars;
+  ASSERT_TRUE(DecomposeAffineExpressions(v, &A, &b, &vars));
+  // The variables are ordered as in ExtractVariablesFromExpression.
+  EXPECT_EQ(vars, ExtractVariablesFromExpression(v).first);
+  ASSERT_EQ(vars.size(), 4);
+
+  // Checks the decomposition against the dense overload.
+  Eigen::MatrixXd A_expected;
+  Eigen::VectorXd b_expected;
+  VectorX<Variable> vars_expected;
+  DecomposeAffineExpressions(v, &A_expected, &b_expected, &vars_expected);
+  EXPECT_EQ(vars, vars_expected);
+  EXPECT_TRUE(CompareMatrices(Eigen::MatrixXd(A), A_expected));
+  EXPECT_TRUE(CompareMatrices(b, b_expected));
+  EXPECT_TRUE(CompareMatrices(b, Eigen::Vector4d(1, 0, 4, 0)));
+  EXPECT_EQ(A.nonZeros(), 6);
+
+  // Non-affine expressions.
+  EXPECT_FALSE(DecomposeAffineExpressions(Vector2<Expression>(x, x * y), &A,
+                                          &b, &vars));
+  EXPECT_FALSE(DecomposeAffineExpressions(Vector1<Expression>(sin(x)), &A, &b,
+                                          &vars));
+}
+
 GTEST_TEST(SymbolicExtraction, DecomposeLumpedParameters) {
   const Variable x("x");
   const Variable y("y");
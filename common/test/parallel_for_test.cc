@@ -0,0 +1,127 @@
+#include "drake/common/parallel_for.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+GTEST_TEST(ParallelForTest, CalcNumParallelThreads) {
+  EXPECT_EQ(CalcNumParallelThreads(1, 10), 1);
+  EXPECT_EQ(CalcNumParallelThreads(4, 10), 4);
+  EXPECT_EQ(CalcNumParallelThreads(4, 3), 3);
+  EXPECT_EQ(CalcNumParallelThreads(4, 0), 1);
+  EXPECT_THROW(CalcNumParallelThreads(0, 10), std::exception);
+}
+
+// Every index is visited exactly once, by a thread whose number is in range.
+GTEST_TEST(ParallelForTest, VisitsEachIndexOnce) {
+  for (const int num_threads : {1, 2, 3, 8}) {
+    for (const int num_indices : {0, 1, 2, 7, 100}) {
+      SCOPED_TRACE(fmt::format("{} threads, {} indices", num_threads,
+                               num_indices));
+      const int expected_threads =
+          CalcNumParallelThreads(num_threads, num_indices);
+      std::vector<std::atomic<int>> dynamic_visits(num_indices);
+      std::vector<std::atomic<int>> static_visits(num_indices);
+      DynamicParallelFor(num_threads, num_indices, [&](int thread_num, int i) {
+        EXPECT_GE(thread_num, 0);
+        EXPECT_LT(thread_num, expected_threads);
+        ++dynamic_visits[i];
+      });
+      StaticParallelFor(num_threads, num_indices, [&](int thread_num, int i) {
+        EXPECT_GE(thread_num, 0);
+        EXPECT_LT(thread_num, expected_threads);
+        ++static_visits[i];
+      });
+      for (int i = 0; i < num_indices; ++i) {
+        EXPECT_EQ(dynamic_visits[i], 1);
+        EXPECT_EQ(static_visits[i], 1);
+      }
+    }
+  }
+}
+
+// With one thread, the indices are processed in order on the calling thread,
+// without allocating.
+GTEST_TEST(ParallelForTest, Serial) {
+  const std::thread::id caller = std::this_thread::get_id();
+  std::vector<int> order;
+  order.reserve(5);
+  {
+    test::LimitMalloc guard;
+    DynamicParallelFor(1, 5, [&](int thread_num, int i) {
+      EXPECT_EQ(thread_num, 0);
+      EXPECT_EQ(std::this_thread::get_id(), caller);
+      order.push_back(i);
+    });
+  }
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+// The caller does some of the work, as thread 0.
+GTEST_TEST(ParallelForTest, CallerIsThreadZero) {
+  const std::thread::id caller = std::this_thread::get_id();
+  std::atomic<int> num_on_caller{0};
+  StaticParallelFor(2, 10, [&](int thread_num, int) {
+    EXPECT_EQ(thread_num == 0, std::this_thread::get_id() == caller);
+    if (thread_num == 0) {
+      ++num_on_caller;
+    }
+  });
+  EXPECT_EQ(num_on_caller, 5);
+}
+
+// The static partition gives each thread a contiguous run of indices.
+GTEST_TEST(ParallelForTest, StaticPartition) {
+  std::vector<int> owner(10, -1);
+  StaticParallelFor(3, 10, [&](int thread_num, int i) {
+    owner[i] = thread_num;
+  });
+  EXPECT_EQ(owner, std::vector<int>({0, 0, 0, 1, 1, 1, 2, 2, 2, 2}));
+}
+
+// An exception from any thread reaches the caller, but only after all of the
+// other threads have finished.
+GTEST_TEST(ParallelForTest, Exception) {
+  for (const int throwing_index : {0, 9}) {
+    std::atomic<int> num_done{0};
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        StaticParallelFor(2, 10,
+                          [&](int, int i) {
+                            if (i == throwing_index) {
+                              throw std::runtime_error("index failed");
+                            }
+                            ++num_done;
+                          }),
+        "index failed");
+    // Whichever thread threw stopped at that index, but the other thread
+    // processed all of its indices.
+    EXPECT_EQ(num_done, throwing_index == 0 ? 5 : 9);
+  }
+
+  // With the dynamic schedule, the other threads pick up the remaining indices.
+  std::atomic<int> num_done{0};
+  auto body = [&](int, int i) {
+    if (i == 50) {
+      throw std::runtime_error("index failed");
+    }
+    ++num_done;
+  };
+  DRAKE_EXPECT_THROWS_MESSAGE(DynamicParallelFor(3, 100, body),
+                              "index failed");
+  EXPECT_EQ(num_done, 99);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
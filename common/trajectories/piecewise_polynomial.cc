@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include <Eigen/SparseCore>
@@ -10,6 +11,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/unused.h"
 
 using std::runtime_error;
 using std::vector;
@@ -36,6 +38,7 @@ PiecewisePolynomial<T>::PiecewisePolynomial(
           "The polynomial matrix for each segment must have the same number of "
           "columns.");
   }
+  UpdateCoefficients();
 }
 
 template <typename T>
@@ -50,6 +53,7 @@ PiecewisePolynomial<T>::PiecewisePolynomial(
     matrix(0, 0) = polynomials[i];
     polynomials_.push_back(matrix);
   }
+  UpdateCoefficients();
 }
 
 template <typename T>
@@ -73,6 +77,7 @@ PiecewisePolynomial<T>::derivative(int derivative_order) const {
       }
     }
   }
+  ret.UpdateCoefficients();
   return ret;
 }
 
@@ -105,21 +110,59 @@ PiecewisePolynomial<T> PiecewisePolynomial<T>::integral(
       }
     }
   }
+  ret.UpdateCoefficients();
   return ret;
 }
 
 template <typename T>
 T PiecewisePolynomial<T>::scalarValue(const T& t, Eigen::Index row,
                                       Eigen::Index col) const {
-  int segment_index = this->get_segment_index(t);
+  int segment_index = GetSegmentIndexWithHint(t);
+  if constexpr (std::is_same_v<T, double>) {
+    if (has_coefficients()) {
+      DRAKE_ASSERT(row >= 0 && row < rows() && col >= 0 && col < cols());
+      T result;
+      EvalCoefficients(segment_index, t - this->breaks()[segment_index], 0,
+                       &result, row + col * rows());
+      return result;
+    }
+  }
   return EvaluateSegmentAbsoluteTime(segment_index, t, row, col);
 }
 
+template <typename T>
+MatrixX<T> PiecewisePolynomial<T>::value(const std::vector<T>& t) const {
+  const int num_times = static_cast<int>(t.size());
+  const Eigen::Index num_cols = cols();
+  MatrixX<T> values(rows(), num_cols * num_times);
+  for (int i = 0; i < num_times; ++i) {
+    if constexpr (std::is_same_v<T, double>) {
+      if (has_coefficients()) {
+        const int segment_index = GetSegmentIndexWithHint(t[i]);
+        const T time = min(max(t[i], this->start_time()), this->end_time());
+        EvalCoefficients(segment_index, time - this->breaks()[segment_index],
+                         0, values.data() + i * num_cols * values.rows());
+        continue;
+      }
+    }
+    values.middleCols(i * num_cols, num_cols) = value(t[i]);
+  }
+  return values;
+}
+
 template <typename T>
 MatrixX<T> PiecewisePolynomial<T>::DoEvalDerivative(
     const T& t, int derivative_order) const {
-  const int segment_index = this->get_segment_index(t);
+  const int segment_index = GetSegmentIndexWithHint(t);
   const T time = min(max(t, this->start_time()), this->end_time());
+  if constexpr (std::is_same_v<T, double>) {
+    if (has_coefficients()) {
+      MatrixX<T> ret(rows(), cols());
+      EvalCoefficients(segment_index, time - this->breaks()[segment_index],
+                       derivative_order, ret.data());
+      return ret;
+    }
+  }
   Eigen::Matrix<T, PolynomialMatrix::RowsAtCompileTime,
                 PolynomialMatrix::ColsAtCompileTime>
       ret(rows(), cols());
@@ -161,6 +204,7 @@ operator+=(const PiecewisePolynomial<T>& other) {
         "Addition not yet implemented when segment times are not equal");
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] += other.polynomials_[i];
+  UpdateCoefficients();
   return *this;
 }
 
@@ -172,6 +216,7 @@ operator-=(const PiecewisePolynomial<T>& other) {
         "Subtraction not yet implemented when segment times are not equal");
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] -= other.polynomials_[i];
+  UpdateCoefficients();
   return *this;
 }
 
@@ -184,6 +229,7 @@ PiecewisePolynomial<T>& PiecewisePolynomial<T>::operator*=(
   for (size_t i = 0; i < polynomials_.size(); i++) {
     polynomials_[i] *= other.polynomials_[i];
   }
+  UpdateCoefficients();
   return *this;
 }
 
@@ -192,6 +238,7 @@ PiecewisePolynomial<T>& PiecewisePolynomial<T>::operator+=(
     const MatrixX<T>& offset) {
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] += offset.template cast<Polynomial<T>>();
+  UpdateCoefficients();
   return *this;
 }
 
@@ -200,6 +247,7 @@ PiecewisePolynomial<T>& PiecewisePolynomial<T>::operator-=(
     const MatrixX<T>& offset) {
   for (size_t i = 0; i < polynomials_.size(); i++)
     polynomials_[i] -= offset.template cast<Polynomial<T>>();
+  UpdateCoefficients();
   return *this;
 }
 
@@ -225,6 +273,7 @@ const PiecewisePolynomial<T> PiecewisePolynomial<T>::operator-() const {
   for (size_t i = 0; i < polynomials_.size(); i++) {
     ret.polynomials_[i] = -polynomials_[i];
   }
+  ret.UpdateCoefficients();
   return ret;
 }
 
@@ -301,10 +350,15 @@ void PiecewisePolynomial<T>::ConcatenateInTime(
     polynomials_.insert(polynomials_.end(),
                         other.polynomials_.begin(),
                         other.polynomials_.end());
+    for (const PolynomialMatrix& matrix : other.polynomials_) {
+      AppendCoefficients(matrix);
+    }
   } else {
     std::vector<T>& breaks = this->get_mutable_breaks();
     breaks = other.breaks();
     polynomials_ = other.polynomials_;
+    coefficients_ = other.coefficients_;
+    coefficient_start_ = other.coefficient_start_;
   }
 }
 
@@ -337,6 +391,7 @@ void PiecewisePolynomial<T>::AppendCubicHermiteSegment(
     }
   }
   polynomials_.push_back(std::move(matrix));
+  AppendCoefficients(polynomials_.back());
   this->get_mutable_breaks().push_back(time);
 }
 
@@ -362,12 +417,17 @@ void PiecewisePolynomial<T>::AppendFirstOrderSegment(
     }
   }
   polynomials_.push_back(std::move(matrix));
+  AppendCoefficients(polynomials_.back());
   this->get_mutable_breaks().push_back(time);
 }
 
 template <typename T>
 void PiecewisePolynomial<T>::RemoveFinalSegment() {
   DRAKE_DEMAND(!empty());
+  if (has_coefficients()) {
+    coefficient_start_.pop_back();
+    coefficients_.resize(coefficient_start_.back());
+  }
   polynomials_.pop_back();
   this->get_mutable_breaks().pop_back();
 }
@@ -402,6 +462,7 @@ void PiecewisePolynomial<T>::ReverseTime() {
   std::vector<T>& breaks = this->get_mutable_breaks();
   std::reverse(breaks.begin(), breaks.end());
   std::reverse(polynomials_.begin(), polynomials_.end());
+  UpdateCoefficients();
   // Update the breaks.
   for (auto it = breaks.begin(); it != breaks.end(); ++it) {
     *it *= -1.0;
@@ -428,6 +489,7 @@ void PiecewisePolynomial<T>::ScaleTime(const T& scale) {
       }
     }
   }
+  UpdateCoefficients();
 
   // Update the breaks.
   std::vector<T>& breaks = this->get_mutable_breaks();
@@ -452,6 +514,7 @@ void PiecewisePolynomial<T>::setPolynomialMatrixBlock(
   this->segment_number_range_check(segment_number);
   polynomials_[segment_number].block(row_start, col_start, replacement.rows(),
                                      replacement.cols()) = replacement;
+  UpdateCoefficients();
 }
 
 template <typename T>
@@ -482,6 +545,118 @@ T PiecewisePolynomial<T>::EvaluateSegmentAbsoluteTime(
       t - this->start_time(segment_index), derivative_order);
 }
 
+template <typename T>
+int PiecewisePolynomial<T>::GetSegmentIndexWithHint(const T& t) const {
+  if constexpr (std::is_same_v<T, double>) {
+    const std::vector<double>& breaks = this->breaks();
+    const int num_segments = this->get_number_of_segments();
+    // Segment i contains t iff breaks[i] <= t < breaks[i + 1], where the first
+    // and the last segment extend to -∞ and ∞, respectively.
+    const auto contains = [&breaks, num_segments, t](int i) {
+      return (i == 0 || breaks[i] <= t) &&
+             (i == num_segments - 1 || t < breaks[i + 1]);
+    };
+    int segment_index = segment_hint_.index.load(std::memory_order_relaxed);
+    if (segment_index >= num_segments) {
+      segment_index = 0;
+    }
+    if (num_segments == 0 || !contains(segment_index)) {
+      if (segment_index + 1 < num_segments && contains(segment_index + 1)) {
+        ++segment_index;
+      } else {
+        segment_index = this->get_segment_index(t);
+      }
+    }
+    segment_hint_.index.store(segment_index, std::memory_order_relaxed);
+    return segment_index;
+  } else {
+    return this->get_segment_index(t);
+  }
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::UpdateCoefficients() {
+  coefficients_.clear();
+  coefficient_start_.clear();
+  if constexpr (std::is_same_v<T, double>) {
+    coefficient_start_.push_back(0);
+    for (const PolynomialMatrix& matrix : polynomials_) {
+      AppendCoefficients(matrix);
+    }
+  }
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::AppendCoefficients(
+    const PolynomialMatrix& matrix) {
+  if constexpr (std::is_same_v<T, double>) {
+    // The coefficients of the previous segments are already invalid.
+    if (coefficient_start_.empty()) return;
+    const int size = matrix.size();
+    int degree = 0;
+    for (int i = 0; i < size; ++i) {
+      if (matrix(i).GetVariables().size() > 1) {
+        coefficients_.clear();
+        coefficient_start_.clear();
+        return;
+      }
+      degree = max(degree, matrix(i).GetDegree());
+    }
+    const int start = coefficient_start_.back();
+    const int end = start + (degree + 1) * size;
+    coefficients_.resize(end, 0.0);
+    for (int i = 0; i < size; ++i) {
+      const Eigen::VectorXd coeffs = matrix(i).GetCoefficients();
+      for (int k = 0; k < coeffs.size(); ++k) {
+        coefficients_[start + k * size + i] = coeffs(k);
+      }
+    }
+    coefficient_start_.push_back(end);
+  } else {
+    unused(matrix);
+  }
+}
+
+template <typename T>
+void PiecewisePolynomial<T>::EvalCoefficients(int segment_index, double tau,
+                                              int derivative_order,
+                                              double* result,
+                                              int entry) const {
+  DRAKE_ASSERT(has_coefficients());
+  DRAKE_ASSERT(derivative_order >= 0);
+  const int size = rows() * cols();
+  if (size == 0) return;
+  const int start = coefficient_start_[segment_index];
+  const int degree =
+      (coefficient_start_[segment_index + 1] - start) / size - 1;
+  const int offset = entry < 0 ? 0 : entry;
+  const int num_entries = entry < 0 ? size : 1;
+  Eigen::Map<Eigen::VectorXd> y(result, num_entries);
+  if (degree < derivative_order) {
+    y.setZero();
+    return;
+  }
+  const auto coefficients = [this, start, size, offset, num_entries](int k) {
+    return Eigen::Map<const Eigen::VectorXd>(
+        &coefficients_[start + k * size + offset], num_entries);
+  };
+  // The coefficient of τᵏ⁻ⁿ in the n'th derivative is k!/(k-n)! times the
+  // coefficient of τᵏ.
+  const auto factor = [derivative_order](int k) {
+    double falling_factorial = 1.0;
+    for (int j = 0; j < derivative_order; ++j) {
+      falling_factorial *= k - j;
+    }
+    return falling_factorial;
+  };
+  // Horner's method; the first term is not multiplied by τ so that constant
+  // segments over [-∞, ∞] do not evaluate to NaN.
+  y = factor(degree) * coefficients(degree);
+  for (int k = degree - 1; k >= derivative_order; --k) {
+    y = tau * y + factor(k) * coefficients(k);
+  }
+}
+
 template <typename T>
 Eigen::Index PiecewisePolynomial<T>::rows() const {
   if (polynomials_.size() > 0) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -94,6 +95,7 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
             std::vector<T>({-std::numeric_limits<double>::infinity(),
                             std::numeric_limits<double>::infinity()})) {
     polynomials_.push_back(constant_value.template cast<Polynomial<T>>());
+    UpdateCoefficients();
   }
 
   /**
@@ -529,6 +531,18 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
       return DoEvalDerivative(t, derivative_order);
   }
 
+  /**
+   * Evaluates the %PiecewisePolynomial at each of the times in `t`. This is
+   * equivalent to (but faster than) calling value() for each time; the
+   * segment search is cheapest when `t` is sorted.
+   *
+   * @return A matrix with rows() rows and `cols() * t.size()` columns, whose
+   *         i-th block of cols() columns is value(t[i]). For a column vector
+   *         trajectory this is the same as vector_values().
+   * @warning See warnings in value().
+   */
+  MatrixX<T> value(const std::vector<T>& t) const;
+
   /**
    * Gets the matrix of Polynomials corresponding to the given segment index.
    * @warning `segment_index` is not checked for validity.
@@ -796,9 +810,57 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
                                 Eigen::Index col,
                                 int derivative_order = 0) const;
 
+  // Returns get_segment_index(t). For T = double, the search starts from the
+  // segment that was found by the previous call (and its successor), so that
+  // evaluations at increasing times take constant time.
+  int GetSegmentIndexWithHint(const T& t) const;
+
+  // Rebuilds coefficients_ and coefficient_start_ from polynomials_. This must
+  // be called whenever polynomials_ is modified, except by the methods that
+  // update them incrementally.
+  void UpdateCoefficients();
+
+  // Appends the coefficients of `matrix` (the new last segment) to
+  // coefficients_, or invalidates them if that is not possible.
+  void AppendCoefficients(const PolynomialMatrix& matrix);
+
+  // Returns true iff coefficients_ is in sync with polynomials_.
+  bool has_coefficients() const {
+    return coefficient_start_.size() == polynomials_.size() + 1;
+  }
+
+  // Evaluates the `derivative_order` derivative of segment `segment_index`
+  // at `tau` (relative to the segment start time) from coefficients_ with
+  // Horner's method, and stores the rows() * cols() (column-major) result in
+  // `result`. If `entry` is non-negative, only that (column-major) entry is
+  // evaluated and stored in result[0].
+  // @pre has_coefficients().
+  void EvalCoefficients(int segment_index, double tau, int derivative_order,
+                        double* result, int entry = -1) const;
+
   // a PolynomialMatrix for each piece (segment).
   std::vector<PolynomialMatrix> polynomials_;
 
+  // For T = double, a copy of the coefficients of polynomials_ in one
+  // contiguous (segment × degree × rows × cols) array, for fast evaluation.
+  // Segment i is stored from coefficient_start_[i] to coefficient_start_[i+1]
+  // as d + 1 column-major rows() × cols() matrices of the coefficients of
+  // τ⁰, ..., τᵈ, where d is the largest degree of its entries. Both vectors
+  // are empty for other scalar types, and when an entry is not univariate
+  // (see has_coefficients()).
+  std::vector<double> coefficients_;
+  std::vector<int> coefficient_start_;
+
+  // The segment index found by the last call to GetSegmentIndexWithHint().
+  // Copies start over from segment zero.
+  struct SegmentHint {
+    SegmentHint() = default;
+    SegmentHint(const SegmentHint&) {}
+    SegmentHint& operator=(const SegmentHint&) { return *this; }
+    std::atomic<int> index{0};
+  };
+  mutable SegmentHint segment_hint_;
+
   // Computes coeffecients for a cubic spline given the value and first
   // derivatives at the end points.
   // Throws `std::exception` if `dt < PiecewiseTrajectory::kEpsilonTime`.
@@ -1,5 +1,7 @@
 #include "drake/common/trajectories/piecewise_polynomial.h"
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <stdexcept>
 #include <vector>
@@ -304,6 +306,118 @@ GTEST_TEST(testPiecewisePolynomial, VectorValueTest) {
       "This method only supports vector-valued trajectories.");
 }
 
+// Evaluates the derivative of `pp` from its Polynomial representation.
+Eigen::MatrixXd EvalPolynomials(const PiecewisePolynomial<double>& pp,
+                                double t, int derivative_order = 0) {
+  const int segment_index = pp.get_segment_index(t);
+  t = std::min(std::max(t, pp.start_time()), pp.end_time());
+  Eigen::MatrixXd result(pp.rows(), pp.cols());
+  for (int row = 0; row < pp.rows(); ++row) {
+    for (int col = 0; col < pp.cols(); ++col) {
+      result(row, col) =
+          pp.getPolynomial(segment_index, row, col)
+              .EvaluateUnivariate(t - pp.start_time(segment_index),
+                                  derivative_order);
+    }
+  }
+  return result;
+}
+
+// Checks value() and EvalDerivative() against the polynomials, for times in
+// increasing, decreasing and random order, at the breaks, and out of range.
+void CheckDenseEvaluation(const PiecewisePolynomial<double>& pp) {
+  const std::vector<double>& breaks = pp.get_segment_times();
+  std::vector<double> times = breaks;
+  times.push_back(breaks.front() - 1);
+  times.push_back(breaks.back() + 1);
+  for (int i = 0; i < pp.get_number_of_segments(); ++i) {
+    for (const double s : {0.1, 0.5, 0.9}) {
+      times.push_back(breaks[i] + s * (breaks[i + 1] - breaks[i]));
+    }
+  }
+  // Constant trajectories are defined over [-∞, ∞].
+  times.erase(std::remove_if(times.begin(), times.end(),
+                             [](double t) { return !std::isfinite(t); }),
+              times.end());
+  times.push_back(0.0);
+  std::sort(times.begin(), times.end());
+  std::vector<double> reversed(times.rbegin(), times.rend());
+  std::vector<double> shuffled = times;
+  std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937());
+  for (const std::vector<double>* order : {&times, &reversed, &shuffled}) {
+    for (const double t : *order) {
+      EXPECT_TRUE(CompareMatrices(pp.value(t), EvalPolynomials(pp, t), 1e-12));
+      if (pp.is_time_in_range(t)) {
+        EXPECT_EQ(pp.scalarValue(t, pp.rows() - 1, pp.cols() - 1),
+                  pp.value(t)(pp.rows() - 1, pp.cols() - 1));
+      }
+      for (int n = 1; n < 4; ++n) {
+        EXPECT_TRUE(CompareMatrices(pp.EvalDerivative(t, n),
+                                    EvalPolynomials(pp, t, n), 1e-10));
+      }
+    }
+    const Eigen::MatrixXd values = pp.value(*order);
+    ASSERT_EQ(values.rows(), pp.rows());
+    ASSERT_EQ(values.cols(), pp.cols() * static_cast<int>(order->size()));
+    for (int i = 0; i < static_cast<int>(order->size()); ++i) {
+      EXPECT_TRUE(CompareMatrices(values.middleCols(i * pp.cols(), pp.cols()),
+                                  pp.value((*order)[i]), 0));
+    }
+  }
+}
+
+GTEST_TEST(testPiecewisePolynomial, DenseEvaluationTest) {
+  default_random_engine generator;
+  const vector<double> breaks =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(6, generator);
+  PiecewisePolynomial<double> pp =
+      test::MakeRandomPiecewisePolynomial(3, 2, 5, breaks);
+  CheckDenseEvaluation(pp);
+
+  // Segments of different degrees.
+  pp.AppendFirstOrderSegment(pp.end_time() + 0.5,
+                             Eigen::MatrixXd::Ones(3, 2));
+  pp.AppendCubicHermiteSegment(pp.end_time() + 0.2,
+                               Eigen::MatrixXd::Zero(3, 2),
+                               Eigen::MatrixXd::Ones(3, 2));
+  CheckDenseEvaluation(pp);
+  pp.RemoveFinalSegment();
+  CheckDenseEvaluation(pp);
+  CheckDenseEvaluation(pp.derivative(2));
+  CheckDenseEvaluation(pp.integral());
+  const Polynomiald quadratic(Eigen::Vector3d(1, 2, 3));
+  pp.setPolynomialMatrixBlock(MatrixX<Polynomiald>::Constant(1, 2, quadratic),
+                              1, 2, 0);
+  CheckDenseEvaluation(pp);
+  pp.Reshape(2, 3);
+  CheckDenseEvaluation(pp);
+  pp.ScaleTime(2.0);
+  pp.ReverseTime();
+  CheckDenseEvaluation(pp);
+
+  PiecewisePolynomial<double> concatenated;
+  concatenated.ConcatenateInTime(pp);
+  concatenated.ConcatenateInTime(PiecewisePolynomial<double>::FirstOrderHold(
+      std::vector<double>{pp.end_time(), pp.end_time() + 1},
+      std::vector<Eigen::MatrixXd>(2, Eigen::MatrixXd::Ones(2, 3))));
+  CheckDenseEvaluation(concatenated);
+
+  // A constant trajectory over [-∞, ∞].
+  CheckDenseEvaluation(PiecewisePolynomial<double>(Eigen::Vector2d(1, 2)));
+}
+
+GTEST_TEST(testPiecewisePolynomial, MultivariateSegmentTest) {
+  // A multivariate entry can be stored, but not evaluated.
+  const Polynomiald x = Polynomiald("x");
+  const Polynomiald y = Polynomiald("y");
+  PiecewisePolynomial<double> pp(std::vector<Polynomiald>{x, x * y},
+                                 std::vector<double>{0, 1, 2});
+  EXPECT_EQ(pp.value(0.5)(0, 0), 0.5);
+  DRAKE_EXPECT_THROWS_MESSAGE(pp.value(1.5), ".*univariate.*");
+  pp.RemoveFinalSegment();
+  EXPECT_EQ(pp.value(0.5)(0, 0), 0.5);
+}
+
 GTEST_TEST(testPiecewisePolynomial, RemoveFinalSegmentTest) {
   Eigen::VectorXd breaks(3);
   breaks << 0, .5, 1.;
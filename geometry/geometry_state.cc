@@ -137,6 +137,30 @@ GeometryState<T>::GeometryState()
   source_root_frame_map_[self_source_] = {world};
 }
 
+template <typename T>
+GeometryState<T>::GeometryState(const GeometryState<T>& source,
+                                internal::CopyOnWriteTag tag)
+    : self_source_(source.self_source_),
+      source_frame_id_map_(source.source_frame_id_map_),
+      source_deformable_geometry_id_map_(
+          source.source_deformable_geometry_id_map_),
+      source_frame_name_map_(source.source_frame_name_map_),
+      source_root_frame_map_(source.source_root_frame_map_),
+      source_names_(source.source_names_),
+      source_anchored_geometry_map_(source.source_anchored_geometry_map_),
+      frames_(source.frames_),
+      geometries_(source.geometries_),
+      frame_index_to_id_map_(source.frame_index_to_id_map_),
+      kinematics_data_(source.kinematics_data_),
+      geometry_engine_(source.geometry_engine_, tag),
+      geometry_version_(source.geometry_version_) {
+  for (const auto& [name, engine] : source.render_engines_) {
+    render_engines_.emplace(name,
+                            internal::EngineOwner<render::RenderEngine>(
+                                engine, tag));
+  }
+}
+
 template <typename T>
 unordered_set<GeometryId> GeometryState<T>::GetGeometryIds(
       const GeometrySet& geometry_set, const std::optional<Role>& role) const {
@@ -828,19 +852,19 @@ void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
       geometry.SetRole(std::move(properties));
       if (geometry.is_deformable()) {
         DRAKE_DEMAND(geometry.reference_mesh() != nullptr);
-        geometry_engine_->AddDeformableGeometry(*geometry.reference_mesh(),
-                                                geometry_id);
+        mutable_proximity_engine().AddDeformableGeometry(
+            *geometry.reference_mesh(), geometry_id);
       } else if (geometry.is_dynamic()) {
         // Pass the geometry to the engine.
         const RigidTransformd& X_WG =
             convert_to_double(kinematics_data_.X_WGs.at(geometry_id));
-        geometry_engine_->AddDynamicGeometry(geometry.shape(), X_WG,
-                                             geometry_id,
-                                             *geometry.proximity_properties());
+        mutable_proximity_engine().AddDynamicGeometry(
+            geometry.shape(), X_WG, geometry_id,
+            *geometry.proximity_properties());
       } else {
-        geometry_engine_->AddAnchoredGeometry(geometry.shape(), geometry.X_FG(),
-                                              geometry_id,
-                                              *geometry.proximity_properties());
+        mutable_proximity_engine().AddAnchoredGeometry(
+            geometry.shape(), geometry.X_FG(), geometry_id,
+            *geometry.proximity_properties());
       }
       // The set of geometries G such that I need to introduce filtered pairs
       // (geometry_id, gᵢ) ∀ gᵢ ∈ G. Generally, it consists of those proximity
@@ -853,7 +877,7 @@ void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
       ids_for_filtering.Add(geometry.frame_id());
       // Apply collision filter between geometry id and any geometries that have
       // been identified. If none have been identified, this makes no changes.
-      geometry_engine_->collision_filter().Apply(
+      mutable_proximity_engine().collision_filter().Apply(
           CollisionFilterDeclaration().ExcludeBetween(GeometrySet(geometry_id),
                                                       ids_for_filtering),
           [this](const GeometrySet& set) {
@@ -863,8 +887,8 @@ void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
     } break;
     case RoleAssign::kReplace:
       // Give the engine a chance to compare properties before and after.
-      geometry_engine_->UpdateRepresentationForNewProperties(geometry,
-                                                             properties);
+      mutable_proximity_engine().UpdateRepresentationForNewProperties(
+          geometry, properties);
       geometry.SetRole(std::move(properties));
       break;
     default:
@@ -896,10 +920,11 @@ void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
   const RigidTransformd& X_WG =
       convert_to_double(kinematics_data_.X_WGs.at(geometry_id));
   bool added_to_renderer{false};
-  for (auto& [name, engine] : render_engines_) {
+  for (const auto& [name, engine] : render_engines_) {
+    unused(engine);
     if (accepting_renderers.empty() || accepting_renderers.count(name) > 0) {
       added_to_renderer =
-          engine->RegisterVisual(
+          GetMutableRenderEngineOrThrow(name).RegisterVisual(
               geometry_id, geometry.shape(), *geometry.perception_properties(),
               X_WG, geometry.is_dynamic()) ||
           added_to_renderer;
@@ -1050,7 +1075,7 @@ SignedDistancePair<T> GeometryState<T>::ComputeSignedDistancePairClosestPoints(
       GeometryId id_A, GeometryId id_B) const {
     ThrowForNonProximity(GetValueOrThrow(id_A, geometries_), __func__);
     ThrowForNonProximity(GetValueOrThrow(id_B, geometries_), __func__);
-    return geometry_engine_->ComputeSignedDistancePairClosestPoints(
+    return posed_proximity_engine().ComputeSignedDistancePairClosestPoints(
         id_A, id_B, kinematics_data_.X_WGs);
   }
 
@@ -1062,7 +1087,8 @@ void GeometryState<T>::AddRenderer(
         "AddRenderer(): A renderer with the name '{}' already exists", name));
   }
   render::RenderEngine* render_engine = renderer.get();
-  render_engines_[name] = move(renderer);
+  render_engines_[name] =
+      internal::EngineOwner<render::RenderEngine>(move(renderer));
   bool accepted = false;
   for (auto& id_geo_pair : geometries_) {
     InternalGeometry& geometry = id_geo_pair.second;
@@ -1107,11 +1133,11 @@ void GeometryState<T>::RenderColorImage(const ColorRenderCamera& camera,
                                         const RigidTransformd& X_PC,
                                         ImageRgba8U* color_image_out) const {
   const RigidTransformd X_WC = GetDoubleWorldPose(parent_frame) * X_PC;
-  const render::RenderEngine& engine =
-      GetRenderEngineOrThrow(camera.core().renderer_name());
+  render::RenderEngine& engine =
+      GetPosedRenderEngineOrThrow(camera.core().renderer_name());
   // TODO(SeanCurtis-TRI): Invoke UpdateViewpoint() as part of a calc cache
   //  entry. Challenge: how to do that with a parameter passed here?
-  const_cast<render::RenderEngine&>(engine).UpdateViewpoint(X_WC);
+  engine.UpdateViewpoint(X_WC);
   engine.RenderColorImage(camera, color_image_out);
 }
 
@@ -1121,10 +1147,10 @@ void GeometryState<T>::RenderDepthImage(const DepthRenderCamera& camera,
                                         const RigidTransformd& X_PC,
                                         ImageDepth32F* depth_image_out) const {
   const RigidTransformd X_WC = GetDoubleWorldPose(parent_frame) * X_PC;
-  const render::RenderEngine& engine =
-      GetRenderEngineOrThrow(camera.core().renderer_name());
-  // See note in RenderColorImage() about this const cast.
-  const_cast<render::RenderEngine&>(engine).UpdateViewpoint(X_WC);
+  render::RenderEngine& engine =
+      GetPosedRenderEngineOrThrow(camera.core().renderer_name());
+  // See note in RenderColorImage() about updating the viewpoint here.
+  engine.UpdateViewpoint(X_WC);
   engine.RenderDepthImage(camera, depth_image_out);
 }
 
@@ -1134,10 +1160,10 @@ void GeometryState<T>::RenderLabelImage(const ColorRenderCamera& camera,
                                         const RigidTransformd& X_PC,
                                         ImageLabel16I* label_image_out) const {
   const RigidTransformd X_WC = GetDoubleWorldPose(parent_frame) * X_PC;
-  const render::RenderEngine& engine =
-      GetRenderEngineOrThrow(camera.core().renderer_name());
-  // See note in RenderColorImage() about this const cast.
-  const_cast<render::RenderEngine&>(engine).UpdateViewpoint(X_WC);
+  render::RenderEngine& engine =
+      GetPosedRenderEngineOrThrow(camera.core().renderer_name());
+  // See note in RenderColorImage() about updating the viewpoint here.
+  engine.UpdateViewpoint(X_WC);
   engine.RenderLabelImage(camera, label_image_out);
 }
 
@@ -1268,10 +1294,21 @@ void GeometryState<T>::FinalizePoseUpdate(
       const internal::KinematicsData<T>& kinematics_data,
       internal::ProximityEngine<T>* proximity_engine,
       std::vector<render::RenderEngine*> render_engines) const {
-  proximity_engine->UpdateWorldPoses(kinematics_data.X_WGs);
+  GeometryState<T>* mutable_state = const_cast<GeometryState<T>*>(this);
+  if (proximity_engine != nullptr) {
+    proximity_engine->UpdateWorldPoses(kinematics_data.X_WGs);
+  } else {
+    mutable_state->geometry_engine_.set_stale(true);
+  }
   for (auto* render_engine : render_engines) {
     render_engine->UpdatePoses(kinematics_data.X_WGs);
   }
+  // The render engines that were left out are shared with a copy-on-write
+  // copy; see GetUnsharedRenderEngines().
+  for (auto& [name, owner] : mutable_state->render_engines_) {
+    unused(name);
+    owner.set_stale(owner.is_shared());
+  }
 }
 
 template <typename T>
@@ -1279,7 +1316,12 @@ void GeometryState<T>::FinalizeConfigurationUpdate(
     const internal::KinematicsData<T>& kinematics_data,
     internal::ProximityEngine<T>* proximity_engine,
     std::vector<render::RenderEngine*>) const {
-  proximity_engine->UpdateDeformableVertexPositions(kinematics_data.q_WGs);
+  GeometryState<T>* mutable_state = const_cast<GeometryState<T>*>(this);
+  if (proximity_engine != nullptr) {
+    proximity_engine->UpdateDeformableVertexPositions(kinematics_data.q_WGs);
+  } else {
+    mutable_state->geometry_engine_.set_stale(true);
+  }
   // TODO(xuchenhan-tri): Update render engine as necessary.
 }
 
@@ -1493,11 +1535,11 @@ bool GeometryState<T>::RemoveRoleUnchecked(GeometryId geometry_id, Role role) {
 template <typename T>
 bool GeometryState<T>::RemoveFromRendererUnchecked(
     const std::string& renderer_name, GeometryId id) {
-  render::RenderEngine* engine = render_engines_[renderer_name].get_mutable();
-  if (engine->has_geometry(id)) {
+  if (GetRenderEngineOrThrow(renderer_name).has_geometry(id)) {
     // The engine has reported the belief that it has geometry `id`. Therefore,
     // removal should report true.
-    DRAKE_DEMAND(engine->RemoveGeometry(id) == true);
+    render::RenderEngine& engine = GetMutableRenderEngineOrThrow(renderer_name);
+    DRAKE_DEMAND(engine.RemoveGeometry(id) == true);
     geometry_version_.modify_perception();
     return true;
   }
@@ -1513,7 +1555,8 @@ bool GeometryState<T>::RemoveProximityRole(GeometryId geometry_id) {
   if (!geometry->has_proximity_role()) return false;
 
   // Geometry *is* registered; do the work to remove it.
-  geometry_engine_->RemoveGeometry(geometry_id, geometry->is_dynamic());
+  mutable_proximity_engine().RemoveGeometry(geometry_id,
+                                            geometry->is_dynamic());
   geometry->RemoveProximityRole();
   geometry_version_.modify_proximity();
   return true;
@@ -1584,6 +1627,78 @@ const render::RenderEngine& GeometryState<T>::GetRenderEngineOrThrow(
       fmt::format("No renderer exists with name: '{}'", renderer_name));
 }
 
+template <typename T>
+render::RenderEngine& GeometryState<T>::GetMutableRenderEngineOrThrow(
+    const std::string& renderer_name) const {
+  GeometryState<T>* mutable_state = const_cast<GeometryState<T>*>(this);
+  auto& render_engines = mutable_state->render_engines_;
+  auto iter = render_engines.find(renderer_name);
+  if (iter == render_engines.end()) {
+    throw std::logic_error(
+        fmt::format("No renderer exists with name: '{}'", renderer_name));
+  }
+  return iter->second.get_mutable();
+}
+
+template <typename T>
+render::RenderEngine& GeometryState<T>::GetPosedRenderEngineOrThrow(
+    const std::string& renderer_name) const {
+  GeometryState<T>* mutable_state = const_cast<GeometryState<T>*>(this);
+  render::RenderEngine& engine = GetMutableRenderEngineOrThrow(renderer_name);
+  auto& owner = mutable_state->render_engines_.at(renderer_name);
+  if (owner.is_stale()) {
+    engine.UpdatePoses(kinematics_data_.X_WGs);
+    owner.set_stale(false);
+  }
+  return engine;
+}
+
+template <typename T>
+const render::RenderEngine* GeometryState<T>::GetRenderEngineByName(
+    const std::string& name) const {
+  if (render_engines_.count(name) > 0) {
+    return &GetPosedRenderEngineOrThrow(name);
+  }
+  return nullptr;
+}
+
+template <typename T>
+internal::ProximityEngine<T>* GeometryState<T>::GetUnsharedProximityEngine()
+    const {
+  if (geometry_engine_.is_shared()) {
+    return nullptr;
+  }
+  return &mutable_proximity_engine();
+}
+
+template <typename T>
+std::vector<render::RenderEngine*> GeometryState<T>::GetUnsharedRenderEngines()
+    const {
+  GeometryState<T>* mutable_state = const_cast<GeometryState<T>*>(this);
+  std::vector<render::RenderEngine*> results;
+  for (auto& [name, owner] : mutable_state->render_engines_) {
+    unused(name);
+    if (!owner.is_shared()) {
+      results.emplace_back(&owner.get_mutable());
+    }
+  }
+  return results;
+}
+
+template <typename T>
+const internal::ProximityEngine<T>& GeometryState<T>::posed_proximity_engine()
+    const {
+  GeometryState<T>* mutable_state = const_cast<GeometryState<T>*>(this);
+  if (!geometry_engine_.is_stale()) {
+    return *geometry_engine_;
+  }
+  internal::ProximityEngine<T>& engine = mutable_proximity_engine();
+  engine.UpdateWorldPoses(kinematics_data_.X_WGs);
+  engine.UpdateDeformableVertexPositions(kinematics_data_.q_WGs);
+  mutable_state->geometry_engine_.set_stale(false);
+  return engine;
+}
+
 template <typename T>
 RigidTransformd GeometryState<T>::GetDoubleWorldPose(FrameId frame_id) const {
   if (frame_id == InternalFrame::world_frame_id()) {
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -82,6 +84,78 @@ struct KinematicsData {
   std::vector<math::RigidTransform<T>> X_WFs;
 };
 
+// Tag type for the constructor of GeometryState that makes a copy-on-write
+// copy; see GeometryState::MakeCopyOnWrite().
+struct CopyOnWriteTag {};
+
+// Owns one of the engines (proximity or render) of a GeometryState. Copying an
+// EngineOwner deep copies the engine, just like copyable_unique_ptr; so does
+// every ordinary copy of a GeometryState. Only the copy-on-write constructor
+// shares the engine with its source. The engine is then cloned by whichever
+// of the sharing owners first gets mutable access to it.
+//
+// An owner also records whether its engine lacks the kinematics data of the
+// GeometryState (its poses are "stale"). That only happens when a pose update
+// skips a shared engine rather than cloning it.
+template <class Engine>
+class EngineOwner {
+ public:
+  EngineOwner() = default;
+
+  explicit EngineOwner(std::unique_ptr<Engine> engine, bool is_stale = false)
+      : engine_(std::move(engine)), is_stale_(is_stale) {}
+
+  EngineOwner(const EngineOwner& other)
+      : engine_(other.engine_ == nullptr ? nullptr : Clone(*other.engine_)),
+        is_stale_(other.is_stale_) {}
+
+  EngineOwner(const EngineOwner& other, CopyOnWriteTag)
+      : engine_(other.engine_), is_stale_(other.is_stale_) {}
+
+  EngineOwner& operator=(const EngineOwner& other) {
+    if (this != &other) *this = EngineOwner(other);
+    return *this;
+  }
+
+  EngineOwner(EngineOwner&&) = default;
+  EngineOwner& operator=(EngineOwner&&) = default;
+
+  const Engine& operator*() const { return *engine_; }
+  const Engine* operator->() const { return engine_.get(); }
+  const Engine* get() const { return engine_.get(); }
+
+  // Reports if another owner shares the engine.
+  bool is_shared() const { return engine_.use_count() > 1; }
+
+  // Returns the engine after replacing it with its own clone if it is shared.
+  Engine& get_mutable() {
+    if (is_shared()) {
+      engine_ = Clone(*engine_);
+    } else {
+      // Another owner may have just released its share of the engine on
+      // another thread; make sure its reads of the engine happen before our
+      // writes.
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *engine_;
+  }
+
+  bool is_stale() const { return is_stale_; }
+  void set_stale(bool is_stale) { is_stale_ = is_stale; }
+
+ private:
+  static std::shared_ptr<Engine> Clone(const Engine& engine) {
+    if constexpr (std::is_same_v<Engine, render::RenderEngine>) {
+      return engine.Clone();
+    } else {
+      return std::make_shared<Engine>(engine);
+    }
+  }
+
+  std::shared_ptr<Engine> engine_;
+  bool is_stale_{false};
+};
+
 }  // namespace internal
 #endif
 
@@ -112,6 +186,15 @@ using GeometryIdSet = std::unordered_set<GeometryId>;
  SceneGraph's context-dependent state includes values (the poses/configurations)
  and structure (the topology of the world).
 
+ Copies of a %GeometryState own deep copies of the proximity and render
+ engines. The one exception is the copy made by MakeCopyOnWrite() for a
+ copy-on-write clone of a Context; it shares the engines with its source until
+ one of them changes an engine. A pose (or configuration) update doesn't change
+ a shared engine. The engine instead receives the current poses before it is
+ next queried or renders, at which point it is cloned. So a copy-on-write
+ copy whose poses change, but which is never queried or rendered, never clones
+ the engines.
+
  @note This is intended as an internal class only.
 
  @tparam_default_scalar
@@ -473,7 +556,7 @@ class GeometryState {
 
   /** Implementation of QueryObject::ComputePointPairPenetration().  */
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const {
-    return geometry_engine_->ComputePointPairPenetration(
+    return posed_proximity_engine().ComputePointPairPenetration(
         kinematics_data_.X_WGs);
   }
 
@@ -483,8 +566,8 @@ class GeometryState {
                             std::vector<ContactSurface<T>>>
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation) const {
-    return geometry_engine_->ComputeContactSurfaces(representation,
-                                                    kinematics_data_.X_WGs);
+    return posed_proximity_engine().ComputeContactSurfaces(
+        representation, kinematics_data_.X_WGs);
   }
 
   /** Implementation of QueryObject::ComputeContactSurfacesWithFallback().  */
@@ -496,7 +579,7 @@ class GeometryState {
       std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
     DRAKE_DEMAND(surfaces != nullptr);
     DRAKE_DEMAND(point_pairs != nullptr);
-    return geometry_engine_->ComputeContactSurfacesWithFallback(
+    return posed_proximity_engine().ComputeContactSurfacesWithFallback(
         representation, kinematics_data_.X_WGs, surfaces, point_pairs);
   }
 
@@ -506,17 +589,19 @@ class GeometryState {
   ComputeDeformableRigidContact(
       std::vector<internal::DeformableRigidContact<T>>*
           deformable_rigid_contact) const {
-    return geometry_engine_->ComputeDeformableRigidContact(
+    return posed_proximity_engine().ComputeDeformableRigidContact(
         deformable_rigid_contact);
   }
 
   /** Implementation of QueryObject::FindCollisionCandidates().  */
   std::vector<SortedPair<GeometryId>> FindCollisionCandidates() const {
-    return geometry_engine_->FindCollisionCandidates();
+    return posed_proximity_engine().FindCollisionCandidates();
   }
 
   /** Implementation of QueryObject::HasCollisions().  */
-  bool HasCollisions() const { return geometry_engine_->HasCollisions(); }
+  bool HasCollisions() const {
+    return posed_proximity_engine().HasCollisions();
+  }
 
   //@}
 
@@ -526,7 +611,8 @@ class GeometryState {
   CollisionFilterManager collision_filter_manager() {
     geometry_version_.modify_proximity();
     return CollisionFilterManager(
-        &geometry_engine_->collision_filter(), [this](const GeometrySet& set) {
+        &mutable_proximity_engine().collision_filter(),
+        [this](const GeometrySet& set) {
           return this->CollectIds(set, Role::kProximity);
         });
   }
@@ -542,7 +628,7 @@ class GeometryState {
    QueryObject::ComputeSignedDistancePairwiseClosestPoints().  */
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
       double max_distance) const {
-    return geometry_engine_->ComputeSignedDistancePairwiseClosestPoints(
+    return posed_proximity_engine().ComputeSignedDistancePairwiseClosestPoints(
         kinematics_data_.X_WGs, max_distance);
   }
 
@@ -554,7 +640,7 @@ class GeometryState {
   /** Implementation of QueryObject::ComputeSignedDistanceToPoint().  */
   std::vector<SignedDistanceToPoint<T>> ComputeSignedDistanceToPoint(
       const Vector3<T>& p_WQ, double threshold) const {
-    return geometry_engine_->ComputeSignedDistanceToPoint(
+    return posed_proximity_engine().ComputeSignedDistanceToPoint(
         p_WQ, kinematics_data_.X_WGs, threshold);
   }
 
@@ -574,14 +660,11 @@ class GeometryState {
     return render_engines_.count(name) > 0;
   }
 
-  /** Implementation of QueryObject::GetRenderEngineByName.  */
+  /** Implementation of QueryObject::GetRenderEngineByName. The engine is
+   prepared as for rendering (see GetMutableRenderEngineOrThrow()), since the
+   caller may render with it.  */
   const render::RenderEngine* GetRenderEngineByName(
-      const std::string& name) const {
-    if (render_engines_.count(name) > 0) {
-      return render_engines_.at(name).get();
-    }
-    return nullptr;
-  }
+      const std::string& name) const;
 
   /** Implementation of SceneGraph::RendererCount().  */
   int RendererCount() const { return static_cast<int>(render_engines_.size()); }
@@ -628,6 +711,20 @@ class GeometryState {
   template <typename>
   friend class GeometryState;
 
+  // Returns a copy of `source` that shares the engines of `source` rather than
+  // deep copying them (see the class documentation). SceneGraph uses this only
+  // for the private copy of a GeometryState that a copy-on-write clone of a
+  // Context makes before it changes the GeometryState.
+  static std::unique_ptr<GeometryState<T>> MakeCopyOnWrite(
+      const GeometryState<T>& source) {
+    return std::unique_ptr<GeometryState<T>>(
+        new GeometryState<T>(source, internal::CopyOnWriteTag{}));
+  }
+
+  // Copy-on-write constructor; see MakeCopyOnWrite(). Like the conversion
+  // constructor below, it must account for every member explicitly.
+  GeometryState(const GeometryState<T>& source, internal::CopyOnWriteTag);
+
   // Conversion constructor.
   // It is _vitally_ important that all members are _explicitly_ accounted for
   // (either in the initialization list or in the body). Failure to do so will
@@ -649,8 +746,8 @@ class GeometryState {
         frames_(source.frames_),
         geometries_(source.geometries_),
         frame_index_to_id_map_(source.frame_index_to_id_map_),
-        geometry_engine_(
-            std::move(source.geometry_engine_->template ToScalarType<T>())),
+        geometry_engine_(source.geometry_engine_->template ToScalarType<T>(),
+                         source.geometry_engine_.is_stale()),
         render_engines_(source.render_engines_),
         geometry_version_(source.geometry_version_) {
     auto convert_pose_vector = [](const std::vector<math::RigidTransform<U>>& s,
@@ -748,7 +845,11 @@ class GeometryState {
                                           GeometryId geometry_id);
 
   // Method that updates the proximity engine and the render engines with the
-  // up-to-date _pose_ data in `kinematics_data`.
+  // up-to-date _pose_ data in `kinematics_data`. The engines that are shared
+  // with a copy-on-write copy are not passed in (see
+  // GetUnsharedProximityEngine() and GetUnsharedRenderEngines()); they are
+  // instead marked as stale, and receive the poses before they are next used
+  // (see posed_proximity_engine() and GetPosedRenderEngineOrThrow()).
   void FinalizePoseUpdate(
       const internal::KinematicsData<T>& kinematics_data,
       internal::ProximityEngine<T>* proximity_engine,
@@ -756,7 +857,8 @@ class GeometryState {
 
   // Method that updates the proximity engine and the render engines with the
   // up-to-date _configuration_ data in `kinematics_data`. Currently, nothing is
-  // propagated to the render engines yet.
+  // propagated to the render engines yet. A null `proximity_engine` is handled
+  // as in FinalizePoseUpdate().
   void FinalizeConfigurationUpdate(
       const internal::KinematicsData<T>& kinematics_data,
       internal::ProximityEngine<T>* proximity_engine,
@@ -869,6 +971,20 @@ class GeometryState {
   const render::RenderEngine& GetRenderEngineOrThrow(
       const std::string& renderer_name) const;
 
+  // Like GetRenderEngineOrThrow(), but first replaces the renderer with its own
+  // clone if it is shared with a copy-on-write copy. Like the other "dangerous
+  // mutable getters" below, it requires that this GeometryState is not shared
+  // between contexts (see SceneGraph::unshared_geometry_state()).
+  render::RenderEngine& GetMutableRenderEngineOrThrow(
+      const std::string& renderer_name) const;
+
+  // Like GetMutableRenderEngineOrThrow(), but also gives the renderer the
+  // current poses if it missed them while it was shared. Rendering changes the
+  // renderer even though the methods are const, so this must be used before
+  // rendering.
+  render::RenderEngine& GetPosedRenderEngineOrThrow(
+      const std::string& renderer_name) const;
+
   // Utility function to facilitate getting a double-valued pose for a frame,
   // regardless of T's actual type.
   math::RigidTransformd GetDoubleWorldPose(FrameId frame_id) const;
@@ -892,28 +1008,38 @@ class GeometryState {
     return mutable_state->kinematics_data_;
   }
 
-  // Returns a mutable reference to the proximity engine in this GeometryState.
+  // Returns a mutable reference to the proximity engine in this GeometryState,
+  // after replacing it with its own clone if it is shared with a copy-on-write
+  // copy.
   internal::ProximityEngine<T>& mutable_proximity_engine() const {
     GeometryState<T>* mutable_state = const_cast<GeometryState<T>*>(this);
-    return *mutable_state->geometry_engine_;
+    return mutable_state->geometry_engine_.get_mutable();
   }
 
-  // Returns a vector of mutable pointers to all render engines in this
-  // GeometryState.
-  std::vector<render::RenderEngine*> GetMutableRenderEngines() const {
-    std::vector<render::RenderEngine*> results;
-    for (auto& [name, render_engine] : render_engines_) {
-      unused(name);
-      results.emplace_back(
-          const_cast<render::RenderEngine*>(render_engine.get()));
-    }
-    return results;
-  }
+  // Returns a mutable pointer to the proximity engine in this GeometryState,
+  // or nullptr if it is shared with a copy-on-write copy. The shared engine is
+  // left alone, so that updating the poses doesn't clone it.
+  internal::ProximityEngine<T>* GetUnsharedProximityEngine() const;
+
+  // Returns a vector of mutable pointers to the render engines in this
+  // GeometryState that are not shared with a copy-on-write copy. The shared
+  // ones are left alone, so that updating the poses doesn't clone them.
+  std::vector<render::RenderEngine*> GetUnsharedRenderEngines() const;
+
+  // Reports if the proximity engine lacks the current poses or configurations
+  // because it was shared during the last update.
+  bool proximity_engine_is_stale() const { return geometry_engine_.is_stale(); }
+
+  // Returns the proximity engine with the current poses and configurations.
+  // If it is stale, it is first replaced with its own clone, which receives
+  // the kinematics data; that requires that this GeometryState is not shared
+  // between contexts (see SceneGraph::posed_geometry_state()).
+  const internal::ProximityEngine<T>& posed_proximity_engine() const;
   //@}
 
   // NOTE: If adding a member it is important that it be _explicitly_ copied
-  // in the converting copy constructor and likewise tested in the unit test
-  // for that constructor.
+  // in the converting copy constructor and the copy-on-write constructor, and
+  // likewise tested in the unit tests for those constructors.
 
   // The GeometryState gets its own source so it can own entities (such as the
   // world frame).
@@ -983,10 +1109,10 @@ class GeometryState {
   // evaluation based on the previous data, but its internal data structures
   // rely on temporal coherency to speed up the calculations. Thus we persist
   // and copy it.
-  copyable_unique_ptr<internal::ProximityEngine<T>> geometry_engine_;
+  internal::EngineOwner<internal::ProximityEngine<T>> geometry_engine_;
 
   // The collection of all registered renderers.
-  std::unordered_map<std::string, copyable_unique_ptr<render::RenderEngine>>
+  std::unordered_map<std::string, internal::EngineOwner<render::RenderEngine>>
       render_engines_;
 
   // The version for this geometry data.
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <atomic>
 #include <cctype>
+#include <chrono>
+#include <cstring>
 #include <exception>
 #include <fstream>
 #include <functional>
@@ -30,6 +32,7 @@
 #include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
+#include "drake/geometry/meshcat_recording.h"
 #include "drake/geometry/meshcat_types.h"
 
 #ifdef BOOST_VERSION
@@ -104,6 +107,14 @@ struct PerSocketData {
 using WebSocket = uWS::WebSocket<kSsl, kIsServer, PerSocketData>;
 using MsgPackMap = std::map<std::string, msgpack::object>;
 
+// Meshcat::PlayRecording() checks whether to send the next chunk of the
+// recording at this period. It sends a chunk once it is due to start playing
+// within this many chunks' duration, unless the connections still have more
+// than this many bytes to send.
+constexpr int kRecordingPollMilliseconds = 50;
+constexpr double kRecordingLeadChunks = 2.0;
+constexpr size_t kMaxRecordingBackpressure = 1 << 22;
+
 // Encode the meshcat command into a Javascript fetch() command.  The particular
 // syntax using `fetch()` was replicated from the corresponding functionality in
 // meshcat-python.
@@ -1026,6 +1037,12 @@ class Meshcat::Impl {
     data.path = FullPath(path);
     Eigen::Map<Eigen::Matrix4d>(data.matrix) = matrix;
 
+    // Keep SetTransforms' record of the client-side poses up to date.
+    auto sent = sent_transforms_.find(data.path);
+    if (sent != sent_transforms_.end()) {
+      sent->second = matrix;
+    }
+
     Defer([this, data = std::move(data)]() {
       DRAKE_DEMAND(IsThread(websocket_thread_id_));
       DRAKE_DEMAND(app_ != nullptr);
@@ -1038,6 +1055,76 @@ class Meshcat::Impl {
     });
   }
 
+  // This function is public via the PIMPL.
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<RigidTransformd>& X_ParentPaths,
+                     double tolerance, bool use_float32) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+    DRAKE_THROW_UNLESS(paths.size() == X_ParentPaths.size());
+    DRAKE_THROW_UNLESS(tolerance >= 0.0);
+
+    // Only send the poses that changed (by more than the tolerance) since they
+    // were last sent; the rest of the batch is dropped.
+    std::vector<std::string> changed_paths;
+    std::vector<Eigen::Matrix4d> changed_matrices;
+    changed_paths.reserve(paths.size());
+    changed_matrices.reserve(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+      std::string full_path = FullPath(paths[i]);
+      const Eigen::Matrix4d matrix = X_ParentPaths[i].GetAsMatrix4();
+      auto [sent, is_new] = sent_transforms_.emplace(full_path, matrix);
+      if (!is_new) {
+        if ((matrix - sent->second).cwiseAbs().maxCoeff() < tolerance) {
+          continue;
+        }
+        sent->second = matrix;
+      }
+      changed_paths.push_back(std::move(full_path));
+      changed_matrices.push_back(matrix);
+    }
+    if (changed_paths.empty()) {
+      return;
+    }
+
+    internal::SetTransformsData data;
+    if (use_float32) {
+      data.dtype = "float32";
+      data.matrices.resize(changed_matrices.size() * 16 * sizeof(float));
+      Eigen::Map<Eigen::Matrix<float, 16, Eigen::Dynamic>> matrices(
+          reinterpret_cast<float*>(data.matrices.data()), 16,
+          changed_matrices.size());
+      for (size_t i = 0; i < changed_matrices.size(); ++i) {
+        matrices.col(i) = Eigen::Map<const Eigen::Matrix<double, 16, 1>>(
+            changed_matrices[i].data()).cast<float>();
+      }
+    } else {
+      data.matrices.resize(changed_matrices.size() * 16 * sizeof(double));
+      std::memcpy(data.matrices.data(), changed_matrices.data(),
+                  data.matrices.size());
+    }
+    data.paths = std::move(changed_paths);
+
+    Defer([this, data = std::move(data),
+           matrices = std::move(changed_matrices)]() {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      DRAKE_DEMAND(app_ != nullptr);
+      std::stringstream message_stream;
+      msgpack::pack(message_stream, data);
+      app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+      // Newly-connected clients are sent the scene tree, which stores each
+      // path's transform as its own (full-precision) set_transform message.
+      internal::SetTransformData element_data;
+      for (size_t i = 0; i < data.paths.size(); ++i) {
+        element_data.path = data.paths[i];
+        Eigen::Map<Eigen::Matrix4d>(element_data.matrix) = matrices[i];
+        message_stream.str("");
+        msgpack::pack(message_stream, element_data);
+        SceneTreeElement& e = scene_tree_root_[element_data.path];
+        e.transform() = message_stream.str();
+      }
+    });
+  }
+
   // This function is public via the PIMPL.
   void Delete(std::string_view path) {
     DRAKE_DEMAND(IsThread(main_thread_id_));
@@ -1045,6 +1132,19 @@ class Meshcat::Impl {
     internal::DeleteData data;
     data.path = FullPath(path);
 
+    // Forget SetTransforms' record of the deleted paths.
+    for (auto iter = sent_transforms_.lower_bound(data.path);
+         iter != sent_transforms_.end() &&
+         iter->first.compare(0, data.path.size(), data.path) == 0;) {
+      const std::string& sent_path = iter->first;
+      if (sent_path.size() == data.path.size() ||
+          sent_path[data.path.size()] == '/' || data.path.back() == '/') {
+        iter = sent_transforms_.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+
     Defer([this, data = std::move(data)]() {
       DRAKE_DEMAND(IsThread(websocket_thread_id_));
       DRAKE_DEMAND(app_ != nullptr);
@@ -1164,6 +1264,33 @@ class Meshcat::Impl {
         });
   }
 
+  // This function is public via the PIMPL.
+  void PlayRecording(const std::string& filename) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+
+    // Open the file here, so that errors in its header are reported to the
+    // caller.
+    auto playback = std::make_unique<RecordingPlayback>(filename);
+
+    Defer([this, playback = std::move(playback)]() mutable {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      // This replaces (i.e., restarts) any playback that is in progress.
+      playback_ = std::move(playback);
+      if (playback_timer_ == nullptr) {
+        playback_timer_ = us_create_timer(
+            reinterpret_cast<struct us_loop_t*>(loop_), 1, sizeof(Impl*));
+        *static_cast<Impl**>(us_timer_ext(playback_timer_)) = this;
+        us_timer_set(
+            playback_timer_,
+            [](us_timer_t* timer) {
+              (*static_cast<Impl**>(us_timer_ext(timer)))->SendRecordingChunk();
+            },
+            kRecordingPollMilliseconds, kRecordingPollMilliseconds);
+      }
+      SendRecordingChunk();
+    });
+  }
+
   // This function is public via the PIMPL.
   void Set2dRenderMode(const math::RigidTransformd& X_WC, double xmin,
                       double xmax, double ymin, double ymax) {
@@ -1813,6 +1940,119 @@ class Meshcat::Impl {
     }
   }
 
+  // The state of the recording being streamed by PlayRecording().
+  struct RecordingPlayback {
+    explicit RecordingPlayback(const std::string& filename)
+        : reader(filename) {}
+
+    MeshcatRecordingReader reader;
+    // The chunk that was read but not sent yet (if any).
+    std::optional<MeshcatRecordingReader::Chunk> next_chunk;
+    // The first frame of the recording and the time at which it was sent, or
+    // std::nullopt if no chunks have been sent yet.
+    std::optional<int> first_frame;
+    std::chrono::steady_clock::time_point start_time;
+  };
+
+  // This function is a private utility for use within this class. It is called
+  // by playback_timer_, and sends (at most) the next chunk of the recording
+  // being played. The chunks are paced to the playback: a chunk is only sent
+  // once the browser will start to play it within kRecordingLeadChunks chunks'
+  // duration, and while the connections have less than
+  // kMaxRecordingBackpressure bytes still to send. Thus, neither this thread
+  // nor the sockets nor the browser buffer more than a few chunks.
+  void SendRecordingChunk() {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    DRAKE_DEMAND(app_ != nullptr);
+    if (playback_ == nullptr) {
+      return;
+    }
+    RecordingPlayback& playback = *playback_;
+    const double fps = playback.reader.frames_per_second();
+    if (!playback.next_chunk.has_value()) {
+      try {
+        playback.next_chunk = playback.reader.ReadNextChunk();
+      } catch (const std::exception& e) {
+        // There is no caller to throw to, so we report the error and stop.
+        drake::log()->error("Meshcat::PlayRecording() stopped early: {}",
+                            e.what());
+        StopRecordingPlayback();
+        return;
+      }
+      if (!playback.next_chunk.has_value()) {
+        StopRecordingPlayback();
+        return;
+      }
+    }
+    const MeshcatRecordingReader::Chunk& chunk = *playback.next_chunk;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (playback.first_frame.has_value()) {
+      const double elapsed =
+          std::chrono::duration<double>(now - playback.start_time).count();
+      const double chunk_start_time =
+          (chunk.first_frame - *playback.first_frame) / fps;
+      const double lead =
+          kRecordingLeadChunks * playback.reader.frames_per_chunk() / fps;
+      if (chunk_start_time > elapsed + lead) {
+        return;
+      }
+      size_t backpressure = 0;
+      for (WebSocket* ws : websockets_) {
+        backpressure += ws->getBufferedAmount();
+      }
+      if (backpressure > kMaxRecordingBackpressure) {
+        return;
+      }
+    }
+
+    internal::RecordingChunkData data;
+    data.reset = !playback.first_frame.has_value();
+    data.fps = fps;
+    data.first_frame = chunk.first_frame;
+    data.num_frames = chunk.num_frames;
+    int num_samples = 0;
+    for (const auto& track : chunk.tracks) {
+      num_samples += track.frames.size();
+    }
+    data.poses.resize(num_samples * 7 * sizeof(double));
+    char* poses = data.poses.data();
+    for (const auto& track : chunk.tracks) {
+      data.paths.push_back(FullPath(prefix_, track.path));
+      data.counts.push_back(track.frames.size());
+      data.frames.insert(data.frames.end(), track.frames.begin(),
+                         track.frames.end());
+      const size_t size = track.poses.size() * sizeof(double);
+      std::memcpy(poses, track.poses.data(), size);
+      poses += size;
+    }
+    std::stringstream message_stream;
+    msgpack::pack(message_stream, data);
+    app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+
+    if (!playback.first_frame.has_value()) {
+      playback.first_frame = chunk.first_frame;
+      playback.start_time = now;
+    }
+    playback.next_chunk.reset();
+  }
+
+  // This function is a private utility for use within this class. It ends the
+  // recording playback (if any), and closes playback_timer_ once control has
+  // returned to the event loop (the timer may be the caller).
+  void StopRecordingPlayback() {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    playback_.reset();
+    loop_->defer([this]() {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      // Leave the timer alone if PlayRecording() was called again meanwhile.
+      if (playback_ == nullptr && playback_timer_ != nullptr) {
+        us_timer_close(playback_timer_);
+        playback_timer_ = nullptr;
+      }
+    });
+  }
+
   // This function is a private utility for use within this class. It closes all
   // sockets therefore will cause the uWS::App::run() function to return, and
   // therefore the worker thread will (eventually) exit. This should only be
@@ -1823,6 +2063,13 @@ class Meshcat::Impl {
     DRAKE_DEMAND(IsThread(websocket_thread_id_));
     drake::log()->debug("Meshcat Shutdown");
 
+    // Stop playing any recording.
+    playback_.reset();
+    if (playback_timer_ != nullptr) {
+      us_timer_close(playback_timer_);
+      playback_timer_ = nullptr;
+    }
+
     // Stop accepting new connections.
     if (listen_socket_ != nullptr) {
       us_listen_socket_close(0, listen_socket_);
@@ -1841,16 +2088,23 @@ class Meshcat::Impl {
   // This function is a private utility for use within this class.
   std::string FullPath(std::string_view path) const {
     DRAKE_DEMAND(IsThread(main_thread_id_));
+    return FullPath(prefix_, path);
+  }
+
+  // This function is a private utility for use within this class. It is the
+  // thread-agnostic implementation of FullPath(path).
+  static std::string FullPath(const std::string& prefix,
+                              std::string_view path) {
     while (path.size() > 1 && path.back() == '/') {
       path.remove_suffix(1);
     }
     if (path.empty()) {
-      return prefix_;
+      return prefix;
     }
     if (path.front() == '/') {
       return std::string(path);
     }
-    return fmt::format("{}/{}", prefix_, path);
+    return fmt::format("{}/{}", prefix, path);
   }
 
   std::thread websocket_thread_{};
@@ -1869,6 +2123,8 @@ class Meshcat::Impl {
   const MeshcatParams params_;
   int port_{};
   std::mt19937 generator_{};
+  // The transform most recently sent for each path set via SetTransforms().
+  std::map<std::string, Eigen::Matrix4d> sent_transforms_{};
 
   // These variables should only be accessed in the websocket thread.
   std::thread::id websocket_thread_id_{};
@@ -1877,6 +2133,10 @@ class Meshcat::Impl {
   uWS::App* app_{nullptr};
   us_listen_socket_t* listen_socket_{nullptr};
   std::set<WebSocket*> websockets_{};
+  // The recording being played by PlayRecording() (if any), and the timer that
+  // sends its chunks (while it is playing).
+  std::unique_ptr<RecordingPlayback> playback_;
+  us_timer_t* playback_timer_{nullptr};
 
   // This variable may be accessed from any thread, but should only be modified
   // in the websocket thread.
@@ -2085,6 +2345,13 @@ void Meshcat::SetTransform(std::string_view path,
   impl().SetTransform(path, matrix);
 }
 
+void Meshcat::SetTransforms(
+    const std::vector<std::string>& paths,
+    const std::vector<math::RigidTransformd>& X_ParentPaths, double tolerance,
+    bool use_float32) {
+  impl().SetTransforms(paths, X_ParentPaths, tolerance, use_float32);
+}
+
 void Meshcat::Delete(std::string_view path) {
   impl().Delete(path);
 }
@@ -2112,6 +2379,10 @@ void Meshcat::SetAnimation(const MeshcatAnimation& animation) {
   impl().SetAnimation(animation);
 }
 
+void Meshcat::PlayRecording(const std::string& filename) {
+  impl().PlayRecording(filename);
+}
+
 void Meshcat::Set2dRenderMode(const math::RigidTransformd& X_WC, double xmin,
                               double xmax, double ymin, double ymax) {
   impl().Set2dRenderMode(X_WC, xmin, xmax, ymin, ymax);
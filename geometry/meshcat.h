@@ -412,6 +412,36 @@ class Meshcat {
   void SetTransform(std::string_view path,
                     const Eigen::Ref<const Eigen::Matrix4d>& matrix);
 
+  /** Sets the RigidTransform for many paths in the scene tree at once; this is
+  equivalent to calling SetTransform(paths[i], X_ParentPaths[i]) for each `i`,
+  but sends all of the transforms to the browser in a single message, which is
+  substantially cheaper for large scenes (e.g., MeshcatVisualizer uses this to
+  update all of its frames at every publish).
+
+  Only the poses that have changed since they were last sent by this method
+  are included in the message: a pose is skipped when no element of its
+  homogeneous matrix differs by `tolerance` or more from the previously sent
+  one.  (With the default `tolerance` of zero, every pose is sent.)  Calls to
+  SetTransform() and Delete() are accounted for, but any other changes to the
+  client-side transforms (e.g., playing back an animation) are not, so a
+  positive tolerance may leave a stale pose in the browser in that case.
+
+  @param paths "/"-delimited strings indicating the paths in the scene tree.
+               See @ref meshcat_path "Meshcat paths" for the semantics.
+  @param X_ParentPaths the relative transforms from each path to its immediate
+                       parent.
+  @param tolerance the change in any element of a pose's homogeneous matrix
+                   below which the pose is not resent.
+  @param use_float32 if true, the transforms are sent to the browser in single
+                     precision (halving the bandwidth); the poses reported to
+                     newly-connected clients still use double precision.
+
+  @throws std::exception if `paths` and `X_ParentPaths` have different sizes
+  or if `tolerance` is negative. */
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<math::RigidTransformd>& X_ParentPaths,
+                     double tolerance = 0.0, bool use_float32 = false);
+
   /** Deletes the object at the given `path` as well as all of its children.
   See @ref meshcat_path for the detailed semantics of deletion. */
   void Delete(std::string_view path = "");
@@ -481,6 +511,27 @@ class Meshcat {
   play/pause/rewind through a series of animation frames in the visualizer. */
   void SetAnimation(const MeshcatAnimation& animation);
 
+  /** Streams a recording (written by MeshcatRecordingWriter, e.g., via
+  MeshcatVisualizer::StartRecordingToFile()) to the browser, which plays it
+  back in real time (at the recording's frame rate) starting immediately.
+
+  The file is read and sent a chunk at a time, shortly before the browser
+  needs each chunk (and only while the connections keep up), and the browser
+  discards each chunk once it has been played, so playback of long recordings
+  needs only a small, constant amount of memory on either side.  Since the
+  chunks are read after this function returns, an error reading the rest of
+  the file (e.g., a truncated file) is logged, and ends the playback at that
+  point.  Only the browsers connected when a chunk is sent receive it.
+
+  Unlike SetAnimation(), the playback has no interface element to pause or
+  rewind it; call this again to restart the playback.  The paths in the
+  recording are interpreted relative to this Meshcat's prefix (see @ref
+  meshcat_path "Meshcat paths"); as with animations, the objects that they
+  move must be sent to the visualizer separately.
+  @throws std::exception if the file cannot be opened or is not a
+  recording. */
+  void PlayRecording(const std::string& filename);
+
   /** @name Meshcat Controls
    Meshcat "Controls" are user interface elements in the browser.  These
    currently include buttons and sliders.
@@ -0,0 +1,279 @@
+#include "drake/geometry/meshcat_recording.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+constexpr char kMagic[8] = {'D', 'R', 'K', 'M', 'C', 'R', 'E', 'C'};
+constexpr int32_t kVersion = 1;
+
+using Pose = Eigen::Matrix<double, 7, 1>;
+
+// Writes `value` in little-endian byte order.
+template <typename T>
+void WriteValue(std::ostream* out, T value) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+  using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+  Bits bits;
+  std::memcpy(&bits, &value, sizeof(T));
+  char bytes[sizeof(T)];
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    bytes[i] = static_cast<char>((bits >> (8 * i)) & 0xFF);
+  }
+  out->write(bytes, sizeof(T));
+}
+
+// Reads a little-endian `T`; returns false at the end of the stream.
+template <typename T>
+bool ReadValue(std::istream* in, T* value) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+  using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+  unsigned char bytes[sizeof(T)];
+  if (!in->read(reinterpret_cast<char*>(bytes), sizeof(T))) {
+    return false;
+  }
+  Bits bits = 0;
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    bits |= static_cast<Bits>(bytes[i]) << (8 * i);
+  }
+  std::memcpy(value, &bits, sizeof(T));
+  return true;
+}
+
+Pose MakePose(const math::RigidTransformd& X) {
+  const Eigen::Quaterniond q = X.rotation().ToQuaternion();
+  Pose pose;
+  pose << X.translation(), q.w(), q.x(), q.y(), q.z();
+  return pose;
+}
+
+}  // namespace
+
+MeshcatRecordingWriter::MeshcatRecordingWriter(const std::string& filename,
+                                               double frames_per_second,
+                                               int frames_per_chunk)
+    : out_(filename, std::ios::binary | std::ios::trunc),
+      filename_(filename),
+      frames_per_second_(frames_per_second),
+      frames_per_chunk_(frames_per_chunk) {
+  DRAKE_THROW_UNLESS(frames_per_second > 0.0);
+  DRAKE_THROW_UNLESS(frames_per_chunk >= 1);
+  if (!out_) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatRecordingWriter: could not open '{}' for writing", filename));
+  }
+  out_.write(kMagic, sizeof(kMagic));
+  WriteValue<int32_t>(&out_, kVersion);
+  WriteValue<double>(&out_, frames_per_second_);
+  WriteValue<int32_t>(&out_, frames_per_chunk_);
+  ThrowIfWriteFailed();
+}
+
+MeshcatRecordingWriter::~MeshcatRecordingWriter() {
+  // Destructors must not throw, so we can only report the error.
+  try {
+    WriteChunk();
+    out_.flush();
+    ThrowIfWriteFailed();
+  } catch (const std::exception& e) {
+    drake::log()->error("{}", e.what());
+  }
+}
+
+void MeshcatRecordingWriter::SetTransform(
+    int frame, const std::string& path,
+    const math::RigidTransformd& X_ParentPath) {
+  if (frame < min_frame_) {
+    throw std::logic_error(fmt::format(
+        "MeshcatRecordingWriter::SetTransform: frame {} precedes the earliest "
+        "frame that can still be recorded ({})",
+        frame, min_frame_));
+  }
+  const int first_frame = frame - frame % frames_per_chunk_;
+  if (chunk_first_frame_.has_value() && first_frame != *chunk_first_frame_) {
+    WriteChunk();
+  }
+  chunk_first_frame_ = first_frame;
+
+  auto [iter, is_new] =
+      path_ids_.emplace(path, static_cast<int>(path_ids_.size()));
+  if (is_new) {
+    pending_paths_.push_back(path);
+  }
+  Track& track = tracks_[iter->second];
+  if (!track.frames.empty() && track.frames.back() >= frame) {
+    if (track.frames.back() > frame) {
+      throw std::logic_error(fmt::format(
+          "MeshcatRecordingWriter::SetTransform: frame {} for path {} precedes "
+          "a frame that was already recorded ({})",
+          frame, path, track.frames.back()));
+    }
+    track.poses.back() = MakePose(X_ParentPath);
+    return;
+  }
+  track.frames.push_back(frame);
+  track.poses.push_back(MakePose(X_ParentPath));
+}
+
+void MeshcatRecordingWriter::Flush() {
+  WriteChunk();
+  out_.flush();
+  ThrowIfWriteFailed();
+}
+
+void MeshcatRecordingWriter::WriteChunk() {
+  if (!chunk_first_frame_.has_value()) {
+    return;
+  }
+  const int first_frame = *chunk_first_frame_;
+  WriteValue<int32_t>(&out_, first_frame);
+  WriteValue<int32_t>(&out_, pending_paths_.size());
+  for (const std::string& path : pending_paths_) {
+    WriteValue<int32_t>(&out_, path.size());
+    out_.write(path.data(), path.size());
+  }
+  WriteValue<int32_t>(&out_, tracks_.size());
+  for (const auto& [path_id, track] : tracks_) {
+    WriteValue<int32_t>(&out_, path_id);
+    WriteValue<int32_t>(&out_, track.frames.size());
+    int previous_frame = first_frame;
+    for (int frame : track.frames) {
+      WriteValue<int32_t>(&out_, frame - previous_frame);
+      previous_frame = frame;
+    }
+    Pose reconstructed = track.poses.front();
+    for (int i = 0; i < 7; ++i) {
+      WriteValue<double>(&out_, reconstructed[i]);
+    }
+    for (size_t k = 1; k < track.poses.size(); ++k) {
+      for (int i = 0; i < 7; ++i) {
+        // Encode relative to what the reader will reconstruct, so that the
+        // rounding errors do not accumulate.
+        const float delta =
+            static_cast<float>(track.poses[k][i] - reconstructed[i]);
+        WriteValue<float>(&out_, delta);
+        reconstructed[i] += delta;
+      }
+    }
+  }
+  pending_paths_.clear();
+  tracks_.clear();
+  min_frame_ = first_frame + frames_per_chunk_;
+  chunk_first_frame_ = std::nullopt;
+  ThrowIfWriteFailed();
+}
+
+void MeshcatRecordingWriter::ThrowIfWriteFailed() const {
+  if (!out_) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatRecordingWriter: could not write to '{}'", filename_));
+  }
+}
+
+MeshcatRecordingReader::MeshcatRecordingReader(const std::string& filename)
+    : in_(filename, std::ios::binary), filename_(filename) {
+  if (!in_) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatRecordingReader: could not open '{}'", filename));
+  }
+  char magic[sizeof(kMagic)];
+  int32_t version{};
+  if (!in_.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+      !ReadValue(&in_, &version) || version != kVersion ||
+      !ReadValue(&in_, &frames_per_second_) ||
+      !ReadValue(&in_, &frames_per_chunk_) || !(frames_per_second_ > 0.0) ||
+      frames_per_chunk_ < 1) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatRecordingReader: '{}' is not a Meshcat recording (version {})",
+        filename, kVersion));
+  }
+}
+
+MeshcatRecordingReader::~MeshcatRecordingReader() = default;
+
+std::optional<MeshcatRecordingReader::Chunk>
+MeshcatRecordingReader::ReadNextChunk() {
+  Chunk chunk;
+  int32_t first_frame{};
+  if (!ReadValue(&in_, &first_frame)) {
+    return std::nullopt;
+  }
+  auto corrupt = [this]() {
+    return std::runtime_error(fmt::format(
+        "MeshcatRecordingReader: '{}' is truncated or corrupt", filename_));
+  };
+  chunk.first_frame = first_frame;
+  chunk.num_frames = frames_per_chunk_;
+
+  int32_t num_new_paths{};
+  if (!ReadValue(&in_, &num_new_paths) || num_new_paths < 0) {
+    throw corrupt();
+  }
+  for (int32_t i = 0; i < num_new_paths; ++i) {
+    int32_t size{};
+    if (!ReadValue(&in_, &size) || size < 0) {
+      throw corrupt();
+    }
+    std::string path(size, '\0');
+    if (!in_.read(path.data(), size)) {
+      throw corrupt();
+    }
+    paths_.push_back(std::move(path));
+  }
+
+  int32_t num_tracks{};
+  if (!ReadValue(&in_, &num_tracks) || num_tracks < 0) {
+    throw corrupt();
+  }
+  chunk.tracks.resize(num_tracks);
+  for (Track& track : chunk.tracks) {
+    int32_t path_id{};
+    int32_t num_samples{};
+    if (!ReadValue(&in_, &path_id) || path_id < 0 ||
+        path_id >= static_cast<int>(paths_.size()) ||
+        !ReadValue(&in_, &num_samples) || num_samples < 1) {
+      throw corrupt();
+    }
+    track.path = paths_[path_id];
+    track.frames.resize(num_samples);
+    int frame = first_frame;
+    for (int& sample_frame : track.frames) {
+      int32_t delta{};
+      if (!ReadValue(&in_, &delta)) {
+        throw corrupt();
+      }
+      frame += delta;
+      sample_frame = frame;
+    }
+    track.poses.resize(7, num_samples);
+    for (int i = 0; i < 7; ++i) {
+      if (!ReadValue(&in_, &track.poses(i, 0))) {
+        throw corrupt();
+      }
+    }
+    for (int k = 1; k < num_samples; ++k) {
+      for (int i = 0; i < 7; ++i) {
+        float delta{};
+        if (!ReadValue(&in_, &delta)) {
+          throw corrupt();
+        }
+        track.poses(i, k) = track.poses(i, k - 1) + delta;
+      }
+    }
+    track.poses.bottomRows<4>().colwise().normalize();
+  }
+  return chunk;
+}
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+
+/** Writes poses to a file in a compact, columnar, binary recording format.
+Unlike MeshcatAnimation (which keeps every frame in memory and is sent to the
+browser as a single message), a recording is written to disk a chunk at a time
+while the simulation runs, and is read back by MeshcatRecordingReader (and
+streamed to the browser by Meshcat::PlayRecording()) a chunk at a time, so
+that neither side's memory grows with the length of the recording.  Only the
+current chunk is held in memory; each chunk is written to disk as soon as a
+frame from a later chunk is recorded (or upon Flush() or destruction).
+
+Frames must be recorded in non-decreasing order across chunks: once a frame
+from a later chunk has been recorded, frames from earlier chunks can no longer
+be set.  Within the current chunk, setting the same path at the same frame
+again overwrites the earlier value.
+
+The file begins with a header:
+- the eight magic bytes `DRKMCREC`,
+- int32 format version (currently 1),
+- float64 frames per second,
+- int32 frames per chunk.
+
+The header is followed by a sequence of chunks; chunk `k` holds the frames in
+the half-open range [k * frames_per_chunk, (k + 1) * frames_per_chunk).  Each
+chunk is:
+- int32 first frame,
+- int32 number of newly-defined paths, followed by each path as an int32 byte
+  count and that many bytes; paths are numbered consecutively (starting from
+  zero) in the order they are first defined in the file,
+- int32 number of tracks, followed by each track as:
+  - int32 path number,
+  - int32 number of samples n,
+  - n x int32 frame numbers, delta-encoded (the first is relative to the
+    chunk's first frame, each subsequent one is relative to its predecessor),
+  - 7 x float64 keyframe pose (x, y, z, qw, qx, qy, qz),
+  - (n - 1) x 7 x float32 pose deltas, each relative to the previous
+    (reconstructed) pose.
+
+All values are little-endian.  Because each delta is computed relative to the
+reconstructed (not the exact) previous pose, float32 rounding errors do not
+accumulate within a chunk. */
+class MeshcatRecordingWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshcatRecordingWriter)
+
+  /** Creates (or overwrites) the recording file and writes its header.
+  @param filename the file to write.
+  @param frames_per_second the rate at which the frames are played back.
+  @param frames_per_chunk the number of frames in each chunk of the file.
+  @throws std::exception if the file cannot be opened or written, if
+  `frames_per_second` is not positive, or if `frames_per_chunk` is less than
+  one. */
+  explicit MeshcatRecordingWriter(const std::string& filename,
+                                  double frames_per_second = 32.0,
+                                  int frames_per_chunk = 64);
+
+  /** Flushes the current chunk and closes the file. Since a destructor cannot
+  throw, a failure to write is only logged; call Flush() first to detect it. */
+  ~MeshcatRecordingWriter();
+
+  /** Returns the frame rate at which the recording will be played back. */
+  double frames_per_second() const { return frames_per_second_; }
+
+  /** Returns the number of frames in each chunk. */
+  int frames_per_chunk() const { return frames_per_chunk_; }
+
+  /** Uses the frame rate to convert from time to the frame number, using
+  std::floor.
+  @pre `time` ≥ 0. */
+  int frame(double time) const {
+    DRAKE_DEMAND(time >= 0.0);
+    return static_cast<int>(std::floor(time * frames_per_second_));
+  }
+
+  /** Records the RigidTransform at `frame` for the given `path`.
+  @see MeshcatAnimation::SetTransform.
+  @throws std::exception if `frame` is negative, precedes the current chunk, or
+  precedes a frame previously recorded for `path` in the current chunk, or if
+  writing the previous chunk to disk fails. */
+  void SetTransform(int frame, const std::string& path,
+                    const math::RigidTransformd& X_ParentPath);
+
+  /** Writes the current chunk (if any) to disk. Subsequent frames must belong
+  to a later chunk.
+  @throws std::exception if writing to the file fails. */
+  void Flush();
+
+ private:
+  // The samples of one path within the current chunk.
+  struct Track {
+    std::vector<int> frames;
+    std::vector<Eigen::Matrix<double, 7, 1>> poses;
+  };
+
+  void WriteChunk();
+  void ThrowIfWriteFailed() const;
+
+  std::ofstream out_;
+  const std::string filename_;
+  const double frames_per_second_;
+  const int frames_per_chunk_;
+  // The path numbers assigned so far, and the paths (in the order of their
+  // numbers) that have not been defined in the file yet.
+  std::map<std::string, int> path_ids_;
+  std::vector<std::string> pending_paths_;
+  // The first frame of the current chunk, or std::nullopt if no frames have
+  // been recorded since the last chunk was written.
+  std::optional<int> chunk_first_frame_;
+  // The first frame that may still be recorded.
+  int min_frame_{0};
+  // Tracks of the current chunk, by path number.
+  std::map<int, Track> tracks_;
+};
+
+/** Reads a file written by MeshcatRecordingWriter (see there for the file
+format), one chunk at a time. */
+class MeshcatRecordingReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshcatRecordingReader)
+
+  /** The decoded samples of one path within a chunk. */
+  struct Track {
+    /** The path, as it was passed to MeshcatRecordingWriter::SetTransform. */
+    std::string path;
+    /** The frame number of each sample, in increasing order. */
+    std::vector<int> frames;
+    /** The pose of each sample, one per column, as (x, y, z, qw, qx, qy, qz).
+    The quaternions are normalized. */
+    Eigen::Matrix<double, 7, Eigen::Dynamic> poses;
+  };
+
+  /** The decoded contents of one chunk. */
+  struct Chunk {
+    /** The first frame that may appear in this chunk. */
+    int first_frame{};
+    /** The number of frames spanned by this chunk. */
+    int num_frames{};
+    /** The tracks of the paths that were set within this chunk. */
+    std::vector<Track> tracks;
+  };
+
+  /** Opens the recording file and reads its header.
+  @throws std::exception if the file cannot be opened or is not a recording. */
+  explicit MeshcatRecordingReader(const std::string& filename);
+
+  ~MeshcatRecordingReader();
+
+  /** Returns the frame rate at which the recording should be played back. */
+  double frames_per_second() const { return frames_per_second_; }
+
+  /** Returns the number of frames in each chunk. */
+  int frames_per_chunk() const { return frames_per_chunk_; }
+
+  /** Reads and decodes the next chunk, or returns std::nullopt at the end of
+  the file.
+  @throws std::exception if the file is corrupt. */
+  std::optional<Chunk> ReadNextChunk();
+
+ private:
+  std::ifstream in_;
+  std::string filename_;
+  double frames_per_second_{};
+  int frames_per_chunk_{};
+  std::vector<std::string> paths_;
+};
+
+}  // namespace geometry
+}  // namespace drake
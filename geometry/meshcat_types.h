@@ -367,6 +367,39 @@ struct SetTransformData {
   MSGPACK_DEFINE_MAP(type, path, matrix);
 };
 
+// Note that this struct is unique to Drake's integration of meshcat; it is not
+// part of upstream meshcat.js. We handle it within meshcat.html by unpacking
+// it into one "set_transform" command per path. The `matrices` are the
+// column-major 4x4 matrices of all paths, concatenated and packed as raw
+// little-endian bytes (of either "float32" or "float64", per the `dtype`).
+struct SetTransformsData {
+  std::string type{"set_transforms"};
+  std::vector<std::string> paths;
+  std::string dtype{"float64"};
+  std::vector<char> matrices;
+  MSGPACK_DEFINE_MAP(type, paths, dtype, matrices);
+};
+
+// Note that this struct is unique to Drake's integration of meshcat; it is not
+// part of upstream meshcat.js. It carries one chunk of a MeshcatRecordingReader
+// recording; meshcat.html buffers the chunks and plays them back in real time.
+// The samples of path[i] are the next counts[i] entries of `frames` (the frame
+// numbers) and of `poses` (the (x, y, z, qw, qx, qy, qz) float64 values of each
+// sample, packed as raw little-endian bytes).
+struct RecordingChunkData {
+  std::string type{"recording_chunk"};
+  bool reset{false};
+  double fps{};
+  int first_frame{};
+  int num_frames{};
+  std::vector<std::string> paths;
+  std::vector<int> counts;
+  std::vector<int> frames;
+  std::vector<char> poses;
+  MSGPACK_DEFINE_MAP(type, reset, fps, first_frame, num_frames, paths, counts,
+                     frames, poses);
+};
+
 // Note that this struct is unique to Drake's integration of meshcat; it is not
 // part of upstream meshcat.js. We handle it directly within meshcat.html,
 // without ever feeding it into meshcat.js.
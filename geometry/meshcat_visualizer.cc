@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -55,6 +56,16 @@ void MeshcatVisualizer<T>::Delete() const {
   version_ = GeometryVersion();
 }
 
+template <typename T>
+void MeshcatVisualizer<T>::StartRecordingToFile(
+    const std::string& filename, bool set_transforms_while_recording) {
+  recording_writer_.reset();
+  recording_writer_ = std::make_unique<MeshcatRecordingWriter>(
+      filename, 1.0 / params_.publish_period);
+  recording_ = true;
+  set_transforms_while_recording_ = set_transforms_while_recording;
+}
+
 template <typename T>
 void MeshcatVisualizer<T>::PublishRecording() const {
   meshcat_->SetAnimation(*animation_);
@@ -170,18 +181,35 @@ template <typename T>
 void MeshcatVisualizer<T>::SetTransforms(
     const systems::Context<T>& context,
     const QueryObject<T>& query_object) const {
+  const bool send = !recording_ || set_transforms_while_recording_;
+  std::vector<std::string> paths;
+  std::vector<math::RigidTransformd> X_WFs;
+  if (send) {
+    paths.reserve(dynamic_frames_.size());
+    X_WFs.reserve(dynamic_frames_.size());
+  }
   for (const auto& [frame_id, path] : dynamic_frames_) {
     const math::RigidTransformd X_WF =
         internal::convert_to_double(query_object.GetPoseInWorld(frame_id));
-    if (!recording_ || set_transforms_while_recording_) {
-      meshcat_->SetTransform(path, X_WF);
+    if (send) {
+      paths.push_back(path);
+      X_WFs.push_back(X_WF);
     }
-    if (recording_) {
+    if (recording_writer_ != nullptr) {
+      recording_writer_->SetTransform(
+          recording_writer_->frame(ExtractDoubleOrThrow(context.get_time())),
+          path, X_WF);
+    } else if (recording_) {
       animation_->SetTransform(
           animation_->frame(ExtractDoubleOrThrow(context.get_time())), path,
           X_WF);
     }
   }
+  if (send) {
+    // Send all of the poses to Meshcat as a single message.
+    meshcat_->SetTransforms(paths, X_WFs, params_.transform_tolerance,
+                            params_.use_float32_transforms);
+  }
 }
 
 template <typename T>
@@ -7,6 +7,7 @@
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/meshcat.h"
 #include "drake/geometry/meshcat_animation.h"
+#include "drake/geometry/meshcat_recording.h"
 #include "drake/geometry/meshcat_visualizer_params.h"
 #include "drake/geometry/rgba.h"
 #include "drake/geometry/scene_graph.h"
@@ -91,12 +92,31 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
   MeshcatAnimation* StartRecording(bool set_transforms_while_recording = true) {
     recording_ = true;
     set_transforms_while_recording_ = set_transforms_while_recording;
+    recording_writer_.reset();
     return get_mutable_recording();
   }
 
+  /** Like StartRecording(), but subsequent publish events are recorded to the
+  file `filename` (using MeshcatRecordingWriter, at a frame rate of 1 /
+  publish_period) instead of into the in-memory MeshcatAnimation.  The file is
+  written incrementally, so memory use does not grow with the length of the
+  recording; use Meshcat::PlayRecording() to play it back.  Frames are recorded
+  at the index MeshcatRecordingWriter::frame(context.get_time()), so a
+  recording to a file cannot go back in time (e.g., by resetting the
+  simulation); start a new file instead.
+
+  @param set_transforms_while_recording see StartRecording().
+  @throws std::exception if the file cannot be opened. */
+  void StartRecordingToFile(const std::string& filename,
+                            bool set_transforms_while_recording = true);
+
   /** Sets a flag to pause/stop recording.  When stopped, publish events will
-  not add frames to the animation. */
-  void StopRecording() { recording_ = false; }
+  not add frames to the animation.  When recording to a file, the file is
+  completed and closed. */
+  void StopRecording() {
+    recording_ = false;
+    recording_writer_.reset();
+  }
 
   /** Sends the recording to Meshcat as an animation. The published animation
   only includes transforms and properties; the objects that they modify must be
@@ -209,6 +229,10 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
    * can be added to it during Publish events. */
   mutable std::unique_ptr<MeshcatAnimation> animation_;
 
+  /* The file being recorded to (if any) when recording_ is true; it is
+  mutable for the same reason as animation_. */
+  mutable std::unique_ptr<MeshcatRecordingWriter> recording_writer_;
+
   /* Recording status.  True means that each new Publish event will record a
   frame in the animation. */
   bool recording_{false};
@@ -20,6 +20,8 @@ struct MeshcatVisualizerParams {
     a->Visit(DRAKE_NVP(default_color));
     a->Visit(DRAKE_NVP(prefix));
     a->Visit(DRAKE_NVP(delete_on_initialization_event));
+    a->Visit(DRAKE_NVP(transform_tolerance));
+    a->Visit(DRAKE_NVP(use_float32_transforms));
   }
 
   /** The duration (in simulation seconds) between attempts to update poses in
@@ -46,6 +48,16 @@ struct MeshcatVisualizerParams {
    simulation. See @ref declare_initialization_events "Declare initialization
    events" for more information. */
   bool delete_on_initialization_event{true};
+
+  /** A frame's pose is only sent to Meshcat when some element of its
+   homogeneous transform matrix has changed by at least this much since it was
+   last sent. The default of zero sends every pose on every publish. See
+   Meshcat::SetTransforms() for details. */
+  double transform_tolerance{0.0};
+
+  /** If true, the poses are sent to the browser in single precision, which
+   halves the bandwidth used by each publish. */
+  bool use_float32_transforms{false};
 };
 
 }  // namespace geometry
@@ -1,14 +1,18 @@
 #include "drake/geometry/optimization/graph_of_convex_sets.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "drake/common/random.h"
 #include "drake/math/quadratic_form.h"
+#include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/create_cost.h"
 #include "drake/solvers/solve.h"
 
@@ -318,6 +322,51 @@ std::set<EdgeId> GraphOfConvexSets::PreprocessShortestPath(
     edge_count++;
   }
 
+  // An edge (u,v) can only be on a path if u is reachable from the source and
+  // the target is reachable from v. These edges are found by a graph search,
+  // so that the (much more expensive) program below is only solved for the
+  // remaining edges.
+  std::vector<const Edge*> edges;
+  for (const auto& [edge_id, e] : edges_) {
+    edges.push_back(e.get());
+  }
+  auto reachable = [&edges, &unusable_edges](
+                       VertexId start,
+                       const std::map<VertexId, std::vector<int>>& adjacent,
+                       bool forward) {
+    std::set<VertexId> visited{start};
+    std::vector<VertexId> stack{start};
+    while (!stack.empty()) {
+      const VertexId vertex_id = stack.back();
+      stack.pop_back();
+      auto it = adjacent.find(vertex_id);
+      if (it == adjacent.end()) {
+        continue;
+      }
+      for (int edge_index : it->second) {
+        const Edge* e = edges[edge_index];
+        if (unusable_edges.count(e->id()) > 0) {
+          continue;
+        }
+        const VertexId next = forward ? e->v().id() : e->u().id();
+        if (visited.insert(next).second) {
+          stack.push_back(next);
+        }
+      }
+    }
+    return visited;
+  };
+  const std::set<VertexId> reachable_from_source =
+      reachable(source_id, outgoing_edges, true);
+  const std::set<VertexId> reaches_target =
+      reachable(target_id, incoming_edges, false);
+  for (const auto& [edge_id, e] : edges_) {
+    if (reachable_from_source.count(e->u().id()) == 0 ||
+        reaches_target.count(e->v().id()) == 0) {
+      unusable_edges.insert(edge_id);
+    }
+  }
+
   int nE = edges_.size();
 
   // Given an edge (u,v) check if a path from source to u and another from v to
@@ -381,6 +430,9 @@ std::set<EdgeId> GraphOfConvexSets::PreprocessShortestPath(
   }
 
   for (const auto& [edge_id, e] : edges_) {
+    if (unusable_edges.count(edge_id) > 0) {
+      continue;
+    }
     // Update bounds of conservation of flow:
     // ∑ f_in,u - ∑ f_out,u = 1 - δ(is_source).
     if (e->u().id() == source_id) {
@@ -950,6 +1002,14 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
   result.set_decision_variable_index(decision_variable_index);
   result.set_x_val(x_val);
 
+  if (options.convex_relaxation && options.max_rounded_paths > 0 &&
+      result.is_success()) {
+    std::optional<MathematicalProgramResult> rounded_result = SolveRoundedPaths(
+        SamplePaths(source_id, target_id, result, options), options);
+    if (rounded_result.has_value()) {
+      return std::move(*rounded_result);
+    }
+  }
   return result;
 }
 
@@ -987,6 +1047,281 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
   return SolveShortestPath(source.id(), target.id(), options);
 }
 
+std::vector<std::vector<const Edge*>> GraphOfConvexSets::SamplePaths(
+    VertexId source_id, VertexId target_id,
+    const MathematicalProgramResult& relaxed_result,
+    const GraphOfConvexSetsOptions& options) const {
+  std::map<VertexId, std::vector<std::pair<const Edge*, double>>> flows;
+  std::vector<EdgeId> required_edges;
+  for (const auto& [edge_id, e] : edges_) {
+    const double phi = relaxed_result.GetSolution(e->phi_);
+    if (phi > options.flow_tolerance) {
+      flows[e->u().id()].emplace_back(e.get(), phi);
+    }
+    if (e->phi_value_.value_or(false)) {
+      required_edges.push_back(edge_id);
+    }
+  }
+
+  RandomGenerator generator(options.rounding_seed);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::vector<std::vector<const Edge*>> paths;
+  std::set<std::vector<EdgeId>> sampled_edge_ids;
+  for (int trial = 0;
+       trial < options.max_rounding_trials &&
+       static_cast<int>(paths.size()) < options.max_rounded_paths;
+       ++trial) {
+    // Walk from the source, taking each outgoing edge with a probability
+    // proportional to its flow. At a dead end, back up one edge; the dead-end
+    // vertex remains visited, so it is not tried again.
+    std::vector<const Edge*> path;
+    std::set<VertexId> visited{source_id};
+    VertexId current = source_id;
+    while (current != target_id) {
+      std::vector<std::pair<const Edge*, double>> candidates;
+      double total_flow = 0;
+      for (const auto& [e, phi] : flows[current]) {
+        if (visited.count(e->v().id()) == 0) {
+          candidates.emplace_back(e, phi);
+          total_flow += phi;
+        }
+      }
+      if (candidates.empty()) {
+        if (path.empty()) {
+          break;
+        }
+        current = path.back()->u().id();
+        path.pop_back();
+        continue;
+      }
+      double sample = uniform(generator) * total_flow;
+      const Edge* next = candidates.back().first;
+      for (const auto& [e, phi] : candidates) {
+        if (sample < phi) {
+          next = e;
+          break;
+        }
+        sample -= phi;
+      }
+      path.push_back(next);
+      current = next->v().id();
+      visited.insert(current);
+    }
+    if (current != target_id) {
+      continue;
+    }
+    std::vector<EdgeId> edge_ids;
+    for (const Edge* e : path) {
+      edge_ids.push_back(e->id());
+    }
+    std::sort(edge_ids.begin(), edge_ids.end());
+    // The path must respect the edges that were added with
+    // AddPhiConstraint(true).
+    if (!std::includes(edge_ids.begin(), edge_ids.end(),
+                       required_edges.begin(), required_edges.end())) {
+      continue;
+    }
+    if (sampled_edge_ids.insert(edge_ids).second) {
+      paths.push_back(std::move(path));
+    }
+  }
+  return paths;
+}
+
+std::optional<MathematicalProgramResult> GraphOfConvexSets::SolveRoundedPaths(
+    const std::vector<std::vector<const Edge*>>& paths,
+    const GraphOfConvexSetsOptions& options) const {
+  if (paths.empty()) {
+    return std::nullopt;
+  }
+  // With ϕ fixed to one, the problem for a path only involves the vertex
+  // variables x of the vertices on that path. The costs and constraints of
+  // each vertex and edge are added to a small program once, and their bindings
+  // are then shared by the programs of all the paths through that vertex or
+  // edge. Each cost is still implemented by a slack ℓ and AddPerspectiveCost,
+  // with a ϕ that is fixed to one, so that the same costs are supported as in
+  // the relaxation.
+  struct Restriction {
+    std::unique_ptr<MathematicalProgram> prog;
+    VectorXDecisionVariable ell;
+  };
+  auto add_costs = [this](const std::vector<Binding<Cost>>& costs,
+                          Restriction* restriction) {
+    if (costs.empty()) {
+      return;
+    }
+    MathematicalProgram* prog = restriction->prog.get();
+    const Variable phi = prog->NewContinuousVariables<1>("phi")[0];
+    prog->AddBoundingBoxConstraint(1, 1, phi);
+    restriction->ell = prog->NewContinuousVariables(costs.size(), "ell");
+    prog->AddLinearCost(VectorXd::Ones(costs.size()), restriction->ell);
+    for (int i = 0; i < static_cast<int>(costs.size()); ++i) {
+      const VectorXDecisionVariable& old_vars = costs[i].variables();
+      VectorXDecisionVariable vars(old_vars.size() + 2);
+      // vars = [phi; ell; x_vars]
+      vars << phi, restriction->ell[i], old_vars;
+      AddPerspectiveCost(prog, costs[i], vars);
+    }
+  };
+  std::map<VertexId, Restriction> vertex_restrictions;
+  std::map<EdgeId, Restriction> edge_restrictions;
+  for (const std::vector<const Edge*>& path : paths) {
+    std::vector<const Vertex*> path_vertices{&path.front()->u()};
+    for (const Edge* e : path) {
+      path_vertices.push_back(&e->v());
+    }
+    for (const Vertex* v : path_vertices) {
+      Restriction& restriction = vertex_restrictions[v->id()];
+      if (restriction.prog != nullptr) {
+        continue;
+      }
+      restriction.prog = std::make_unique<MathematicalProgram>();
+      restriction.prog->AddDecisionVariables(v->x());
+      v->set().AddPointInSetConstraints(restriction.prog.get(), v->x());
+      for (const Binding<Constraint>& b : v->constraints_) {
+        restriction.prog->AddConstraint(b);
+      }
+      add_costs(v->costs_, &restriction);
+    }
+    for (const Edge* e : path) {
+      Restriction& restriction = edge_restrictions[e->id()];
+      if (restriction.prog != nullptr) {
+        continue;
+      }
+      restriction.prog = std::make_unique<MathematicalProgram>();
+      restriction.prog->AddDecisionVariables(e->u().x());
+      if (e->v().id() != e->u().id()) {
+        restriction.prog->AddDecisionVariables(e->v().x());
+      }
+      for (const Binding<Constraint>& b : e->constraints_) {
+        restriction.prog->AddConstraint(b);
+      }
+      add_costs(e->costs_, &restriction);
+    }
+  }
+
+  // Assemble the program for each path from the shared bindings.
+  std::vector<std::unique_ptr<MathematicalProgram>> progs;
+  for (const std::vector<const Edge*>& path : paths) {
+    auto prog = std::make_unique<MathematicalProgram>();
+    auto add_restriction = [&prog](const MathematicalProgram& restriction) {
+      for (int i = 0; i < restriction.num_vars(); ++i) {
+        const Variable& var = restriction.decision_variable(i);
+        if (prog->decision_variable_index().count(var.get_id()) == 0) {
+          prog->AddDecisionVariables(Vector1<Variable>(var));
+        }
+      }
+      for (const Binding<Constraint>& b : restriction.GetAllConstraints()) {
+        prog->AddConstraint(b);
+      }
+      for (const Binding<Cost>& b : restriction.GetAllCosts()) {
+        prog->AddCost(b);
+      }
+    };
+    add_restriction(*vertex_restrictions.at(path.front()->u().id()).prog);
+    for (const Edge* e : path) {
+      add_restriction(*vertex_restrictions.at(e->v().id()).prog);
+      add_restriction(*edge_restrictions.at(e->id()).prog);
+    }
+    progs.push_back(std::move(prog));
+  }
+
+  std::vector<MathematicalProgramResult> results(progs.size());
+  if (options.solver != nullptr && solvers::GetKnownSolvers().count(
+                                       options.solver->solver_id()) == 0) {
+    // SolveInParallel() can only make new instances of the known solvers, so
+    // any other solver is used as given, one path at a time.
+    for (int i = 0; i < static_cast<int>(progs.size()); ++i) {
+      options.solver->Solve(*progs[i], {}, options.solver_options,
+                            &results[i]);
+    }
+  } else {
+    std::vector<const MathematicalProgram*> prog_ptrs;
+    for (const auto& prog : progs) {
+      prog_ptrs.push_back(prog.get());
+    }
+    const std::vector<std::optional<solvers::SolverOptions>> solver_options(
+        progs.size(), options.solver_options);
+    std::optional<solvers::SolverId> solver_id;
+    if (options.solver) {
+      solver_id = options.solver->solver_id();
+    }
+    results = solvers::SolveInParallel(prog_ptrs, nullptr, &solver_options,
+                                       solver_id, options.num_threads);
+  }
+
+  std::optional<int> best;
+  for (int i = 0; i < static_cast<int>(paths.size()); ++i) {
+    if (results[i].is_success() &&
+        (!best.has_value() || results[i].get_optimal_cost() <
+                                  results[*best].get_optimal_cost())) {
+      best = i;
+    }
+  }
+  if (!best.has_value()) {
+    return std::nullopt;
+  }
+
+  // Push the placeholder variables into the result, so that they can be
+  // accessed as in the result of the relaxation. The vertices that are not on
+  // the path have NaN solutions, and the edges that are not on the path have
+  // ϕ = 0.
+  MathematicalProgramResult result = std::move(results[*best]);
+  const std::vector<const Edge*>& path = paths[*best];
+  std::unordered_map<symbolic::Variable::Id, int> decision_variable_index =
+      progs[*best]->decision_variable_index();
+  std::vector<double> values(
+      result.get_x_val().data(),
+      result.get_x_val().data() + result.get_x_val().size());
+  auto push_value = [&decision_variable_index, &values](const Variable& var,
+                                                        double value) {
+    if (decision_variable_index.emplace(var.get_id(), values.size()).second) {
+      values.push_back(value);
+    }
+  };
+  std::set<VertexId> path_vertex_ids{path.front()->u().id()};
+  for (const Edge* e : path) {
+    path_vertex_ids.insert(e->v().id());
+  }
+  for (const auto& [vertex_id, v] : vertices_) {
+    // The vertex variables on the path are already in the result.
+    for (int i = 0; i < v->ambient_dimension(); ++i) {
+      push_value(v->x()[i], std::numeric_limits<double>::quiet_NaN());
+    }
+    const bool on_path = path_vertex_ids.count(vertex_id) > 0;
+    for (int i = 0; i < v->ell_.size(); ++i) {
+      push_value(v->ell_[i],
+                 on_path ? result.GetSolution(
+                               vertex_restrictions.at(vertex_id).ell[i])
+                         : 0.0);
+    }
+  }
+  for (const auto& [edge_id, e] : edges_) {
+    const bool on_path =
+        std::find(path.begin(), path.end(), e.get()) != path.end();
+    const VectorXd y = on_path ? result.GetSolution(e->u().x())
+                               : VectorXd::Zero(e->y_.size());
+    const VectorXd z = on_path ? result.GetSolution(e->v().x())
+                               : VectorXd::Zero(e->z_.size());
+    for (int i = 0; i < e->y_.size(); ++i) {
+      push_value(e->y_[i], y[i]);
+    }
+    for (int i = 0; i < e->z_.size(); ++i) {
+      push_value(e->z_[i], z[i]);
+    }
+    for (int i = 0; i < e->ell_.size(); ++i) {
+      const double ell =
+          on_path ? result.GetSolution(edge_restrictions.at(edge_id).ell[i])
+                  : 0.0;
+      push_value(e->ell_[i], ell);
+    }
+    push_value(e->phi_, on_path ? 1.0 : 0.0);
+  }
+  result.set_decision_variable_index(decision_variable_index);
+  result.set_x_val(Eigen::Map<const VectorXd>(values.data(), values.size()));
+  return result;
+}
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
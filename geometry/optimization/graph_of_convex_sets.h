@@ -33,9 +33,37 @@ struct GraphOfConvexSetsOptions {
 
   /** Performs a preprocessing step to remove edges that cannot lie on the
   path from source to target. In most cases, preprocessing causes a net
-  reduction in computation by reducing the size of the optimization solved. */
+  reduction in computation by reducing the size of the optimization solved.
+  Edges that are not reachable from the source, or from which the target is not
+  reachable, are found by a graph search; a small linear program is solved only
+  for each of the remaining edges. */
   bool preprocessing{true};
 
+  /** The maximum number of distinct paths to compare after solving the convex
+  relaxation. When convex_relaxation is true and max_rounded_paths > 0, paths
+  from source to target are sampled by random walks that take each outgoing
+  edge with probability proportional to its relaxed flow ϕ. For each distinct
+  path, the convex problem with the path fixed is solved, and the solution
+  with the smallest cost is returned. If none of these problems can be solved,
+  then the solution of the convex relaxation is returned. */
+  int max_rounded_paths{0};
+
+  /** The maximum number of random walks used to sample the rounded paths. */
+  int max_rounding_trials{100};
+
+  /** The random walks do not take edges whose relaxed flow ϕ is smaller than
+  this tolerance. */
+  double flow_tolerance{1e-5};
+
+  /** The seed for the random walks that sample the rounded paths. */
+  int rounding_seed{0};
+
+  /** The maximum number of threads used to solve the convex problems of the
+  rounded paths concurrently. See solvers::SolveInParallel(). If `solver` is
+  set to a solver that is not one of solvers::GetKnownSolvers(), then that
+  solver is used for one rounded path at a time instead. */
+  int num_threads{1};
+
   /** Optimizer to be used to solve the shortest path optimization problem. If
   not set, the best solver for the given problem is selected. Note that if the
   solver cannot handle the type of optimization problem generated, the calling
@@ -526,6 +554,20 @@ class GraphOfConvexSets {
   std::set<EdgeId> PreprocessShortestPath(VertexId source_id,
                                           VertexId target_id) const;
 
+  // Samples up to options.max_rounded_paths distinct paths from source to
+  // target by random walks on the relaxed flows in `relaxed_result`.
+  std::vector<std::vector<const Edge*>> SamplePaths(
+      VertexId source_id, VertexId target_id,
+      const solvers::MathematicalProgramResult& relaxed_result,
+      const GraphOfConvexSetsOptions& options) const;
+
+  // Solves the convex problem obtained by fixing ϕ = 1 on each of the `paths`
+  // (and ϕ = 0 on every other edge), and returns the result with the smallest
+  // cost, or nullopt if none of the problems was solved successfully.
+  std::optional<solvers::MathematicalProgramResult> SolveRoundedPaths(
+      const std::vector<std::vector<const Edge*>>& paths,
+      const GraphOfConvexSetsOptions& options) const;
+
   // Adds a perspective constraint to the mathematical program to upper bound
   // the cost below a slack variable, ℓ. Specifically given a cost g(x) to
   // minimize, this method implements it with a slack variable and a constraint:
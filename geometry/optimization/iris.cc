@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
@@ -9,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/symbolic/expression.h"
 #include "drake/geometry/optimization/cartesian_product.h"
 #include "drake/geometry/optimization/convex_set.h"
@@ -320,6 +323,18 @@ class SamePointConstraint : public Constraint {
   std::unique_ptr<Context<Expression>> symbolic_context_{nullptr};
 };
 
+// Solves `prog` with `solver`, holding `solver_mutex` (if non-null) during the
+// solve.
+void SolveWithLock(const solvers::SolverInterface& solver,
+                   std::mutex* solver_mutex, const MathematicalProgram& prog,
+                   solvers::MathematicalProgramResult* result) {
+  std::unique_lock<std::mutex> lock;
+  if (solver_mutex != nullptr) {
+    lock = std::unique_lock<std::mutex>(*solver_mutex);
+  }
+  solver.Solve(prog, std::nullopt, std::nullopt, result);
+}
+
 // Solves the optimization
 // min_q (q-d)*CᵀC(q-d)
 // s.t. setA in frameA and setB in frameB are in collision in q.
@@ -327,6 +342,7 @@ class SamePointConstraint : public Constraint {
 // where C, d are the matrix and center from the hyperellipsoid E.
 // Returns true iff a collision is found.
 // Sets `closest` to an optimizing solution q*, if a solution is found.
+// If `solver_mutex` is non-null, it is locked while solving.
 bool FindClosestCollision(
     std::shared_ptr<SamePointConstraint> same_point_constraint,
     const multibody::Frame<double>& frameA,
@@ -334,7 +350,7 @@ bool FindClosestCollision(
     const ConvexSet& setB, const Hyperellipsoid& E,
     const Eigen::Ref<const Eigen::MatrixXd>& A,
     const Eigen::Ref<const Eigen::VectorXd>& b,
-    const solvers::SolverInterface& solver,
+    const solvers::SolverInterface& solver, std::mutex* solver_mutex,
     const Eigen::Ref<const Eigen::VectorXd>& q_guess, VectorXd* closest) {
   MathematicalProgram prog;
   auto q = prog.NewContinuousVariables(A.cols(), "q");
@@ -384,7 +400,7 @@ bool FindClosestCollision(
   }
 
   solvers::MathematicalProgramResult result;
-  solver.Solve(prog, std::nullopt, std::nullopt, &result);
+  SolveWithLock(solver, solver_mutex, prog, &result);
   if (result.is_success()) {
     *closest = result.GetSolution(q);
     return true;
@@ -483,11 +499,12 @@ class CounterExampleConstraint : public Constraint {
 // where C, d are the matrix and center from the hyperellipsoid E.
 // Returns true iff a counter-example is found.
 // Sets `closest` to an optimizing solution q*, if a solution is found.
+// If `solver_mutex` is non-null, it is locked while solving.
 bool FindCounterExample(
     std::shared_ptr<CounterExampleConstraint> counter_example_constraint,
     const Hyperellipsoid& E, const Eigen::Ref<const Eigen::MatrixXd>& A,
     const Eigen::Ref<const Eigen::VectorXd>& b,
-    const solvers::SolverInterface& solver,
+    const solvers::SolverInterface& solver, std::mutex* solver_mutex,
     const Eigen::Ref<const Eigen::VectorXd>& q_guess, VectorXd* closest) {
   MathematicalProgram prog;
   auto q = prog.NewContinuousVariables(A.cols(), "q");
@@ -508,7 +525,7 @@ bool FindCounterExample(
   prog.SetInitialGuess(q, q_guess);
 
   solvers::MathematicalProgramResult result;
-  solver.Solve(prog, std::nullopt, std::nullopt, &result);
+  SolveWithLock(solver, solver_mutex, prog, &result);
   if (result.is_success()) {
     *closest = result.GetSolution(q);
     return true;
@@ -557,44 +574,22 @@ struct GeometryPairWithDistance {
   }
 };
 
-}  // namespace
+using RowMajorMatrixXd =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
 
-HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
-                                     const Context<double>& context,
-                                     const IrisOptions& options) {
-  // Check the inputs.
-  plant.ValidateContext(context);
-  const int nq = plant.num_positions();
-  const Eigen::VectorXd sample = plant.GetPositions(context);
-  // Note: We require finite joint limits to define the bounding box for the
-  // IRIS algorithm.
-  DRAKE_DEMAND(plant.GetPositionLowerLimits().array().isFinite().all());
-  DRAKE_DEMAND(plant.GetPositionUpperLimits().array().isFinite().all());
-
-  // We don't yet support Ibex when the user has defined additional constraints.
-  // It wouldn't be hard to support this, but it would require that all
-  // constraints passed in support symbolic, and most kinematic constraints do
-  // not (yet).
-  DRAKE_DEMAND(options.prog_with_additional_constraints == nullptr ||
-               options.enable_ibex == false);
-  if (options.prog_with_additional_constraints) {
-    DRAKE_DEMAND(options.prog_with_additional_constraints->num_vars() == nq);
-  }
-
-  // Make the polytope and ellipsoid.
-  HPolyhedron P = HPolyhedron::MakeBox(plant.GetPositionLowerLimits(),
-                                       plant.GetPositionUpperLimits());
-  DRAKE_DEMAND(P.A().rows() == 2 * nq);
-  const double kEpsilonEllipsoid = 1e-2;
-  Hyperellipsoid E = Hyperellipsoid::MakeHypersphere(kEpsilonEllipsoid, sample);
+// The convex sets (in their geometry frames) and the body frames of all of the
+// proximity geometries; neither depends on the positions of the plant.
+struct CollisionGeometries {
+  std::unordered_map<GeometryId, copyable_unique_ptr<ConvexSet>> sets;
+  std::unordered_map<GeometryId, const multibody::Frame<double>*> frames;
+};
 
-  // Make all of the convex sets and supporting quantities.
-  auto query_object =
-      plant.get_geometry_query_input_port().Eval<QueryObject<double>>(context);
+CollisionGeometries MakeCollisionGeometries(
+    const MultibodyPlant<double>& plant,
+    const QueryObject<double>& query_object) {
   const SceneGraphInspector<double>& inspector = query_object.inspector();
   IrisConvexSetMaker maker(query_object, inspector.world_frame_id());
-  std::unordered_map<GeometryId, copyable_unique_ptr<ConvexSet>> sets{};
-  std::unordered_map<GeometryId, const multibody::Frame<double>*> frames{};
+  CollisionGeometries geometries;
   const std::unordered_set<GeometryId> geom_ids = inspector.GetGeometryIds(
       GeometrySet(inspector.GetAllGeometryIds()), Role::kProximity);
   copyable_unique_ptr<ConvexSet> temp_set;
@@ -604,43 +599,65 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
     maker.set_reference_frame(frame_id);
     maker.set_geometry_id(geom_id);
     inspector.GetShape(geom_id).Reify(&maker, &temp_set);
-    sets.emplace(geom_id, std::move(temp_set));
-    frames.emplace(geom_id, &plant.GetBodyFromFrameId(frame_id)->body_frame());
+    geometries.sets.emplace(geom_id, std::move(temp_set));
+    geometries.frames.emplace(
+        geom_id, &plant.GetBodyFromFrameId(frame_id)->body_frame());
   }
+  return geometries;
+}
 
-  auto pairs = inspector.GetCollisionCandidates();
-  const int N = static_cast<int>(pairs.size());
-  auto same_point_constraint =
-      std::make_shared<SamePointConstraint>(&plant, context);
-
-  // As a surrogate for the true objective, the pairs are sorted by the distance
-  // between each collision pair from the sample point configuration. This could
-  // improve computation times in Ibex here and produce regions with fewer
-  // faces.
+// As a surrogate for the true objective, the pairs are sorted by the distance
+// between each collision pair from the sample point configuration. This could
+// improve computation times in Ibex here and produce regions with fewer
+// faces.
+std::vector<GeometryPairWithDistance> SortCollisionPairs(
+    const QueryObject<double>& query_object) {
   std::vector<GeometryPairWithDistance> sorted_pairs;
-  for (const auto& [geomA, geomB] : pairs) {
+  for (const auto& [geomA, geomB] :
+       query_object.inspector().GetCollisionCandidates()) {
     sorted_pairs.emplace_back(
         geomA, geomB,
         query_object.ComputeSignedDistancePairClosestPoints(geomA, geomB)
             .distance);
   }
   std::sort(sorted_pairs.begin(), sorted_pairs.end());
+  return sorted_pairs;
+}
+
+// The polytope {x | A * x <= b} that every region starts from: the joint limits
+// plus the linear constraints in options.prog_with_additional_constraints. The
+// remaining additional constraints are kept in additional_constraint_bindings.
+struct InitialPolytope {
+  RowMajorMatrixXd A;
+  VectorXd b;
+  int num_constraints{};
+  std::vector<Binding<Constraint>> additional_constraint_bindings;
+};
+
+InitialPolytope MakeInitialPolytope(const MultibodyPlant<double>& plant,
+                                    int num_pairs,
+                                    const IrisOptions& options) {
+  const int nq = plant.num_positions();
+  const HPolyhedron P = HPolyhedron::MakeBox(plant.GetPositionLowerLimits(),
+                                             plant.GetPositionUpperLimits());
+  DRAKE_DEMAND(P.A().rows() == 2 * nq);
 
   // On each iteration, we will build the collision-free polytope represented as
   // {x | A * x <= b}.  Here we pre-allocate matrices with a generous maximum
   // size.
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> A(
-      P.A().rows() + 2 * N, nq);
-  VectorXd b(P.A().rows() + 2 * N);
+  InitialPolytope initial;
+  RowMajorMatrixXd& A = initial.A;
+  VectorXd& b = initial.b;
+  int& num_initial_constraints = initial.num_constraints;
+  A.resize(P.A().rows() + 2 * num_pairs, nq);
+  b.resize(P.A().rows() + 2 * num_pairs);
   A.topRows(P.A().rows()) = P.A();
   b.head(P.A().rows()) = P.b();
-  int num_initial_constraints = P.A().rows();
+  num_initial_constraints = P.A().rows();
 
-  std::shared_ptr<CounterExampleConstraint> counter_example_constraint{};
-  std::vector<Binding<Constraint>> additional_constraint_bindings{};
   if (options.prog_with_additional_constraints) {
-    counter_example_constraint = std::make_shared<CounterExampleConstraint>(
-                options.prog_with_additional_constraints);
+    std::vector<Binding<Constraint>>& additional_constraint_bindings =
+        initial.additional_constraint_bindings;
     additional_constraint_bindings =
         options.prog_with_additional_constraints->GetAllConstraints();
     // Handle bounding box and linear constraints as a special case (extracting
@@ -685,19 +702,297 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
     HandleLinearConstraints(
         options.prog_with_additional_constraints->linear_constraints());
   }
+  return initial;
+}
+
+// The nonlinear optimizer used to find counter-examples.
+std::unique_ptr<solvers::SolverInterface> MakeCounterExampleSolver() {
+  return solvers::MakeFirstAvailableSolver(
+      {solvers::SnoptSolver::id(), solvers::IpoptSolver::id()});
+}
+
+// Checks whether the geometries A and B of a collision pair are in collision
+// at a configuration q, using the signed distance reported by SceneGraph.
+class CollisionPairChecker {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CollisionPairChecker)
+
+  CollisionPairChecker(const MultibodyPlant<double>* plant,
+                       Context<double>* root_context, GeometryId geomA,
+                       GeometryId geomB)
+      : plant_(plant),
+        plant_context_(&plant->GetMyMutableContextFromRoot(root_context)),
+        geomA_(geomA),
+        geomB_(geomB) {}
+
+  bool IsInCollision(const Eigen::Ref<const Eigen::VectorXd>& q) {
+    plant_->SetPositions(plant_context_, q);
+    const auto& query_object =
+        plant_->get_geometry_query_input_port().Eval<QueryObject<double>>(
+            *plant_context_);
+    return query_object.ComputeSignedDistancePairClosestPoints(geomA_, geomB_)
+               .distance <= 0.0;
+  }
+
+ private:
+  const MultibodyPlant<double>* const plant_;
+  Context<double>* const plant_context_;
+  const GeometryId geomA_;
+  const GeometryId geomB_;
+};
+
+// The scratch objects that one thread uses to search for collisions. The
+// SamePointConstraint owns its own Context of the plant, so that searches on
+// separate threads do not share any mutable state. The solver_mutex (if
+// non-null) is locked while solving, when other threads may be using the same
+// kind of solvers and those are not thread-safe.
+struct CollisionSearcher {
+  std::shared_ptr<SamePointConstraint> same_point_constraint;
+  std::unique_ptr<solvers::SolverInterface> solver;
+  std::unique_ptr<solvers::IbexSolver> ibex;
+  std::mutex* solver_mutex{};
+};
+
+// Searches each of the `sorted_pairs` for the closest collision in
+// {x | A * x <= b} (using Ibex iff `use_ibex`), and adds the tangent to the
+// polytope, until no more collisions are found. Unless `use_ibex`, each pair is
+// first checked at `num_collision_samples` uniform samples of the polytope
+// (drawn using a generator seeded with `sampling_seed` plus the index of the
+// pair, and collision-checked by setting the plant's positions in
+// `root_context`), and the nonlinear program is only used once the samples
+// have no collisions left. With a single searcher, the pairs are searched one
+// after another. Otherwise, each pair is searched concurrently against the
+// polytope from the start of this call plus the hyperplanes found for that
+// pair, and those hyperplanes are added in the order of the pairs. Searching
+// stops once `sample_point_requirement` is false.
+void AddCollisionHyperplanes(
+    const MultibodyPlant<double>& plant, const CollisionGeometries& geometries,
+    const std::vector<GeometryPairWithDistance>& sorted_pairs,
+    const Hyperellipsoid& E, const Eigen::Ref<const Eigen::VectorXd>& sample,
+    const IrisOptions& options, bool use_ibex, int num_collision_samples,
+    RandomGenerator::result_type sampling_seed,
+    std::vector<CollisionSearcher>* searchers, Context<double>* root_context,
+    RowMajorMatrixXd* A, VectorXd* b, int* num_constraints,
+    bool* sample_point_requirement) {
+  const bool use_samples = !use_ibex && num_collision_samples > 0;
+  // The samples are checked using the one root_context.
+  DRAKE_DEMAND(!use_samples ||
+               (root_context != nullptr && searchers->size() == 1));
+  // Adds the tangent at `point` to {x | pair_A * x <= pair_b}, and returns
+  // false iff that violates the sample point requirement.
+  auto AddTangent = [&](const Eigen::Ref<const Eigen::VectorXd>& point,
+                        RowMajorMatrixXd* pair_A, VectorXd* pair_b,
+                        int* pair_num_constraints) {
+    AddTangentToPolytope(E, point, options.configuration_space_margin, pair_A,
+                         pair_b, pair_num_constraints);
+    return !options.require_sample_point_is_contained ||
+           pair_A->row(*pair_num_constraints - 1) * sample <=
+               (*pair_b)(*pair_num_constraints - 1);
+  };
+
+  // Searches the pair with the given index, adding the hyperplanes to
+  // {x | pair_A * x <= pair_b} and (if non-null) the collisions to `found`.
+  // Returns false iff the sample point requirement was violated.
+  auto SearchPair = [&](CollisionSearcher* searcher, int pair_index,
+                        RowMajorMatrixXd* pair_A, VectorXd* pair_b,
+                        int* pair_num_constraints,
+                        std::vector<VectorXd>* found) {
+    const GeometryPairWithDistance& pair = sorted_pairs[pair_index];
+    const multibody::Frame<double>& frameA = *geometries.frames.at(pair.geomA);
+    const multibody::Frame<double>& frameB = *geometries.frames.at(pair.geomB);
+    const ConvexSet& setA = *geometries.sets.at(pair.geomA);
+    const ConvexSet& setB = *geometries.sets.at(pair.geomB);
+    auto Add = [&](const VectorXd& point) {
+      if (found != nullptr) {
+        found->push_back(point);
+      }
+      return AddTangent(point, pair_A, pair_b, pair_num_constraints);
+    };
+
+    if (use_samples) {
+      CollisionPairChecker checker(&plant, root_context, pair.geomA,
+                                   pair.geomB);
+      RandomGenerator generator(sampling_seed + pair_index);
+      const HPolyhedron P(pair_A->topRows(*pair_num_constraints),
+                          pair_b->head(*pair_num_constraints));
+      std::vector<VectorXd> collisions;
+      VectorXd previous = E.center();
+      for (int i = 0; i < num_collision_samples; ++i) {
+        previous = P.UniformSample(&generator, previous);
+        if (checker.IsInCollision(previous)) {
+          collisions.push_back(previous);
+        }
+      }
+      const bool center_is_free =
+          !collisions.empty() && !checker.IsInCollision(E.center());
+      while (!collisions.empty()) {
+        // Mimic the nonlinear program by cutting at the colliding sample
+        // closest to the center of the ellipsoid, first bisecting towards the
+        // (collision-free) center to get near the boundary of the obstacle.
+        auto closest = std::min_element(
+            collisions.begin(), collisions.end(),
+            [&E](const VectorXd& x, const VectorXd& y) {
+              return (E.A() * (x - E.center())).squaredNorm() <
+                     (E.A() * (y - E.center())).squaredNorm();
+            });
+        VectorXd in_collision = *closest;
+        if (center_is_free) {
+          VectorXd free = E.center();
+          // Bisect until we are well within the configuration space margin of
+          // the boundary (with a cap, in case the margin is zero).
+          for (int i = 0;
+               i < 30 && (in_collision - free).norm() >
+                             1e-2 * options.configuration_space_margin;
+               ++i) {
+            const VectorXd midpoint = 0.5 * (free + in_collision);
+            if (checker.IsInCollision(midpoint)) {
+              in_collision = midpoint;
+            } else {
+              free = midpoint;
+            }
+          }
+        }
+        if (!Add(in_collision)) {
+          return false;
+        }
+        // Drop the samples that have been cut away.
+        const int k = *pair_num_constraints - 1;
+        collisions.erase(
+            std::remove_if(collisions.begin(), collisions.end(),
+                           [&](const VectorXd& x) {
+                             return pair_A->row(k) * x > (*pair_b)(k);
+                           }),
+            collisions.end());
+      }
+    }
+
+    const solvers::SolverInterface& solver =
+        use_ibex ? *searcher->ibex : *searcher->solver;
+    VectorXd closest(pair_A->cols());
+    while (FindClosestCollision(
+        searcher->same_point_constraint, frameA, frameB, setA, setB, E,
+        pair_A->topRows(*pair_num_constraints),
+        pair_b->head(*pair_num_constraints), solver, searcher->solver_mutex,
+        sample, &closest)) {
+      if (!Add(closest)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  const int num_pairs = static_cast<int>(sorted_pairs.size());
+  if (searchers->size() == 1) {
+    for (int i = 0; i < num_pairs && *sample_point_requirement; ++i) {
+      *sample_point_requirement =
+          SearchPair(&searchers->front(), i, A, b, num_constraints, nullptr);
+    }
+    return;
+  }
+  if (!*sample_point_requirement) {
+    return;
+  }
+
+  // Each thread repeatedly claims the next unsearched pair, and records the
+  // collisions found for it.
+  std::vector<std::vector<VectorXd>> collisions(num_pairs);
+  drake::internal::DynamicParallelFor(
+      searchers->size(), num_pairs, [&](int thread_num, int i) {
+        RowMajorMatrixXd pair_A = A->topRows(*num_constraints);
+        VectorXd pair_b = b->head(*num_constraints);
+        int pair_num_constraints = *num_constraints;
+        SearchPair(&(*searchers)[thread_num], i, &pair_A, &pair_b,
+                   &pair_num_constraints, &collisions[i]);
+      });
+
+  for (const std::vector<VectorXd>& pair_collisions : collisions) {
+    for (const VectorXd& point : pair_collisions) {
+      *sample_point_requirement = AddTangent(point, A, b, num_constraints);
+      if (!*sample_point_requirement) {
+        return;
+      }
+    }
+  }
+}
+
+void CheckIrisInConfigurationSpaceInputs(const MultibodyPlant<double>& plant,
+                                         const IrisOptions& options) {
+  // Note: We require finite joint limits to define the bounding box for the
+  // IRIS algorithm.
+  DRAKE_DEMAND(plant.GetPositionLowerLimits().array().isFinite().all());
+  DRAKE_DEMAND(plant.GetPositionUpperLimits().array().isFinite().all());
+
+  // We don't yet support Ibex when the user has defined additional constraints.
+  // It wouldn't be hard to support this, but it would require that all
+  // constraints passed in support symbolic, and most kinematic constraints do
+  // not (yet).
+  DRAKE_DEMAND(options.prog_with_additional_constraints == nullptr ||
+               options.enable_ibex == false);
+  if (options.prog_with_additional_constraints) {
+    DRAKE_DEMAND(options.prog_with_additional_constraints->num_vars() ==
+                 plant.num_positions());
+  }
+  DRAKE_THROW_UNLESS(options.num_threads >= 1);
+}
+
+// Grows one IRIS region from `sample`, searching the collision pairs with up
+// to `num_threads` threads. The `num_collision_samples` (if any) are checked
+// using the scratch `root_context`, which must be the root context of the
+// diagram that contains the plant, and may be null iff num_collision_samples is
+// zero. When `additional_constraints_mutex` is non-null, it is locked while
+// searching for counter-examples of the additional constraints. When
+// `solver_mutex` is non-null, it is locked during every solve.
+HPolyhedron GrowRegion(
+    const MultibodyPlant<double>& plant, const Context<double>& context,
+    const CollisionGeometries& geometries,
+    const std::vector<GeometryPairWithDistance>& sorted_pairs,
+    const InitialPolytope& initial,
+    const Eigen::Ref<const Eigen::VectorXd>& sample,
+    const IrisOptions& options, int num_threads, int num_collision_samples,
+    Context<double>* root_context, std::mutex* additional_constraints_mutex,
+    std::mutex* solver_mutex) {
+  const int nq = plant.num_positions();
+
+  // Make the polytope and ellipsoid.
+  HPolyhedron P = HPolyhedron::MakeBox(plant.GetPositionLowerLimits(),
+                                       plant.GetPositionUpperLimits());
+  const double kEpsilonEllipsoid = 1e-2;
+  Hyperellipsoid E = Hyperellipsoid::MakeHypersphere(kEpsilonEllipsoid, sample);
+
+  RowMajorMatrixXd A = initial.A;
+  VectorXd b = initial.b;
+  const int num_initial_constraints = initial.num_constraints;
+  const std::vector<Binding<Constraint>>& additional_constraint_bindings =
+      initial.additional_constraint_bindings;
+  std::shared_ptr<CounterExampleConstraint> counter_example_constraint{};
+  if (options.prog_with_additional_constraints) {
+    counter_example_constraint = std::make_shared<CounterExampleConstraint>(
+                options.prog_with_additional_constraints);
+  }
 
   double best_volume = E.Volume();
   int iteration = 0;
   VectorXd closest(nq);
   RandomGenerator generator(options.random_seed);
 
-  auto solver = solvers::MakeFirstAvailableSolver(
-      {solvers::SnoptSolver::id(), solvers::IpoptSolver::id()});
-  std::unique_ptr<solvers::IbexSolver> ibex;
-  if (options.enable_ibex) {
-    ibex = std::make_unique<solvers::IbexSolver>();
-    DRAKE_DEMAND(ibex->is_available() && ibex->is_enabled());
-    same_point_constraint->EnableSymbolic();
+  std::unique_ptr<solvers::SolverInterface> solver = MakeCounterExampleSolver();
+  int num_searchers = num_threads;
+  if (!solver->is_thread_safe() ||
+      (options.enable_ibex && !solvers::IbexSolver().is_thread_safe())) {
+    num_searchers = 1;
+  }
+  std::vector<CollisionSearcher> searchers(num_searchers);
+  for (CollisionSearcher& searcher : searchers) {
+    searcher.same_point_constraint =
+        std::make_shared<SamePointConstraint>(&plant, context);
+    searcher.solver = solvers::MakeSolver(solver->solver_id());
+    searcher.solver_mutex = solver_mutex;
+    if (options.enable_ibex) {
+      searcher.ibex = std::make_unique<solvers::IbexSolver>();
+      DRAKE_DEMAND(searcher.ibex->is_available() &&
+                   searcher.ibex->is_enabled());
+      searcher.same_point_constraint->EnableSymbolic();
+    }
   }
 
   while (true) {
@@ -710,23 +1005,19 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
     // can find.  We always pass `sample` in as the initial guess for all
     // iterations (not E.center()), because with the nonlinear optimizer, it's
     // possible the E.center() could become infeasible.
-    for (const auto& pair : sorted_pairs) {
-      while (sample_point_requirement &&
-             FindClosestCollision(
-                 same_point_constraint, *frames.at(pair.geomA),
-                 *frames.at(pair.geomB), *sets.at(pair.geomA),
-                 *sets.at(pair.geomB), E, A.topRows(num_constraints),
-                 b.head(num_constraints), *solver, sample, &closest)) {
-        AddTangentToPolytope(E, closest, options.configuration_space_margin, &A,
-                             &b, &num_constraints);
-        if (options.require_sample_point_is_contained) {
-          sample_point_requirement =
-              A.row(num_constraints - 1) * sample <= b(num_constraints - 1);
-        }
-      }
-    }
+    const RandomGenerator::result_type sampling_seed =
+        num_collision_samples > 0 ? generator() : 0;
+    AddCollisionHyperplanes(plant, geometries, sorted_pairs, E, sample,
+                            options, false /* use_ibex */,
+                            num_collision_samples, sampling_seed,
+                            &searchers, root_context, &A, &b, &num_constraints,
+                            &sample_point_requirement);
 
     if (options.prog_with_additional_constraints) {
+      std::unique_lock<std::mutex> lock;
+      if (additional_constraints_mutex != nullptr) {
+        lock = std::unique_lock<std::mutex>(*additional_constraints_mutex);
+      }
       VectorXd guess = P.UniformSample(&generator);
       for (const auto& binding : additional_constraint_bindings) {
         for (int index = 0; index < binding.evaluator()->num_constraints();
@@ -749,7 +1040,8 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
                    options.num_additional_constraint_infeasible_samples) {
               if (FindCounterExample(
                       counter_example_constraint, E, A.topRows(num_constraints),
-                      b.head(num_constraints), *solver, guess, &closest)) {
+                      b.head(num_constraints), *solver, solver_mutex, guess,
+                      &closest)) {
                 AddTangentToPolytope(E, closest,
                                      options.configuration_space_margin, &A, &b,
                                      &num_constraints);
@@ -775,21 +1067,11 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
       // requested.
       // TODO(russt): Consider (re-)implementing a "feasibility only" version of
       // the IRIS check + nonlinear optimization to improve.
-      for (const auto& pair : sorted_pairs) {
-        while (sample_point_requirement &&
-               FindClosestCollision(
-                   same_point_constraint, *frames.at(pair.geomA),
-                   *frames.at(pair.geomB), *sets.at(pair.geomA),
-                   *sets.at(pair.geomB), E, A.topRows(num_constraints),
-                   b.head(num_constraints), *ibex, sample, &closest)) {
-          AddTangentToPolytope(E, closest, options.configuration_space_margin,
-                               &A, &b, &num_constraints);
-          if (options.require_sample_point_is_contained) {
-            sample_point_requirement =
-                A.row(num_constraints - 1) * sample <= b(num_constraints - 1);
-          }
-        }
-      }
+      AddCollisionHyperplanes(plant, geometries, sorted_pairs, E, sample,
+                              options, true /* use_ibex */,
+                              0 /* num_collision_samples */, 0 /* unused */,
+                              &searchers, nullptr, &A, &b, &num_constraints,
+                              &sample_point_requirement);
     }
 
     if (!sample_point_requirement) {
@@ -816,6 +1098,95 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
   return P;
 }
 
+}  // namespace
+
+HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
+                                     const Context<double>& context,
+                                     const IrisOptions& options) {
+  // Check the inputs.
+  plant.ValidateContext(context);
+  CheckIrisInConfigurationSpaceInputs(plant, options);
+  const Eigen::VectorXd sample = plant.GetPositions(context);
+
+  // Make all of the convex sets and supporting quantities.
+  auto query_object =
+      plant.get_geometry_query_input_port().Eval<QueryObject<double>>(context);
+  const CollisionGeometries geometries =
+      MakeCollisionGeometries(plant, query_object);
+  const std::vector<GeometryPairWithDistance> sorted_pairs =
+      SortCollisionPairs(query_object);
+  const InitialPolytope initial =
+      MakeInitialPolytope(plant, sorted_pairs.size(), options);
+
+  return GrowRegion(plant, context, geometries, sorted_pairs, initial, sample,
+                    options, options.num_threads,
+                    0 /* num_collision_samples */, nullptr, nullptr, nullptr);
+}
+
+std::vector<HPolyhedron> IrisInConfigurationSpaceFromSeeds(
+    const MultibodyPlant<double>& plant, const Context<double>& root_context,
+    const Eigen::Ref<const Eigen::MatrixXd>& seeds,
+    const IrisOptions& options, int num_collision_samples) {
+  // Check the inputs. GetMyContextFromRoot() throws unless root_context is a
+  // root context that contains the plant's context.
+  plant.ValidateContext(plant.GetMyContextFromRoot(root_context));
+  CheckIrisInConfigurationSpaceInputs(plant, options);
+  DRAKE_THROW_UNLESS(seeds.rows() == plant.num_positions());
+  DRAKE_THROW_UNLESS(num_collision_samples >= 0);
+  const int num_seeds = seeds.cols();
+  if (num_seeds == 0) {
+    return {};
+  }
+
+  const int num_workers =
+      drake::internal::CalcNumParallelThreads(options.num_threads, num_seeds);
+  // The regions are grown concurrently even if the solvers are not
+  // thread-safe, since most of the work (e.g., evaluating the collision pairs
+  // and samples, and updating the polytopes) is; the solves are then made one
+  // at a time.
+  const bool solvers_are_thread_safe =
+      MakeCounterExampleSolver()->is_thread_safe() &&
+      (!options.enable_ibex || solvers::IbexSolver().is_thread_safe());
+  std::mutex solver_mutex;
+  // Each thread sets the positions of its own clone of the root context to
+  // each of its seeds, to sort the collision pairs by their distance.
+  std::vector<std::unique_ptr<Context<double>>> root_contexts(num_workers);
+  for (auto& thread_root_context : root_contexts) {
+    thread_root_context = root_context.Clone();
+  }
+
+  // Make the convex sets, which do not depend on the positions.
+  const auto& query_object =
+      plant.get_geometry_query_input_port().Eval<QueryObject<double>>(
+          plant.GetMyContextFromRoot(*root_contexts.front()));
+  const CollisionGeometries geometries =
+      MakeCollisionGeometries(plant, query_object);
+  const InitialPolytope initial = MakeInitialPolytope(
+      plant, query_object.inspector().GetCollisionCandidates().size(), options);
+
+  // Each thread repeatedly claims the next seed, and grows its region.
+  std::vector<HPolyhedron> regions(num_seeds);
+  std::mutex additional_constraints_mutex;
+  drake::internal::DynamicParallelFor(
+      num_workers, num_seeds, [&](int thread_num, int i) {
+        Context<double>& plant_context =
+            plant.GetMyMutableContextFromRoot(root_contexts[thread_num].get());
+        plant.SetPositions(&plant_context, seeds.col(i));
+        const std::vector<GeometryPairWithDistance> sorted_pairs =
+            SortCollisionPairs(
+                plant.get_geometry_query_input_port()
+                    .Eval<QueryObject<double>>(plant_context));
+        regions[i] = GrowRegion(plant, plant_context, geometries, sorted_pairs,
+                                initial, seeds.col(i), options, 1,
+                                num_collision_samples,
+                                root_contexts[thread_num].get(),
+                                &additional_constraints_mutex,
+                                solvers_are_thread_safe ? nullptr
+                                                        : &solver_mutex);
+      });
+  return regions;
+}
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
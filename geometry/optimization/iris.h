@@ -85,8 +85,23 @@ struct IrisOptions {
 
   /** The only randomization in IRIS is the random sampling done to find
   counter-examples for the additional constraints using in
-  IrisInConfigurationSpace. Use this option to set the initial seed. */
+  IrisInConfigurationSpace (and the collision samples drawn by
+  IrisInConfigurationSpaceFromSeeds). Use this option to set the initial
+  seed. */
   int random_seed{1234};
+
+  /** For IRIS in configuration space, the number of threads used to search for
+  collisions. With more than one thread, the collision pairs on each iteration
+  are searched concurrently, each against the polytope from the start of that
+  iteration (and the hyperplanes found for that same pair), and the hyperplanes
+  are then added in the usual order of the pairs. The resulting region may have
+  more faces than the single-threaded search, but does not depend on the number
+  of threads. Solvers that are not thread-safe (see
+  solvers::SolverInterface::is_thread_safe()) always use a single thread. For
+  IrisInConfigurationSpaceFromSeeds, the threads are used to grow separate
+  regions concurrently instead, with any solver (see there).
+  @pre num_threads >= 1. */
+  int num_threads{1};
 };
 
 /** The IRIS (Iterative Region Inflation by Semidefinite programming) algorithm,
@@ -164,6 +179,51 @@ HPolyhedron IrisInConfigurationSpace(
     const systems::Context<double>& context,
     const IrisOptions& options = IrisOptions());
 
+/** Runs IrisInConfigurationSpace from each column of @p seeds, growing up to
+`options.num_threads` of the regions concurrently.  Each region matches the
+result of IrisInConfigurationSpace with the plant's positions set to its seed
+and `options.num_threads` set to one (when @p num_collision_samples is zero).
+Only this function can check collision samples, since each check sets the
+positions in a clone of @p root_context.
+
+The convex sets of the collision geometries are only computed once.  Each
+thread works on its own clone of @p root_context, so that setting the
+positions (to a seed, to evaluate the distances of the collision pairs, or to
+a sample, to check it for collisions) does not affect the other threads.  Any
+constraints in `options.prog_with_additional_constraints` are only evaluated by
+one thread at a time, since their evaluators need not be thread-safe.  If the
+solvers used to find collisions are not thread-safe (see
+solvers::SolverInterface::is_thread_safe()), the regions are still grown
+concurrently, but the solves are made one at a time.
+
+@param root_context is the root context of the systems::Diagram that contains
+@p plant and its SceneGraph.  Its positions are ignored.
+@param seeds has one seed configuration per column.
+@param num_collision_samples is the number of uniform samples (drawn with
+HPolyhedron::UniformSample) of the current region that are checked for each
+collision pair before searching for a collision with the nonlinear optimizer.
+A sample is in collision if SceneGraph reports a non-positive signed distance
+between the pair's geometries. Every sample found in collision produces a
+separating hyperplane without any nonlinear solves: the colliding sample
+nearest the center of the ellipsoid is bisected towards the center, the
+tangent at the result is added, and the samples that it cuts away are dropped.
+The (much slower) nonlinear program is only used once sampling finds no more
+collisions. Zero (the default) disables sampling. The samples are not used with
+Ibex.
+@returns one region per column of @p seeds.
+@throws std::exception if @p root_context is not a root context of a diagram
+that contains @p plant.
+@throws std::exception if `seeds.rows() != plant.num_positions()`.
+@throws std::exception if `num_collision_samples < 0`.
+
+@ingroup geometry_optimization
+*/
+std::vector<HPolyhedron> IrisInConfigurationSpaceFromSeeds(
+    const multibody::MultibodyPlant<double>& plant,
+    const systems::Context<double>& root_context,
+    const Eigen::Ref<const Eigen::MatrixXd>& seeds,
+    const IrisOptions& options = IrisOptions(), int num_collision_samples = 0);
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
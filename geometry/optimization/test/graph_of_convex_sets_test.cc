@@ -1406,6 +1406,131 @@ GTEST_TEST(ShortestPathTest, Figure9) {
   EXPECT_NEAR(v3->GetSolution(result)[1], 0, kTol);
 }
 
+// The convex relaxation of Figure9 splits the flow between two paths; rounding
+// recovers one of the two (equally short) paths.
+GTEST_TEST(ShortestPathTest, Figure9Rounding) {
+  GraphOfConvexSets spp;
+
+  const Vertex* source = spp.AddVertex(Point(Vector2d::Zero()), "source");
+  const Vertex* v1 = spp.AddVertex(Point(Vector2d(0, 2)));
+  const Vertex* v2 = spp.AddVertex(Point(Vector2d(0, -2)));
+  const Vertex* v3 =
+      spp.AddVertex(HPolyhedron::MakeBox(Vector2d(2, -2), Vector2d(4, 2)));
+  const Vertex* target = spp.AddVertex(Point(Vector2d(5, 0)), "target");
+  // An edge that cannot be on any path from source to target.
+  const Vertex* unreachable = spp.AddVertex(Point(Vector2d(1, 1)));
+
+  const Edge* e01 = spp.AddEdge(*source, *v1);
+  const Edge* e02 = spp.AddEdge(*source, *v2);
+  const Edge* e13 = spp.AddEdge(*v1, *v3);
+  const Edge* e23 = spp.AddEdge(*v2, *v3);
+  const Edge* e34 = spp.AddEdge(*v3, *target);
+  const Edge* e53 = spp.AddEdge(*unreachable, *v3);
+
+  Matrix<double, 2, 4> A;
+  A.leftCols(2) = Matrix2d::Identity();
+  A.rightCols(2) = -Matrix2d::Identity();
+  auto cost = std::make_shared<solvers::L2NormCost>(A, Vector2d::Zero());
+  for (const auto& e : spp.Edges()) {
+    e->AddCost(solvers::Binding(cost, {e->xu(), e->xv()}));
+  }
+
+  GraphOfConvexSetsOptions options;
+  options.max_rounded_paths = 10;
+  for (int num_threads : {1, 2}) {
+    options.num_threads = num_threads;
+    auto result = spp.SolveShortestPath(source->id(), target->id(), options);
+    ASSERT_TRUE(result.is_success());
+
+    const double kTol = 1e-4;
+    const double phi01 = result.GetSolution(e01->phi());
+    EXPECT_TRUE(std::abs(phi01) < kTol || std::abs(phi01 - 1) < kTol);
+    EXPECT_NEAR(result.GetSolution(e02->phi()), 1 - phi01, kTol);
+    EXPECT_NEAR(result.GetSolution(e13->phi()), phi01, kTol);
+    EXPECT_NEAR(result.GetSolution(e23->phi()), 1 - phi01, kTol);
+    EXPECT_NEAR(result.GetSolution(e34->phi()), 1.0, kTol);
+    EXPECT_EQ(result.GetSolution(e53->phi()), 0.0);
+    EXPECT_TRUE(unreachable->GetSolution(result).array().isNaN().all());
+
+    // The straight line from v1 (or v2) to the target crosses v3.
+    const double kExpectedCost = 2 + std::sqrt(29.0);
+    EXPECT_NEAR(result.get_optimal_cost(), kExpectedCost, kTol);
+    double total_cost = 0;
+    for (const auto& e : spp.Edges()) {
+      total_cost += e->GetSolutionCost(result);
+    }
+    EXPECT_NEAR(total_cost, kExpectedCost, kTol);
+    const Vector2d x1 = phi01 > 0.5 ? Vector2d(0, 2) : Vector2d(0, -2);
+    EXPECT_TRUE(CompareMatrices(e34->GetSolutionPhiXu(result),
+                                v3->GetSolution(result), 1e-12));
+    EXPECT_NEAR((v3->GetSolution(result) - x1).norm() +
+                    (Vector2d(5, 0) - v3->GetSolution(result)).norm(),
+                std::sqrt(29.0), kTol);
+  }
+}
+
+// With linear costs, the convex relaxation and the rounded problems are linear
+// programs. The two paths through v1 and v2 have the same cost, and the
+// rounded result describes one of them through the placeholder variables.
+GTEST_TEST(ShortestPathTest, LinearCostRounding) {
+  GraphOfConvexSets spp;
+
+  Vertex* source = spp.AddVertex(Point(Vector1d(0)), "source");
+  Vertex* v1 = spp.AddVertex(HPolyhedron::MakeBox(Vector1d(1), Vector1d(2)));
+  Vertex* v2 = spp.AddVertex(HPolyhedron::MakeBox(Vector1d(1), Vector1d(2)));
+  Vertex* target = spp.AddVertex(Point(Vector1d(3)), "target");
+  // An edge that cannot be on any path from source to target.
+  Vertex* unreachable = spp.AddVertex(Point(Vector1d(5)));
+
+  const Edge* e01 = spp.AddEdge(*source, *v1);
+  const Edge* e02 = spp.AddEdge(*source, *v2);
+  const Edge* e13 = spp.AddEdge(*v1, *target);
+  const Edge* e23 = spp.AddEdge(*v2, *target);
+  const Edge* e43 = spp.AddEdge(*unreachable, *target);
+
+  // Each edge costs the distance traveled, and v1 and v2 cost their position.
+  auto edge_cost = std::make_shared<LinearCost>(Vector2d(-1, 1), 0);
+  for (const auto& e : spp.Edges()) {
+    e->AddCost(Binding(edge_cost, {e->xu(), e->xv()}));
+  }
+  auto vertex_cost = std::make_shared<LinearCost>(Vector1d(1), 0);
+  v1->AddCost(Binding(vertex_cost, v1->x()));
+  v2->AddCost(Binding(vertex_cost, v2->x()));
+
+  GraphOfConvexSetsOptions options;
+  options.max_rounded_paths = 10;
+  for (int num_threads : {1, 2}) {
+    options.num_threads = num_threads;
+    auto result = spp.SolveShortestPath(source->id(), target->id(), options);
+    ASSERT_TRUE(result.is_success());
+
+    const double kTol = 1e-4;
+    const double phi01 = result.GetSolution(e01->phi());
+    EXPECT_TRUE(phi01 == 0.0 || phi01 == 1.0);
+    EXPECT_EQ(result.GetSolution(e02->phi()), 1 - phi01);
+    EXPECT_EQ(result.GetSolution(e13->phi()), phi01);
+    EXPECT_EQ(result.GetSolution(e23->phi()), 1 - phi01);
+    EXPECT_EQ(result.GetSolution(e43->phi()), 0.0);
+    const Vertex* on_path = phi01 > 0.5 ? v1 : v2;
+    const Vertex* off_path = phi01 > 0.5 ? v2 : v1;
+
+    EXPECT_NEAR(result.get_optimal_cost(), 4, kTol);
+    EXPECT_NEAR(on_path->GetSolution(result)[0], 1, kTol);
+    EXPECT_NEAR(on_path->GetSolutionCost(result), 1, kTol);
+    EXPECT_TRUE(std::isnan(off_path->GetSolution(result)[0]));
+    EXPECT_EQ(off_path->GetSolutionCost(result), 0.0);
+    EXPECT_TRUE(std::isnan(unreachable->GetSolution(result)[0]));
+    EXPECT_NEAR(source->GetSolution(result)[0], 0, kTol);
+    EXPECT_NEAR(target->GetSolution(result)[0], 3, kTol);
+    double total_edge_cost = 0;
+    for (const auto& e : spp.Edges()) {
+      total_edge_cost += e->GetSolutionCost(result);
+    }
+    EXPECT_NEAR(total_edge_cost, 3, kTol);
+    EXPECT_EQ(e43->GetSolutionCost(result), 0.0);
+  }
+}
+
 GTEST_TEST(ShortestPathTest, Graphviz) {
   GraphOfConvexSets g;
   auto source = g.AddVertex(Point(Vector2d{1.0, 2.}), "source");
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/geometry/meshcat.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
 #include "drake/geometry/optimization/iris.h"
@@ -8,6 +9,7 @@
 #include "drake/multibody/inverse_kinematics/inverse_kinematics.h"
 #include "drake/multibody/parsing/parser.h"
 #include "drake/solvers/ibex_solver.h"
+#include "drake/solvers/snopt_solver.h"
 #include "drake/systems/framework/diagram_builder.h"
 
 namespace drake {
@@ -101,22 +103,125 @@ const char boxes_urdf[] = R"(
 
 // Three boxes.  Two on the outside are fixed.  One in the middle on a prismatic
 // joint.  The configuration space is a (convex) line segment q ∈ (−1,1).
-GTEST_TEST(IrisInConfigurationSpaceTest, BoxesPrismatic) {
-  const Vector1d sample = Vector1d::Zero();
-  IrisOptions options;
-  HPolyhedron region = IrisFromUrdf(boxes_urdf, sample, options);
+// The parameter is the number of threads. IrisInConfigurationSpaceFromSeeds
+// uses them with any solver, while IrisInConfigurationSpace only searches the
+// collision pairs concurrently if its solver is thread-safe (e.g., SNOPT, but
+// not IPOPT).
+class BoxesPrismaticTest : public ::testing::TestWithParam<int> {
+ protected:
+  BoxesPrismaticTest() {
+    systems::DiagramBuilder<double> builder;
+    plant_ = &multibody::AddMultibodyPlantSceneGraph(&builder, 0.0).plant;
+    multibody::Parser(plant_).AddModelFromString(boxes_urdf, "urdf");
+    plant_->Finalize();
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+    options_.num_threads = GetParam();
+  }
 
-  EXPECT_EQ(region.ambient_dimension(), 1);
+  // Returns the region grown by IrisInConfigurationSpace from `seed`.
+  HPolyhedron GrowRegion(double seed) {
+    systems::Context<double>& plant_context =
+        plant_->GetMyMutableContextFromRoot(context_.get());
+    plant_->SetPositions(&plant_context, Vector1d{seed});
+    return IrisInConfigurationSpace(*plant_, plant_context, options_);
+  }
 
-  const double kTol = 1e-3;  // due to ibex's rel_eps_f.
-  const double qmin = -1.0 + options.configuration_space_margin,
-               qmax = 1.0 - options.configuration_space_margin;
-  EXPECT_TRUE(region.PointInSet(Vector1d{qmin + kTol}));
-  EXPECT_TRUE(region.PointInSet(Vector1d{qmax - kTol}));
-  EXPECT_FALSE(region.PointInSet(Vector1d{qmin - kTol}));
-  EXPECT_FALSE(region.PointInSet(Vector1d{qmax + kTol}));
+  void CheckRegion(const HPolyhedron& region) const {
+    EXPECT_EQ(region.ambient_dimension(), 1);
+
+    const double kTol = 1e-3;  // due to ibex's rel_eps_f.
+    const double qmin = -1.0 + options_.configuration_space_margin,
+                 qmax = 1.0 - options_.configuration_space_margin;
+    EXPECT_TRUE(region.PointInSet(Vector1d{qmin + kTol}));
+    EXPECT_TRUE(region.PointInSet(Vector1d{qmax - kTol}));
+    EXPECT_FALSE(region.PointInSet(Vector1d{qmin - kTol}));
+    EXPECT_FALSE(region.PointInSet(Vector1d{qmax + kTol}));
+  }
+
+  multibody::MultibodyPlant<double>* plant_{};
+  std::unique_ptr<systems::Diagram<double>> diagram_;
+  std::unique_ptr<systems::Context<double>> context_;
+  IrisOptions options_;
+};
+
+TEST_P(BoxesPrismaticTest, Region) {
+  CheckRegion(GrowRegion(0.0));
 }
 
+// Grows the region from several seeds at once, and checks that each matches
+// the region grown from that seed alone.
+TEST_P(BoxesPrismaticTest, FromSeeds) {
+  const Eigen::RowVector3d seeds(-0.5, 0.0, 0.5);
+  const std::vector<HPolyhedron> regions =
+      IrisInConfigurationSpaceFromSeeds(*plant_, *context_, seeds, options_);
+  ASSERT_EQ(regions.size(), 3);
+
+  options_.num_threads = 1;
+  for (int i = 0; i < seeds.cols(); ++i) {
+    const HPolyhedron expected = GrowRegion(seeds(i));
+    EXPECT_TRUE(CompareMatrices(regions[i].A(), expected.A()));
+    EXPECT_TRUE(CompareMatrices(regions[i].b(), expected.b()));
+  }
+
+  EXPECT_TRUE(IrisInConfigurationSpaceFromSeeds(*plant_, *context_,
+                                                Eigen::MatrixXd(1, 0), options_)
+                  .empty());
+  EXPECT_THROW(IrisInConfigurationSpaceFromSeeds(
+                   *plant_, *context_, Eigen::MatrixXd::Zero(2, 1), options_),
+               std::exception);
+  // The context must be the root context.
+  EXPECT_THROW(IrisInConfigurationSpaceFromSeeds(
+                   *plant_, plant_->GetMyContextFromRoot(*context_), seeds,
+                   options_),
+               std::exception);
+}
+
+// Finds the collisions by sampling before using the nonlinear optimizer.
+TEST_P(BoxesPrismaticTest, Sampling) {
+  const Eigen::RowVector2d seeds(0.0, 0.0);
+  EXPECT_THROW(IrisInConfigurationSpaceFromSeeds(*plant_, *context_, seeds,
+                                                 options_, -1),
+               std::exception);
+
+  // Without sampling, the nonlinear program cuts at the closest collision, so
+  // the random seed (which is otherwise unused here) has no effect. With
+  // sampling, each cut is at a sampled collision bisected towards the center,
+  // which depends on the random seed.
+  std::vector<HPolyhedron> regions;
+  for (int num_collision_samples : {0, 20}) {
+    for (int random_seed : {1234, 5678}) {
+      options_.random_seed = random_seed;
+      const std::vector<HPolyhedron> seed_regions =
+          IrisInConfigurationSpaceFromSeeds(*plant_, *context_, seeds,
+                                            options_, num_collision_samples);
+      ASSERT_EQ(seed_regions.size(), 2);
+      // Both seeds are grown the same way.
+      EXPECT_TRUE(CompareMatrices(seed_regions[0].A(), seed_regions[1].A()));
+      EXPECT_TRUE(CompareMatrices(seed_regions[0].b(), seed_regions[1].b()));
+      CheckRegion(seed_regions[0]);
+      regions.push_back(seed_regions[0]);
+    }
+  }
+  auto same_region = [](const HPolyhedron& a, const HPolyhedron& b) {
+    return a.b().size() == b.b().size() && CompareMatrices(a.A(), b.A()) &&
+           CompareMatrices(a.b(), b.b());
+  };
+  EXPECT_TRUE(same_region(regions[0], regions[1]));
+  EXPECT_FALSE(same_region(regions[2], regions[3]));
+
+  // The sampled regions do not depend on the number of threads.
+  options_.num_threads = 1;
+  const std::vector<HPolyhedron> single_thread_regions =
+      IrisInConfigurationSpaceFromSeeds(*plant_, *context_, seeds, options_,
+                                        20);
+  ASSERT_EQ(single_thread_regions.size(), 2);
+  EXPECT_TRUE(same_region(single_thread_regions[0], regions[3]));
+}
+
+INSTANTIATE_TEST_SUITE_P(IrisInConfigurationSpaceTest, BoxesPrismaticTest,
+                         ::testing::Values(1, 3));
+
 // Three spheres.  Two on the outside are fixed.  One in the middle on a
 // prismatic joint.  The configuration space is a (convex) line segment q ∈
 // (−1,1).
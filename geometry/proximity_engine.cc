@@ -267,6 +267,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   CollisionFilter& collision_filter() { return collision_filter_; }
 
+  const CollisionFilter& collision_filter() const { return collision_filter_; }
+
   void AddDynamicGeometry(const Shape& shape, const RigidTransformd& X_WG,
                           GeometryId id, const ProximityProperties& props) {
     AddGeometry(shape, X_WG, id, props, true, &dynamic_tree_,
@@ -1010,6 +1012,11 @@ CollisionFilter& ProximityEngine<T>::collision_filter() {
   return impl_->collision_filter();
 }
 
+template <typename T>
+const CollisionFilter& ProximityEngine<T>::collision_filter() const {
+  return impl_->collision_filter();
+}
+
 template <typename T>
 void ProximityEngine<T>::UpdateWorldPoses(
     const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) {
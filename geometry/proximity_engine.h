@@ -87,6 +87,9 @@ class ProximityEngine {
   /* Provides access to the mutable collision filter this engine uses. */
   CollisionFilter& collision_filter();
 
+  /* Provides access to the collision filter this engine uses. */
+  const CollisionFilter& collision_filter() const;
+
   /* @name Topology management */
   //@{
 
@@ -37,7 +37,8 @@ QueryObject<T>& QueryObject<T>::operator=(const QueryObject<T>& query_object) {
   } else if (query_object.context_ && query_object.scene_graph_) {
     // Create a new baked state; make sure the source is fully updated.
     query_object.FullPoseAndConfigurationUpdate();
-    state_ = std::make_shared<GeometryState<T>>(query_object.geometry_state());
+    state_ = std::make_shared<GeometryState<T>>(
+        query_object.posed_geometry_state());
   }
   inspector_.set(state_.get());
   // If `query_object` is default, then this will likewise be default.
@@ -91,7 +92,7 @@ QueryObject<T>::ComputePointPairPenetration() const {
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = posed_geometry_state();
   return state.ComputePointPairPenetration();
 }
 
@@ -101,7 +102,7 @@ std::vector<SortedPair<GeometryId>> QueryObject<T>::FindCollisionCandidates()
   ThrowIfNotCallable();
   // TODO(amcastro-tri): Modify this when the cache system is in place.
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = posed_geometry_state();
   return state.FindCollisionCandidates();
 }
 
@@ -110,7 +111,7 @@ bool QueryObject<T>::HasCollisions() const {
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = posed_geometry_state();
   return state.HasCollisions();
 }
 
@@ -123,7 +124,7 @@ QueryObject<T>::ComputeContactSurfaces(
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = posed_geometry_state();
   return state.ComputeContactSurfaces(representation);
 }
 
@@ -140,7 +141,7 @@ QueryObject<T>::ComputeContactSurfacesWithFallback(
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = posed_geometry_state();
   state.ComputeContactSurfacesWithFallback(representation, surfaces,
                                            point_pairs);
 }
@@ -156,7 +157,7 @@ QueryObject<T>::ComputeDeformableRigidContact(
 
   FullPoseAndConfigurationUpdate();
 
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = posed_geometry_state();
   state.ComputeDeformableRigidContact(deformable_rigid_contact);
 }
 
@@ -167,7 +168,7 @@ QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = posed_geometry_state();
   return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
 }
 
@@ -177,7 +178,7 @@ SignedDistancePair<T> QueryObject<T>::ComputeSignedDistancePairClosestPoints(
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = posed_geometry_state();
   return state.ComputeSignedDistancePairClosestPoints(geometry_id_A,
                                                       geometry_id_B);
 }
@@ -190,7 +191,7 @@ QueryObject<T>::ComputeSignedDistanceToPoint(
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = posed_geometry_state();
   return state.ComputeSignedDistanceToPoint(p_WQ, threshold);
 }
 
@@ -202,7 +203,7 @@ void QueryObject<T>::RenderColorImage(const ColorRenderCamera& camera,
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = unshared_geometry_state();
   return state.RenderColorImage(camera, parent_frame, X_PC, color_image_out);
 }
 
@@ -214,7 +215,7 @@ void QueryObject<T>::RenderDepthImage(const DepthRenderCamera& camera,
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = unshared_geometry_state();
   return state.RenderDepthImage(camera, parent_frame, X_PC, depth_image_out);
 }
 
@@ -226,7 +227,7 @@ void QueryObject<T>::RenderLabelImage(const ColorRenderCamera& camera,
   ThrowIfNotCallable();
 
   FullPoseUpdate();
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = unshared_geometry_state();
   return state.RenderLabelImage(camera, parent_frame, X_PC, label_image_out);
 }
 
@@ -236,7 +237,7 @@ const render::RenderEngine* QueryObject<T>::GetRenderEngineByName(
   ThrowIfNotCallable();
   FullPoseUpdate();
 
-  const GeometryState<T>& state = geometry_state();
+  const GeometryState<T>& state = unshared_geometry_state();
   return state.GetRenderEngineByName(name);
 }
 
@@ -251,6 +252,26 @@ const GeometryState<T>& QueryObject<T>::geometry_state() const {
   }
 }
 
+template <typename T>
+const GeometryState<T>& QueryObject<T>::posed_geometry_state() const {
+  DRAKE_ASSERT_VOID(ThrowIfNotCallable());
+  if (context_) {
+    return scene_graph_->posed_geometry_state(*context_);
+  } else {
+    return *state_;
+  }
+}
+
+template <typename T>
+const GeometryState<T>& QueryObject<T>::unshared_geometry_state() const {
+  DRAKE_ASSERT_VOID(ThrowIfNotCallable());
+  if (context_) {
+    return scene_graph_->unshared_geometry_state(*context_);
+  } else {
+    return *state_;
+  }
+}
+
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
     (&QueryObject<T>::template ComputeContactSurfaces<T>,
      &QueryObject<T>::template ComputeContactSurfacesWithFallback<T>))
@@ -139,6 +139,9 @@ class QueryObject {
   /** Provides an inspector for the topological structure of the underlying
    scene graph data (see SceneGraphInspector for details).  */
   const SceneGraphInspector<T>& inspector() const {
+    // A live query object's geometry state may have been replaced by a copy
+    // since set() was called (see SceneGraph::unshared_geometry_state()).
+    if (context_ != nullptr) inspector_.set(&geometry_state());
     return inspector_;
   }
 
@@ -786,6 +789,18 @@ class QueryObject {
   // @pre ThrowIfNotCallable() has been invoked prior to this.
   const GeometryState<T>& geometry_state() const;
 
+  // Like geometry_state(), but the proximity engine of the returned geometry
+  // state has the current poses (see SceneGraph::posed_geometry_state()). Use
+  // this for the queries that use the proximity engine.
+  // @pre ThrowIfNotCallable() has been invoked prior to this.
+  const GeometryState<T>& posed_geometry_state() const;
+
+  // Like geometry_state(), but a live query object's geometry state isn't
+  // shared with any other context (see SceneGraph::unshared_geometry_state()).
+  // Use this for the queries that change a render engine.
+  // @pre ThrowIfNotCallable() has been invoked prior to this.
+  const GeometryState<T>& unshared_geometry_state() const;
+
   // Sets the query object to be *live*. That means the `context` and
   // `scene_graph` cannot be null.
   void set(const systems::Context<T>* context,
@@ -879,7 +894,7 @@ class QueryObject {
   const systems::Context<T>* context_{nullptr};
   const SceneGraph<T>* scene_graph_{nullptr};
 
-  SceneGraphInspector<T> inspector_;
+  mutable SceneGraphInspector<T> inspector_;
 
   // When a QueryObject is copied to a "baked" version, it contains a fully
   // updated GeometryState. Copies of bakes all share the same version.
@@ -427,7 +427,7 @@ void SceneGraph<T>::CalcPoseUpdate(const Context<T>& context,
 
   using std::to_string;
 
-  const GeometryState<T>& state = geometry_state(context);
+  const GeometryState<T>& state = unshared_geometry_state(context);
   // See KinematicsData class documentation for why this caching violation is
   // needed and is correct.
   internal::KinematicsData<T>& kinematics_data =
@@ -458,15 +458,17 @@ void SceneGraph<T>::CalcPoseUpdate(const Context<T>& context,
     }
   }
 
+  // The engines that are shared with a copy-on-write clone of the context are
+  // left alone; they get the new poses only when they are queried or render.
   state.FinalizePoseUpdate(kinematics_data,
-                           &state.mutable_proximity_engine(),
-                           state.GetMutableRenderEngines());
+                           state.GetUnsharedProximityEngine(),
+                           state.GetUnsharedRenderEngines());
 }
 
 template <typename T>
 void SceneGraph<T>::CalcConfigurationUpdate(const Context<T>& context,
                                             int*) const {
-  const GeometryState<T>& state = geometry_state(context);
+  const GeometryState<T>& state = unshared_geometry_state(context);
   // See KinematicsData class documentation for why this caching violation is
   // needed and is correct.
   internal::KinematicsData<T>& kinematics_data =
@@ -498,8 +500,8 @@ void SceneGraph<T>::CalcConfigurationUpdate(const Context<T>& context,
   }
 
   state.FinalizeConfigurationUpdate(kinematics_data,
-                                    &state.mutable_proximity_engine(),
-                                    state.GetMutableRenderEngines());
+                                    state.GetUnsharedProximityEngine(),
+                                    state.GetUnsharedRenderEngines());
 }
 
 template <typename T>
@@ -526,6 +528,34 @@ const GeometryState<T>& SceneGraph<T>::geometry_state(
       .template get_abstract_parameter<GeometryState<T>>(geometry_state_index_);
 }
 
+template <typename T>
+const GeometryState<T>& SceneGraph<T>::unshared_geometry_state(
+    const Context<T>& context) const {
+  // The private copy shares the engines with the copy-on-write clone that the
+  // geometry state is shared with; see GeometryState::MakeCopyOnWrite().
+  return context.get_parameters()
+      .get_abstract_parameters()
+      .get_unshared_value(geometry_state_index_,
+                          [](const AbstractValue& shared) {
+                            return std::make_unique<Value<GeometryState<T>>>(
+                                GeometryState<T>::MakeCopyOnWrite(
+                                    shared.get_value<GeometryState<T>>()));
+                          })
+      .template get_value<GeometryState<T>>();
+}
+
+template <typename T>
+const GeometryState<T>& SceneGraph<T>::posed_geometry_state(
+    const Context<T>& context) const {
+  const GeometryState<T>& state = geometry_state(context);
+  if (!state.proximity_engine_is_stale()) {
+    return state;
+  }
+  const GeometryState<T>& unshared_state = unshared_geometry_state(context);
+  unshared_state.posed_proximity_engine();
+  return unshared_state;
+}
+
 }  // namespace geometry
 
 namespace systems {
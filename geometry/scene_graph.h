@@ -987,6 +987,21 @@ class SceneGraph final : public systems::LeafSystem<T> {
   const GeometryState<T>& geometry_state(
       const systems::Context<T>& context) const;
 
+  // Like geometry_state(), but first gives the context its own copy of the
+  // geometry state if it is shared with a copy-on-write clone of the context.
+  // That copy still shares the engines (see GeometryState::MakeCopyOnWrite()).
+  // Use this before updating the kinematics data and engines that the geometry
+  // state holds in mutable members.
+  const GeometryState<T>& unshared_geometry_state(
+      const systems::Context<T>& context) const;
+
+  // Returns the geometry state for proximity queries. That is geometry_state(),
+  // unless its proximity engine missed the last pose or configuration update
+  // because it was shared; then the engine of unshared_geometry_state() is
+  // brought up to date first (see GeometryState::posed_proximity_engine()).
+  const GeometryState<T>& posed_geometry_state(
+      const systems::Context<T>& context) const;
+
   // A struct that stores the port indices for a given source.
   // TODO(SeanCurtis-TRI): Consider making these TypeSafeIndex values.
   struct SourcePorts {
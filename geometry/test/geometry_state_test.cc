@@ -138,14 +138,22 @@ class GeometryStateTester {
 
   void FinalizePoseUpdate() {
     state_->FinalizePoseUpdate(state_->kinematics_data_,
-                               &state_->mutable_proximity_engine(),
-                               state_->GetMutableRenderEngines());
+                               state_->GetUnsharedProximityEngine(),
+                               state_->GetUnsharedRenderEngines());
   }
 
   void FinalizeConfigurationUpdate() {
     state_->FinalizeConfigurationUpdate(state_->kinematics_data_,
-                                        &state_->mutable_proximity_engine(),
-                                        state_->GetMutableRenderEngines());
+                                        state_->GetUnsharedProximityEngine(),
+                                        state_->GetUnsharedRenderEngines());
+  }
+
+  bool proximity_engine_is_stale() const {
+    return state_->proximity_engine_is_stale();
+  }
+
+  std::unique_ptr<GeometryState<T>> MakeCopyOnWrite() const {
+    return GeometryState<T>::MakeCopyOnWrite(*state_);
   }
 
   template <typename ValueType>
@@ -168,7 +176,7 @@ class GeometryStateTester {
     return *state_->geometry_engine_;
   }
 
-  const unordered_map<string, copyable_unique_ptr<render::RenderEngine>>&
+  const unordered_map<string, internal::EngineOwner<render::RenderEngine>>&
   render_engines() const {
     return state_->render_engines_;
   }
@@ -3696,6 +3704,85 @@ TEST_F(GeometryStateTest, RendererPoseUpdate) {
   expect_poses(render_engine_->updated_ids(), expected_ids);
 }
 
+// Confirms that an ordinary copy of a GeometryState deep copies the engines,
+// while a copy-on-write copy shares them until it changes them, and that a pose
+// update leaves the shared engines alone.
+TEST_F(GeometryStateTest, CopyOnWriteSharesEngines) {
+  SetUpSingleSourceTree(Assign::kProximity | Assign::kPerception);
+  FramePoseVector<double> poses;
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    poses.set_value(frames_[f], X_PFs_[f]);
+  }
+  gs_tester_.SetFramePoses(
+      source_id_, poses, &gs_tester_.mutable_kinematics_data());
+  gs_tester_.FinalizePoseUpdate();
+  render_engine_->init_test_data();
+
+  {
+    GeometryState<double> deep_copy(geometry_state_);
+    GeometryStateTester<double> deep_tester;
+    deep_tester.set_state(&deep_copy);
+    EXPECT_NE(&deep_tester.proximity_engine(), &gs_tester_.proximity_engine());
+    EXPECT_NE(deep_tester.render_engines().at(kDummyRenderName).get(),
+              render_engine_);
+  }
+
+  std::unique_ptr<GeometryState<double>> copy_ptr =
+      gs_tester_.MakeCopyOnWrite();
+  GeometryState<double>& copy = *copy_ptr;
+  GeometryStateTester<double> copy_tester;
+  copy_tester.set_state(&copy);
+  EXPECT_EQ(copy.get_num_frames(), geometry_state_.get_num_frames());
+  EXPECT_EQ(copy.get_num_geometries(), geometry_state_.get_num_geometries());
+  EXPECT_TRUE(copy.geometry_version().IsSameAs(
+      geometry_state_.geometry_version(), Role::kProximity));
+  EXPECT_EQ(copy_tester.get_geometry_world_poses().size(),
+            gs_tester_.get_geometry_world_poses().size());
+  EXPECT_EQ(&copy_tester.proximity_engine(), &gs_tester_.proximity_engine());
+  EXPECT_EQ(copy_tester.render_engines().at(kDummyRenderName).get(),
+            render_engine_);
+
+  // Move the frames of the copy.
+  const Vector3d offset{1, 2, 3};
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    RigidTransformd X_PF = X_PFs_[f];
+    X_PF.set_translation(X_PF.translation() + offset);
+    poses.set_value(frames_[f], X_PF);
+  }
+  copy_tester.SetFramePoses(
+      source_id_, poses, &copy_tester.mutable_kinematics_data());
+  copy_tester.FinalizePoseUpdate();
+
+  // The engines are still shared, and the shared render engine didn't get the
+  // copy's poses.
+  EXPECT_EQ(&copy_tester.proximity_engine(), &gs_tester_.proximity_engine());
+  EXPECT_TRUE(copy_tester.proximity_engine_is_stale());
+  EXPECT_FALSE(gs_tester_.proximity_engine_is_stale());
+  EXPECT_EQ(copy_tester.render_engines().at(kDummyRenderName).get(),
+            render_engine_);
+  EXPECT_EQ(render_engine_->updated_ids().size(), 0u);
+
+  // A proximity query gives the copy its own engine with the copy's poses.
+  EXPECT_EQ(copy.FindCollisionCandidates().size(),
+            geometry_state_.FindCollisionCandidates().size());
+  EXPECT_NE(&copy_tester.proximity_engine(), &gs_tester_.proximity_engine());
+  EXPECT_FALSE(copy_tester.proximity_engine_is_stale());
+
+  // Getting a render engine to render with gives the copy its own renderer
+  // with the copy's poses.
+  const auto* copy_engine = dynamic_cast<const DummyRenderEngine*>(
+      copy.GetRenderEngineByName(kDummyRenderName));
+  ASSERT_NE(copy_engine, nullptr);
+  EXPECT_NE(copy_engine, render_engine_);
+  EXPECT_EQ(render_engine_->updated_ids().size(), 0u);
+  for (int i = 0; i < single_tree_dynamic_geometry_count(); ++i) {
+    const GeometryId id = geometries_[i];
+    EXPECT_TRUE(CompareMatrices(
+        copy_engine->updated_ids().at(id).GetAsMatrix34(),
+        copy_tester.get_geometry_world_poses().at(id).GetAsMatrix34()));
+  }
+}
+
 // This tests the equivalence of versions among copies of GeometryState
 // instances; two copies are equivalent and equivalence is transitive. So, for
 // state s: copy(s) == s and copy(copy(s)) == s.
@@ -0,0 +1,174 @@
+#include "drake/geometry/meshcat_recording.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+// Returns a smoothly-varying pose for the given frame.
+RigidTransformd MakePose(int frame, double phase) {
+  const double t = 0.01 * frame + phase;
+  return RigidTransformd(RollPitchYawd(t, 2 * t, -t),
+                         Vector3d(std::sin(t), std::cos(t), 100 + t));
+}
+
+// Checks that the pose column of a reader's track matches `X`.
+void ExpectPose(const Eigen::Ref<const Eigen::Matrix<double, 7, 1>>& pose,
+                const RigidTransformd& X, double tolerance) {
+  const Eigen::Quaterniond q(pose[3], pose[4], pose[5], pose[6]);
+  const RigidTransformd actual(q, pose.head<3>());
+  EXPECT_TRUE(actual.IsNearlyEqualTo(X, tolerance));
+}
+
+GTEST_TEST(MeshcatRecordingTest, RoundTrip) {
+  const std::string filename = temp_directory() + "/round_trip.drake_rec";
+  const int kFramesPerChunk = 8;
+  const int kNumFrames = 30;
+  {
+    MeshcatRecordingWriter writer(filename, 64.0, kFramesPerChunk);
+    EXPECT_EQ(writer.frames_per_second(), 64.0);
+    EXPECT_EQ(writer.frames_per_chunk(), kFramesPerChunk);
+    EXPECT_EQ(writer.frame(0.5), 32);
+    for (int frame = 0; frame < kNumFrames; ++frame) {
+      writer.SetTransform(frame, "a", MakePose(frame, 0.0));
+      // Path "b" only moves on odd frames, and only in the first two chunks.
+      if (frame % 2 == 1 && frame < 2 * kFramesPerChunk) {
+        writer.SetTransform(frame, "/b", MakePose(frame, 1.0));
+      }
+    }
+    // Setting the same frame again overwrites it.
+    writer.SetTransform(kNumFrames - 1, "a", MakePose(0, 0.0));
+    // The destructor writes the final chunk.
+  }
+
+  MeshcatRecordingReader reader(filename);
+  EXPECT_EQ(reader.frames_per_second(), 64.0);
+  EXPECT_EQ(reader.frames_per_chunk(), kFramesPerChunk);
+  int num_chunks = 0;
+  int num_a_samples = 0;
+  int num_b_samples = 0;
+  while (std::optional<MeshcatRecordingReader::Chunk> chunk =
+             reader.ReadNextChunk()) {
+    EXPECT_EQ(chunk->first_frame, num_chunks * kFramesPerChunk);
+    EXPECT_EQ(chunk->num_frames, kFramesPerChunk);
+    for (const auto& track : chunk->tracks) {
+      ASSERT_EQ(track.poses.cols(), track.frames.size());
+      for (int k = 0; k < static_cast<int>(track.frames.size()); ++k) {
+        const int frame = track.frames[k];
+        EXPECT_GE(frame, chunk->first_frame);
+        EXPECT_LT(frame, chunk->first_frame + chunk->num_frames);
+        if (track.path == "a") {
+          ++num_a_samples;
+          const RigidTransformd expected =
+              frame == kNumFrames - 1 ? MakePose(0, 0.0) : MakePose(frame, 0.0);
+          // The deltas are single precision, but do not accumulate error.
+          ExpectPose(track.poses.col(k), expected, 1e-6);
+        } else {
+          EXPECT_EQ(track.path, "/b");
+          EXPECT_EQ(frame % 2, 1);
+          ++num_b_samples;
+          ExpectPose(track.poses.col(k), MakePose(frame, 1.0), 1e-6);
+        }
+        if (k == 0) {
+          // The keyframe is exact (up to the quaternion conversion).
+          ExpectPose(track.poses.col(k),
+                     track.path == "a" ? MakePose(frame, 0.0)
+                                       : MakePose(frame, 1.0),
+                     1e-14);
+        }
+      }
+    }
+    ++num_chunks;
+  }
+  EXPECT_EQ(num_chunks, 4);
+  EXPECT_EQ(num_a_samples, kNumFrames);
+  EXPECT_EQ(num_b_samples, kFramesPerChunk);
+}
+
+GTEST_TEST(MeshcatRecordingTest, Flush) {
+  const std::string filename = temp_directory() + "/flush.drake_rec";
+  MeshcatRecordingWriter writer(filename, 32.0, 10);
+  writer.SetTransform(3, "a", RigidTransformd());
+  writer.Flush();
+  {
+    // The flushed chunk is readable while the writer is still open.
+    MeshcatRecordingReader reader(filename);
+    std::optional<MeshcatRecordingReader::Chunk> chunk = reader.ReadNextChunk();
+    ASSERT_TRUE(chunk.has_value());
+    ASSERT_EQ(chunk->tracks.size(), 1);
+    EXPECT_EQ(chunk->tracks[0].frames, std::vector<int>({3}));
+    EXPECT_FALSE(reader.ReadNextChunk().has_value());
+  }
+  // After a flush, frames of the same chunk can no longer be recorded.
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.SetTransform(5, "a", RigidTransformd()),
+                              ".*frame 5 precedes.*");
+  writer.SetTransform(10, "a", RigidTransformd());
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.SetTransform(-1, "b", RigidTransformd()),
+                              ".*frame -1 precedes.*");
+  writer.SetTransform(12, "a", RigidTransformd());
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.SetTransform(11, "a", RigidTransformd()),
+                              ".*frame 11 for path a precedes.*");
+}
+
+GTEST_TEST(MeshcatRecordingTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(MeshcatRecordingReader("/no/such/file"),
+                              ".*could not open.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MeshcatRecordingWriter(temp_directory() + "/bad", 0.0),
+      ".*frames_per_second.*");
+
+  const std::string filename = temp_directory() + "/not_a_recording";
+  {
+    std::ofstream out(filename);
+    out << "hello, world";
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(MeshcatRecordingReader{filename},
+                              ".*not a Meshcat recording.*");
+
+  // A truncated chunk is reported as corrupt.
+  const std::string truncated = temp_directory() + "/truncated.drake_rec";
+  {
+    MeshcatRecordingWriter writer(truncated);
+    writer.SetTransform(0, "a", RigidTransformd());
+    writer.SetTransform(1, "a", RigidTransformd());
+  }
+  std::string contents;
+  {
+    std::ifstream in(truncated, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(in), {});
+  }
+  {
+    std::ofstream out(truncated, std::ios::binary | std::ios::trunc);
+    out << contents.substr(0, contents.size() - 3);
+  }
+  MeshcatRecordingReader reader(truncated);
+  DRAKE_EXPECT_THROWS_MESSAGE(reader.ReadNextChunk(), ".*truncated.*");
+}
+
+// A failure to write to disk is reported. We use the Linux /dev/full device,
+// which fails every write, so there is nothing to check on other platforms.
+GTEST_TEST(MeshcatRecordingTest, WriteError) {
+  if (!std::filesystem::exists("/dev/full")) {
+    return;
+  }
+  MeshcatRecordingWriter writer("/dev/full");
+  writer.SetTransform(0, "a", RigidTransformd());
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.Flush(),
+                              ".*could not write to '/dev/full'.*");
+}
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
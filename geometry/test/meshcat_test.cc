@@ -1,6 +1,9 @@
 #include "drake/geometry/meshcat.h"
 
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <iterator>
 #include <thread>
 
 #include <fmt/format.h>
@@ -9,8 +12,10 @@
 #include <msgpack.hpp>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/meshcat_recording.h"
 #include "drake/geometry/meshcat_types.h"
 
 namespace drake {
@@ -445,6 +450,64 @@ GTEST_TEST(MeshcatTest, SetTransformWithMatrix) {
   EXPECT_TRUE(CompareMatrices(matrix, actual));
 }
 
+// Returns the matrix of the packed set_transform message at `path`.
+Eigen::Matrix4d GetTransformMatrix(const Meshcat& meshcat,
+                                   std::string_view path) {
+  std::string transform = meshcat.GetPackedTransform(path);
+  msgpack::object_handle oh =
+      msgpack::unpack(transform.data(), transform.size());
+  auto data = oh.get().as<internal::SetTransformData>();
+  EXPECT_EQ(data.type, "set_transform");
+  return Eigen::Map<Eigen::Matrix4d>(data.matrix);
+}
+
+GTEST_TEST(MeshcatTest, SetTransforms) {
+  Meshcat meshcat;
+  const RigidTransformd X_1{math::RollPitchYawd(.5, .26, -3),
+                            Vector3d{.9, -2., .12}};
+  const RigidTransformd X_2{Vector3d{1., 2., 3.}};
+  meshcat.SetTransforms({"frame1", "/frame2"}, {X_1, X_2});
+  EXPECT_TRUE(CompareMatrices(GetTransformMatrix(meshcat, "frame1"),
+                              X_1.GetAsMatrix4()));
+  EXPECT_TRUE(CompareMatrices(GetTransformMatrix(meshcat, "/frame2"),
+                              X_2.GetAsMatrix4()));
+
+  // Changes smaller than the tolerance are not sent.
+  const RigidTransformd X_1_small{X_1.rotation(),
+                                  X_1.translation() + Vector3d(1e-4, 0, 0)};
+  const RigidTransformd X_2_large{Vector3d{1., 2., 4.}};
+  meshcat.SetTransforms({"frame1", "/frame2"}, {X_1_small, X_2_large}, 1e-3,
+                        true /* use_float32 */);
+  EXPECT_TRUE(CompareMatrices(GetTransformMatrix(meshcat, "frame1"),
+                              X_1.GetAsMatrix4()));
+  // Newly-connected clients receive full-precision transforms.
+  EXPECT_TRUE(CompareMatrices(GetTransformMatrix(meshcat, "/frame2"),
+                              X_2_large.GetAsMatrix4()));
+
+  // With a smaller tolerance, the same change is sent.
+  meshcat.SetTransforms({"frame1"}, {X_1_small}, 5e-5);
+  EXPECT_TRUE(CompareMatrices(GetTransformMatrix(meshcat, "frame1"),
+                              X_1_small.GetAsMatrix4()));
+
+  // SetTransform is accounted for.
+  meshcat.SetTransform("frame1", X_1);
+  meshcat.SetTransforms({"frame1"}, {X_1_small}, 5e-5);
+  EXPECT_TRUE(CompareMatrices(GetTransformMatrix(meshcat, "frame1"),
+                              X_1_small.GetAsMatrix4()));
+
+  // After a Delete, the (unchanged) poses are sent again.
+  meshcat.Delete();
+  EXPECT_FALSE(meshcat.HasPath("frame1"));
+  meshcat.SetTransforms({"frame1", "/frame2"}, {X_1_small, X_2_large}, 1.0);
+  EXPECT_TRUE(meshcat.HasPath("frame1"));
+  EXPECT_TRUE(meshcat.HasPath("/frame2"));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(meshcat.SetTransforms({"frame1"}, {}),
+                              ".*paths.size.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(meshcat.SetTransforms({"frame1"}, {X_1}, -1.0),
+                              ".*tolerance.*");
+}
+
 GTEST_TEST(MeshcatTest, Delete) {
   Meshcat meshcat;
   // Ok to delete an empty tree.
@@ -744,6 +807,44 @@ GTEST_TEST(MeshcatTest, SetOrthographicCamera) {
     })""");
 }
 
+GTEST_TEST(MeshcatTest, PlayRecording) {
+  Meshcat meshcat;
+  const std::string filename = temp_directory() + "/play.drake_rec";
+  {
+    MeshcatRecordingWriter writer(filename, 32.0, 4);
+    for (int frame = 0; frame < 10; ++frame) {
+      writer.SetTransform(frame, "sphere",
+                          RigidTransformd(Vector3d{0, 0, 0.1 * frame}));
+    }
+  }
+  // The chunks are only streamed to connected clients (not stored in the scene
+  // tree), so there is nothing else to check here. Playing again restarts the
+  // playback.
+  EXPECT_NO_THROW(meshcat.PlayRecording(filename));
+  EXPECT_NO_THROW(meshcat.PlayRecording(filename));
+  meshcat.Flush();
+
+  DRAKE_EXPECT_THROWS_MESSAGE(meshcat.PlayRecording("/no/such/file"),
+                              ".*could not open.*");
+
+  // The chunks are read as the playback proceeds, so a truncated chunk is
+  // only logged, and ends the playback.
+  std::string contents;
+  {
+    std::ifstream in(filename, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(in), {});
+  }
+  const std::string truncated = temp_directory() + "/truncated.drake_rec";
+  {
+    std::ofstream out(truncated, std::ios::binary);
+    out << contents.substr(0, contents.size() - 3);
+  }
+  EXPECT_NO_THROW(meshcat.PlayRecording(truncated));
+  // Give the playback time to reach the truncated chunk.
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  meshcat.Flush();
+}
+
 GTEST_TEST(MeshcatTest, SetAnimation) {
   Meshcat meshcat;
   MeshcatAnimation animation;
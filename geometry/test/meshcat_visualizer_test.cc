@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/multibody/parsing/parser.h"
 #include "drake/multibody/plant/multibody_plant.h"
@@ -176,6 +177,54 @@ TEST_F(MeshcatVisualizerWithIiwaTest, DeletePrefixOnInitialization) {
   EXPECT_TRUE(meshcat_->HasPath("/drake/visualizer/my_random_path"));
 }
 
+TEST_F(MeshcatVisualizerWithIiwaTest, BatchedTransforms) {
+  MeshcatVisualizerParams params;
+  params.transform_tolerance = 1e-6;
+  params.use_float32_transforms = true;
+  SetUpDiagram(params);
+  const std::string path = "/drake/visualizer/iiwa14/iiwa_link_7";
+  EXPECT_TRUE(meshcat_->GetPackedTransform(path).empty());
+  diagram_->Publish(*context_);
+  EXPECT_FALSE(meshcat_->GetPackedTransform(path).empty());
+  // Publishing again (with unchanged poses) is harmless.
+  diagram_->Publish(*context_);
+  EXPECT_FALSE(meshcat_->GetPackedTransform(path).empty());
+}
+
+TEST_F(MeshcatVisualizerWithIiwaTest, RecordingToFile) {
+  const std::string filename = temp_directory() + "/iiwa.drake_rec";
+  MeshcatVisualizerParams params;
+  SetUpDiagram(params);
+  visualizer_->StartRecordingToFile(filename);
+  const int kNumPublishes = 100;
+  for (int i = 0; i < kNumPublishes; ++i) {
+    context_->SetTime(i * params.publish_period);
+    diagram_->Publish(*context_);
+  }
+  visualizer_->StopRecording();
+
+  MeshcatRecordingReader reader(filename);
+  EXPECT_EQ(reader.frames_per_second(), 1.0 / params.publish_period);
+  int num_samples = 0;
+  while (auto chunk = reader.ReadNextChunk()) {
+    for (const auto& track : chunk->tracks) {
+      if (track.path == "visualizer/iiwa14/iiwa_link_1") {
+        num_samples += track.frames.size();
+      }
+    }
+  }
+  EXPECT_EQ(num_samples, kNumPublishes);
+
+  // Once stopped, publishing does not record.
+  diagram_->Publish(*context_);
+  MeshcatRecordingReader unchanged(filename);
+  int num_chunks = 0;
+  while (unchanged.ReadNextChunk()) {
+    ++num_chunks;
+  }
+  EXPECT_EQ(num_chunks, (kNumPublishes + 63) / 64);
+}
+
 TEST_F(MeshcatVisualizerWithIiwaTest, Delete) {
   SetUpDiagram();
   diagram_->Publish(*context_);
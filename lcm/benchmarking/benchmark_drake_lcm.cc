@@ -0,0 +1,98 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/lcm/drake_lcm.h"
+#include "drake/tools/performance/fixture_common.h"
+
+/* Measures the latency of DrakeLcm message dispatch for a control loop that
+listens to many channels, with and without DrakeLcmParams::receive_thread. */
+
+namespace drake {
+namespace lcm {
+namespace {
+
+// The size of a typical robot status message (in bytes).
+constexpr int kMessageSize = 512;
+
+class DrakeLcmFixture : public benchmark::Fixture {
+ public:
+  DrakeLcmFixture() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    const bool receive_thread = state.range(0);
+    const int num_channels = state.range(1);
+    // The in-memory provider takes the network out of the measurement, so
+    // that we see only the costs that DrakeLcm itself adds.
+    lcm_ = std::make_unique<DrakeLcm>(DrakeLcmParams{
+        .lcm_url = "memq://", .receive_thread = receive_thread});
+    num_received_ = 0;
+    for (int i = 0; i < num_channels; ++i) {
+      channels_.push_back(fmt::format("BENCHMARK_CHANNEL_{}", i));
+      subscriptions_.push_back(lcm_->Subscribe(
+          channels_.back(), [this](const void*, int) { ++num_received_; }));
+    }
+  }
+
+  using benchmark::Fixture::TearDown;
+  void TearDown(benchmark::State&) override {
+    subscriptions_.clear();
+    channels_.clear();
+    lcm_.reset();
+  }
+
+ protected:
+  std::unique_ptr<DrakeLcm> lcm_;
+  std::vector<std::string> channels_;
+  std::vector<std::shared_ptr<DrakeSubscriptionInterface>> subscriptions_;
+  int num_received_{};
+  const std::vector<uint8_t> message_ = std::vector<uint8_t>(kMessageSize);
+};
+
+// One control tick: every channel receives one message, and the control loop
+// dispatches all of them.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(DrakeLcmFixture, PublishAndHandle)(benchmark::State& state) {
+  const int num_channels = channels_.size();
+  for (auto _ : state) {
+    for (const std::string& channel : channels_) {
+      lcm_->Publish(channel, message_.data(), message_.size(), {});
+    }
+    num_received_ = 0;
+    while (num_received_ < num_channels) {
+      lcm_->HandleSubscriptions(1 /* millis */);
+    }
+  }
+}
+BENCHMARK_REGISTER_F(DrakeLcmFixture, PublishAndHandle)
+    ->ArgNames({"receive_thread", "channels"})
+    ->ArgsProduct({{0, 1}, {1, 40}})
+    ->Unit(benchmark::kMicrosecond);
+
+// One control tick with no new messages; this is the cost that a control loop
+// pays on every tick just to check for messages.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(DrakeLcmFixture, HandleIdle)(benchmark::State& state) {
+  for (auto _ : state) {
+    lcm_->HandleSubscriptions(0 /* millis */);
+  }
+  DRAKE_DEMAND(num_received_ == 0);
+}
+BENCHMARK_REGISTER_F(DrakeLcmFixture, HandleIdle)
+    ->ArgNames({"receive_thread", "channels"})
+    ->ArgsProduct({{0, 1}, {1, 40}})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
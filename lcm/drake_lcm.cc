@@ -1,8 +1,15 @@
 #include "drake/lcm/drake_lcm.h"
 
+#include <poll.h>
+
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -14,6 +21,7 @@
 #include "drake/common/drake_throw.h"
 #include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
+#include "drake/lcm/lcm_message_queue.h"
 
 namespace drake {
 namespace lcm {
@@ -23,9 +31,29 @@ namespace {
 // appear to provide *any* API to determine this.
 constexpr const char* const kLcmDefaultUrl = "udpm://239.255.76.67:7667?ttl=0";
 
+// How long the background receive thread blocks waiting for network traffic
+// before re-checking whether it has been asked to stop.
+constexpr int kReceivePollMillis = 50;
+
 // Defined below.
 class DrakeSubscription;
 
+// The state shared between DrakeLcm, its subscriptions, and its background
+// receive thread (when DrakeLcmParams::receive_thread is enabled).
+struct ReceiveThreadState {
+  // Serializes all calls into the native LCM instance that might touch its
+  // subscription table (handle, subscribe, unsubscribe), because the receive
+  // thread and the user's thread both make such calls.
+  std::mutex native_mutex;
+
+  // The total number of messages in all subscription queues.
+  std::atomic<int> num_queued{0};
+
+  // Used by HandleSubscriptions() to block until num_queued is non-zero.
+  std::mutex wake_mutex;
+  std::condition_variable wake;
+};
+
 }  // namespace
 
 class DrakeLcm::Impl {
@@ -38,6 +66,9 @@ class DrakeLcm::Impl {
         deferred_initialization_(params.defer_initialization),
         lcm_(requested_lcm_url_),
         channel_suffix_(params.channel_suffix) {
+    if (params.receive_thread) {
+      receive_thread_state_ = std::make_unique<ReceiveThreadState>();
+    }
     // This duplicates logic from external/lcm/lcm.c, but until LCM offers an
     // API for this it's the best we can do.
     if (lcm_url_.empty()) {
@@ -60,6 +91,16 @@ class DrakeLcm::Impl {
         }), subscriptions_.end());
   }
 
+  // Returns null unless DrakeLcmParams::receive_thread was enabled.
+  ReceiveThreadState* receive_thread_state() {
+    return receive_thread_state_.get();
+  }
+
+  // These are defined below, after DrakeSubscription.
+  void StartReceiveThreadIfNeeded();
+  void StopReceiveThread();
+  int DispatchQueuedMessages(int timeout_millis);
+
   const std::string requested_lcm_url_;
   std::string lcm_url_;
   bool deferred_initialization_{};
@@ -67,6 +108,14 @@ class DrakeLcm::Impl {
   const std::string channel_suffix_;
   std::vector<std::weak_ptr<DrakeSubscription>> subscriptions_;
   std::string handle_subscriptions_error_message_;
+
+ private:
+  void ReceiveLoop();
+  int DispatchQueuedMessagesOnce();
+
+  std::unique_ptr<ReceiveThreadState> receive_thread_state_;
+  std::thread receive_thread_;
+  std::atomic<bool> stop_receive_thread_{false};
 };
 
 DrakeLcm::DrakeLcm() : DrakeLcm(std::string{}) {}
@@ -82,6 +131,7 @@ DrakeLcm::DrakeLcm(const DrakeLcmParams& params)
     // ThreadSanitizer builds may report false positives related to the
     // self-test happening concurrently with LCM publishing.
     impl_->lcm_.getFileno();
+    impl_->StartReceiveThreadIfNeeded();
   }
 }
 
@@ -124,14 +174,14 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
       DrakeLcmInterface::MultichannelHandlerFunction;
 
   static std::shared_ptr<DrakeSubscription> CreateSingleChannel(
-      ::lcm::LCM* native_instance, const std::string& channel,
-      HandlerFunction single_channel_handler) {
+      ::lcm::LCM* native_instance, ReceiveThreadState* receive_thread_state,
+      const std::string& channel, HandlerFunction single_channel_handler) {
     // The argument to subscribeFunction is regex (not a string literal), so
     // we'll need to escape the channel name before calling subscribeFunction.
     char* const channel_regex = g_regex_escape_string(channel.c_str(), -1);
     ScopeExit guard([channel_regex](){ g_free(channel_regex); });
 
-    return Create(native_instance, channel_regex,
+    return Create(native_instance, receive_thread_state, channel_regex,
                   [handler = std::move(single_channel_handler)](
                       std::string_view, const void* data, int size) {
                     handler(data, size);
@@ -139,17 +189,21 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
   }
 
   static std::shared_ptr<DrakeSubscription> CreateMultichannel(
-      ::lcm::LCM* native_instance,
+      ::lcm::LCM* native_instance, ReceiveThreadState* receive_thread_state,
       MultichannelHandlerFunction multichannel_handler) {
     // TODO(jwnimmer-tri) If a channel_suffix was given, we should use it here
     // for efficiency (to drop unwanted packets as early as possible). Be sure
     // to regex-escape it first.
-    return Create(native_instance, ".*", std::move(multichannel_handler));
+    return Create(native_instance, receive_thread_state, ".*",
+                  std::move(multichannel_handler));
   }
 
+  // When receive_thread_state is non-null, received messages are queued by
+  // the background receive thread and later dispatched by DispatchQueued();
+  // otherwise, they are dispatched directly from the native LCM callback.
   static std::shared_ptr<DrakeSubscription> Create(
-      ::lcm::LCM* native_instance, std::string_view channel_regex,
-      MultichannelHandlerFunction handler) {
+      ::lcm::LCM* native_instance, ReceiveThreadState* receive_thread_state,
+      std::string_view channel_regex, MultichannelHandlerFunction handler) {
     DRAKE_DEMAND(native_instance != nullptr);
     DRAKE_DEMAND(handler != nullptr);
 
@@ -157,6 +211,11 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
     auto result = std::make_shared<DrakeSubscription>();
     result->channel_regex_ = channel_regex;
     result->native_instance_ = native_instance;
+    result->receive_thread_state_ = receive_thread_state;
+    if (receive_thread_state != nullptr) {
+      result->queue_ =
+          std::make_unique<internal::LcmMessageQueue>(result->queue_capacity_);
+    }
     result->user_callback_ = std::move(handler);
     result->weak_self_reference_ = result;
     result->strong_self_reference_ = result;
@@ -175,12 +234,17 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
     DRAKE_DEMAND(strong_self_reference_ == nullptr);
     if (native_subscription_) {
       DRAKE_DEMAND(native_instance_ != nullptr);
+      std::unique_lock<std::mutex> guard = LockNative();
       native_instance_->unsubscribe(native_subscription_);
     }
+    DiscardQueued();
   }
 
   void set_unsubscribe_on_delete(bool enabled) final {
-    DRAKE_DEMAND(!weak_self_reference_.expired());
+    if (weak_self_reference_.expired()) {
+      // Our DrakeLcm has been destroyed, so there is nothing to unsubscribe.
+      return;
+    }
     if (enabled) {
       // The caller needs to keep this Subscription active.
       strong_self_reference_.reset();
@@ -191,32 +255,72 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
   }
 
   void set_queue_capacity(int capacity) final {
-    DRAKE_DEMAND(!weak_self_reference_.expired());
+    std::unique_lock<std::mutex> guard = LockNative();
+    if (weak_self_reference_.expired()) {
+      // Our DrakeLcm has been destroyed, so there is no queue to resize.
+      return;
+    }
     queue_capacity_ = capacity;
     if (native_subscription_) {
       DRAKE_DEMAND(native_instance_ != nullptr);
       native_subscription_->setQueueCapacity(capacity);
     }
+    if (queue_ != nullptr) {
+      // The receive thread is blocked by our lock, so we may safely replace
+      // the queue.  (Any messages still queued are discarded.)
+      DiscardQueued();
+      queue_ = std::make_unique<internal::LcmMessageQueue>(capacity);
+    }
   }
 
   void AttachIfNeeded() {
     if (native_subscription_ != nullptr) {
       return;
     }
+    std::unique_lock<std::mutex> guard = LockNative();
     native_subscription_ = native_instance_->subscribeFunction(
         channel_regex_, &DrakeSubscription::NativeCallback, this);
     native_subscription_->setQueueCapacity(queue_capacity_);
   }
 
+  // Calls the user's callback for every message that the receive thread has
+  // queued so far, and returns the number of such messages.  This must only
+  // be called from HandleSubscriptions().
+  int DispatchQueued() {
+    if (queue_ == nullptr) {
+      return 0;
+    }
+    int count = 0;
+    for (const internal::LcmMessageQueue::Message* message = queue_->front();
+         message != nullptr; message = queue_->front()) {
+      // Pop the message even if the callback throws.
+      ScopeExit guard([this]() {
+        queue_->Pop();
+        receive_thread_state_->num_queued.fetch_sub(1);
+      });
+      ++count;
+      if (user_callback_ != nullptr) {
+        user_callback_(message->channel, message->data.data(),
+                       message->data.size());
+      }
+    }
+    return count;
+  }
+
   // This is ONLY called from the DrakeLcm dtor.  Thus, a HandleSubscriptions
   // is never in flight, so we can freely change any/all of our member fields.
   void Detach() {
-    DRAKE_DEMAND(!weak_self_reference_.expired());
+    if (weak_self_reference_.expired()) {
+      return;
+    }
     if (native_subscription_) {
       DRAKE_DEMAND(native_instance_ != nullptr);
       native_instance_->unsubscribe(native_subscription_);
     }
+    DiscardQueued();
     native_instance_ = {};
+    receive_thread_state_ = {};
+    queue_ = {};
     native_subscription_ = {};
     user_callback_ = {};
     weak_self_reference_ = {};
@@ -244,12 +348,48 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
  private:
   void InstanceCallback(const std::string& channel,
                         const ::lcm::ReceiveBuffer* buffer) {
-    DRAKE_DEMAND(!weak_self_reference_.expired());
+    // With a receive thread, we are called under the native_mutex, and the
+    // user's thread might have just dropped the last reference to us; our
+    // destructor is then waiting for the native_mutex (so our members are
+    // still intact) in order to unsubscribe.  In that case, we quietly drop
+    // the message.  Note that we must not take a strong reference here: if it
+    // turned out to be the last one, the destructor would run on the receive
+    // thread while it holds the native_mutex.
+    if (weak_self_reference_.expired()) {
+      return;
+    }
+    if (queue_ != nullptr) {
+      // We are on the receive thread; defer the user's callback until the
+      // next HandleSubscriptions().
+      if (queue_->Push(channel, buffer->data, buffer->data_size)) {
+        receive_thread_state_->num_queued.fetch_add(1);
+      }
+      return;
+    }
     if (user_callback_ != nullptr) {
       user_callback_(channel, buffer->data, buffer->data_size);
     }
   }
 
+  // When there is a receive thread, returns a lock on its native_mutex;
+  // otherwise, returns an empty lock.
+  std::unique_lock<std::mutex> LockNative() const {
+    if (receive_thread_state_ == nullptr) {
+      return {};
+    }
+    return std::unique_lock<std::mutex>(receive_thread_state_->native_mutex);
+  }
+
+  // Drops all queued messages (if any), keeping num_queued consistent.
+  void DiscardQueued() {
+    if (queue_ == nullptr) {
+      return;
+    }
+    for (; queue_->front() != nullptr; queue_->Pop()) {
+      receive_thread_state_->num_queued.fetch_sub(1);
+    }
+  }
+
   std::string channel_regex_;
 
   // The native handle we can use to unsubscribe.
@@ -257,6 +397,12 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
   ::lcm::Subscription* native_subscription_{};
   int queue_capacity_{1};
 
+  // These are only set when DrakeLcmParams::receive_thread is enabled.  The
+  // receive thread is the producer for the queue_, and HandleSubscriptions()
+  // is the consumer.
+  ReceiveThreadState* receive_thread_state_{};
+  std::unique_ptr<internal::LcmMessageQueue> queue_;
+
   DrakeLcmInterface::MultichannelHandlerFunction user_callback_;
 
   // We can use "strong" to pretend a subscriber is still active.
@@ -266,6 +412,74 @@ class DrakeSubscription final : public DrakeSubscriptionInterface {
 
 }  // namespace
 
+void DrakeLcm::Impl::StartReceiveThreadIfNeeded() {
+  if (receive_thread_state_ == nullptr || receive_thread_.joinable()) {
+    return;
+  }
+  stop_receive_thread_ = false;
+  receive_thread_ = std::thread([this]() { this->ReceiveLoop(); });
+}
+
+void DrakeLcm::Impl::StopReceiveThread() {
+  if (!receive_thread_.joinable()) {
+    return;
+  }
+  stop_receive_thread_ = true;
+  receive_thread_.join();
+}
+
+void DrakeLcm::Impl::ReceiveLoop() {
+  ReceiveThreadState& state = *receive_thread_state_;
+  const int fileno = lcm_.getFileno();
+  while (!stop_receive_thread_) {
+    // Wait for traffic without holding any lock, so that the user's thread
+    // is free to (un)subscribe in the meantime.
+    pollfd poll_fd{fileno, POLLIN, 0};
+    if (::poll(&poll_fd, 1, kReceivePollMillis) <= 0) {
+      continue;
+    }
+    int num_handled = 0;
+    {
+      std::lock_guard<std::mutex> guard(state.native_mutex);
+      while (lcm_.handleTimeout(0) > 0) {
+        ++num_handled;
+      }
+    }
+    if (num_handled > 0) {
+      // Taking the lock (even briefly) guarantees that a concurrent waiter in
+      // DispatchQueuedMessages() is either already blocked (and will be
+      // woken) or has not yet checked num_queued (and will see it non-zero).
+      { std::lock_guard<std::mutex> guard(state.wake_mutex); }
+      state.wake.notify_all();
+    }
+  }
+}
+
+int DrakeLcm::Impl::DispatchQueuedMessagesOnce() {
+  int total = 0;
+  for (const auto& weak_subscription : subscriptions_) {
+    auto subscription = weak_subscription.lock();
+    if (subscription) {
+      total += subscription->DispatchQueued();
+    }
+  }
+  return total;
+}
+
+int DrakeLcm::Impl::DispatchQueuedMessages(int timeout_millis) {
+  DRAKE_DEMAND(receive_thread_state_ != nullptr);
+  ReceiveThreadState& state = *receive_thread_state_;
+  int total = DispatchQueuedMessagesOnce();
+  if (total == 0 && timeout_millis > 0) {
+    std::unique_lock<std::mutex> lock(state.wake_mutex);
+    state.wake.wait_for(lock, std::chrono::milliseconds(timeout_millis),
+                        [&state]() { return state.num_queued > 0; });
+    lock.unlock();
+    total = DispatchQueuedMessagesOnce();
+  }
+  return total;
+}
+
 std::shared_ptr<DrakeSubscriptionInterface> DrakeLcm::Subscribe(
     const std::string& channel, HandlerFunction handler) {
   DRAKE_THROW_UNLESS(!channel.empty());
@@ -275,7 +489,8 @@ std::shared_ptr<DrakeSubscriptionInterface> DrakeLcm::Subscribe(
   // Add the new subscriber.
   const std::string actual_channel = channel + impl_->channel_suffix_;
   auto result = DrakeSubscription::CreateSingleChannel(
-      &(impl_->lcm_), actual_channel, std::move(handler));
+      &(impl_->lcm_), impl_->receive_thread_state(), actual_channel,
+      std::move(handler));
   if (!impl_->deferred_initialization_) {
     result->AttachIfNeeded();
   }
@@ -308,7 +523,7 @@ std::shared_ptr<DrakeSubscriptionInterface> DrakeLcm::SubscribeAllChannels(
 
   // Add the new subscriber.
   auto result = DrakeSubscription::CreateMultichannel(
-      &(impl_->lcm_), std::move(handler));
+      &(impl_->lcm_), impl_->receive_thread_state(), std::move(handler));
   if (!impl_->deferred_initialization_) {
     result->AttachIfNeeded();
   }
@@ -323,14 +538,21 @@ int DrakeLcm::HandleSubscriptions(int timeout_millis) {
       sub.lock()->AttachIfNeeded();
     }
     impl_->deferred_initialization_ = false;
+    impl_->StartReceiveThreadIfNeeded();
   }
-  // Keep pumping handleTimeout until it's empty, but only pause for the
-  // timeout on the first attempt.
   int total_messages = 0;
-  int zero_or_one = impl_->lcm_.handleTimeout(timeout_millis);
-  for (; zero_or_one > 0; zero_or_one = impl_->lcm_.handleTimeout(0)) {
-    DRAKE_DEMAND(zero_or_one == 1);
-    ++total_messages;
+  if (impl_->receive_thread_state() != nullptr) {
+    // The receive thread has already done the network work; we just need to
+    // run the handlers for whatever it has queued.
+    total_messages = impl_->DispatchQueuedMessages(timeout_millis);
+  } else {
+    // Keep pumping handleTimeout until it's empty, but only pause for the
+    // timeout on the first attempt.
+    int zero_or_one = impl_->lcm_.handleTimeout(timeout_millis);
+    for (; zero_or_one > 0; zero_or_one = impl_->lcm_.handleTimeout(0)) {
+      DRAKE_DEMAND(zero_or_one == 1);
+      ++total_messages;
+    }
   }
   // If a handler posted an error, raise it now that we're done with LCM C code.
   if (!impl_->handle_subscriptions_error_message_.empty()) {
@@ -350,6 +572,9 @@ void DrakeLcm::OnHandleSubscriptionsError(const std::string& error_message) {
 }
 
 DrakeLcm::~DrakeLcm() {
+  // Stop receiving before tearing down the subscriptions it might call into.
+  impl_->StopReceiveThread();
+
   // Invalidate our DrakeSubscription objects.
   for (const auto& weak_subscription : impl_->subscriptions_) {
     auto subscription = weak_subscription.lock();
@@ -17,6 +17,7 @@ struct DrakeLcmParams {
     a->Visit(DRAKE_NVP(lcm_url));
     a->Visit(DRAKE_NVP(channel_suffix));
     a->Visit(DRAKE_NVP(defer_initialization));
+    a->Visit(DRAKE_NVP(receive_thread));
   }
 
   /** The URL for DrakeLcm communication. If empty, DrakeLcm will use the
@@ -47,6 +48,20 @@ struct DrakeLcmParams {
   configuration for new threads varies between the construction time and first
   use. */
   bool defer_initialization{false};
+
+  /** (Advanced) Controls whether network reception happens on a dedicated
+  background thread owned by DrakeLcm (when true), or only during calls to
+  DrakeLcm::HandleSubscriptions() (when false).
+
+  When true, the background thread receives and copies each message into a
+  lock-free queue belonging to its subscription (sized per
+  DrakeSubscriptionInterface::set_queue_capacity()), and
+  DrakeLcm::HandleSubscriptions() merely drains those queues. Subscription
+  handlers are still only ever called from within HandleSubscriptions(), on
+  the caller's thread; only the network receive work moves to the background.
+  This reduces the time spent inside HandleSubscriptions() when there are many
+  channels or high message rates. */
+  bool receive_thread{false};
 };
 
 }  // namespace lcm
@@ -0,0 +1,492 @@
+#include "drake/lcm/indexed_lcm_log.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+// The LCM log event header, per lcm/eventlog.c.  All integers are big-endian:
+//   uint32 magic, int64 event number, int64 timestamp,
+//   int32 channel length, int32 data length,
+// followed by the channel name (not nul-terminated) and the data.
+constexpr uint32_t kEventMagic = 0xEDA1DA01;
+constexpr size_t kEventHeaderSize = 4 + 8 + 8 + 4 + 4;
+// LCM itself refuses channel names longer than this.
+constexpr int32_t kMaxChannelLength = 256;
+
+// The index file format; all integers are in host byte order, since the index
+// is a cache for the local machine only.
+constexpr char kIndexMagic[8] = {'D', 'R', 'K', 'L', 'C', 'M', 'I', 'X'};
+constexpr uint32_t kIndexVersion = 1;
+
+uint32_t ReadBigEndian32(const uint8_t* bytes) {
+  return (uint32_t{bytes[0]} << 24) | (uint32_t{bytes[1]} << 16) |
+         (uint32_t{bytes[2]} << 8) | uint32_t{bytes[3]};
+}
+
+uint64_t ReadBigEndian64(const uint8_t* bytes) {
+  return (uint64_t{ReadBigEndian32(bytes)} << 32) |
+         uint64_t{ReadBigEndian32(bytes + 4)};
+}
+
+// The facts about the log file that, if unchanged, mean a saved index is
+// still valid.
+struct LogFileIdentity {
+  uint64_t size{};
+  int64_t mtime_nsec{};
+};
+
+template <typename T>
+void WritePod(std::ofstream* out, const T& value) {
+  out->write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void WriteVector(std::ofstream* out, const std::vector<T>& values) {
+  out->write(reinterpret_cast<const char*>(values.data()),
+             values.size() * sizeof(T));
+}
+
+template <typename T>
+bool ReadPod(std::ifstream* in, T* value) {
+  in->read(reinterpret_cast<char*>(value), sizeof(T));
+  return in->good();
+}
+
+template <typename T>
+bool ReadVector(std::ifstream* in, size_t size, std::vector<T>* values) {
+  values->resize(size);
+  in->read(reinterpret_cast<char*>(values->data()), size * sizeof(T));
+  return in->good();
+}
+
+}  // namespace
+
+class IndexedLcmLog::Impl {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Impl)
+
+  Impl(const std::string& filename,
+       const std::optional<std::string>& index_filename) {
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error(fmt::format(
+          "IndexedLcmLog: failed to open log file '{}': {}", filename,
+          std::strerror(errno)));
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+      const std::string message = std::strerror(errno);
+      ::close(fd);
+      throw std::runtime_error(fmt::format(
+          "IndexedLcmLog: failed to stat log file '{}': {}", filename,
+          message));
+    }
+    identity_.size = info.st_size;
+#ifdef __APPLE__
+    const struct timespec& mtime = info.st_mtimespec;
+#else
+    const struct timespec& mtime = info.st_mtim;
+#endif
+    identity_.mtime_nsec = int64_t{mtime.tv_sec} * 1000000000 + mtime.tv_nsec;
+    if (identity_.size > 0) {
+      void* data =
+          ::mmap(nullptr, identity_.size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        const std::string message = std::strerror(errno);
+        ::close(fd);
+        throw std::runtime_error(fmt::format(
+            "IndexedLcmLog: failed to map log file '{}': {}", filename,
+            message));
+      }
+      data_ = static_cast<const uint8_t*>(data);
+    }
+    ::close(fd);
+
+    if (index_filename && LoadIndex(*index_filename)) {
+      index_was_loaded_ = true;
+    } else {
+      BuildIndex();
+      if (index_filename) {
+        SaveIndex(*index_filename);
+      }
+    }
+    BuildChannelEvents();
+  }
+
+  ~Impl() {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<uint8_t*>(data_), identity_.size);
+    }
+  }
+
+  int num_events() const { return offsets_.size(); }
+
+  bool index_was_loaded() const { return index_was_loaded_; }
+
+  const std::vector<std::string>& channels() const { return channels_; }
+
+  Event get_event(int index) const {
+    DRAKE_THROW_UNLESS(index >= 0 && index < num_events());
+    const uint8_t* const header = data_ + offsets_[index];
+    const int32_t channel_length = ReadBigEndian32(header + 20);
+    const int32_t data_length = ReadBigEndian32(header + 24);
+    Event result;
+    result.event_number = ReadBigEndian64(header + 4);
+    result.timestamp = timestamps_[index];
+    result.channel = std::string_view(
+        reinterpret_cast<const char*>(header + kEventHeaderSize),
+        channel_length);
+    result.data = header + kEventHeaderSize + channel_length;
+    result.data_size = data_length;
+    return result;
+  }
+
+  double get_event_time(int index) const {
+    DRAKE_THROW_UNLESS(index >= 0 && index < num_events());
+    return timestamp_to_second(timestamps_[index]);
+  }
+
+  int FindEvent(double time_sec) const {
+    const auto iter = std::lower_bound(
+        timestamps_.begin(), timestamps_.end(), time_sec,
+        [](int64_t timestamp, double time) {
+          return timestamp_to_second(timestamp) < time;
+        });
+    return iter - timestamps_.begin();
+  }
+
+  const std::vector<int>& GetChannelEvents(const std::string& channel) const {
+    static const never_destroyed<std::vector<int>> empty;
+    const auto iter = std::lower_bound(channels_.begin(), channels_.end(),
+                                       channel);
+    if (iter == channels_.end() || *iter != channel) {
+      return empty.access();
+    }
+    return channel_events_[iter - channels_.begin()];
+  }
+
+ private:
+  // Scans the whole log and fills in offsets_, timestamps_, channel_ids_, and
+  // channels_.
+  void BuildIndex() {
+    const size_t size = identity_.size;
+    std::map<std::string_view, uint32_t> channel_ids;
+    size_t offset = 0;
+    while (offset + kEventHeaderSize <= size) {
+      const uint8_t* const header = data_ + offset;
+      if (ReadBigEndian32(header) != kEventMagic) {
+        // Resynchronize by searching for the next magic number, like LCM.
+        ++offset;
+        continue;
+      }
+      const int64_t timestamp = ReadBigEndian64(header + 12);
+      const int32_t channel_length = ReadBigEndian32(header + 20);
+      const int32_t data_length = ReadBigEndian32(header + 24);
+      if (channel_length <= 0 || channel_length > kMaxChannelLength ||
+          data_length < 0) {
+        ++offset;
+        continue;
+      }
+      const size_t event_size =
+          kEventHeaderSize + size_t{uint32_t(channel_length)} +
+          size_t{uint32_t(data_length)};
+      if (offset + event_size > size) {
+        // A truncated final event.
+        break;
+      }
+      const std::string_view channel(
+          reinterpret_cast<const char*>(header + kEventHeaderSize),
+          channel_length);
+      const auto [iter, inserted] =
+          channel_ids.emplace(channel, channel_ids.size());
+      offsets_.push_back(offset);
+      timestamps_.push_back(timestamp);
+      channel_ids_.push_back(iter->second);
+      offset += event_size;
+    }
+
+    // Renumber the channels into sorted order.
+    std::vector<uint32_t> renumber(channel_ids.size());
+    channels_.clear();
+    for (const auto& [name, id] : channel_ids) {
+      renumber[id] = channels_.size();
+      channels_.emplace_back(name);
+    }
+    for (uint32_t& id : channel_ids_) {
+      id = renumber[id];
+    }
+
+    // Put the events into time order, if they aren't already.
+    if (!std::is_sorted(timestamps_.begin(), timestamps_.end())) {
+      std::vector<int> order(timestamps_.size());
+      std::iota(order.begin(), order.end(), 0);
+      std::stable_sort(order.begin(), order.end(), [this](int a, int b) {
+        return timestamps_[a] < timestamps_[b];
+      });
+      auto permute = [&order](auto* values) {
+        std::remove_reference_t<decltype(*values)> result;
+        result.reserve(order.size());
+        for (const int i : order) {
+          result.push_back((*values)[i]);
+        }
+        *values = std::move(result);
+      };
+      permute(&offsets_);
+      permute(&timestamps_);
+      permute(&channel_ids_);
+    }
+  }
+
+  // Fills in channel_events_ from channel_ids_.
+  void BuildChannelEvents() {
+    channel_events_.clear();
+    channel_events_.resize(channels_.size());
+    for (int i = 0; i < num_events(); ++i) {
+      channel_events_[channel_ids_[i]].push_back(i);
+    }
+  }
+
+  // Attempts to load the index from the given file.  Returns false if the file
+  // does not exist, is malformed, or describes a different log.
+  bool LoadIndex(const std::string& index_filename) {
+    std::ifstream in(index_filename, std::ios::binary);
+    if (!in.good()) {
+      return false;
+    }
+    char magic[sizeof(kIndexMagic)]{};
+    uint32_t version{};
+    LogFileIdentity identity;
+    uint64_t num_events{};
+    uint64_t num_channels{};
+    if (!in.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, kIndexMagic, sizeof(magic)) != 0 ||
+        !ReadPod(&in, &version) || version != kIndexVersion ||
+        !ReadPod(&in, &identity.size) || !ReadPod(&in, &identity.mtime_nsec) ||
+        identity.size != identity_.size ||
+        identity.mtime_nsec != identity_.mtime_nsec ||
+        !ReadPod(&in, &num_events) || !ReadPod(&in, &num_channels) ||
+        num_events > identity_.size / kEventHeaderSize ||
+        num_channels > num_events) {
+      return false;
+    }
+    std::vector<std::string> channels(num_channels);
+    for (std::string& channel : channels) {
+      uint32_t length{};
+      if (!ReadPod(&in, &length) || length > uint32_t{kMaxChannelLength}) {
+        return false;
+      }
+      channel.resize(length);
+      if (!in.read(channel.data(), length)) {
+        return false;
+      }
+    }
+    std::vector<uint64_t> offsets;
+    std::vector<int64_t> timestamps;
+    std::vector<uint32_t> channel_ids;
+    if (!ReadVector(&in, num_events, &offsets) ||
+        !ReadVector(&in, num_events, &timestamps) ||
+        !ReadVector(&in, num_events, &channel_ids)) {
+      return false;
+    }
+    // Guard against a stale or corrupt index: every entry must describe a
+    // complete event that lies within the log.
+    for (size_t i = 0; i < num_events; ++i) {
+      if (!IsValidEntry(offsets[i], timestamps[i], channel_ids[i], channels)) {
+        return false;
+      }
+    }
+    if (!std::is_sorted(timestamps.begin(), timestamps.end())) {
+      return false;
+    }
+    channels_ = std::move(channels);
+    offsets_ = std::move(offsets);
+    timestamps_ = std::move(timestamps);
+    channel_ids_ = std::move(channel_ids);
+    return true;
+  }
+
+  // Returns true iff the log holds a complete event at `offset` with the
+  // given timestamp, on the channel channels[channel_id].
+  bool IsValidEntry(uint64_t offset, int64_t timestamp, uint32_t channel_id,
+                    const std::vector<std::string>& channels) const {
+    const uint64_t size = identity_.size;
+    if (channel_id >= channels.size() || offset > size ||
+        size - offset < kEventHeaderSize) {
+      return false;
+    }
+    const uint8_t* const header = data_ + offset;
+    const int32_t channel_length = ReadBigEndian32(header + 20);
+    const int32_t data_length = ReadBigEndian32(header + 24);
+    if (ReadBigEndian32(header) != kEventMagic ||
+        int64_t(ReadBigEndian64(header + 12)) != timestamp ||
+        channel_length <= 0 || channel_length > kMaxChannelLength ||
+        data_length < 0 ||
+        size - offset - kEventHeaderSize <
+            uint64_t{uint32_t(channel_length)} + uint32_t(data_length)) {
+      return false;
+    }
+    const std::string_view channel(
+        reinterpret_cast<const char*>(header + kEventHeaderSize),
+        channel_length);
+    return channel == channels[channel_id];
+  }
+
+  void SaveIndex(const std::string& index_filename) const {
+    // Write to a temporary file and then rename it, so that concurrent readers
+    // never see a partially-written index.
+    const std::string temp_filename =
+        fmt::format("{}.tmp{}", index_filename, ::getpid());
+    {
+      std::ofstream out(temp_filename, std::ios::binary | std::ios::trunc);
+      out.write(kIndexMagic, sizeof(kIndexMagic));
+      WritePod(&out, kIndexVersion);
+      WritePod(&out, identity_.size);
+      WritePod(&out, identity_.mtime_nsec);
+      WritePod(&out, uint64_t(offsets_.size()));
+      WritePod(&out, uint64_t(channels_.size()));
+      for (const std::string& channel : channels_) {
+        WritePod(&out, uint32_t(channel.size()));
+        out.write(channel.data(), channel.size());
+      }
+      WriteVector(&out, offsets_);
+      WriteVector(&out, timestamps_);
+      WriteVector(&out, channel_ids_);
+      if (!out.good()) {
+        log()->debug("IndexedLcmLog: could not write index file '{}'",
+                     temp_filename);
+        ::unlink(temp_filename.c_str());
+        return;
+      }
+    }
+    if (std::rename(temp_filename.c_str(), index_filename.c_str()) != 0) {
+      log()->debug("IndexedLcmLog: could not rename '{}' to '{}'",
+                   temp_filename, index_filename);
+      ::unlink(temp_filename.c_str());
+    }
+  }
+
+  LogFileIdentity identity_;
+  const uint8_t* data_{};
+  bool index_was_loaded_{false};
+
+  // The index proper, in time order.
+  std::vector<uint64_t> offsets_;
+  std::vector<int64_t> timestamps_;
+  std::vector<uint32_t> channel_ids_;
+
+  // Sorted channel names; channel_ids_ index into this list.
+  std::vector<std::string> channels_;
+
+  // For each channel (indexed like channels_), its event indices.
+  std::vector<std::vector<int>> channel_events_;
+};
+
+IndexedLcmLog::IndexedLcmLog(
+    const std::string& filename,
+    const std::optional<std::string>& index_filename)
+    : impl_(std::make_unique<Impl>(filename, index_filename)) {}
+
+IndexedLcmLog::~IndexedLcmLog() = default;
+
+int IndexedLcmLog::num_events() const {
+  return impl_->num_events();
+}
+
+bool IndexedLcmLog::index_was_loaded() const {
+  return impl_->index_was_loaded();
+}
+
+const std::vector<std::string>& IndexedLcmLog::channels() const {
+  return impl_->channels();
+}
+
+IndexedLcmLog::Event IndexedLcmLog::get_event(int index) const {
+  return impl_->get_event(index);
+}
+
+double IndexedLcmLog::get_event_time(int index) const {
+  return impl_->get_event_time(index);
+}
+
+int IndexedLcmLog::FindEvent(double time_sec) const {
+  return impl_->FindEvent(time_sec);
+}
+
+const std::vector<int>& IndexedLcmLog::GetChannelEvents(
+    const std::string& channel) const {
+  return impl_->GetChannelEvents(channel);
+}
+
+void IndexedLcmLog::ForEachEvent(
+    double start_time, double end_time,
+    const std::vector<std::string>& channels,
+    const std::function<void(const Event&)>& callback) const {
+  DRAKE_THROW_UNLESS(callback != nullptr);
+  const int begin = FindEvent(start_time);
+  const int end = FindEvent(end_time);
+  if (channels.empty()) {
+    for (int i = begin; i < end; ++i) {
+      callback(get_event(i));
+    }
+    return;
+  }
+
+  // Merge the (sorted) per-channel event lists, so that we never touch the
+  // events on other channels.
+  std::vector<int> selected;
+  for (const std::string& channel : channels) {
+    const std::vector<int>& events = GetChannelEvents(channel);
+    const auto first = std::lower_bound(events.begin(), events.end(), begin);
+    const auto last = std::lower_bound(first, events.end(), end);
+    selected.insert(selected.end(), first, last);
+  }
+  std::sort(selected.begin(), selected.end());
+  selected.erase(std::unique(selected.begin(), selected.end()),
+                 selected.end());
+  for (const int i : selected) {
+    callback(get_event(i));
+  }
+}
+
+void IndexedLcmLog::ForEachChannelInParallel(
+    const std::vector<std::string>& channels,
+    const std::function<void(const Event&)>& callback,
+    int num_threads) const {
+  DRAKE_THROW_UNLESS(callback != nullptr);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  const std::vector<std::string>& work = channels.empty() ? this->channels()
+                                                          : channels;
+
+  // Each thread repeatedly claims the next unvisited channel.
+  internal::DynamicParallelFor(num_threads, work.size(), [&](int, int c) {
+    for (const int i : GetChannelEvents(work[c])) {
+      callback(get_event(i));
+    }
+  });
+}
+
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace lcm {
+
+/**
+ * A read-only, random-access view of an LCM log file, for offline analysis of
+ * large logs.
+ *
+ * Unlike DrakeLcmLog (which reads a log strictly sequentially), this class
+ * memory-maps the log file and builds an index of every event's timestamp,
+ * channel, and file offset.  With the index, seeking to a time is a binary
+ * search, iterating over a subset of channels skips the other channels'
+ * events entirely, and independent channels can be decoded concurrently.
+ *
+ * Building the index requires one pass over the event headers (but not the
+ * message payloads) of the whole log.  To avoid repeating that work, the index
+ * can be saved to (and later loaded from) an index file; the index file
+ * records the size and modification time of the log it describes, and is
+ * rebuilt automatically whenever those no longer match.
+ *
+ * Events are indexed in order of non-decreasing timestamp.  (Logs written by
+ * lcm-logger or DrakeLcmLog are already in that order; any out-of-order
+ * events are stably sorted.)  As with DrakeLcmLog, a timestamp is an integer
+ * number of microseconds and a time is the timestamp converted to seconds.
+ *
+ * A truncated final event (e.g., from a logger that was killed mid-write) is
+ * ignored, as is any garbage between events.
+ *
+ * This class is safe to use from multiple threads concurrently, because all of
+ * its member functions are const after construction.
+ */
+class IndexedLcmLog final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IndexedLcmLog)
+
+  /** One logged message.  The channel and data point into the memory-mapped
+  log file, and so remain valid for the lifetime of the IndexedLcmLog. */
+  struct Event {
+    /** The event number recorded by the logger. */
+    int64_t event_number{};
+    /** The time (in microseconds) recorded by the logger. */
+    int64_t timestamp{};
+    /** The channel name. */
+    std::string_view channel;
+    /** The encoded message bytes. */
+    const void* data{};
+    /** The number of encoded message bytes. */
+    int data_size{};
+  };
+
+  /**
+   * Opens and indexes the log file.
+   * @param filename The LCM log file to read.
+   * @param index_filename (Optional) A file used to cache the index.  If it
+   * exists and describes the current contents of `filename`, the index is
+   * loaded from it; otherwise, the index is built by scanning the log and then
+   * written to it.  Failing to write the index file is not an error.
+   * @throws std::exception if the log file cannot be opened.
+   */
+  explicit IndexedLcmLog(
+      const std::string& filename,
+      const std::optional<std::string>& index_filename = std::nullopt);
+
+  ~IndexedLcmLog();
+
+  /** Returns the number of events in the log. */
+  int num_events() const;
+
+  /** Returns true iff the index was loaded from `index_filename` (as opposed
+  to being built by scanning the log). */
+  bool index_was_loaded() const;
+
+  /** Returns the names of all channels that appear in the log, sorted. */
+  const std::vector<std::string>& channels() const;
+
+  /** Returns the event with the given index.
+  @pre 0 <= index < num_events() */
+  Event get_event(int index) const;
+
+  /** Returns the time (in seconds) of the event with the given index, without
+  touching the log file itself.
+  @pre 0 <= index < num_events() */
+  double get_event_time(int index) const;
+
+  /** Returns the index of the first event whose time is greater than or equal
+  to `time_sec`, or num_events() if there is no such event.  This takes
+  O(log n) time for a log of n events. */
+  int FindEvent(double time_sec) const;
+
+  /** Returns the indices (in time order) of all events on the given channel,
+  or an empty list if the channel never appears in the log. */
+  const std::vector<int>& GetChannelEvents(const std::string& channel) const;
+
+  /**
+   * Calls `callback` on every event whose time lies in the half-open interval
+   * [start_time, end_time), in time order.
+   * @param channels If non-empty, only events on these channels are visited.
+   */
+  void ForEachEvent(double start_time, double end_time,
+                    const std::vector<std::string>& channels,
+                    const std::function<void(const Event&)>& callback) const;
+
+  /**
+   * Calls `callback` on every event on each of the given channels, using up to
+   * `num_threads` threads.  The events of any one channel are visited in time
+   * order from a single thread, but different channels are visited
+   * concurrently, so `callback` must be safe to call concurrently for events
+   * on different channels (e.g., by decoding each channel into separate
+   * storage).
+   * @param channels The channels to visit; if empty, visits every channel.
+   * @param num_threads The maximum number of threads to use.  Must be >= 1.
+   */
+  void ForEachChannelInParallel(
+      const std::vector<std::string>& channels,
+      const std::function<void(const Event&)>& callback,
+      int num_threads) const;
+
+  /** Converts @p timestamp (in microseconds) to time (in seconds). */
+  static double timestamp_to_second(int64_t timestamp) {
+    return static_cast<double>(timestamp) / 1e6;
+  }
+
+ private:
+  class Impl;
+  const std::unique_ptr<const Impl> impl_;
+};
+
+}  // namespace lcm
+}  // namespace drake
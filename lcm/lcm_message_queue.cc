@@ -0,0 +1,52 @@
+#include "drake/lcm/lcm_message_queue.h"
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace lcm {
+namespace internal {
+
+LcmMessageQueue::LcmMessageQueue(int capacity) {
+  DRAKE_THROW_UNLESS(capacity >= 1);
+  slots_.resize(capacity);
+}
+
+LcmMessageQueue::~LcmMessageQueue() = default;
+
+bool LcmMessageQueue::Push(
+    std::string_view channel, const void* data, int size) {
+  DRAKE_DEMAND(size >= 0);
+  DRAKE_DEMAND(data != nullptr || size == 0);
+  const uint64_t tail = tail_.load(std::memory_order_relaxed);
+  const uint64_t head = head_.load(std::memory_order_acquire);
+  if (tail - head >= slots_.size()) {
+    num_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  Message& slot = slots_[tail % slots_.size()];
+  slot.channel.assign(channel.data(), channel.size());
+  const uint8_t* const bytes = static_cast<const uint8_t*>(data);
+  slot.data.assign(bytes, bytes + size);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+const LcmMessageQueue::Message* LcmMessageQueue::front() const {
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  const uint64_t tail = tail_.load(std::memory_order_acquire);
+  if (head == tail) {
+    return nullptr;
+  }
+  return &slots_[head % slots_.size()];
+}
+
+void LcmMessageQueue::Pop() {
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  DRAKE_DEMAND(head != tail_.load(std::memory_order_acquire));
+  head_.store(head + 1, std::memory_order_release);
+}
+
+}  // namespace internal
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace lcm {
+namespace internal {
+
+/* A bounded, lock-free, single-producer single-consumer queue of raw LCM
+messages (channel name plus encoded bytes).
+
+Storage for each slot is reused from one message to the next, so once the
+queue has warmed up Push() does not allocate unless a message is larger than
+any previous message in the same slot.
+
+When the queue is full, Push() drops the new message (matching the behavior
+of LCM's own subscription queues) and counts it in num_dropped().
+
+Thread safety: Push() may only be called by one thread at a time (the
+producer), and front() / Pop() may only be called by one thread at a time
+(the consumer); the two threads may differ. */
+class LcmMessageQueue final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LcmMessageQueue)
+
+  /* One queued message. */
+  struct Message {
+    std::string channel;
+    std::vector<uint8_t> data;
+  };
+
+  /* Creates an empty queue that holds at most `capacity` messages.
+  @pre capacity >= 1 */
+  explicit LcmMessageQueue(int capacity);
+
+  ~LcmMessageQueue();
+
+  int capacity() const { return static_cast<int>(slots_.size()); }
+
+  /* (Producer.) Copies the message into the queue.  Returns false iff the
+  queue was full, in which case the message was dropped. */
+  bool Push(std::string_view channel, const void* data, int size);
+
+  /* (Consumer.) Returns the oldest message, or nullptr if the queue is empty.
+  The pointer remains valid until the next call to Pop(). */
+  const Message* front() const;
+
+  /* (Consumer.) Discards the oldest message.
+  @pre front() != nullptr */
+  void Pop();
+
+  /* Returns the number of messages dropped by Push() because the queue was
+  full.  Safe to call from any thread. */
+  int64_t num_dropped() const {
+    return num_dropped_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::vector<Message> slots_;
+
+  // The producer and consumer indices are monotonically increasing counters
+  // (slot = counter % capacity).  Keep them on separate cache lines so that
+  // the two threads don't false-share.
+  alignas(64) std::atomic<uint64_t> head_{0};  // Next slot to pop.
+  alignas(64) std::atomic<uint64_t> tail_{0};  // Next slot to push.
+  alignas(64) std::atomic<int64_t> num_dropped_{0};
+};
+
+}  // namespace internal
+}  // namespace lcm
+}  // namespace drake
@@ -1,5 +1,6 @@
 #include "drake/lcm/drake_lcm.h"
 
+#include <atomic>
 #include <chrono>
 #include <stdexcept>
 #include <thread>
@@ -314,6 +315,137 @@ TEST_F(DrakeLcmTest, QueueCapacityTest) {
   count = 0;
 }
 
+// Tests subscribing with a background receive thread.  The handler must still
+// be called on the thread that calls HandleSubscriptions().
+TEST_F(DrakeLcmTest, ReceiveThreadSubscribeTest) {
+  dut_ = std::make_unique<DrakeLcm>(DrakeLcmParams{
+      .lcm_url = kUdpmUrl, .receive_thread = true});
+  const std::string channel_name = "DrakeLcmTest.ReceiveThreadSubscribeTest";
+
+  lcmt_drake_signal received{};
+  std::thread::id handler_thread;
+  auto subscription = dut_->Subscribe(channel_name, [&](
+      const void* data, int size) {
+    handler_thread = std::this_thread::get_id();
+    received.decode(data, 0, size);
+  });
+
+  int total = 0;
+  LoopUntilDone(&received, 20 /* retries */, [&]() {
+    Publish(dut_.get(), channel_name, message_);
+    total += dut_->HandleSubscriptions(50 /* millis */);
+  });
+  EXPECT_GE(total, 1);
+  EXPECT_EQ(handler_thread, std::this_thread::get_id());
+
+  // Once unsubscribed, nothing more is received.
+  subscription.reset();
+  Publish(dut_.get(), channel_name, message_);
+  EXPECT_EQ(dut_->HandleSubscriptions(100 /* millis */), 0);
+}
+
+// Repeats QueueCapacityTest, but with a background receive thread.
+TEST_F(DrakeLcmTest, ReceiveThreadQueueCapacityTest) {
+  dut_ = std::make_unique<DrakeLcm>(DrakeLcmParams{
+      .lcm_url = kUdpmUrl, .receive_thread = true});
+  const std::string channel_name =
+      "DrakeLcmTest.ReceiveThreadQueueCapacityTest";
+
+  int count = 0;
+  auto subscription = dut_->Subscribe(channel_name, [&count](
+      const void* data, int size) {
+    ++count;
+  });
+  EXPECT_EQ(dut_->HandleSubscriptions(10 /* millis */), 0);
+
+  // Send three messages, but only one comes out.
+  for (int i = 0; i < 3; ++i) {
+    Publish(dut_.get(), channel_name, message_);
+    // Let our receive thread get scheduled.
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(dut_->HandleSubscriptions(1000 /* millis */), 1);
+  ASSERT_EQ(dut_->HandleSubscriptions(100 /* millis */), 0);
+  EXPECT_EQ(count, 1);
+  count = 0;
+
+  // Send five messages, but only three come out.
+  subscription->set_queue_capacity(3);
+  for (int i = 0; i < 5; ++i) {
+    Publish(dut_.get(), channel_name, message_);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(dut_->HandleSubscriptions(1000 /* millis */), 3);
+  ASSERT_EQ(dut_->HandleSubscriptions(100 /* millis */), 0);
+  EXPECT_EQ(count, 3);
+}
+
+// Tests that subscriptions may be dropped while the receive thread is busy
+// receiving messages for them.
+TEST_F(DrakeLcmTest, ReceiveThreadUnsubscribeUnderTrafficTest) {
+  dut_ = std::make_unique<DrakeLcm>(DrakeLcmParams{
+      .lcm_url = kUdpmUrl, .receive_thread = true});
+  const std::string channel_name =
+      "DrakeLcmTest.ReceiveThreadUnsubscribeUnderTrafficTest";
+
+  // Publish continuously (from a separate instance) until we are done.
+  std::atomic<bool> done{false};
+  std::thread publisher([this, &done, &channel_name]() {
+    DrakeLcm other(kUdpmUrl);
+    while (!done) {
+      Publish(&other, channel_name, message_);
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+  });
+
+  // Repeatedly subscribe, receive a little, and unsubscribe.  Some
+  // subscriptions are dropped with messages still queued, some without ever
+  // handling any; none of them may crash.
+  int total = 0;
+  for (int i = 0; i < 100; ++i) {
+    auto subscription = dut_->Subscribe(channel_name, [](const void*, int) {});
+    subscription->set_unsubscribe_on_delete(true);
+    subscription->set_queue_capacity(1 + i % 3);
+    if (i % 2 == 0) {
+      total += dut_->HandleSubscriptions(1 /* millis */);
+    } else {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    subscription.reset();
+  }
+  done = true;
+  publisher.join();
+  EXPECT_GT(total, 0);
+
+  // Once unsubscribed, nothing more is received.
+  EXPECT_EQ(dut_->HandleSubscriptions(100 /* millis */), 0);
+
+  // A subscription that outlives its DrakeLcm may still be adjusted.
+  auto subscription = dut_->Subscribe(channel_name, [](const void*, int) {});
+  dut_.reset();
+  subscription->set_queue_capacity(2);
+  subscription->set_unsubscribe_on_delete(true);
+}
+
+// Tests that deferred initialization also defers the receive thread.
+TEST_F(DrakeLcmTest, ReceiveThreadDeferredTest) {
+  dut_ = std::make_unique<DrakeLcm>(DrakeLcmParams{
+      .lcm_url = kUdpmUrl,
+      .defer_initialization = true,
+      .receive_thread = true});
+  const std::string channel_name = "DrakeLcmTest.ReceiveThreadDeferredTest";
+
+  lcmt_drake_signal received{};
+  auto subscription = dut_->Subscribe(channel_name, [&received](
+      const void* data, int size) {
+    received.decode(data, 0, size);
+  });
+  LoopUntilDone(&received, 20 /* retries */, [&]() {
+    Publish(dut_.get(), channel_name, message_);
+    dut_->HandleSubscriptions(50 /* millis */);
+  });
+}
+
 // Tests that upstream LCM actually obeys the IP address in the URL.
 TEST_F(DrakeLcmTest, AddressFilterAcceptanceTest) {
   const std::string channel_name = "DrakeLcmTest.AddressFilterAcceptanceTest";
@@ -0,0 +1,219 @@
+#include "drake/lcm/indexed_lcm_log.h"
+
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace lcm {
+namespace {
+
+// Writes LCM log events in the same format as lcm-logger (and DrakeLcmLog).
+class LogWriter {
+ public:
+  explicit LogWriter(const std::string& filename)
+      : out_(filename, std::ios::binary | std::ios::trunc) {}
+
+  void Write(int64_t timestamp, const std::string& channel,
+             const std::string& data) {
+    Write32(0xEDA1DA01);
+    Write64(event_number_++);
+    Write64(timestamp);
+    Write32(channel.size());
+    Write32(data.size());
+    out_ << channel << data;
+  }
+
+  void WriteGarbage(const std::string& bytes) { out_ << bytes; }
+
+ private:
+  void Write32(uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      out_.put(static_cast<char>((value >> shift) & 0xFF));
+    }
+  }
+
+  void Write64(uint64_t value) {
+    Write32(value >> 32);
+    Write32(value & 0xFFFFFFFF);
+  }
+
+  std::ofstream out_;
+  int64_t event_number_{0};
+};
+
+class IndexedLcmLogTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    filename_ = temp_directory() + "/test.lcmlog";
+    index_filename_ = temp_directory() + "/test.lcmlog.index";
+    LogWriter writer(filename_);
+    // Three channels at different rates, over one second.
+    for (int i = 0; i < 100; ++i) {
+      const int64_t timestamp = i * 10000;
+      writer.Write(timestamp, "FAST", "fast" + std::to_string(i));
+      if (i % 10 == 0) {
+        writer.Write(timestamp, "SLOW", "slow" + std::to_string(i));
+      }
+      if (i == 50) {
+        writer.WriteGarbage("not an event");
+        writer.Write(timestamp + 1, "ONCE", "once");
+      }
+    }
+    // A truncated final event.
+    writer.WriteGarbage(std::string("\xED\xA1\xDA\x01\x00\x00", 6));
+  }
+
+  std::string filename_;
+  std::string index_filename_;
+};
+
+TEST_F(IndexedLcmLogTest, Basic) {
+  const IndexedLcmLog dut(filename_);
+  EXPECT_FALSE(dut.index_was_loaded());
+  EXPECT_EQ(dut.num_events(), 100 + 10 + 1);
+  EXPECT_EQ(dut.channels(),
+            std::vector<std::string>({"FAST", "ONCE", "SLOW"}));
+
+  const IndexedLcmLog::Event first = dut.get_event(0);
+  EXPECT_EQ(first.event_number, 0);
+  EXPECT_EQ(first.timestamp, 0);
+  EXPECT_EQ(first.channel, "FAST");
+  EXPECT_EQ(std::string(static_cast<const char*>(first.data), first.data_size),
+            "fast0");
+  EXPECT_EQ(dut.get_event_time(dut.num_events() - 1), 0.99);
+  EXPECT_THROW(dut.get_event(dut.num_events()), std::exception);
+
+  EXPECT_EQ(dut.GetChannelEvents("FAST").size(), 100);
+  EXPECT_EQ(dut.GetChannelEvents("SLOW").size(), 10);
+  EXPECT_EQ(dut.GetChannelEvents("ONCE").size(), 1);
+  EXPECT_EQ(dut.GetChannelEvents("NONE").size(), 0);
+}
+
+TEST_F(IndexedLcmLogTest, FindEvent) {
+  const IndexedLcmLog dut(filename_);
+  EXPECT_EQ(dut.FindEvent(-1.0), 0);
+  EXPECT_EQ(dut.FindEvent(0.0), 0);
+  // The event at 0.5 is the first FAST event at or after 0.5.
+  const int index = dut.FindEvent(0.5);
+  EXPECT_EQ(dut.get_event_time(index), 0.5);
+  EXPECT_LT(dut.get_event_time(index - 1), 0.5);
+  EXPECT_EQ(dut.FindEvent(10.0), dut.num_events());
+}
+
+TEST_F(IndexedLcmLogTest, ForEachEvent) {
+  const IndexedLcmLog dut(filename_);
+  std::vector<std::string> visited;
+  auto record = [&visited](const IndexedLcmLog::Event& event) {
+    visited.emplace_back(static_cast<const char*>(event.data),
+                         event.data_size);
+  };
+
+  dut.ForEachEvent(0.2, 0.4, {"SLOW", "ONCE"}, record);
+  EXPECT_EQ(visited, std::vector<std::string>({"slow20", "slow30"}));
+  visited.clear();
+
+  dut.ForEachEvent(0.495, 0.515, {}, record);
+  EXPECT_EQ(visited, std::vector<std::string>(
+                         {"fast50", "slow50", "once", "fast51"}));
+}
+
+TEST_F(IndexedLcmLogTest, ForEachChannelInParallel) {
+  const IndexedLcmLog dut(filename_);
+  std::mutex mutex;
+  std::map<std::string, std::vector<int64_t>> timestamps;
+  dut.ForEachChannelInParallel({}, [&](const IndexedLcmLog::Event& event) {
+    std::lock_guard<std::mutex> lock(mutex);
+    timestamps[std::string(event.channel)].push_back(event.timestamp);
+  }, 4);
+  ASSERT_EQ(timestamps.size(), 3);
+  EXPECT_EQ(timestamps["FAST"].size(), 100);
+  EXPECT_EQ(timestamps["SLOW"].size(), 10);
+  EXPECT_EQ(timestamps["ONCE"].size(), 1);
+  // Each channel is visited in time order.
+  EXPECT_TRUE(std::is_sorted(timestamps["FAST"].begin(),
+                             timestamps["FAST"].end()));
+
+  EXPECT_THROW(dut.ForEachChannelInParallel({}, [](const auto&) {}, 0),
+               std::exception);
+}
+
+TEST_F(IndexedLcmLogTest, IndexFile) {
+  {
+    const IndexedLcmLog dut(filename_, index_filename_);
+    EXPECT_FALSE(dut.index_was_loaded());
+  }
+  const IndexedLcmLog dut(filename_, index_filename_);
+  EXPECT_TRUE(dut.index_was_loaded());
+  EXPECT_EQ(dut.num_events(), 111);
+  EXPECT_EQ(dut.channels(),
+            std::vector<std::string>({"FAST", "ONCE", "SLOW"}));
+  EXPECT_EQ(dut.GetChannelEvents("SLOW").size(), 10);
+  EXPECT_EQ(dut.get_event(dut.FindEvent(0.5)).channel, "FAST");
+
+  // Changing the log invalidates the index.
+  {
+    LogWriter writer(filename_);
+    writer.Write(0, "OTHER", "");
+  }
+  const IndexedLcmLog changed(filename_, index_filename_);
+  EXPECT_FALSE(changed.index_was_loaded());
+  EXPECT_EQ(changed.num_events(), 1);
+}
+
+// An index file that matches the log's size and modification time but whose
+// entries do not describe the log's events is rebuilt, not trusted.
+TEST_F(IndexedLcmLogTest, CorruptIndexFile) {
+  { const IndexedLcmLog dut(filename_, index_filename_); }
+  // The offsets follow the header (44 bytes) and the three channel names
+  // (three 4-byte lengths plus 12 bytes of names).
+  const std::streamoff offsets_position = 44 + 3 * 4 + 12;
+  for (const uint64_t bad_offset : {~uint64_t{0}, uint64_t{1}}) {
+    {
+      std::fstream index(index_filename_,
+                         std::ios::binary | std::ios::in | std::ios::out);
+      index.seekp(offsets_position + 8);
+      index.write(reinterpret_cast<const char*>(&bad_offset),
+                  sizeof(bad_offset));
+      ASSERT_TRUE(index.good());
+    }
+    const IndexedLcmLog dut(filename_, index_filename_);
+    EXPECT_FALSE(dut.index_was_loaded());
+    EXPECT_EQ(dut.num_events(), 111);
+    EXPECT_EQ(dut.get_event(1).channel, "SLOW");
+  }
+}
+
+GTEST_TEST(IndexedLcmLogUnsortedTest, OutOfOrder) {
+  const std::string filename = temp_directory() + "/unsorted.lcmlog";
+  {
+    LogWriter writer(filename);
+    writer.Write(30, "A", "a");
+    writer.Write(10, "B", "b");
+    writer.Write(20, "A", "c");
+  }
+  const IndexedLcmLog dut(filename);
+  ASSERT_EQ(dut.num_events(), 3);
+  EXPECT_EQ(dut.get_event(0).channel, "B");
+  EXPECT_EQ(dut.get_event(0).event_number, 1);
+  EXPECT_EQ(dut.get_event(1).timestamp, 20);
+  EXPECT_EQ(dut.get_event(2).timestamp, 30);
+  EXPECT_EQ(dut.GetChannelEvents("A"), std::vector<int>({1, 2}));
+}
+
+GTEST_TEST(IndexedLcmLogErrorTest, MissingFile) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      IndexedLcmLog("/no/such/file.lcmlog"),
+      ".*failed to open log file.*");
+}
+
+}  // namespace
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,74 @@
+#include "drake/lcm/lcm_message_queue.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace lcm {
+namespace internal {
+namespace {
+
+GTEST_TEST(LcmMessageQueueTest, Basic) {
+  LcmMessageQueue dut(2);
+  EXPECT_EQ(dut.capacity(), 2);
+  EXPECT_EQ(dut.front(), nullptr);
+
+  const uint8_t bytes[] = {1, 2, 3};
+  EXPECT_TRUE(dut.Push("A", bytes, 3));
+  EXPECT_TRUE(dut.Push("B", bytes, 1));
+  // Full; the new message is dropped.
+  EXPECT_FALSE(dut.Push("C", bytes, 2));
+  EXPECT_EQ(dut.num_dropped(), 1);
+
+  ASSERT_NE(dut.front(), nullptr);
+  EXPECT_EQ(dut.front()->channel, "A");
+  EXPECT_EQ(dut.front()->data, std::vector<uint8_t>({1, 2, 3}));
+  dut.Pop();
+  ASSERT_NE(dut.front(), nullptr);
+  EXPECT_EQ(dut.front()->channel, "B");
+  EXPECT_EQ(dut.front()->data, std::vector<uint8_t>({1}));
+
+  // Wrap around the end of the storage.
+  EXPECT_TRUE(dut.Push("D", nullptr, 0));
+  dut.Pop();
+  ASSERT_NE(dut.front(), nullptr);
+  EXPECT_EQ(dut.front()->channel, "D");
+  EXPECT_TRUE(dut.front()->data.empty());
+  dut.Pop();
+  EXPECT_EQ(dut.front(), nullptr);
+}
+
+// Streams messages from a producer thread to this (consumer) thread, and
+// checks that every message that was not dropped arrives intact and in order.
+GTEST_TEST(LcmMessageQueueTest, Threaded) {
+  constexpr int kNumMessages = 100000;
+  LcmMessageQueue dut(16);
+  std::thread producer([&dut]() {
+    for (int i = 0; i < kNumMessages; ++i) {
+      const uint8_t byte = i % 256;
+      const std::vector<uint8_t> bytes(1 + i % 7, byte);
+      while (!dut.Push("X", bytes.data(), bytes.size())) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  for (int i = 0; i < kNumMessages; ++i) {
+    const LcmMessageQueue::Message* message{};
+    while ((message = dut.front()) == nullptr) {
+      std::this_thread::yield();
+    }
+    ASSERT_EQ(message->data.size(), 1 + i % 7);
+    for (const uint8_t byte : message->data) {
+      ASSERT_EQ(byte, i % 256);
+    }
+    dut.Pop();
+  }
+  producer.join();
+  EXPECT_EQ(dut.front(), nullptr);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace lcm
+}  // namespace drake
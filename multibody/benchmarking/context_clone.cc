@@ -0,0 +1,131 @@
+// @file
+// Benchmarks for cloning the context of a MultibodyPlant and SceneGraph
+// diagram, as in sampling-based planning or tree-search rollouts that only
+// change the plant state.
+//
+// This compares Context::Clone() with Context::CloneCopyOnWrite(), whose
+// clones share SceneGraph's GeometryState (and its engines) with the original.
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/geometry/query_object.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using geometry::QueryObject;
+using geometry::SceneGraph;
+using systems::Context;
+using systems::Diagram;
+using systems::DiagramBuilder;
+
+class ContextCloneFixture : public benchmark::Fixture {
+ public:
+  ContextCloneFixture() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State&) override {
+    const int kNumIiwas = 10;
+
+    const std::string iiwa_path = FindResourceOrThrow(
+        "drake/manipulation/models/iiwa_description/sdf/"
+        "iiwa14_polytope_collision.sdf");
+    DiagramBuilder<double> builder;
+    auto [plant, scene_graph] = AddMultibodyPlantSceneGraph(&builder, 0.0);
+    plant_ = &plant;
+    scene_graph_ = &scene_graph;
+    Parser parser(plant_);
+    for (int i = 0; i < kNumIiwas; ++i) {
+      const ModelInstanceIndex model_instance =
+          parser.AddModelFromFile(iiwa_path, fmt::format("iiwa{}", i));
+      plant_->WeldFrames(
+          plant_->world_frame(),
+          plant_->GetFrameByName("iiwa_link_0", model_instance),
+          math::RigidTransformd(Eigen::Vector3d(0.5 * i, 0, 0)));
+    }
+    plant_->Finalize();
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+
+    q_ = Eigen::VectorXd::LinSpaced(plant_->num_positions(), -0.5, 0.5);
+    frame_id_ = plant_->GetBodyFrameIdOrThrow(
+        plant_->GetBodyByName("iiwa_link_7",
+                              plant_->GetModelInstanceByName("iiwa0"))
+            .index());
+  }
+
+ protected:
+  // Mimics a rollout step, which changes the plant positions and evaluates the
+  // poses of the geometries. When `query_proximity` is true, it also evaluates
+  // a proximity query.
+  void Step(Context<double>* context, bool query_proximity) {
+    Context<double>& plant_context =
+        plant_->GetMyMutableContextFromRoot(context);
+    q_(0) += 0.01;  // avoid caching.
+    plant_->SetPositions(&plant_context, q_);
+    const auto& query_object =
+        scene_graph_->get_query_output_port()
+            .Eval<QueryObject<double>>(
+                scene_graph_->GetMyContextFromRoot(*context));
+    benchmark::DoNotOptimize(query_object.GetPoseInWorld(frame_id_));
+    if (query_proximity) {
+      benchmark::DoNotOptimize(query_object.ComputePointPairPenetration());
+    }
+  }
+
+  MultibodyPlant<double>* plant_{};
+  SceneGraph<double>* scene_graph_{};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+  Eigen::VectorXd q_;
+  geometry::FrameId frame_id_;
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(ContextCloneFixture, Clone)(benchmark::State& state) {
+  for (auto _ : state) {
+    auto clone = context_->Clone();
+    Step(clone.get(), false);
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(ContextCloneFixture, CloneCopyOnWrite)(benchmark::State& state) {
+  for (auto _ : state) {
+    auto clone = context_->CloneCopyOnWrite();
+    Step(clone.get(), false);
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(ContextCloneFixture, CloneWithQuery)(benchmark::State& state) {
+  for (auto _ : state) {
+    auto clone = context_->Clone();
+    Step(clone.get(), true);
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(ContextCloneFixture, CloneCopyOnWriteWithQuery)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    auto clone = context_->CloneCopyOnWrite();
+    Step(clone.get(), true);
+  }
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
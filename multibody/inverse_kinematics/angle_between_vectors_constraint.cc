@@ -3,6 +3,7 @@
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+using drake::multibody::internal::KinematicPathGradientSparsityPattern;
 using drake::multibody::internal::NormalizeVector;
 using drake::multibody::internal::RefFromPtrOrThrow;
 using drake::multibody::internal::UpdateContextConfiguration;
@@ -33,6 +34,8 @@ AngleBetweenVectorsConstraint::AngleBetweenVectorsConstraint(
         "AngleBetweenVectorsConstraint: should satisfy 0 <= angle_lower <= "
         "angle_upper <= pi");
   }
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frameA, frameB, num_outputs()));
 }
 
 AngleBetweenVectorsConstraint::AngleBetweenVectorsConstraint(
@@ -61,6 +64,8 @@ AngleBetweenVectorsConstraint::AngleBetweenVectorsConstraint(
         "AngleBetweenVectorsConstraint: should satisfy 0 <= angle_lower <= "
         "angle_upper <= pi");
   }
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frameA, frameB, num_outputs()));
 }
 
 void EvalConstraintGradient(
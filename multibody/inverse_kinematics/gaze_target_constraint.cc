@@ -5,6 +5,7 @@
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+using drake::multibody::internal::KinematicPathGradientSparsityPattern;
 using drake::multibody::internal::NormalizeVector;
 using drake::multibody::internal::RefFromPtrOrThrow;
 using drake::multibody::internal::UpdateContextConfiguration;
@@ -37,6 +38,8 @@ GazeTargetConstraint::GazeTargetConstraint(
     throw std::invalid_argument(
         "GazeTargetConstraint: cone_half_angle should be within [0, pi/2]");
   }
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frameA, frameB, num_outputs()));
 }
 
 GazeTargetConstraint::GazeTargetConstraint(
@@ -67,6 +70,8 @@ GazeTargetConstraint::GazeTargetConstraint(
     throw std::invalid_argument(
         "GazeTargetConstraint: cone_half_angle should be within [0, pi/2]");
   }
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frameA, frameB, num_outputs()));
 }
 
 void EvalConstraintGradient(
@@ -1,5 +1,9 @@
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+#include <algorithm>
+#include <iterator>
+#include <unordered_map>
+
 namespace drake {
 namespace multibody {
 namespace internal {
@@ -69,6 +73,104 @@ void UpdateContextPositionsAndVelocities(
     plant.SetPositionsAndVelocities(context, q_v);
   }
 }
+
+namespace {
+// Adds the indices of the positions on the path from `body` to the world into
+// `indices`. Returns false if the path cannot be determined (e.g. because a
+// body has neither an inboard joint nor a floating mobilizer).
+template <typename T>
+bool AddPathToWorldPositionIndices(
+    const MultibodyPlant<T>& plant,
+    const std::unordered_map<BodyIndex, JointIndex>& inboard_joints,
+    const Body<T>& body, std::vector<int>* indices) {
+  BodyIndex current = body.index();
+  // A path visits each body at most once; guard against ill-formed trees.
+  for (int depth = 0; depth < plant.num_bodies(); ++depth) {
+    if (current == world_index()) {
+      return true;
+    }
+    const auto joint = inboard_joints.find(current);
+    if (joint != inboard_joints.end()) {
+      const Joint<T>& inboard = plant.get_joint(joint->second);
+      for (int i = 0; i < inboard.num_positions(); ++i) {
+        indices->push_back(inboard.position_start() + i);
+      }
+      current = inboard.parent_body().index();
+      continue;
+    }
+    const Body<T>& current_body = plant.get_body(current);
+    if (!current_body.is_floating()) {
+      return false;
+    }
+    const int num_floating_positions =
+        current_body.has_quaternion_dofs() ? 7 : 6;
+    for (int i = 0; i < num_floating_positions; ++i) {
+      indices->push_back(current_body.floating_positions_start() + i);
+    }
+    return true;
+  }
+  return false;
+}
+}  // namespace
+
+template <typename T>
+std::vector<int> GetKinematicPathPositionIndices(const MultibodyPlant<T>& plant,
+                                                 const Frame<T>& frameA,
+                                                 const Frame<T>& frameB) {
+  std::unordered_map<BodyIndex, JointIndex> inboard_joints;
+  for (JointIndex i(0); i < plant.num_joints(); ++i) {
+    inboard_joints.emplace(plant.get_joint(i).child_body().index(), i);
+  }
+  std::vector<int> path_A;
+  std::vector<int> path_B;
+  if (!AddPathToWorldPositionIndices(plant, inboard_joints, frameA.body(),
+                                     &path_A) ||
+      !AddPathToWorldPositionIndices(plant, inboard_joints, frameB.body(),
+                                     &path_B)) {
+    std::vector<int> all(plant.num_positions());
+    for (int i = 0; i < plant.num_positions(); ++i) {
+      all[i] = i;
+    }
+    return all;
+  }
+  std::sort(path_A.begin(), path_A.end());
+  std::sort(path_B.begin(), path_B.end());
+  std::vector<int> result;
+  std::set_symmetric_difference(path_A.begin(), path_A.end(), path_B.begin(),
+                                path_B.end(), std::back_inserter(result));
+  return result;
+}
+
+template <typename T>
+std::vector<std::pair<int, int>> KinematicPathGradientSparsityPattern(
+    const MultibodyPlant<T>& plant, const Frame<T>& frameA,
+    const Frame<T>& frameB, int num_outputs) {
+  const std::vector<int> q_indices =
+      GetKinematicPathPositionIndices(plant, frameA, frameB);
+  std::vector<std::pair<int, int>> pattern;
+  pattern.reserve(num_outputs * q_indices.size());
+  for (int row = 0; row < num_outputs; ++row) {
+    for (int q_index : q_indices) {
+      pattern.emplace_back(row, q_index);
+    }
+  }
+  return pattern;
+}
+
+template std::vector<int> GetKinematicPathPositionIndices<double>(
+    const MultibodyPlant<double>&, const Frame<double>&, const Frame<double>&);
+template std::vector<int> GetKinematicPathPositionIndices<AutoDiffXd>(
+    const MultibodyPlant<AutoDiffXd>&, const Frame<AutoDiffXd>&,
+    const Frame<AutoDiffXd>&);
+template std::vector<std::pair<int, int>>
+KinematicPathGradientSparsityPattern<double>(const MultibodyPlant<double>&,
+                                             const Frame<double>&,
+                                             const Frame<double>&, int);
+template std::vector<std::pair<int, int>>
+KinematicPathGradientSparsityPattern<AutoDiffXd>(
+    const MultibodyPlant<AutoDiffXd>&, const Frame<AutoDiffXd>&,
+    const Frame<AutoDiffXd>&, int);
+
 }  // namespace internal
 }  // namespace multibody
 }  // namespace drake
@@ -2,6 +2,8 @@
 
 #include <limits>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/plant/multibody_plant.h"
@@ -85,6 +87,31 @@ const MultibodyPlant<T>& RefFromPtrOrThrow(
   return *plant;
 }
 
+/*
+ * Returns the (sorted) indices of the generalized positions q that can affect
+ * the pose of `frameB` relative to `frameA`, namely the positions of the
+ * joints on the kinematic path between the two frames' bodies. The joints
+ * which are shared by the paths from both bodies to the world do not affect the
+ * relative pose, and are excluded. If the path cannot be determined, then all
+ * of the plant's positions are returned.
+ */
+template <typename T>
+std::vector<int> GetKinematicPathPositionIndices(const MultibodyPlant<T>& plant,
+                                                 const Frame<T>& frameA,
+                                                 const Frame<T>& frameB);
+
+/*
+ * Returns the gradient sparsity pattern of a kinematic constraint with
+ * `num_outputs` rows that are functions of the relative pose of `frameA` and
+ * `frameB`, and whose decision variables are the plant's generalized positions
+ * q. Each row can only depend on GetKinematicPathPositionIndices(). See
+ * solvers::EvaluatorBase::SetGradientSparsityPattern().
+ */
+template <typename T>
+std::vector<std::pair<int, int>> KinematicPathGradientSparsityPattern(
+    const MultibodyPlant<T>& plant, const Frame<T>& frameA,
+    const Frame<T>& frameB, int num_outputs);
+
 template <typename T>
 T* PtrOrThrow(T* ptr, std::string_view error) {
   if (ptr == nullptr) {
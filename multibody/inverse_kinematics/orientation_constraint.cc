@@ -3,6 +3,7 @@
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+using drake::multibody::internal::KinematicPathGradientSparsityPattern;
 using drake::multibody::internal::RefFromPtrOrThrow;
 using drake::multibody::internal::UpdateContextConfiguration;
 
@@ -29,6 +30,8 @@ OrientationConstraint::OrientationConstraint(
     throw std::invalid_argument(
         "OrientationConstraint: theta_bound should be non-negative.\n");
   }
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frameAbar, frameBbar, num_outputs()));
 }
 
 OrientationConstraint::OrientationConstraint(
@@ -54,6 +57,8 @@ OrientationConstraint::OrientationConstraint(
     throw std::invalid_argument(
         "OrientationConstraint: theta_bound should be non-negative.\n");
   }
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frameAbar, frameBbar, num_outputs()));
 }
 
 namespace {
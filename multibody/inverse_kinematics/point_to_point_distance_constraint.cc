@@ -3,6 +3,7 @@
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+using drake::multibody::internal::KinematicPathGradientSparsityPattern;
 using drake::multibody::internal::RefFromPtrOrThrow;
 using drake::multibody::internal::UpdateContextConfiguration;
 
@@ -30,6 +31,8 @@ PointToPointDistanceConstraint::PointToPointDistanceConstraint(
   }
   DRAKE_DEMAND(distance_lower >= 0);
   DRAKE_DEMAND(distance_upper >= distance_lower);
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frame1, frame2, num_outputs()));
 }
 
 PointToPointDistanceConstraint::PointToPointDistanceConstraint(
@@ -55,6 +58,8 @@ PointToPointDistanceConstraint::PointToPointDistanceConstraint(
   }
   DRAKE_DEMAND(distance_lower >= 0);
   DRAKE_DEMAND(distance_upper >= distance_lower);
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frame1, frame2, num_outputs()));
 }
 
 template <typename T>
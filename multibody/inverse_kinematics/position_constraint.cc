@@ -3,6 +3,7 @@
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/inverse_kinematics/kinematic_evaluator_utilities.h"
 
+using drake::multibody::internal::KinematicPathGradientSparsityPattern;
 using drake::multibody::internal::RefFromPtrOrThrow;
 using drake::multibody::internal::UpdateContextConfiguration;
 
@@ -41,6 +42,8 @@ PositionConstraint::PositionConstraint(
   if (plant_context == nullptr)
     throw std::invalid_argument(
         "PositionConstraint(): plant_context is nullptr.");
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frameAbar, frameB, num_outputs()));
 }
 
 PositionConstraint::PositionConstraint(
@@ -65,6 +68,8 @@ PositionConstraint::PositionConstraint(
       context_autodiff_(plant_context) {
   if (plant_context == nullptr)
     throw std::invalid_argument("plant_context is nullptr.");
+  SetGradientSparsityPattern(KinematicPathGradientSparsityPattern(
+      *plant, frameAbar, frameB, num_outputs()));
 }
 
 PositionConstraint::PositionConstraint(
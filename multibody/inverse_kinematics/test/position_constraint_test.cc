@@ -1,6 +1,8 @@
 #include "drake/multibody/inverse_kinematics/position_constraint.h"
 
 #include <limits>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -134,6 +136,40 @@ TEST_F(IiwaKinematicConstraintTest, PositionConstraint) {
   EXPECT_TRUE(CompareMatrices(constraint.upper_bound(), new_ub));
 }
 
+TEST_F(IiwaKinematicConstraintTest, PositionConstraintGradientSparsity) {
+  // Only the joints between iiwa_link_3 and iiwa_link_7 (namely iiwa_joint_4
+  // to iiwa_joint_7) affect the relative position of the two links.
+  const Frame<double>& frameA = plant_->GetFrameByName("iiwa_link_7");
+  const Frame<double>& frameB = plant_->GetFrameByName("iiwa_link_3");
+  std::vector<std::pair<int, int>> pattern_expected;
+  for (int row = 0; row < 3; ++row) {
+    for (int q_index = 3; q_index < 7; ++q_index) {
+      pattern_expected.emplace_back(row, q_index);
+    }
+  }
+  const PositionConstraint dut(plant_, frameA, Eigen::Vector3d::Zero(),
+                               Eigen::Vector3d::Zero(), frameB,
+                               Eigen::Vector3d::Zero(), plant_context_);
+  ASSERT_TRUE(dut.gradient_sparsity_pattern().has_value());
+  EXPECT_EQ(dut.gradient_sparsity_pattern().value(), pattern_expected);
+
+  const PositionConstraint dut_autodiff(
+      plant_autodiff_.get(), plant_autodiff_->GetFrameByName("iiwa_link_7"),
+      Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero(),
+      plant_autodiff_->GetFrameByName("iiwa_link_3"), Eigen::Vector3d::Zero(),
+      plant_context_autodiff_.get());
+  EXPECT_EQ(dut_autodiff.gradient_sparsity_pattern(),
+            dut.gradient_sparsity_pattern());
+
+  // The gradient is indeed zero outside of the sparsity pattern.
+  Eigen::VectorXd q(7);
+  q << 0.1, 0.2, 0.3, 0.4, -0.1, -0.2, -0.3;
+  AutoDiffVecXd y;
+  dut.Eval(math::InitializeAutoDiff(q), &y);
+  const Eigen::MatrixXd dy = math::ExtractGradient(y);
+  EXPECT_TRUE(CompareMatrices(dy.leftCols<3>(), Eigen::MatrixXd::Zero(3, 3)));
+}
+
 TEST_F(TwoFreeBodiesConstraintTest, PositionConstraint) {
   // Given two free bodies with some given (arbitrary) poses, check if the poses
   // satisfy given position constraints.
@@ -169,6 +205,21 @@ TEST_F(TwoFreeBodiesConstraintTest, PositionConstraint) {
         plant_->get_frame(body1_index_), p_BQ, plant_context_);
     EXPECT_FALSE(bad_constraint.CheckSatisfied(q));
   }
+  {
+    // A free body's position only depends on its own floating positions.
+    PositionConstraint world_constraint(
+        plant_, plant_->world_frame(), p_AQ, p_AQ,
+        plant_->get_frame(body1_index_), p_BQ, plant_context_);
+    ASSERT_TRUE(world_constraint.gradient_sparsity_pattern().has_value());
+    const int body1_positions_start =
+        plant_->get_frame(body1_index_).body().floating_positions_start();
+    EXPECT_EQ(world_constraint.gradient_sparsity_pattern()->size(), 3 * 7);
+    for (const auto& [row, q_index] :
+         world_constraint.gradient_sparsity_pattern().value()) {
+      EXPECT_GE(q_index, body1_positions_start);
+      EXPECT_LT(q_index, body1_positions_start + 7);
+    }
+  }
 }
 }  // namespace
 }  // namespace multibody
@@ -113,9 +113,67 @@ static void BenchmarkSosProgram3(benchmark::State& state) {  // NOLINT
   }
 }
 
+// Returns the banded expressions xᵢ - 2xᵢ₊₁ + xᵢ₊₂ for i = 0, ..., n - 1. Many
+// programs (e.g., the ones constructed by GCS or IRIS) impose a large number of
+// sparse linear constraints like these.
+VectorX<symbolic::Expression> MakeBandedExpressions(
+    const VectorXDecisionVariable& x, int n) {
+  return x.head(n) - 2.0 * x.segment(1, n) + x.tail(n);
+}
+
+// Adds the linear constraints as one array of formulas.
+static void BenchmarkAddLinearConstraintFormulas(
+    benchmark::State& state) {  // NOLINT
+  const int n = state.range(0);
+  for (auto _ : state) {
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables(n + 2, "x");
+    const VectorX<symbolic::Expression> v = MakeBandedExpressions(x, n);
+    prog.AddLinearConstraint(v.array() <= 1.0);
+  }
+}
+
+// Adds the linear constraints one formula at a time.
+static void BenchmarkAddLinearConstraintFormulaLoop(
+    benchmark::State& state) {  // NOLINT
+  const int n = state.range(0);
+  for (auto _ : state) {
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables(n + 2, "x");
+    const VectorX<symbolic::Expression> v = MakeBandedExpressions(x, n);
+    for (int i = 0; i < n; ++i) {
+      prog.AddLinearConstraint(v(i) <= 1.0);
+    }
+  }
+}
+
+// Adds the linear equality constraints as one vector of expressions.
+static void BenchmarkAddLinearEqualityConstraintExpressions(
+    benchmark::State& state) {  // NOLINT
+  const int n = state.range(0);
+  for (auto _ : state) {
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables(n + 2, "x");
+    const VectorX<symbolic::Expression> v = MakeBandedExpressions(x, n);
+    prog.AddLinearEqualityConstraint(v, Eigen::VectorXd::Zero(n));
+  }
+}
+
 BENCHMARK(BenchmarkSosProgram1);
 BENCHMARK(BenchmarkSosProgram2);
 BENCHMARK(BenchmarkSosProgram3);
+BENCHMARK(BenchmarkAddLinearConstraintFormulas)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BenchmarkAddLinearConstraintFormulaLoop)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BenchmarkAddLinearEqualityConstraintExpressions)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond);
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
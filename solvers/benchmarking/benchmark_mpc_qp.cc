@@ -0,0 +1,128 @@
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/solvers/clp_solver.h"
+#include "drake/solvers/fbstab_solver.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/osqp_solver.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+// The model predictive control QP of a chain of four masses connected by
+// springs, with one force input per mass, transcribed the way
+// DirectTranscription transcribes a discrete-time linear system. The argument
+// is the number of samples.
+class MpcQp : public benchmark::Fixture {
+ public:
+  MpcQp() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    const int num_samples = state.range(0);
+    const int num_masses = 4;
+    const int nx = 2 * num_masses;
+    const int nu = num_masses;
+    const double dt = 0.05;
+    // Semi-implicit Euler discretization of q̈ = -K q + u.
+    Eigen::MatrixXd K = Eigen::MatrixXd::Zero(num_masses, num_masses);
+    for (int i = 0; i < num_masses; ++i) {
+      K(i, i) = 2;
+      if (i > 0) {
+        K(i, i - 1) = -1;
+        K(i - 1, i) = -1;
+      }
+    }
+    Eigen::MatrixXd A(nx, nx);
+    A << Eigen::MatrixXd::Identity(num_masses, num_masses) - dt * dt * K,
+        dt * Eigen::MatrixXd::Identity(num_masses, num_masses), -dt * K,
+        Eigen::MatrixXd::Identity(num_masses, num_masses);
+    Eigen::MatrixXd B(nx, nu);
+    B << dt * dt * Eigen::MatrixXd::Identity(num_masses, num_masses),
+        dt * Eigen::MatrixXd::Identity(num_masses, num_masses);
+
+    prog_ = std::make_unique<MathematicalProgram>();
+    const auto x = prog_->NewContinuousVariables(nx, num_samples, "x");
+    const auto u = prog_->NewContinuousVariables(nu, num_samples, "u");
+    Eigen::MatrixXd dynamics(nx, 2 * nx + nu);
+    dynamics << A, B, -Eigen::MatrixXd::Identity(nx, nx);
+    for (int k = 0; k < num_samples - 1; ++k) {
+      prog_->AddLinearEqualityConstraint(
+          dynamics, Eigen::VectorXd::Zero(nx),
+          {x.col(k), u.col(k), x.col(k + 1)});
+    }
+    prog_->AddLinearEqualityConstraint(u.col(num_samples - 2) ==
+                                       u.col(num_samples - 1));
+    for (int k = 0; k < num_samples - 1; ++k) {
+      prog_->AddQuadraticErrorCost(Eigen::MatrixXd::Identity(nx, nx),
+                                   Eigen::VectorXd::Zero(nx), x.col(k));
+      prog_->AddQuadraticErrorCost(0.01 * Eigen::MatrixXd::Identity(nu, nu),
+                                   Eigen::VectorXd::Zero(nu), u.col(k));
+    }
+    prog_->AddBoundingBoxConstraint(-1, 1, u);
+    prog_->AddBoundingBoxConstraint(-0.5, 0.5, x.bottomRows(num_masses));
+    Eigen::VectorXd x0 = Eigen::VectorXd::Zero(nx);
+    x0.head(num_masses) = Eigen::VectorXd::LinSpaced(num_masses, 1, -1);
+    prog_->AddBoundingBoxConstraint(x0, x0, x.col(0));
+  }
+
+ protected:
+  void Run(const SolverInterface& solver, benchmark::State& state) {
+    if (!solver.available()) {
+      state.SkipWithError("The solver is not available.");
+      return;
+    }
+    for (auto _ : state) {
+      MathematicalProgramResult result;
+      solver.Solve(*prog_, std::nullopt, std::nullopt, &result);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+
+  std::unique_ptr<MathematicalProgram> prog_;
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(MpcQp, Fbstab)(benchmark::State& state) {
+  Run(internal::FbstabSolver(), state);
+}
+BENCHMARK_REGISTER_F(MpcQp, Fbstab)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(20)
+    ->Arg(50)
+    ->Arg(100)
+    ->Arg(200);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(MpcQp, Osqp)(benchmark::State& state) {
+  Run(OsqpSolver(), state);
+}
+BENCHMARK_REGISTER_F(MpcQp, Osqp)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(20)
+    ->Arg(50)
+    ->Arg(100)
+    ->Arg(200);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(MpcQp, Clp)(benchmark::State& state) {
+  Run(ClpSolver(), state);
+}
+BENCHMARK_REGISTER_F(MpcQp, Clp)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(20)
+    ->Arg(50)
+    ->Arg(100)
+    ->Arg(200);
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,86 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/solve.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+// A batch of small, independent QPs, such as those that score grasp candidates
+// or seed inverse kinematics.
+class BatchOfQps : public benchmark::Fixture {
+ public:
+  BatchOfQps() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State&) override {
+    const int num_progs = 200;
+    const int num_vars = 10;
+    progs_.clear();
+    prog_ptrs_.clear();
+    for (int i = 0; i < num_progs; ++i) {
+      auto prog = std::make_unique<MathematicalProgram>();
+      const auto x = prog->NewContinuousVariables(num_vars);
+      // min |x - x_desired|² s.t. -1 ≤ x ≤ 1, sum(x) ≥ 0.5.
+      Eigen::VectorXd x_desired(num_vars);
+      for (int j = 0; j < num_vars; ++j) {
+        x_desired(j) = std::sin(0.1 * i + j);
+      }
+      prog->AddQuadraticErrorCost(Eigen::MatrixXd::Identity(num_vars, num_vars),
+                                  x_desired, x);
+      prog->AddBoundingBoxConstraint(-1, 1, x);
+      prog->AddLinearConstraint(Eigen::RowVectorXd::Ones(num_vars), 0.5,
+                                std::numeric_limits<double>::infinity(), x);
+      prog_ptrs_.push_back(prog.get());
+      progs_.push_back(std::move(prog));
+    }
+  }
+
+ protected:
+  std::vector<std::unique_ptr<MathematicalProgram>> progs_;
+  std::vector<const MathematicalProgram*> prog_ptrs_;
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(BatchOfQps, SerialSolve)(benchmark::State& state) {
+  for (auto _ : state) {
+    for (const MathematicalProgram* prog : prog_ptrs_) {
+      benchmark::DoNotOptimize(Solve(*prog));
+    }
+  }
+}
+BENCHMARK_REGISTER_F(BatchOfQps, SerialSolve)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// The argument is the number of threads.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(BatchOfQps, SolveInParallel)(benchmark::State& state) {
+  const int num_threads = state.range(0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SolveInParallel(prog_ptrs_, nullptr, nullptr,
+                                             std::nullopt, num_threads));
+  }
+}
+BENCHMARK_REGISTER_F(BatchOfQps, SolveInParallel)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8);
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
@@ -7,6 +7,7 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/gurobi_solver.h"
@@ -292,6 +293,13 @@ void MixedIntegerBranchAndBoundNode::FixBinaryVariable(
 
 void MixedIntegerBranchAndBoundNode::Branch(
     const symbolic::Variable& binary_variable) {
+  CreateChildren(binary_variable, false /* warm_start */);
+  left_child_->SolveProgram();
+  right_child_->SolveProgram();
+}
+
+void MixedIntegerBranchAndBoundNode::CreateChildren(
+    const symbolic::Variable& binary_variable, bool warm_start) {
   left_child_.reset(new MixedIntegerBranchAndBoundNode(
       *prog_, remaining_binary_variables_, solver_id_));
   right_child_.reset(new MixedIntegerBranchAndBoundNode(
@@ -300,17 +308,20 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
-  left_child_->solution_result_ = SolveProgramWithSolver(
-      *left_child_->prog_, left_child_->solver_id_,
-      left_child_->prog_result_.get());
-  right_child_->solution_result_ = SolveProgramWithSolver(
-      *right_child_->prog_, right_child_->solver_id_,
-      right_child_->prog_result_.get());
-  if (left_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    left_child_->CheckOptimalSolutionIsIntegral();
+  // Warm start the children from the relaxed solution in this node.
+  if (warm_start && solution_result_ == SolutionResult::kSolutionFound) {
+    const Eigen::VectorXd x_sol =
+        prog_result_->GetSolution(prog_->decision_variables());
+    left_child_->prog_->SetInitialGuessForAllVariables(x_sol);
+    right_child_->prog_->SetInitialGuessForAllVariables(x_sol);
   }
-  if (right_child_->solution_result_ == SolutionResult::kSolutionFound) {
-    right_child_->CheckOptimalSolutionIsIntegral();
+}
+
+void MixedIntegerBranchAndBoundNode::SolveProgram() {
+  solution_result_ =
+      SolveProgramWithSolver(*prog_, solver_id_, prog_result_.get());
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    CheckOptimalSolutionIsIntegral();
   }
 }
 
@@ -323,6 +334,7 @@ MixedIntegerBranchAndBound::MixedIntegerBranchAndBound(
       solutions_{} {
   std::tie(root_, map_old_vars_to_new_vars_) =
       MixedIntegerBranchAndBoundNode::ConstructRootNode(prog, solver_id);
+  solver_is_thread_safe_ = MakeSolver(solver_id)->is_thread_safe();
   if (root_->solution_result() == SolutionResult::kSolutionFound) {
     best_lower_bound_ = root_->prog_result()->get_optimal_cost();
     // If an integral solution is found, then update the best solutions,
@@ -360,20 +372,23 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
-    // Found a branching node, branch on this node. If no branching node is
+  std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+      PickBranchingNodes(num_threads_);
+  while (!branching_nodes.empty()) {
+    // Found branching nodes, branch on these nodes. If no branching node is
     // found, then every leaf node is fathomed, the branch-and-bound process
     // should terminate.
     // TODO(hongkai.dai) We might need to have a function that picks the
     // branching node together with the branching variable simultaneously.
-    const symbolic::Variable* branching_variable =
-        PickBranchingVariable(*branching_node);
-    BranchAndUpdate(branching_node, *branching_variable);
+    std::vector<const symbolic::Variable*> branching_variables;
+    for (const auto* branching_node : branching_nodes) {
+      branching_variables.push_back(PickBranchingVariable(*branching_node));
+    }
+    BranchAndUpdate(branching_nodes, branching_variables);
     if (HasConverged()) {
       return SolutionResult::kSolutionFound;
     }
-    branching_node = PickBranchingNode();
+    branching_nodes = PickBranchingNodes(num_threads_);
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -386,6 +401,11 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       "Unknown result. The problem is not optimal, infeasible, nor unbounded.");
 }
 
+void MixedIntegerBranchAndBound::set_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  num_threads_ = num_threads;
+}
+
 void MixedIntegerBranchAndBound::NodeCallback(
     const MixedIntegerBranchAndBoundNode& node) {
   if (node_callback_userfun_ != nullptr) {
@@ -612,6 +632,69 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickDepthFirstNode()
   return PickDepthFirstNodeInSubTree(*this, *root_);
 }
 
+namespace {
+// Appends the non-fathomed leaf nodes in the subtree, from left to right.
+void AddUnfathomedLeafNodesInSubTree(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* leaf_nodes) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      leaf_nodes->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+  } else {
+    AddUnfathomedLeafNodesInSubTree(bnb, *(sub_tree_root.left_child()),
+                                    leaf_nodes);
+    AddUnfathomedLeafNodesInSubTree(bnb, *(sub_tree_root.right_child()),
+                                    leaf_nodes);
+  }
+}
+}  // namespace
+
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes(int max_num_nodes) const {
+  DRAKE_DEMAND(max_num_nodes >= 1);
+  // The first node is the one that PickBranchingNode() would pick on its own.
+  MixedIntegerBranchAndBoundNode* first_node = PickBranchingNode();
+  if (first_node == nullptr) {
+    return {};
+  }
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes{first_node};
+  if (max_num_nodes == 1 ||
+      node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    return nodes;
+  }
+  std::vector<MixedIntegerBranchAndBoundNode*> leaf_nodes;
+  AddUnfathomedLeafNodesInSubTree(*this, *root_, &leaf_nodes);
+  // Order the remaining leaf nodes by the node selection method. The sort is
+  // stable, so ties are broken from left to right in the tree.
+  if (node_selection_method_ == NodeSelectionMethod::kMinLowerBound) {
+    std::stable_sort(leaf_nodes.begin(), leaf_nodes.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->prog_result()->get_optimal_cost() <
+                              b->prog_result()->get_optimal_cost();
+                     });
+  } else {
+    std::stable_sort(leaf_nodes.begin(), leaf_nodes.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->remaining_binary_variables().size() <
+                              b->remaining_binary_variables().size();
+                     });
+  }
+  for (auto* leaf_node : leaf_nodes) {
+    if (static_cast<int>(nodes.size()) >= max_num_nodes) {
+      break;
+    }
+    if (leaf_node != first_node) {
+      nodes.push_back(leaf_node);
+    }
+  }
+  return nodes;
+}
+
 const symbolic::Variable* MixedIntegerBranchAndBound::PickBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node) const {
   switch (variable_selection_method_) {
@@ -655,7 +738,31 @@ bool MixedIntegerBranchAndBound::IsLeafNodeFathomed(
 void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
-  node->Branch(branching_variable);
+  BranchAndUpdate(std::vector<MixedIntegerBranchAndBoundNode*>{node},
+                  std::vector<const symbolic::Variable*>{&branching_variable});
+}
+
+void MixedIntegerBranchAndBound::BranchAndUpdate(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+    const std::vector<const symbolic::Variable*>& branching_variables) {
+  DRAKE_DEMAND(nodes.size() == branching_variables.size());
+  std::vector<MixedIntegerBranchAndBoundNode*> children;
+  for (int i = 0; i < static_cast<int>(nodes.size()); ++i) {
+    nodes[i]->CreateChildren(*branching_variables[i],
+                             warm_start_children_from_parent_);
+    children.push_back(nodes[i]->left_child_.get());
+    children.push_back(nodes[i]->right_child_.get());
+  }
+  const int num_workers = solver_is_thread_safe_ ? num_threads_ : 1;
+  // Each thread repeatedly claims the next unsolved child node.
+  drake::internal::DynamicParallelFor(
+      num_workers, children.size(),
+      [&children](int, int k) { children[k]->SolveProgram(); });
+  UpdateAfterBranching(nodes);
+}
+
+void MixedIntegerBranchAndBound::UpdateAfterBranching(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes) {
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -663,20 +770,22 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
-    if (child->solution_result() == SolutionResult::kSolutionFound &&
-        child->optimal_solution_is_integral()) {
-      const double child_node_optimal_cost =
-          child->prog_result()->get_optimal_cost();
-      const Eigen::VectorXd x_sol =
-          child->prog_result()->GetSolution(
-              child->prog()->decision_variables());
-      UpdateIntegralSolution(x_sol, child_node_optimal_cost);
-    }
-    if (search_integral_solution_by_rounding_) {
-      SearchIntegralSolutionByRounding(*child);
+  for (const auto* node : nodes) {
+    for (auto& child : {node->left_child(), node->right_child()}) {
+      if (child->solution_result() == SolutionResult::kSolutionFound &&
+          child->optimal_solution_is_integral()) {
+        const double child_node_optimal_cost =
+            child->prog_result()->get_optimal_cost();
+        const Eigen::VectorXd x_sol =
+            child->prog_result()->GetSolution(
+                child->prog()->decision_variables());
+        UpdateIntegralSolution(x_sol, child_node_optimal_cost);
+      }
+      if (search_integral_solution_by_rounding_) {
+        SearchIntegralSolutionByRounding(*child);
+      }
+      NodeCallback(*child);
     }
-    NodeCallback(*child);
   }
 }
 
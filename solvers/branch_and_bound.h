@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
@@ -197,6 +198,20 @@ class MixedIntegerBranchAndBoundNode {
   // Only call this function AFTER the program is solved.
   void CheckOptimalSolutionIsIntegral();
 
+  // Creates the two child nodes by fixing binary_variable to 0 and 1, without
+  // solving their programs. If warm_start is true and this node has an optimal
+  // solution, then that solution is the initial guess of the child programs.
+  void CreateChildren(const symbolic::Variable& binary_variable,
+                      bool warm_start);
+
+  // Solves the program in this node, and checks if its optimal solution is
+  // integral.
+  void SolveProgram();
+
+  // MixedIntegerBranchAndBound creates and solves the child nodes separately,
+  // so that it can solve the programs of several nodes concurrently.
+  friend class MixedIntegerBranchAndBound;
+
   enum class OptimalSolutionIsIntegral {
     kTrue,   ///< The program in this node has been solved, and the solution to
              /// all binary variables satisfies the integral constraints.
@@ -494,6 +509,15 @@ class MixedIntegerBranchAndBound {
     search_integral_solution_by_rounding_ = flag;
   }
 
+  /** Set the flag to true if the user wants the optimization program in each
+   * child node to use the optimal solution of its parent node as the initial
+   * guess. Otherwise (the default), the child programs keep the initial guess
+   * of the mixed-integer program.
+   */
+  void SetWarmStartChildrenFromParent(bool flag) {
+    warm_start_children_from_parent_ = flag;
+  }
+
   /**
    * The user can set a defined callback function in each node. This function is
    * called after the optimization is solved in each node.
@@ -563,6 +587,25 @@ class MixedIntegerBranchAndBound {
   /** Geeter for the relative gap tolerance. */
   [[nodiscard]] double relative_gap_tol() const { return relative_gap_tol_; }
 
+  /**
+   * Setter for the number of threads used to solve the node programs.
+   * With more than one thread, each iteration of Solve() picks up to
+   * `num_threads` un-fathomed leaf nodes (in the order given by the node
+   * selection method), branches on all of them, and solves the programs in
+   * the new child nodes concurrently. The bounds, the solutions and the node
+   * callbacks are then updated in the order of the picked nodes, so the
+   * result only depends on `num_threads`, and not on the thread scheduling.
+   * The child programs are solved one at a time if the solver is not
+   * thread-safe (see SolverInterface::is_thread_safe()). With
+   * NodeSelectionMethod::kUserDefined, only one node is branched in each
+   * iteration.
+   * @throws std::exception if num_threads < 1.
+   */
+  void set_num_threads(int num_threads);
+
+  /** Getter for the number of threads. The default is 1. */
+  [[nodiscard]] int num_threads() const { return num_threads_; }
+
  private:
   // Forward declaration the tester class.
   friend class MixedIntegerBranchAndBoundTester;
@@ -582,6 +625,14 @@ class MixedIntegerBranchAndBound {
    */
   [[nodiscard]] MixedIntegerBranchAndBoundNode* PickDepthFirstNode() const;
 
+  /**
+   * Pick up to `max_num_nodes` distinct nodes to branch, in the order given by
+   * the node selection method. Returns an empty vector if every leaf node is
+   * fathomed.
+   */
+  [[nodiscard]] std::vector<MixedIntegerBranchAndBoundNode*>
+  PickBranchingNodes(int max_num_nodes) const;
+
   /**
    * Pick the branching variable in a node.
    */
@@ -597,6 +648,24 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on each of the nodes, solve the optimization programs in all the
+   * child nodes concurrently on up to num_threads() threads, and then update
+   * the best lower and upper bounds in the order of the nodes.
+   * @param nodes. The nodes to be branched.
+   * @param branching_variables. Branch on branching_variables[i] in nodes[i].
+   */
+  void BranchAndUpdate(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+      const std::vector<const symbolic::Variable*>& branching_variables);
+
+  /**
+   * Update the best lower and upper bounds after the nodes are branched, and
+   * call the node callback on each child node.
+   */
+  void UpdateAfterBranching(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
@@ -681,6 +750,8 @@ class MixedIntegerBranchAndBound {
 
   bool search_integral_solution_by_rounding_ = false;
 
+  bool warm_start_children_from_parent_ = false;
+
   // The user defined function to pick a branching variable. Default is null.
   VariableSelectFun variable_selection_userfun_ = nullptr;
 
@@ -689,6 +760,13 @@ class MixedIntegerBranchAndBound {
 
   // The user defined callback function in each node. Default is null.
   NodeCallbackFun node_callback_userfun_ = nullptr;
+
+  // The number of threads used to solve the programs in the nodes.
+  int num_threads_{1};
+
+  // Whether the solver can solve several programs concurrently. Set in the
+  // constructor.
+  bool solver_is_thread_safe_{false};
 };
 }  // namespace solvers
 }  // namespace drake
@@ -59,6 +59,9 @@ class ClpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Returns true, because each solve has its own ClpSimplex model.
+  bool is_thread_safe() const final;
+
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
@@ -21,6 +21,8 @@ SolverId ClpSolver::id() {
 
 bool ClpSolver::is_enabled() { return true; }
 
+bool ClpSolver::is_thread_safe() const { return true; }
+
 namespace {
 // If the program is compatible with this solver, returns true and clears the
 // explanation.  Otherwise, returns false and sets the explanation.  In either
@@ -2,9 +2,11 @@
 
 #include <cmath>
 #include <limits>
+#include <mutex>
 #include <set>
 #include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -586,10 +588,44 @@ ExpressionConstraint::ExpressionConstraint(
   }
 }
 
+const symbolic::CompiledExpressions* ExpressionConstraint::GetCompiled()
+    const {
+  std::call_once(compile_once_, [this]() {
+    // Compile the expressions followed by their (column-major) derivatives, so
+    // that the common subexpressions are shared, and the values can be
+    // evaluated on their own.
+    const std::vector<symbolic::Variable> parameters(
+        vars_.data(), vars_.data() + vars_.size());
+    VectorX<symbolic::Expression> values_and_gradients(expressions_.size() +
+                                                       derivatives_.size());
+    values_and_gradients << expressions_,
+        Eigen::Map<const VectorX<symbolic::Expression>>(derivatives_.data(),
+                                                        derivatives_.size());
+    try {
+      compiled_.emplace(parameters, values_and_gradients);
+    } catch (const std::exception&) {
+      // Some expressions (e.g., those with uninterpreted functions) cannot be
+      // compiled; they are evaluated using the environment instead.
+    }
+  });
+  return compiled_.has_value() ? &*compiled_ : nullptr;
+}
+
 void ExpressionConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                   Eigen::VectorXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
 
+  if (const symbolic::CompiledExpressions* compiled = GetCompiled()) {
+    // The values are the leading outputs of the compiled program.
+    y->resize(num_constraints());
+    compiled->Evaluate(x, y);
+    // Otherwise, evaluate symbolically below, which throws for, e.g., a
+    // division by zero.
+    if (y->allFinite()) {
+      return;
+    }
+  }
+
   // Set environment with current x values.
   for (int i = 0; i < vars_.size(); i++) {
     environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id()));
@@ -606,6 +642,22 @@ void ExpressionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                                   AutoDiffVecXd* y) const {
   DRAKE_DEMAND(x.rows() == vars_.rows());
 
+  if (const symbolic::CompiledExpressions* compiled = GetCompiled()) {
+    // Using ∂y/∂z = ∂f/∂x ∂x/∂z.
+    const int num_y = num_constraints();
+    Eigen::VectorXd values_and_gradients(num_y * (1 + x.size()));
+    compiled->Evaluate(math::ExtractValue(x), &values_and_gradients);
+    // Otherwise, evaluate symbolically below, which throws for, e.g., a
+    // division by zero.
+    if (values_and_gradients.allFinite()) {
+      const Eigen::Map<const Eigen::MatrixXd> dydx(
+          values_and_gradients.data() + num_y, num_y, x.size());
+      *y = math::InitializeAutoDiff(values_and_gradients.head(num_y),
+                                    dydx * math::ExtractGradient(x));
+      return;
+    }
+  }
+
   // Set environment with current x values.
   for (int i = 0; i < vars_.size(); i++) {
     environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id())).value();
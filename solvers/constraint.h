@@ -4,6 +4,8 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -17,6 +19,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
+#include "drake/common/symbolic/codegen.h"
 #include "drake/common/symbolic/expression.h"
 #include "drake/solvers/decision_variable.h"
 #include "drake/solvers/evaluator_base.h"
@@ -987,8 +990,18 @@ class LinearMatrixInequalityConstraint : public Constraint {
 
 /**
  * Impose a generic (potentially nonlinear) constraint represented as a
- * vector of symbolic Expression.  Expression::Evaluate is called on every
- * constraint evaluation.
+ * vector of symbolic Expression.  The expressions and their derivatives are
+ * compiled together the first time the constraint is evaluated (see
+ * symbolic::CompiledExpressions), and the compiled program is run on every
+ * constraint evaluation.  Expressions which cannot be compiled fall back to
+ * Expression::Evaluate.
+ *
+ * The compiled program follows IEEE floating-point semantics.  Whenever it
+ * produces a value (or, for AutoDiffXd, a derivative) which is not finite, the
+ * constraint is evaluated with Expression::Evaluate instead, so that the errors
+ * that it reports (e.g., a division by zero) are still thrown.  An error whose
+ * effect does not reach the result, e.g., the inner division of 1 / (1 / x) at
+ * x = 0, which yields 0, is not detected.
  *
  * Uses symbolic::Jacobian to provide the gradients to the AutoDiff method.
  *
@@ -1036,6 +1049,14 @@ class ExpressionConstraint : public Constraint {
   VectorXDecisionVariable vars_{0};
   std::unordered_map<symbolic::Variable::Id, int> map_var_to_index_;
 
+  // Returns the compiled expressions_ followed by the column-major
+  // derivatives_ (compiling them upon the first call), or nullptr if they
+  // cannot be compiled.
+  const symbolic::CompiledExpressions* GetCompiled() const;
+
+  mutable std::once_flag compile_once_;
+  mutable std::optional<symbolic::CompiledExpressions> compiled_;
+
   // Only for caching, does not carrying hidden state.
   mutable symbolic::Environment environment_;
 };
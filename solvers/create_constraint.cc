@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cmath>
 #include <sstream>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -37,36 +38,44 @@ Binding<Constraint> ParseConstraint(
     const Eigen::Ref<const Eigen::VectorXd>& ub) {
   DRAKE_ASSERT(v.rows() == lb.rows() && v.rows() == ub.rows());
 
-  if (!IsAffine(v)) {
+  // Decompose v = A * vars + b, which also determines whether v is affine.
+  Eigen::SparseMatrix<double> A;
+  Eigen::VectorXd b;
+  VectorXDecisionVariable vars;
+  if (!symbolic::DecomposeAffineExpressions(v, &A, &b, &vars)) {
     auto constraint = make_shared<ExpressionConstraint>(v, lb, ub);
     return CreateBinding(constraint, constraint->vars());
   }  // else, continue on to linear-specific version below.
 
   if ((ub - lb).isZero()) {
-    return ParseLinearEqualityConstraint(v, lb);
+    return CreateBinding(make_shared<LinearEqualityConstraint>(A, lb - b),
+                         vars);
   }
 
-  // Setup map_var_to_index and vars.
-  // such that map_var_to_index[vars(i)] = i
-  VectorXDecisionVariable vars;
-  unordered_map<Variable::Id, int> map_var_to_index;
-  std::tie(vars, map_var_to_index) =
-      symbolic::ExtractVariablesFromExpression(v);
+  // For each row of A, the number of nonzero coefficients, and the column and
+  // value of the (last) nonzero coefficient.
+  std::vector<int> num_row_variables(v.size(), 0);
+  std::vector<int> row_variable_index(v.size(), -1);
+  std::vector<double> row_variable_coeff(v.size(), 0.0);
+  for (int j = 0; j < A.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+      if (it.value() != 0) {
+        ++num_row_variables[it.row()];
+        row_variable_index[it.row()] = j;
+        row_variable_coeff[it.row()] = it.value();
+      }
+    }
+  }
 
-  // Construct A, new_lb, new_ub. map_var_to_index is used here.
-  Eigen::MatrixXd A{Eigen::MatrixXd::Zero(v.size(), vars.size())};
+  // Construct new_lb, new_ub.
   Eigen::VectorXd new_lb{v.size()};
   Eigen::VectorXd new_ub{v.size()};
   // We will determine if lb <= v <= ub is a bounding box constraint, namely
   // x_lb <= x <= x_ub.
   bool is_v_bounding_box = true;
-  Eigen::RowVectorXd Ai(A.cols());
   for (int i = 0; i < v.size(); ++i) {
-    double constant_term = 0;
-    int num_vi_variables = symbolic::DecomposeAffineExpression(
-        v(i), map_var_to_index, &Ai, &constant_term);
-    A.row(i) = Ai;
-    if (num_vi_variables == 0 &&
+    const double constant_term = b(i);
+    if (num_row_variables[i] == 0 &&
         !(lb(i) <= constant_term && constant_term <= ub(i))) {
       // Unsatisfiable constraint with no variables, such as 1 <= 0 <= 2
       throw std::runtime_error(
@@ -79,7 +88,7 @@ Binding<Constraint> ParseConstraint(
       new_ub(i) = ub(i) - constant_term;
       DRAKE_DEMAND(!std::isnan(new_lb(i)));
       DRAKE_DEMAND(!std::isnan(new_ub(i)));
-      if (num_vi_variables != 1) {
+      if (num_row_variables[i] != 1) {
         is_v_bounding_box = false;
       }
     }
@@ -90,14 +99,8 @@ Binding<Constraint> ParseConstraint(
     VectorXDecisionVariable bounding_box_x(v.size());
     for (int i = 0; i < v.size(); ++i) {
       // v(i) is in the form of c * x
-      double x_coeff = 0;
-      for (const auto& x : v(i).GetVariables()) {
-        const double coeff = A(i, map_var_to_index[x.get_id()]);
-        if (coeff != 0) {
-          x_coeff += coeff;
-          bounding_box_x(i) = x;
-        }
-      }
+      const double x_coeff = row_variable_coeff[i];
+      bounding_box_x(i) = vars(row_variable_index[i]);
       if (x_coeff > 0) {
         new_lb(i) /= x_coeff;
         new_ub(i) /= x_coeff;
@@ -475,10 +478,19 @@ Binding<LinearEqualityConstraint> DoParseLinearEqualityConstraint(
     const Eigen::Ref<const Eigen::VectorXd>& b) {
   DRAKE_DEMAND(v.rows() == b.rows());
   VectorX<symbolic::Variable> vars;
+  {
+    Eigen::SparseMatrix<double> A;
+    Eigen::VectorXd constant_terms;
+    if (symbolic::DecomposeAffineExpressions(v, &A, &constant_terms, &vars)) {
+      return CreateBinding(
+          make_shared<LinearEqualityConstraint>(A, b - constant_terms), vars);
+    }
+  }
+  // Some element of v is not affine. The code below throws an error which
+  // reports it.
   unordered_map<Variable::Id, int> map_var_to_index;
   std::tie(vars, map_var_to_index) =
       symbolic::ExtractVariablesFromExpression(v);
-  // TODO(hongkai.dai): use sparse matrix.
   Eigen::MatrixXd A = Eigen::MatrixXd::Zero(v.rows(), vars.rows());
   Eigen::VectorXd beq = Eigen::VectorXd::Zero(v.rows());
   Eigen::RowVectorXd Ai(A.cols());
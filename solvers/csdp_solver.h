@@ -83,6 +83,10 @@ class CsdpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Returns true, because each solve has its own CSDP problem data, and the
+  /// CSDP error handler uses a per-thread jump buffer.
+  bool is_thread_safe() const final;
+
   using Details = CsdpSolverDetails;
 
  private:
@@ -24,6 +24,8 @@ SolverId CsdpSolver::id() {
 
 bool CsdpSolver::is_enabled() { return true; }
 
+bool CsdpSolver::is_thread_safe() const { return true; }
+
 bool CsdpSolver::ProgramAttributesSatisfied(const MathematicalProgram& prog) {
   static const never_destroyed<ProgramAttributes> solver_capabilities(
       std::initializer_list<ProgramAttribute>{
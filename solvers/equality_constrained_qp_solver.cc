@@ -331,6 +331,8 @@ bool EqualityConstrainedQPSolver::is_available() { return true; }
 
 bool EqualityConstrainedQPSolver::is_enabled() { return true; }
 
+bool EqualityConstrainedQPSolver::is_thread_safe() const { return true; }
+
 bool EqualityConstrainedQPSolver::ProgramAttributesSatisfied(
     const MathematicalProgram& prog) {
   static const never_destroyed<ProgramAttributes> solver_capabilities(
@@ -40,6 +40,9 @@ class EqualityConstrainedQPSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Returns true, because each solve only uses Eigen on its own data.
+  bool is_thread_safe() const final;
+
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
@@ -0,0 +1,999 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Sparse>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/text_logging.h"
+#include "drake/solvers/aggregate_costs_constraints.h"
+#include "drake/solvers/fbstab/fbstab_dense.h"
+#include "drake/solvers/fbstab/fbstab_mpc.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using fbstab::ExitFlag;
+using fbstab::FBstabDense;
+using fbstab::FBstabMpc;
+using fbstab::SolverOut;
+
+using SparseMatrixd = Eigen::SparseMatrix<double>;
+using RowMajorSparseMatrixd = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+// A column of the dynamics is only used as a state if its component that is
+// orthogonal to the states chosen so far is at least this fraction of its norm.
+constexpr double kRankTolerance = 1e-8;
+
+// The program in the form
+//
+//     min ½ zᵀHz + fᵀz + constant  s.t.  G z = h,  C z ≤ d.
+struct CanonicalQp {
+  SparseMatrixd H;
+  VectorXd f;
+  double constant{0};
+  RowMajorSparseMatrixd G;
+  VectorXd h;
+  RowMajorSparseMatrixd C;
+  VectorXd d;
+};
+
+// The rows of a CanonicalQp that a constraint row lb ≤ aᵀz ≤ ub became: a row
+// of G if lb == ub, and otherwise the rows of C for its finite upper and lower
+// bounds (-1 for an infinite bound).
+struct RowIndices {
+  int equality{-1};
+  int upper{-1};
+  int lower{-1};
+};
+
+// The rows of a CanonicalQp for each row of the constraints in a program, so
+// that the dual solution can be set for each constraint.
+struct ConstraintRows {
+  // Indexed like prog.linear_equality_constraints(), then by the row.
+  std::vector<std::vector<RowIndices>> linear_equality;
+  // Indexed like prog.linear_constraints(), then by the row.
+  std::vector<std::vector<RowIndices>> linear;
+  // The aggregated bounds of each variable.
+  std::vector<RowIndices> bounds;
+  VectorXd lower;
+  VectorXd upper;
+};
+
+CanonicalQp MakeCanonicalQp(const MathematicalProgram& prog,
+                            ConstraintRows* rows) {
+  const int num_vars = prog.num_vars();
+  CanonicalQp qp;
+  std::vector<Eigen::Triplet<double>> H_triplets;
+  qp.f = VectorXd::Zero(num_vars);
+  for (const auto& binding : prog.quadratic_costs()) {
+    const std::vector<int> indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    const MatrixXd& Q = binding.evaluator()->Q();
+    for (int i = 0; i < Q.rows(); ++i) {
+      for (int j = 0; j < Q.cols(); ++j) {
+        if (Q(i, j) != 0) {
+          // Symmetrize, in case Q is not symmetric.
+          H_triplets.emplace_back(indices[i], indices[j], 0.5 * Q(i, j));
+          H_triplets.emplace_back(indices[j], indices[i], 0.5 * Q(i, j));
+        }
+      }
+      qp.f(indices[i]) += binding.evaluator()->b()(i);
+    }
+    qp.constant += binding.evaluator()->c();
+  }
+  for (const auto& binding : prog.linear_costs()) {
+    const std::vector<int> indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    for (int i = 0; i < static_cast<int>(indices.size()); ++i) {
+      qp.f(indices[i]) += binding.evaluator()->a()(i);
+    }
+    qp.constant += binding.evaluator()->b();
+  }
+  qp.H.resize(num_vars, num_vars);
+  qp.H.setFromTriplets(H_triplets.begin(), H_triplets.end());
+  qp.H.prune(0.0);
+
+  std::vector<Eigen::Triplet<double>> G_triplets;
+  std::vector<double> h;
+  std::vector<Eigen::Triplet<double>> C_triplets;
+  std::vector<double> d;
+  // Adds the rows lb ≤ A x ≤ ub, where x are the variables at `indices`, and
+  // returns where each of them went.
+  auto add_rows = [&](const Eigen::SparseMatrix<double>& A,
+                      const VectorXd& lb, const VectorXd& ub,
+                      const std::vector<int>& indices) {
+    const RowMajorSparseMatrixd A_rows = A;
+    std::vector<RowIndices> result(A_rows.rows());
+    for (int i = 0; i < A_rows.rows(); ++i) {
+      if (lb(i) == ub(i)) {
+        for (RowMajorSparseMatrixd::InnerIterator it(A_rows, i); it; ++it) {
+          G_triplets.emplace_back(h.size(), indices[it.col()], it.value());
+        }
+        result[i].equality = h.size();
+        h.push_back(ub(i));
+        continue;
+      }
+      if (std::isfinite(ub(i))) {
+        for (RowMajorSparseMatrixd::InnerIterator it(A_rows, i); it; ++it) {
+          C_triplets.emplace_back(d.size(), indices[it.col()], it.value());
+        }
+        result[i].upper = d.size();
+        d.push_back(ub(i));
+      }
+      if (std::isfinite(lb(i))) {
+        for (RowMajorSparseMatrixd::InnerIterator it(A_rows, i); it; ++it) {
+          C_triplets.emplace_back(d.size(), indices[it.col()], -it.value());
+        }
+        result[i].lower = d.size();
+        d.push_back(-lb(i));
+      }
+    }
+    return result;
+  };
+  for (const auto& binding : prog.linear_equality_constraints()) {
+    const auto& constraint = binding.evaluator();
+    rows->linear_equality.push_back(
+        add_rows(constraint->get_sparse_A(), constraint->lower_bound(),
+                 constraint->lower_bound(),
+                 prog.FindDecisionVariableIndices(binding.variables())));
+  }
+  for (const auto& binding : prog.linear_constraints()) {
+    const auto& constraint = binding.evaluator();
+    rows->linear.push_back(
+        add_rows(constraint->get_sparse_A(), constraint->lower_bound(),
+                 constraint->upper_bound(),
+                 prog.FindDecisionVariableIndices(binding.variables())));
+  }
+  AggregateBoundingBoxConstraints(prog, &rows->lower, &rows->upper);
+  for (int i = 0; i < num_vars; ++i) {
+    SparseMatrixd e(1, 1);
+    e.insert(0, 0) = 1.0;
+    rows->bounds.push_back(add_rows(e, rows->lower.segment<1>(i),
+                                    rows->upper.segment<1>(i), {i})[0]);
+  }
+
+  qp.G.resize(h.size(), num_vars);
+  qp.G.setFromTriplets(G_triplets.begin(), G_triplets.end());
+  qp.G.prune(0.0);
+  qp.h = Eigen::Map<VectorXd>(h.data(), h.size());
+  qp.C.resize(d.size(), num_vars);
+  qp.C.setFromTriplets(C_triplets.begin(), C_triplets.end());
+  qp.C.prune(0.0);
+  qp.d = Eigen::Map<VectorXd>(d.data(), d.size());
+  return qp;
+}
+
+// The program after substituting z = T y + t, which eliminates the variables
+// that are aliases of other variables.
+struct ReducedQp {
+  CanonicalQp qp;
+  SparseMatrixd T;
+  VectorXd t;
+  // The original index of each variable y.
+  std::vector<int> kept;
+};
+
+// Eliminates the equality constraints a zⱼ + b zₖ = c where one of the two
+// variables appears in no other equality constraint, such as the u[N-2] ==
+// u[N-1] constraint of DirectTranscription, which would otherwise break the
+// stagewise structure of the dynamics.
+ReducedQp EliminateAliases(const CanonicalQp& qp) {
+  const int num_vars = qp.f.size();
+  std::vector<int> num_rows(num_vars, 0);
+  for (int k = 0; k < qp.G.outerSize(); ++k) {
+    for (RowMajorSparseMatrixd::InnerIterator it(qp.G, k); it; ++it) {
+      ++num_rows[it.col()];
+    }
+  }
+  // For each eliminated variable, the row and the variable it is expressed in.
+  std::vector<std::optional<std::pair<int, int>>> alias_of(num_vars);
+  // The variables that eliminated variables are expressed in; these are never
+  // eliminated themselves, so that one substitution suffices.
+  std::vector<bool> is_anchor(num_vars, false);
+  std::vector<bool> keep_row(qp.G.rows(), true);
+  for (int r = 0; r < qp.G.rows(); ++r) {
+    if (qp.G.row(r).nonZeros() != 2) {
+      continue;
+    }
+    RowMajorSparseMatrixd::InnerIterator it(qp.G, r);
+    const int j = it.col();
+    const int k = (++it).col();
+    if (alias_of[j] || alias_of[k]) {
+      continue;
+    }
+    int eliminated{-1};
+    if (num_rows[k] == 1 && !is_anchor[k]) {
+      eliminated = k;
+    } else if (num_rows[j] == 1 && !is_anchor[j]) {
+      eliminated = j;
+    } else {
+      continue;
+    }
+    const int anchor = eliminated == k ? j : k;
+    alias_of[eliminated] = std::make_pair(r, anchor);
+    is_anchor[anchor] = true;
+    --num_rows[anchor];
+    keep_row[r] = false;
+  }
+
+
+  ReducedQp reduced;
+  std::vector<int> column(num_vars, -1);
+  for (int i = 0; i < num_vars; ++i) {
+    if (!alias_of[i]) {
+      column[i] = reduced.kept.size();
+      reduced.kept.push_back(i);
+    }
+  }
+  const int num_kept = reduced.kept.size();
+  std::vector<Eigen::Triplet<double>> T_triplets;
+  reduced.t = VectorXd::Zero(num_vars);
+  for (int i = 0; i < num_vars; ++i) {
+    if (!alias_of[i]) {
+      T_triplets.emplace_back(i, column[i], 1.0);
+      continue;
+    }
+    const auto [r, anchor] = *alias_of[i];
+    const double a = qp.G.coeff(r, i);
+    T_triplets.emplace_back(i, column[anchor], -qp.G.coeff(r, anchor) / a);
+    reduced.t(i) = qp.h(r) / a;
+  }
+  reduced.T.resize(num_vars, num_kept);
+  reduced.T.setFromTriplets(T_triplets.begin(), T_triplets.end());
+
+  std::vector<Eigen::Triplet<double>> G_triplets;
+  std::vector<double> h;
+  for (int r = 0; r < qp.G.rows(); ++r) {
+    if (keep_row[r]) {
+      for (RowMajorSparseMatrixd::InnerIterator it(qp.G, r); it; ++it) {
+        G_triplets.emplace_back(h.size(), it.col(), it.value());
+      }
+      h.push_back(qp.h(r));
+    }
+  }
+  RowMajorSparseMatrixd G(h.size(), num_vars);
+  G.setFromTriplets(G_triplets.begin(), G_triplets.end());
+
+  const SparseMatrixd& T = reduced.T;
+  const VectorXd& t = reduced.t;
+  CanonicalQp& y_qp = reduced.qp;
+  y_qp.H = T.transpose() * qp.H * T;
+  y_qp.H.prune(0.0);
+  y_qp.f = T.transpose() * (qp.H * t + qp.f);
+  y_qp.constant = qp.constant + 0.5 * t.dot(qp.H * t) + qp.f.dot(t);
+  y_qp.G = G * T;
+  y_qp.G.prune(0.0);
+  y_qp.h = Eigen::Map<VectorXd>(h.data(), h.size()) - G * t;
+  y_qp.C = qp.C * T;
+  y_qp.C.prune(0.0);
+  y_qp.d = qp.d - qp.C * t;
+  return reduced;
+}
+
+// A row aᵀz ⋈ b of a constraint matrix.
+struct SparseRow {
+  std::vector<int> vars;
+  std::vector<double> coeffs;
+  double rhs{};
+};
+
+std::vector<SparseRow> GetRows(const RowMajorSparseMatrixd& A,
+                               const VectorXd& b) {
+  std::vector<SparseRow> rows(A.rows());
+  for (int r = 0; r < A.rows(); ++r) {
+    for (RowMajorSparseMatrixd::InnerIterator it(A, r); it; ++it) {
+      rows[r].vars.push_back(it.col());
+      rows[r].coeffs.push_back(it.value());
+    }
+    rows[r].rhs = b(r);
+  }
+  return rows;
+}
+
+// The data of an FBstabMpc problem that is equivalent to a CanonicalQp.
+struct MpcProblem {
+  int N{};
+  int nx{};
+  int nu{};
+  int nc{};
+  // The index of each variable of the CanonicalQp in FBstabMpc's z.
+  std::vector<int> position;
+  // The index of each row of the CanonicalQp's C in FBstabMpc's v.
+  std::vector<int> inequality_position;
+  std::vector<MatrixXd> Q, R, S;
+  std::vector<VectorXd> q, r;
+  std::vector<MatrixXd> A, B;
+  std::vector<VectorXd> c;
+  std::vector<MatrixXd> E, L;
+  std::vector<VectorXd> d;
+  VectorXd x0;
+};
+
+// Searches `qp` for the stagewise structure of a model predictive control
+// problem (see the FbstabSolver class documentation), and returns the
+// equivalent FBstabMpc problem; returns nullopt if there is no such structure.
+std::optional<MpcProblem> FindMpcStructure(const CanonicalQp& qp) {
+  const int num_vars = qp.f.size();
+  std::vector<SparseRow> inequalities = GetRows(qp.C, qp.d);
+
+  // Split the equality constraints into the ones that fix a single variable
+  // and the dynamics.
+  std::vector<std::optional<double>> fixed_value(num_vars);
+  std::vector<SparseRow> dynamics;
+  for (SparseRow& row : GetRows(qp.G, qp.h)) {
+    if (row.vars.empty()) {
+      return std::nullopt;
+    }
+    if (row.vars.size() > 1) {
+      dynamics.push_back(std::move(row));
+      continue;
+    }
+    const int j = row.vars[0];
+    if (fixed_value[j]) {
+      return std::nullopt;
+    }
+    fixed_value[j] = row.rhs / row.coeffs[0];
+  }
+  std::vector<std::vector<int>> dynamics_of_var(num_vars);
+  for (int r = 0; r < static_cast<int>(dynamics.size()); ++r) {
+    for (int j : dynamics[r].vars) {
+      dynamics_of_var[j].push_back(r);
+    }
+  }
+
+  // The stage of each variable, and the states and inputs of each stage.
+  std::vector<int> stage(num_vars, -1);
+  std::vector<std::vector<int>> states(1);
+  std::vector<std::vector<int>> inputs;
+  // The dynamics rows of each step.
+  std::vector<std::vector<int>> step_rows;
+  for (int j = 0; j < num_vars; ++j) {
+    if (!fixed_value[j]) {
+      continue;
+    }
+    if (!dynamics_of_var[j].empty()) {
+      states[0].push_back(j);
+      stage[j] = 0;
+    } else {
+      // This variable is not part of the initial state; fix it with a pair of
+      // inequality constraints instead.
+      inequalities.push_back(SparseRow{{j}, {1.0}, *fixed_value[j]});
+      inequalities.push_back(SparseRow{{j}, {-1.0}, -*fixed_value[j]});
+    }
+  }
+  if (states[0].empty()) {
+    return std::nullopt;
+  }
+
+  // Whether the variable is coupled to a variable of the given stage by the
+  // costs or the inequality constraints.
+  std::vector<std::vector<int>> inequalities_of_var(num_vars);
+  for (int r = 0; r < static_cast<int>(inequalities.size()); ++r) {
+    for (int j : inequalities[r].vars) {
+      inequalities_of_var[j].push_back(r);
+    }
+  }
+  auto is_coupled_to_stage = [&](int j, int k) {
+    for (SparseMatrixd::InnerIterator it(qp.H, j); it; ++it) {
+      if (stage[it.row()] == k) {
+        return true;
+      }
+    }
+    for (int r : inequalities_of_var[j]) {
+      for (int i : inequalities[r].vars) {
+        if (stage[i] == k) {
+          return true;
+        }
+      }
+    }
+    return false;
+  };
+
+  std::vector<bool> row_assigned(dynamics.size(), false);
+  std::vector<int> candidate_index(num_vars, -1);
+  while (true) {
+    const int k = states.size() - 1;
+    std::vector<int> rows;
+    for (int j : states[k]) {
+      for (int r : dynamics_of_var[j]) {
+        if (!row_assigned[r]) {
+          row_assigned[r] = true;
+          rows.push_back(r);
+        }
+      }
+    }
+    if (rows.empty()) {
+      break;
+    }
+    std::sort(rows.begin(), rows.end());
+
+    // The new variables of these rows are the next states and the inputs.
+    std::vector<int> candidates;
+    for (int r : rows) {
+      for (int j : dynamics[r].vars) {
+        if (stage[j] == -1 && candidate_index[j] == -1) {
+          candidate_index[j] = candidates.size();
+          candidates.push_back(j);
+        } else if (stage[j] != -1 && stage[j] != k) {
+          return std::nullopt;
+        }
+      }
+    }
+    const int num_rows = rows.size();
+    const int num_candidates = candidates.size();
+    if (num_candidates < num_rows) {
+      return std::nullopt;
+    }
+    MatrixXd residual = MatrixXd::Zero(num_rows, num_candidates);
+    for (int i = 0; i < num_rows; ++i) {
+      const SparseRow& row = dynamics[rows[i]];
+      for (int n = 0; n < static_cast<int>(row.vars.size()); ++n) {
+        if (candidate_index[row.vars[n]] >= 0) {
+          residual(i, candidate_index[row.vars[n]]) = row.coeffs[n];
+        }
+      }
+    }
+    const VectorXd norms = residual.colwise().norm().transpose();
+
+    // Choose the next states by a column-pivoted Gram-Schmidt, so that they
+    // can be solved for. The variables that appear in later steps must be
+    // states; after those, prefer the variables that are not coupled to the
+    // current stage, since the next states belong to the next stage.
+    std::vector<int> group(num_candidates);
+    for (int n = 0; n < num_candidates; ++n) {
+      const int j = candidates[n];
+      const bool in_later_rows = std::any_of(
+          dynamics_of_var[j].begin(), dynamics_of_var[j].end(),
+          [&](int r) { return !row_assigned[r]; });
+      group[n] = in_later_rows ? 0 : (is_coupled_to_stage(j, k) ? 2 : 1);
+    }
+    std::vector<bool> chosen(num_candidates, false);
+    int num_chosen = 0;
+    for (int g = 0; g < 3; ++g) {
+      while (num_chosen < num_rows) {
+        int best = -1;
+        double best_ratio = kRankTolerance;
+        for (int n = 0; n < num_candidates; ++n) {
+          if (!chosen[n] && group[n] == g && norms(n) > 0) {
+            const double ratio = residual.col(n).norm() / norms(n);
+            if (ratio > best_ratio) {
+              best = n;
+              best_ratio = ratio;
+            }
+          }
+        }
+        if (best < 0) {
+          break;
+        }
+        chosen[best] = true;
+        ++num_chosen;
+        const VectorXd direction = residual.col(best).normalized();
+        residual -= direction * (direction.transpose() * residual);
+      }
+      if (g == 0) {
+        for (int n = 0; n < num_candidates; ++n) {
+          if (group[n] == 0 && !chosen[n]) {
+            return std::nullopt;
+          }
+        }
+      }
+    }
+    if (num_chosen < num_rows) {
+      return std::nullopt;
+    }
+    states.emplace_back();
+    inputs.emplace_back();
+    for (int n = 0; n < num_candidates; ++n) {
+      const int j = candidates[n];
+      candidate_index[j] = -1;
+      if (chosen[n]) {
+        states[k + 1].push_back(j);
+        stage[j] = k + 1;
+      } else {
+        inputs[k].push_back(j);
+        stage[j] = k;
+      }
+    }
+    step_rows.push_back(std::move(rows));
+  }
+  const int N = step_rows.size();
+  if (N == 0) {
+    return std::nullopt;
+  }
+  for (bool assigned : row_assigned) {
+    if (!assigned) {
+      return std::nullopt;
+    }
+  }
+  inputs.emplace_back();
+
+  // Add each remaining variable to the inputs of the only stage that it is
+  // coupled to, or to the last stage if it is not coupled to any.
+  std::vector<int> remaining;
+  for (int j = 0; j < num_vars; ++j) {
+    if (stage[j] == -1) {
+      remaining.push_back(j);
+    }
+  }
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int j : remaining) {
+      if (stage[j] != -1) {
+        continue;
+      }
+      std::set<int> coupled_stages;
+      for (SparseMatrixd::InnerIterator it(qp.H, j); it; ++it) {
+        if (stage[it.row()] >= 0) {
+          coupled_stages.insert(stage[it.row()]);
+        }
+      }
+      for (int r : inequalities_of_var[j]) {
+        for (int i : inequalities[r].vars) {
+          if (stage[i] >= 0) {
+            coupled_stages.insert(stage[i]);
+          }
+        }
+      }
+      if (coupled_stages.size() > 1) {
+        return std::nullopt;
+      }
+      if (coupled_stages.size() == 1) {
+        stage[j] = *coupled_stages.begin();
+        inputs[stage[j]].push_back(j);
+        changed = true;
+      }
+    }
+  }
+  for (int j : remaining) {
+    if (stage[j] == -1) {
+      stage[j] = N;
+      inputs[N].push_back(j);
+    }
+  }
+
+  // The costs and the inequality constraints must not couple the stages.
+  for (int j = 0; j < num_vars; ++j) {
+    for (SparseMatrixd::InnerIterator it(qp.H, j); it; ++it) {
+      if (stage[it.row()] != stage[j]) {
+        return std::nullopt;
+      }
+    }
+  }
+  std::vector<std::vector<int>> stage_inequalities(N + 1);
+  for (int r = 0; r < static_cast<int>(inequalities.size()); ++r) {
+    const std::vector<int>& vars = inequalities[r].vars;
+    const int k = vars.empty() ? 0 : stage[vars[0]];
+    for (int j : vars) {
+      if (stage[j] != k) {
+        return std::nullopt;
+      }
+    }
+    stage_inequalities[k].push_back(r);
+  }
+
+  // Lay out the stages, padding them to the same size. Padded states are
+  // fixed to zero by the dynamics, padded inputs are free, and padded
+  // constraints are 0 ≤ 1.
+  MpcProblem mpc;
+  mpc.N = N;
+  mpc.nx = 1;
+  mpc.nu = 1;
+  mpc.nc = 1;
+  for (int k = 0; k <= N; ++k) {
+    mpc.nx = std::max<int>(mpc.nx, states[k].size());
+    mpc.nu = std::max<int>(mpc.nu, inputs[k].size());
+    mpc.nc = std::max<int>(mpc.nc, stage_inequalities[k].size());
+  }
+  const int nx = mpc.nx;
+  const int nu = mpc.nu;
+  const int nc = mpc.nc;
+  const int stage_size = nx + nu;
+  mpc.position.resize(num_vars);
+  mpc.inequality_position.resize(qp.C.rows());
+  for (int k = 0; k <= N; ++k) {
+    for (int p = 0; p < static_cast<int>(states[k].size()); ++p) {
+      mpc.position[states[k][p]] = k * stage_size + p;
+    }
+    for (int p = 0; p < static_cast<int>(inputs[k].size()); ++p) {
+      mpc.position[inputs[k][p]] = k * stage_size + nx + p;
+    }
+  }
+  // The index of variable j within its stage.
+  auto local = [&](int j) {
+    return mpc.position[j] - stage[j] * stage_size;
+  };
+
+  std::vector<MatrixXd> hessians(N + 1, MatrixXd::Zero(stage_size, stage_size));
+  std::vector<VectorXd> gradients(N + 1, VectorXd::Zero(stage_size));
+  for (int j = 0; j < num_vars; ++j) {
+    for (SparseMatrixd::InnerIterator it(qp.H, j); it; ++it) {
+      hessians[stage[j]](local(it.row()), local(j)) += it.value();
+    }
+    gradients[stage[j]](local(j)) += qp.f(j);
+  }
+  for (int k = 0; k <= N; ++k) {
+    mpc.Q.push_back(hessians[k].topLeftCorner(nx, nx));
+    mpc.R.push_back(hessians[k].bottomRightCorner(nu, nu));
+    mpc.S.push_back(hessians[k].bottomLeftCorner(nu, nx));
+    mpc.q.push_back(gradients[k].head(nx));
+    mpc.r.push_back(gradients[k].tail(nu));
+  }
+
+  // Solve the dynamics of each step for the next state.
+  for (int k = 0; k < N; ++k) {
+    const int m = step_rows[k].size();
+    MatrixXd G_next = MatrixXd::Zero(m, m);
+    MatrixXd G_state = MatrixXd::Zero(m, nx);
+    MatrixXd G_input = MatrixXd::Zero(m, nu);
+    VectorXd h(m);
+    for (int i = 0; i < m; ++i) {
+      const SparseRow& row = dynamics[step_rows[k][i]];
+      for (int n = 0; n < static_cast<int>(row.vars.size()); ++n) {
+        const int j = row.vars[n];
+        if (stage[j] == k + 1) {
+          G_next(i, local(j)) = row.coeffs[n];
+        } else if (local(j) < nx) {
+          G_state(i, local(j)) = row.coeffs[n];
+        } else {
+          G_input(i, local(j) - nx) = row.coeffs[n];
+        }
+      }
+      h(i) = row.rhs;
+    }
+    const Eigen::PartialPivLU<MatrixXd> lu(G_next);
+    mpc.A.push_back(MatrixXd::Zero(nx, nx));
+    mpc.B.push_back(MatrixXd::Zero(nx, nu));
+    mpc.c.push_back(VectorXd::Zero(nx));
+    mpc.A.back().topRows(m) = -lu.solve(G_state);
+    mpc.B.back().topRows(m) = -lu.solve(G_input);
+    mpc.c.back().head(m) = lu.solve(h);
+  }
+
+  for (int k = 0; k <= N; ++k) {
+    mpc.E.push_back(MatrixXd::Zero(nc, nx));
+    mpc.L.push_back(MatrixXd::Zero(nc, nu));
+    mpc.d.push_back(VectorXd::Constant(nc, -1.0));
+    for (int i = 0; i < static_cast<int>(stage_inequalities[k].size()); ++i) {
+      const SparseRow& row = inequalities[stage_inequalities[k][i]];
+      for (int n = 0; n < static_cast<int>(row.vars.size()); ++n) {
+        const int j = row.vars[n];
+        if (local(j) < nx) {
+          mpc.E[k](i, local(j)) += row.coeffs[n];
+        } else {
+          mpc.L[k](i, local(j) - nx) += row.coeffs[n];
+        }
+      }
+      mpc.d[k](i) = -row.rhs;
+      if (stage_inequalities[k][i] < qp.C.rows()) {
+        mpc.inequality_position[stage_inequalities[k][i]] = k * nc + i;
+      }
+    }
+  }
+
+  mpc.x0 = VectorXd::Zero(nx);
+  for (int p = 0; p < static_cast<int>(states[0].size()); ++p) {
+    mpc.x0(p) = *fixed_value[states[0][p]];
+  }
+  return mpc;
+}
+
+template <typename Solver, typename Algorithm>
+void SetFbstabOptions(const SolverOptions& options, Solver* solver) {
+  options.CheckOptionKeysForSolver(
+      FbstabSolver::id(),
+      {"abs_tol", "rel_tol", "stall_tol", "infeas_tol", "sigma0", "alpha",
+       "beta", "eta", "inner_tol_multiplier", "inner_tol_max",
+       "inner_tol_min"},
+      {"max_newton_iters", "max_prox_iters", "max_inner_iters",
+       "max_linesearch_iters", "check_feasibility", "record_solve_time"},
+      {});
+  const SolverId id = FbstabSolver::id();
+  for (const auto& [key, value] : options.GetOptionsDouble(id)) {
+    solver->UpdateOption(key.c_str(), value);
+  }
+  for (const auto& [key, value] : options.GetOptionsInt(id)) {
+    if (key == "check_feasibility" || key == "record_solve_time") {
+      solver->UpdateOption(key.c_str(), value != 0);
+    } else {
+      solver->UpdateOption(key.c_str(), value);
+    }
+  }
+  solver->SetDisplayLevel(options.get_print_to_console()
+                              ? Algorithm::Display::FINAL
+                              : Algorithm::Display::OFF);
+}
+
+// Solves the FBstabMpc problem, and sets the solution of the CanonicalQp and
+// the (nonnegative) multipliers of the rows of its C.
+SolverOut SolveMpc(const MpcProblem& mpc, const VectorXd& guess,
+                   const SolverOptions& options, VectorXd* solution,
+                   VectorXd* inequality_dual) {
+  FBstabMpc solver(mpc.N, mpc.nx, mpc.nu, mpc.nc);
+  SetFbstabOptions<FBstabMpc, fbstab::FBstabAlgoMpc>(options, &solver);
+  const FBstabMpc::QPData data{&mpc.Q, &mpc.R, &mpc.S, &mpc.q, &mpc.r,
+                               &mpc.A, &mpc.B, &mpc.c, &mpc.E, &mpc.L,
+                               &mpc.d, &mpc.x0};
+  const int num_stages = mpc.N + 1;
+  VectorXd z = VectorXd::Zero((mpc.nx + mpc.nu) * num_stages);
+  VectorXd l = VectorXd::Zero(mpc.nx * num_stages);
+  VectorXd v = VectorXd::Zero(mpc.nc * num_stages);
+  VectorXd y = VectorXd::Zero(mpc.nc * num_stages);
+  for (int j = 0; j < guess.size(); ++j) {
+    z(mpc.position[j]) = guess(j);
+  }
+  const FBstabMpc::QPVariable variable{&z, &l, &v, &y};
+  const SolverOut out = solver.Solve(data, &variable);
+  solution->resize(guess.size());
+  for (int j = 0; j < guess.size(); ++j) {
+    (*solution)(j) = z(mpc.position[j]);
+  }
+  const int num_inequalities = mpc.inequality_position.size();
+  inequality_dual->resize(num_inequalities);
+  for (int r = 0; r < num_inequalities; ++r) {
+    (*inequality_dual)(r) = v(mpc.inequality_position[r]);
+  }
+  return out;
+}
+
+// Solves `qp` with FBstabDense, writing each equality constraint as a pair of
+// inequality constraints, and sets the solution and the (nonnegative)
+// multipliers of the rows of C.
+SolverOut SolveDense(const CanonicalQp& qp, const VectorXd& guess,
+                     const SolverOptions& options, VectorXd* solution,
+                     VectorXd* inequality_dual) {
+  const int num_vars = qp.f.size();
+  const int num_rows = qp.C.rows() + 2 * qp.G.rows();
+  // FBstabDense needs at least one constraint; pad with 0 ≤ 1.
+  MatrixXd A = MatrixXd::Zero(std::max(num_rows, 1), num_vars);
+  VectorXd b = VectorXd::Ones(std::max(num_rows, 1));
+  if (num_rows > 0) {
+    A << MatrixXd(qp.C), MatrixXd(qp.G), -MatrixXd(qp.G);
+    b << qp.d, qp.h, -qp.h;
+  }
+  const MatrixXd H(qp.H);
+  FBstabDense solver(num_vars, A.rows());
+  SetFbstabOptions<FBstabDense, fbstab::FBstabAlgoDense>(options, &solver);
+  const FBstabDense::QPData data{&H, &A, &qp.f, &b};
+  VectorXd z = guess;
+  VectorXd v = VectorXd::Zero(A.rows());
+  VectorXd y = VectorXd::Zero(A.rows());
+  const FBstabDense::QPVariable variable{&z, &v, &y};
+  const SolverOut out = solver.Solve(data, &variable);
+  *solution = z;
+  *inequality_dual = v.head(qp.C.rows());
+  return out;
+}
+
+// Returns Drake's dual solution (the sensitivity of the optimal cost to the
+// bound) of a constraint row, given the multipliers of the rows of G and C.
+double GetRowDual(const RowIndices& row, const VectorXd& equality_dual,
+                  const VectorXd& inequality_dual) {
+  if (row.equality >= 0) {
+    return -equality_dual(row.equality);
+  }
+  double dual = 0;
+  if (row.lower >= 0) {
+    dual += inequality_dual(row.lower);
+  }
+  if (row.upper >= 0) {
+    dual -= inequality_dual(row.upper);
+  }
+  return dual;
+}
+
+template <typename C>
+void SetDualSolution(const std::vector<Binding<C>>& bindings,
+                     const std::vector<std::vector<RowIndices>>& rows,
+                     const VectorXd& equality_dual,
+                     const VectorXd& inequality_dual,
+                     MathematicalProgramResult* result) {
+  for (int i = 0; i < static_cast<int>(bindings.size()); ++i) {
+    VectorXd dual(rows[i].size());
+    for (int k = 0; k < dual.size(); ++k) {
+      dual(k) = GetRowDual(rows[i][k], equality_dual, inequality_dual);
+    }
+    result->set_dual_solution(bindings[i], dual);
+  }
+}
+
+// Sets the dual solution of each linear constraint, linear equality
+// constraint, and bounding box constraint of `prog`, given the solution `x` of
+// `qp` and the multipliers `inequality_dual` of the rows of its C. FBstab's
+// multipliers of the equality constraints are those of the reduced program, so
+// the multipliers of the rows of G are recovered from the stationarity
+// condition H x + f + Cᵀμ + Gᵀλ = 0 instead, by least squares.
+void SetDualSolutions(const MathematicalProgram& prog, const CanonicalQp& qp,
+                      const ConstraintRows& rows, const VectorXd& x,
+                      const VectorXd& inequality_dual,
+                      MathematicalProgramResult* result) {
+  VectorXd equality_dual = VectorXd::Zero(qp.G.rows());
+  if (qp.G.rows() > 0) {
+    SparseMatrixd G_transpose = qp.G.transpose();
+    G_transpose.makeCompressed();
+    Eigen::SparseQR<SparseMatrixd, Eigen::COLAMDOrdering<int>> qr(G_transpose);
+    if (qr.info() == Eigen::Success) {
+      const VectorXd residual =
+          qp.H * x + qp.f + qp.C.transpose() * inequality_dual;
+      equality_dual = qr.solve(-residual);
+    }
+  }
+  SetDualSolution(prog.linear_equality_constraints(), rows.linear_equality,
+                  equality_dual, inequality_dual, result);
+  SetDualSolution(prog.linear_constraints(), rows.linear, equality_dual,
+                  inequality_dual, result);
+  // As in ClpSolver, the dual solution of a variable's bound goes to each
+  // bounding box constraint whose bound is the active one.
+  for (const auto& binding : prog.bounding_box_constraints()) {
+    const std::vector<int> indices =
+        prog.FindDecisionVariableIndices(binding.variables());
+    const VectorXd& lb = binding.evaluator()->lower_bound();
+    const VectorXd& ub = binding.evaluator()->upper_bound();
+    VectorXd dual = VectorXd::Zero(indices.size());
+    for (int k = 0; k < dual.size(); ++k) {
+      const int j = indices[k];
+      const double bound_dual =
+          GetRowDual(rows.bounds[j], equality_dual, inequality_dual);
+      if ((bound_dual > 0 && lb(k) == rows.lower(j)) ||
+          (bound_dual < 0 && ub(k) == rows.upper(j))) {
+        dual(k) = bound_dual;
+      }
+    }
+    result->set_dual_solution(binding, dual);
+  }
+}
+
+SolutionResult ConvertExitFlag(ExitFlag flag) {
+  switch (flag) {
+    case ExitFlag::SUCCESS:
+      return SolutionResult::kSolutionFound;
+    case ExitFlag::DIVERGENCE:
+      return SolutionResult::kUnknownError;
+    case ExitFlag::MAXITERATIONS:
+      return SolutionResult::kIterationLimit;
+    case ExitFlag::PRIMAL_INFEASIBLE:
+      return SolutionResult::kInfeasibleConstraints;
+    case ExitFlag::DUAL_INFEASIBLE:
+      return SolutionResult::kDualInfeasible;
+    case ExitFlag::PRIMAL_DUAL_INFEASIBLE:
+      return SolutionResult::kInfeasibleOrUnbounded;
+  }
+  DRAKE_UNREACHABLE();
+}
+
+// If the program is compatible with this solver, returns true and clears the
+// explanation.  Otherwise, returns false and sets the explanation.  In either
+// case, the explanation can be nullptr in which case it is ignored.
+bool CheckAttributes(const MathematicalProgram& prog,
+                     std::string* explanation) {
+  static const never_destroyed<ProgramAttributes> solver_capabilities(
+      std::initializer_list<ProgramAttribute>{
+          ProgramAttribute::kLinearCost, ProgramAttribute::kQuadraticCost,
+          ProgramAttribute::kLinearConstraint,
+          ProgramAttribute::kLinearEqualityConstraint});
+  if (!internal::CheckConvexSolverAttributes(prog, solver_capabilities.access(),
+                                             "FbstabSolver", explanation)) {
+    return false;
+  }
+  if (prog.required_capabilities().count(ProgramAttribute::kQuadraticCost) ==
+      0) {
+    if (explanation) {
+      *explanation =
+          "FbstabSolver is unable to solve because a QuadraticCost is "
+          "required but has not been declared. Please use a different solver "
+          "such as CLP for linear programming.";
+    }
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+FbstabSolver::FbstabSolver()
+    : SolverBase(&id, &is_available, &is_enabled, &ProgramAttributesSatisfied,
+                 &UnsatisfiedProgramAttributes) {}
+
+FbstabSolver::~FbstabSolver() = default;
+
+SolverId FbstabSolver::id() {
+  static const never_destroyed<SolverId> singleton{"FBstab"};
+  return singleton.access();
+}
+
+bool FbstabSolver::is_available() { return true; }
+
+bool FbstabSolver::is_enabled() { return true; }
+
+bool FbstabSolver::ProgramAttributesSatisfied(const MathematicalProgram& prog) {
+  return CheckAttributes(prog, nullptr);
+}
+
+std::string FbstabSolver::UnsatisfiedProgramAttributes(
+    const MathematicalProgram& prog) {
+  std::string explanation;
+  CheckAttributes(prog, &explanation);
+  return explanation;
+}
+
+void FbstabSolver::DoSolve(const MathematicalProgram& prog,
+                           const Eigen::VectorXd& initial_guess,
+                           const SolverOptions& merged_options,
+                           MathematicalProgramResult* result) const {
+  if (!prog.GetVariableScaling().empty()) {
+    static const logging::Warn log_once(
+        "FbstabSolver doesn't support the feature of variable scaling.");
+  }
+
+  ConstraintRows rows;
+  const CanonicalQp qp = MakeCanonicalQp(prog, &rows);
+  const ReducedQp reduced = EliminateAliases(qp);
+  const int num_kept = reduced.kept.size();
+  VectorXd guess(num_kept);
+  for (int i = 0; i < num_kept; ++i) {
+    const double value = initial_guess(reduced.kept[i]);
+    guess(i) = std::isnan(value) ? 0.0 : value;
+  }
+
+  FbstabSolverDetails& details =
+      result->SetSolverDetailsType<FbstabSolverDetails>();
+  details = FbstabSolverDetails{};
+  VectorXd solution;
+  VectorXd inequality_dual;
+  SolverOut out;
+  if (const std::optional<MpcProblem> mpc = FindMpcStructure(reduced.qp)) {
+    out = SolveMpc(*mpc, guess, merged_options, &solution, &inequality_dual);
+    details.used_riccati = true;
+    details.horizon = mpc->N;
+    details.num_states = mpc->nx;
+    details.num_inputs = mpc->nu;
+    details.num_stage_constraints = mpc->nc;
+  } else {
+    out = SolveDense(reduced.qp, guess, merged_options, &solution,
+                     &inequality_dual);
+  }
+  details.exit_flag = static_cast<int>(out.eflag);
+  details.residual = out.residual;
+  details.newton_iters = out.newton_iters;
+  details.prox_iters = out.prox_iters;
+  details.solve_time = out.solve_time;
+
+  const VectorXd x = reduced.T * solution + reduced.t;
+  result->set_x_val(x);
+  const SolutionResult solution_result = ConvertExitFlag(out.eflag);
+  result->set_solution_result(solution_result);
+  switch (solution_result) {
+    case SolutionResult::kSolutionFound: {
+      result->set_optimal_cost(0.5 * x.dot(qp.H * x) + qp.f.dot(x) +
+                               qp.constant);
+      SetDualSolutions(prog, qp, rows, x, inequality_dual, result);
+      break;
+    }
+    case SolutionResult::kInfeasibleConstraints: {
+      result->set_optimal_cost(MathematicalProgram::kGlobalInfeasibleCost);
+      break;
+    }
+    default: {
+      result->set_optimal_cost(NAN);
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/solvers/solver_base.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+
+/*
+ * The FBstab solver details after calling Solve() function. The user can call
+ * MathematicalProgramResult::get_solver_details<FbstabSolver>() to obtain the
+ * details.
+ */
+struct FbstabSolverDetails {
+  // True if the program was recognized as a model predictive control problem
+  // and solved with the Riccati-based FBstabMpc; false if it was solved with
+  // the dense FBstabDense.
+  bool used_riccati{false};
+  // The dimensions (N, nx, nu, nc) of the FBstabMpc problem, including any
+  // padding that was added so that all stages have the same size. All zero
+  // when used_riccati is false.
+  int horizon{};
+  int num_states{};
+  int num_inputs{};
+  int num_stage_constraints{};
+  // The FBstab exit flag, see fbstab::ExitFlag (0 is success).
+  int exit_flag{};
+  // The norm of the natural residual at termination.
+  double residual{};
+  // Number of Newton and proximal point iterations taken.
+  int newton_iters{};
+  int prox_iters{};
+  // Time taken by the FBstab solve (seconds); this is only measured when the
+  // "record_solve_time" option is set.
+  double solve_time{};
+};
+
+/*
+ * Solves convex quadratic programs with FBstab, a proximally stabilized
+ * semismooth Newton method (https://arxiv.org/pdf/1901.04046.pdf).
+ *
+ * The program may have linear and quadratic costs (a quadratic cost is
+ * required), and linear, linear equality and bounding box constraints. Before
+ * solving, the program is searched for the stagewise structure of a linear
+ * model predictive control problem
+ *
+ *     min  ∑ₖ ½ [xₖ; uₖ]ᵀ Hₖ [xₖ; uₖ] + hₖᵀ [xₖ; uₖ]
+ *     s.t. xₖ₊₁ = Aₖ xₖ + Bₖ uₖ + cₖ,  x₀ = x̂₀,  Eₖ xₖ + Lₖ uₖ ≤ dₖ,
+ *
+ * as it is created by, e.g., DirectTranscription of a discrete-time linear
+ * system (and therefore by LinearModelPredictiveController). The structure is
+ * found from the sparsity of the constraints, so the order in which the
+ * variables and constraints were added does not matter:
+ *
+ * - The initial state x̂₀ is the set of variables that are fixed by equality
+ *   (or bounding box) constraints and appear in the other equality constraints.
+ * - Each remaining equality constraint must describe the dynamics of one step:
+ *   the states xₖ₊₁ are recovered from the equality constraints that involve
+ *   xₖ, and the remaining new variables of those constraints are the inputs uₖ.
+ *   An equality constraint between two variables, where one of them appears in
+ *   no other equality constraint (such as the `u[N-2] == u[N-1]` constraint
+ *   of DirectTranscription), is eliminated by substitution first.
+ * - Variables that appear in no equality constraint are appended to the inputs
+ *   of the only stage that they are coupled to (by the costs or inequality
+ *   constraints).
+ * - The costs and inequality constraints may only couple variables of the
+ *   same stage.
+ *
+ * When the structure is found, the program is solved with FBstabMpc, whose
+ * Riccati recursion costs O(N (nx + nu)³) per iteration for a horizon of N
+ * steps. Otherwise, the program is solved with FBstabDense, which costs
+ * O(n³) per iteration for n decision variables; the result is the same up to
+ * the solver tolerance. FbstabSolverDetails::used_riccati reports which one
+ * was used.
+ *
+ * The initial guess is used to warm start the solver; NaN entries are replaced
+ * by zero.
+ *
+ * When the program is solved, the dual solution of each linear, linear
+ * equality and bounding box constraint is set on the result (see
+ * MathematicalProgramResult::GetDualSolution()).
+ *
+ * The FBstab library in solvers/fbstab is deprecated, so this solver is kept
+ * internal: it is not bound in Python, is not one of the solvers known to
+ * ChooseBestSolver() or MakeSolver(), and will be removed along with the
+ * library.
+ *
+ * The user can set the FBstab options
+ * "abs_tol", "rel_tol", "stall_tol", "infeas_tol", "sigma0", "alpha", "beta",
+ * "eta", "inner_tol_multiplier", "inner_tol_max", "inner_tol_min" (double),
+ * "max_newton_iters", "max_prox_iters", "max_inner_iters",
+ * "max_linesearch_iters", "check_feasibility" and "record_solve_time" (int;
+ * the last two are booleans). See fbstab_algorithm.h for their meaning. The
+ * solver only prints its progress if CommonSolverOption::kPrintToConsole is
+ * set.
+ */
+class FbstabSolver final : public SolverBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FbstabSolver)
+
+  // Type of details stored in MathematicalProgramResult.
+  using Details = FbstabSolverDetails;
+
+  FbstabSolver();
+  ~FbstabSolver() final;
+
+  // Static versions of the instance methods with similar names.
+  static SolverId id();
+  static bool is_available();
+  static bool is_enabled();
+  static bool ProgramAttributesSatisfied(const MathematicalProgram&);
+  static std::string UnsatisfiedProgramAttributes(const MathematicalProgram&);
+
+  using SolverBase::Solve;
+
+ private:
+  void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
+               const SolverOptions&, MathematicalProgramResult*) const final;
+};
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -133,12 +133,57 @@ void SetAllConstraintDualSolution(
   }
 }
 
-/// @param[out] num_grad number of gradients
-/// @return number of constraints
-int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
-  const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
-  return num_constraints;
+/// The structure of the rows of the constraint Jacobian that belong to one
+/// constraint binding.  Only the nonzero entries of the binding's Jacobian are
+/// reported to IPOPT, so that it can exploit their sparsity (instead of
+/// treating each binding's block of the Jacobian as dense).
+struct ConstraintJacobianStructure {
+  /// The (row, column) of each nonzero entry of this binding's Jacobian; the
+  /// row is relative to the binding's first row and the column indexes the
+  /// binding's variables.
+  std::vector<std::pair<int, int>> nonzeros;
+  /// The index in the program's decision variables of each of the binding's
+  /// variables.
+  std::vector<int> variable_indices;
+  /// For linear constraints, the (constant) value of each nonzero entry, so
+  /// that the Jacobian never needs to be evaluated; empty otherwise.
+  std::vector<double> linear_values;
+  /// True iff `nonzeros` lists every (row, column) pair in row-major order.
+  bool dense{false};
+};
+
+template <typename C>
+ConstraintJacobianStructure MakeConstraintJacobianStructure(
+    const MathematicalProgram& prog, const Binding<C>& binding) {
+  ConstraintJacobianStructure result;
+  result.variable_indices =
+      prog.FindDecisionVariableIndices(binding.variables());
+  const Constraint& c = *binding.evaluator();
+  const auto* linear = dynamic_cast<const LinearConstraint*>(&c);
+  if (linear != nullptr) {
+    // A linear constraint's Jacobian is its (sparse) A matrix.
+    const Eigen::SparseMatrix<double>& A = linear->get_sparse_A();
+    result.nonzeros.reserve(A.nonZeros());
+    result.linear_values.reserve(A.nonZeros());
+    for (int j = 0; j < A.outerSize(); ++j) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(A, j); it; ++it) {
+        result.nonzeros.emplace_back(it.row(), it.col());
+        result.linear_values.push_back(it.value());
+      }
+    }
+  } else if (c.gradient_sparsity_pattern().has_value()) {
+    result.nonzeros = c.gradient_sparsity_pattern().value();
+  } else {
+    const int num_vars = result.variable_indices.size();
+    result.nonzeros.reserve(c.num_constraints() * num_vars);
+    for (int i = 0; i < c.num_constraints(); ++i) {
+      for (int j = 0; j < num_vars; ++j) {
+        result.nonzeros.emplace_back(i, j);
+      }
+    }
+    result.dense = true;
+  }
+  return result;
 }
 
 /// @param constraint_idx The starting row number for the constraint
@@ -153,21 +198,14 @@ int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
 /// http://www.coin-or.org/Ipopt/documentation/node38.html#app.triplet
 ///
 /// @return the number of row/column pairs filled in.
-size_t GetGradientMatrix(
-    const MathematicalProgram& prog, const Constraint& c,
-    const Eigen::Ref<const VectorXDecisionVariable>& variables,
-    Index constraint_idx, Index* iRow, Index* jCol) {
-  const int m = c.num_constraints();
+size_t GetGradientMatrix(const ConstraintJacobianStructure& structure,
+                         Index constraint_idx, Index* iRow, Index* jCol) {
   size_t grad_index = 0;
-
-  for (int i = 0; i < static_cast<int>(m); ++i) {
-    for (int j = 0; j < variables.rows(); ++j) {
-      iRow[grad_index] = constraint_idx + i;
-      jCol[grad_index] = prog.FindDecisionVariableIndex(variables(j));
-      grad_index++;
-    }
+  for (const auto& [row, col] : structure.nonzeros) {
+    iRow[grad_index] = constraint_idx + row;
+    jCol[grad_index] = structure.variable_indices[col];
+    grad_index++;
   }
-
   return grad_index;
 }
 
@@ -185,9 +223,8 @@ Eigen::VectorXd MakeEigenVector(Index n, const Number* x) {
 /// GetGradientMatrix.
 ///
 /// @return number of gradient entries populated.
-size_t EvaluateConstraint(const MathematicalProgram& prog,
-                          const Eigen::VectorXd& xvec, const Constraint& c,
-                          const VectorXDecisionVariable& variables,
+size_t EvaluateConstraint(const Eigen::VectorXd& xvec, const Constraint& c,
+                          const ConstraintJacobianStructure& structure,
                           Number* result, Number* grad) {
   // For constraints which don't use all of the variables in the X
   // input, extract a subset into the AutoDiffVecXd this_x to evaluate
@@ -196,15 +233,15 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   // the correct geometry (e.g. the constraint uses all decision
   // variables in the same order they appear in xvec), but this is not
   // currently done).
-  int num_v_variables = variables.rows();
+  const int num_v_variables = structure.variable_indices.size();
   Eigen::VectorXd this_x(num_v_variables);
   for (int i = 0; i < num_v_variables; ++i) {
-    this_x(i) = xvec(prog.FindDecisionVariableIndex(variables(i)));
+    this_x(i) = xvec(structure.variable_indices[i]);
   }
 
-  if (!grad) {
-    // We don't want the gradient info, so just call the VectorXd version of
-    // Eval.
+  if (!grad || !structure.linear_values.empty()) {
+    // We don't want the gradient info (or, for a linear constraint, already
+    // know it), so just call the VectorXd version of Eval.
     Eigen::VectorXd ty(c.num_constraints());
 
     c.Eval(this_x, &ty);
@@ -213,7 +250,12 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
     for (int i = 0; i < c.num_constraints(); i++) {
       result[i] = ty(i);
     }
-    return 0;
+    if (!grad) {
+      return 0;
+    }
+    std::copy(structure.linear_values.begin(), structure.linear_values.end(),
+              grad);
+    return structure.linear_values.size();
   }
 
   // Run the version which calculates gradients.
@@ -232,16 +274,24 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   size_t grad_idx = 0;
 
   DRAKE_ASSERT(ty.rows() == c.num_constraints());
-  for (int i = 0; i < ty.rows(); i++) {
-    if (ty(i).derivatives().size() > 0) {
-      for (int j = 0; j < variables.rows(); j++) {
-        grad[grad_idx++] = ty(i).derivatives()(j);
-      }
-    } else {
-      for (int j = 0; j < variables.rows(); j++) {
-        grad[grad_idx++] = 0;
+  if (structure.dense) {
+    for (int i = 0; i < ty.rows(); i++) {
+      if (ty(i).derivatives().size() > 0) {
+        for (int j = 0; j < num_v_variables; j++) {
+          grad[grad_idx++] = ty(i).derivatives()(j);
+        }
+      } else {
+        for (int j = 0; j < num_v_variables; j++) {
+          grad[grad_idx++] = 0;
+        }
       }
     }
+  } else {
+    for (const auto& [row, col] : structure.nonzeros) {
+      grad[grad_idx++] = ty(row).derivatives().size() > 0
+                             ? ty(row).derivatives()(col)
+                             : 0.0;
+    }
   }
 
   return grad_idx;
@@ -325,28 +375,26 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     // Initialize the cost cache with those dimensions.
     cost_cache_.reset(new ResultCache(n, 1, n));
 
+    // Compute the Jacobian structure of every constraint once, in the same
+    // order as the constraints are enumerated by get_bounds_info().
+    jacobian_structures_.clear();
+    auto add_structures = [this](const auto& bindings) {
+      for (const auto& c : bindings) {
+        jacobian_structures_.emplace_back(
+            c.evaluator().get(), MakeConstraintJacobianStructure(*problem_, c));
+      }
+    };
+    add_structures(problem_->generic_constraints());
+    add_structures(problem_->lorentz_cone_constraints());
+    add_structures(problem_->rotated_lorentz_cone_constraints());
+    add_structures(problem_->linear_constraints());
+    add_structures(problem_->linear_equality_constraints());
+
     m = 0;
     nnz_jac_g = 0;
-    Index num_grad = 0;
-    for (const auto& c : problem_->generic_constraints()) {
-      m += GetNumGradients(*(c.evaluator()), c.variables().rows(), &num_grad);
-      nnz_jac_g += num_grad;
-    }
-    for (const auto& c : problem_->lorentz_cone_constraints()) {
-      m += GetNumGradients(*(c.evaluator()), c.variables().rows(), &num_grad);
-      nnz_jac_g += num_grad;
-    }
-    for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
-      m += GetNumGradients(*(c.evaluator()), c.variables().rows(), &num_grad);
-      nnz_jac_g += num_grad;
-    }
-    for (const auto& c : problem_->linear_constraints()) {
-      m += GetNumGradients(*(c.evaluator()), c.variables().rows(), &num_grad);
-      nnz_jac_g += num_grad;
-    }
-    for (const auto& c : problem_->linear_equality_constraints()) {
-      m += GetNumGradients(*(c.evaluator()), c.variables().rows(), &num_grad);
-      nnz_jac_g += num_grad;
+    for (const auto& [c, structure] : jacobian_structures_) {
+      m += c->num_constraints();
+      nnz_jac_g += structure.nonzeros.size();
     }
 
     constraint_cache_.reset(new ResultCache(n, m, nnz_jac_g));
@@ -497,41 +545,16 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
       DRAKE_ASSERT(jCol != nullptr);
 
       int constraint_idx = 0;  // Passed into GetGradientMatrix as
-                                  // the starting row number for the
-                                  // constraint being described.
+                               // the starting row number for the
+                               // constraint being described.
       int grad_idx = 0;        // Offset into iRow, jCol output variables.
-                                  // Incremented by the number of triplets
-                                  // populated by each call to
-                                  // GetGradientMatrix.
-      for (const auto& c : problem_->generic_constraints()) {
-        grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
-        constraint_idx += c.evaluator()->num_constraints();
-      }
-      for (const auto& c : problem_->lorentz_cone_constraints()) {
-        grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
-        constraint_idx += c.evaluator()->num_constraints();
-      }
-      for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
-        grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
-        constraint_idx += c.evaluator()->num_constraints();
-      }
-      for (const auto& c : problem_->linear_constraints()) {
-        grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
-        constraint_idx += c.evaluator()->num_constraints();
-      }
-      for (const auto& c : problem_->linear_equality_constraints()) {
-        grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
-        constraint_idx += c.evaluator()->num_constraints();
+                               // Incremented by the number of triplets
+                               // populated by each call to
+                               // GetGradientMatrix.
+      for (const auto& [c, structure] : jacobian_structures_) {
+        grad_idx += GetGradientMatrix(structure, constraint_idx,
+                                      iRow + grad_idx, jCol + grad_idx);
+        constraint_idx += c->num_constraints();
       }
       DRAKE_ASSERT(static_cast<Index>(grad_idx) == nele_jac);
       return true;
@@ -661,30 +684,9 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     Number* result = constraint_cache_->result.data();
     Number* grad = eval_gradient ? constraint_cache_->grad.data() : nullptr;
 
-    for (const auto& c : problem_->generic_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_equality_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, (*c.evaluator()),
-                                 c.variables(), result, grad);
-      result += c.evaluator()->num_constraints();
+    for (const auto& [c, structure] : jacobian_structures_) {
+      grad += EvaluateConstraint(xvec, *c, structure, result, grad);
+      result += c->num_constraints();
     }
 
     if (eval_gradient) {
@@ -708,6 +710,10 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   // constraint_dual_start_index_[constraint] stores the starting index of the
   // corresponding dual variables.
   std::unordered_map<Binding<Constraint>, int> constraint_dual_start_index_;
+  // The Jacobian structure of each constraint, in the order of the rows of
+  // the constraint vector g(x).
+  std::vector<std::pair<const Constraint*, ConstraintJacobianStructure>>
+      jacobian_structures_;
 };
 
 template <typename T>
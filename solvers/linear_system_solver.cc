@@ -24,6 +24,8 @@ bool LinearSystemSolver::is_available() { return true; }
 
 bool LinearSystemSolver::is_enabled() { return true; }
 
+bool LinearSystemSolver::is_thread_safe() const { return true; }
+
 void LinearSystemSolver::DoSolve(
     const MathematicalProgram& prog,
     const Eigen::VectorXd& initial_guess,
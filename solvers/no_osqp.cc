@@ -19,5 +19,27 @@ void OsqpSolver::DoSolve(
       "solver.");
 }
 
+struct PersistentOsqpSolver::Workspace {};
+
+PersistentOsqpSolver::PersistentOsqpSolver()
+    : SolverBase(&OsqpSolver::id, &OsqpSolver::is_available,
+                 &OsqpSolver::is_enabled,
+                 &OsqpSolver::ProgramAttributesSatisfied,
+                 &OsqpSolver::UnsatisfiedProgramAttributes) {}
+
+PersistentOsqpSolver::~PersistentOsqpSolver() = default;
+
+void PersistentOsqpSolver::Reset() {}
+
+void PersistentOsqpSolver::DoSolve(
+    const MathematicalProgram&,
+    const Eigen::VectorXd&,
+    const SolverOptions&,
+    MathematicalProgramResult*) const {
+  throw std::runtime_error(
+      "The OSQP bindings were not compiled.  You'll need to use a different "
+      "solver.");
+}
+
 }  // namespace solvers
 }  // namespace drake
@@ -1,7 +1,10 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <memory>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
@@ -319,84 +322,91 @@ void SetDualSolution(
                                    constraint.evaluator()->num_constraints()));
   }
 }
-}  // namespace
-
-bool OsqpSolver::is_available() { return true; }
-
-void OsqpSolver::DoSolve(
-    const MathematicalProgram& prog,
-    const Eigen::VectorXd& initial_guess,
-    const SolverOptions& merged_options,
-    MathematicalProgramResult* result) const {
-  OsqpSolverDetails& solver_details =
-      result->SetSolverDetailsType<OsqpSolverDetails>();
-
-  // TODO(hongkai.dai): OSQP uses initial guess to warm start.
-  unused(initial_guess);
-
-  // OSQP solves a convex quadratic programming problem
-  // min 0.5 xᵀPx + qᵀx
-  // s.t l ≤ Ax ≤ u
-  // OSQP is written in C, so this function will be in C style.
 
-  // Get the cost for the QP.
-  Eigen::SparseMatrix<c_float> P_sparse;
-  std::vector<c_float> q(prog.num_vars(), 0);
+// The data of the QP min 0.5 xᵀPx + qᵀx s.t l ≤ Ax ≤ u, parsed from a
+// MathematicalProgram.
+struct OsqpProblem {
+  Eigen::SparseMatrix<c_float> P;
+  std::vector<c_float> q;
   double constant_cost_term{0};
-
-  ParseQuadraticCosts(prog, &P_sparse, &q, &constant_cost_term);
-  ParseLinearCosts(prog, &q, &constant_cost_term);
-
-  // linear_constraint_start_row[binding] stores the starting row index in A
+  Eigen::SparseMatrix<c_float> A;
+  std::vector<c_float> l;
+  std::vector<c_float> u;
+  // constraint_start_row[binding] stores the starting row index in A
   // corresponding to the linear constraint `binding`.
   std::unordered_map<Binding<Constraint>, int> constraint_start_row;
+};
+
+void ParseProblem(const MathematicalProgram& prog, OsqpProblem* problem) {
+  problem->q.assign(prog.num_vars(), 0);
+  problem->constant_cost_term = 0;
+  ParseQuadraticCosts(prog, &problem->P, &problem->q,
+                      &problem->constant_cost_term);
+  ParseLinearCosts(prog, &problem->q, &problem->constant_cost_term);
+  ParseAllLinearConstraints(prog, &problem->A, &problem->l, &problem->u,
+                            &problem->constraint_start_row);
+  problem->P.makeCompressed();
+  problem->A.makeCompressed();
+}
 
-  // Parse the linear constraints.
-  Eigen::SparseMatrix<c_float> A_sparse;
-  std::vector<c_float> l, u;
-  ParseAllLinearConstraints(prog, &A_sparse, &l, &u, &constraint_start_row);
-
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+// Returns the OSQP data that refers to `problem`. The caller is responsible
+// for freeing the memory with FreeOsqpData(), while `problem` remains alive.
+OSQPData* MakeOsqpData(OsqpProblem* problem) {
+  OSQPData* data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+  data->n = problem->q.size();
+  data->m = problem->A.rows();
+  data->P = EigenSparseToCSC(problem->P);
+  data->q = problem->q.data();
+  data->A = EigenSparseToCSC(problem->A);
+  data->l = problem->l.data();
+  data->u = problem->u.data();
+  return data;
+}
 
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
+void FreeOsqpData(OSQPData* data) {
+  c_free(data->P->x);
+  c_free(data->P->i);
+  c_free(data->P->p);
+  c_free(data->P);
+  c_free(data->A->x);
+  c_free(data->A->i);
+  c_free(data->A->p);
+  c_free(data->A);
+  c_free(data);
+}
 
-  // Define Solver settings as default.
-  // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
+// If the initial guess has no NaN entries, warm starts the primal solution of
+// `work` with it.
+void WarmStartPrimal(const MathematicalProgram& prog,
+                     const Eigen::VectorXd& initial_guess,
+                     OSQPWorkspace* work) {
+  if (initial_guess.array().isNaN().any()) {
+    return;
+  }
+  // OSQP solves for the unscaled variables, see ParseQuadraticCosts().
+  std::vector<c_float> x(initial_guess.data(),
+                         initial_guess.data() + initial_guess.size());
+  for (const auto& [index, scale] : prog.GetVariableScaling()) {
+    x[index] /= scale;
+  }
+  osqp_warm_start_x(work, x.data());
+}
 
-  SetOsqpSolverSettings(merged_options, settings);
+// Solves the problem in `work`, and stores the outcome in `result`.
+void SolveAndExtractResults(const MathematicalProgram& prog,
+                            const OsqpProblem& problem, OSQPWorkspace* work,
+                            MathematicalProgramResult* result) {
+  OsqpSolverDetails& solver_details =
+      result->SetSolverDetailsType<OsqpSolverDetails>();
 
   // If any step fails, it will set the solution_result and skip other steps.
   std::optional<SolutionResult> solution_result;
 
-  // Setup workspace.
-  OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
-    const c_int osqp_setup_err = osqp_setup(&work, data, settings);
-    if (osqp_setup_err != 0) {
-      solution_result = SolutionResult::kInvalidInput;
-    }
-  }
-
   // Solve problem.
-  if (!solution_result) {
-    DRAKE_THROW_UNLESS(work != nullptr);
-    const c_int osqp_solve_err = osqp_solve(work);
-    if (osqp_solve_err != 0) {
-      solution_result = SolutionResult::kInvalidInput;
-    }
+  DRAKE_THROW_UNLESS(work != nullptr);
+  const c_int osqp_solve_err = osqp_solve(work);
+  if (osqp_solve_err != 0) {
+    solution_result = SolutionResult::kInvalidInput;
   }
 
   // Extract results.
@@ -430,16 +440,17 @@ void OsqpSolver::DoSolve(
           result->set_x_val(osqp_sol.cast<double>());
         }
 
-        result->set_optimal_cost(work->info->obj_val + constant_cost_term);
+        result->set_optimal_cost(work->info->obj_val +
+                                 problem.constant_cost_term);
         solver_details.y =
             Eigen::Map<Eigen::VectorXd>(work->solution->y, work->data->m);
         solution_result = SolutionResult::kSolutionFound;
         SetDualSolution(prog.linear_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        problem.constraint_start_row, result);
         SetDualSolution(prog.linear_equality_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        problem.constraint_start_row, result);
         SetDualSolution(prog.bounding_box_constraints(), solver_details.y,
-                        constraint_start_row, result);
+                        problem.constraint_start_row, result);
 
         break;
       }
@@ -465,20 +476,175 @@ void OsqpSolver::DoSolve(
     }
   }
   result->set_solution_result(solution_result.value());
+}
+
+// Returns true iff the two sparse matrices have the same sparsity pattern.
+bool HaveSameSparsity(const Eigen::SparseMatrix<c_float>& a,
+                      const Eigen::SparseMatrix<c_float>& b) {
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         a.nonZeros() == b.nonZeros() &&
+         std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.outerSize() + 1,
+                    b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                    b.innerIndexPtr());
+}
+
+// Returns true iff the two sparse matrices (with the same sparsity pattern)
+// have the same values.
+bool HaveSameValues(const Eigen::SparseMatrix<c_float>& a,
+                    const Eigen::SparseMatrix<c_float>& b) {
+  return std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
+
+// Returns true iff all of the settings that SetOsqpSolverSettings() sets are
+// the same.
+bool HaveSameSettings(const OSQPSettings& a, const OSQPSettings& b) {
+  return a.rho == b.rho && a.sigma == b.sigma && a.max_iter == b.max_iter &&
+         a.eps_abs == b.eps_abs && a.eps_rel == b.eps_rel &&
+         a.eps_prim_inf == b.eps_prim_inf && a.eps_dual_inf == b.eps_dual_inf &&
+         a.alpha == b.alpha && a.delta == b.delta && a.polish == b.polish &&
+         a.polish_refine_iter == b.polish_refine_iter &&
+         a.verbose == b.verbose &&
+         a.scaled_termination == b.scaled_termination &&
+         a.check_termination == b.check_termination &&
+         a.warm_start == b.warm_start && a.scaling == b.scaling &&
+         a.adaptive_rho == b.adaptive_rho &&
+         a.adaptive_rho_interval == b.adaptive_rho_interval &&
+         a.adaptive_rho_tolerance == b.adaptive_rho_tolerance &&
+         a.adaptive_rho_fraction == b.adaptive_rho_fraction &&
+         a.time_limit == b.time_limit;
+}
+}  // namespace
+
+bool OsqpSolver::is_available() { return true; }
+
+void OsqpSolver::DoSolve(
+    const MathematicalProgram& prog,
+    const Eigen::VectorXd& initial_guess,
+    const SolverOptions& merged_options,
+    MathematicalProgramResult* result) const {
+  result->SetSolverDetailsType<OsqpSolverDetails>();
+
+  // OSQP solves a convex quadratic programming problem
+  // min 0.5 xᵀPx + qᵀx
+  // s.t l ≤ Ax ≤ u
+  // OSQP is written in C, so this function will be in C style.
+  OsqpProblem problem;
+  ParseProblem(prog, &problem);
+
+  // Now pass the constraint and cost to osqp data.
+  OSQPData* data = MakeOsqpData(&problem);
+
+  // Define Solver settings as default.
+  // Problem settings
+  OSQPSettings* settings =
+      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+  osqp_set_default_settings(settings);
+
+  SetOsqpSolverSettings(merged_options, settings);
+
+  // Setup workspace.
+  OSQPWorkspace* work = nullptr;
+  const c_int osqp_setup_err = osqp_setup(&work, data, settings);
+  if (osqp_setup_err != 0) {
+    result->set_solution_result(SolutionResult::kInvalidInput);
+  } else {
+    WarmStartPrimal(prog, initial_guess, work);
+    SolveAndExtractResults(prog, problem, work, result);
+  }
 
   // Clean workspace.
   osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
+  FreeOsqpData(data);
   c_free(settings);
 }
 
+struct PersistentOsqpSolver::Workspace {
+  Workspace() { osqp_set_default_settings(&settings); }
+
+  ~Workspace() { osqp_cleanup(work); }
+
+  // The problem and settings that `work` currently holds.
+  OsqpProblem problem;
+  OSQPSettings settings;
+  OSQPWorkspace* work{nullptr};
+};
+
+PersistentOsqpSolver::PersistentOsqpSolver()
+    : SolverBase(&OsqpSolver::id, &OsqpSolver::is_available,
+                 &OsqpSolver::is_enabled,
+                 &OsqpSolver::ProgramAttributesSatisfied,
+                 &OsqpSolver::UnsatisfiedProgramAttributes) {}
+
+PersistentOsqpSolver::~PersistentOsqpSolver() = default;
+
+void PersistentOsqpSolver::Reset() {
+  workspace_.reset();
+  reused_workspace_ = false;
+}
+
+void PersistentOsqpSolver::DoSolve(
+    const MathematicalProgram& prog,
+    const Eigen::VectorXd& initial_guess,
+    const SolverOptions& merged_options,
+    MathematicalProgramResult* result) const {
+  result->SetSolverDetailsType<OsqpSolverDetails>();
+
+  OsqpProblem problem;
+  ParseProblem(prog, &problem);
+  OSQPSettings settings;
+  osqp_set_default_settings(&settings);
+  SetOsqpSolverSettings(merged_options, &settings);
+
+  reused_workspace_ =
+      workspace_ != nullptr &&
+      problem.q.size() == workspace_->problem.q.size() &&
+      HaveSameSparsity(problem.P, workspace_->problem.P) &&
+      HaveSameSparsity(problem.A, workspace_->problem.A) &&
+      HaveSameSettings(settings, workspace_->settings);
+
+  if (reused_workspace_) {
+    // Update the data in place. The KKT matrix is only factorized again if the
+    // values of P or A changed.
+    OSQPWorkspace* work = workspace_->work;
+    c_int update_err = osqp_update_lin_cost(work, problem.q.data());
+    if (update_err == 0) {
+      update_err =
+          osqp_update_bounds(work, problem.l.data(), problem.u.data());
+    }
+    const bool P_changed = !HaveSameValues(problem.P, workspace_->problem.P);
+    const bool A_changed = !HaveSameValues(problem.A, workspace_->problem.A);
+    if (update_err == 0 && (P_changed || A_changed)) {
+      update_err = osqp_update_P_A(
+          work, problem.P.valuePtr(), OSQP_NULL, problem.P.nonZeros(),
+          problem.A.valuePtr(), OSQP_NULL, problem.A.nonZeros());
+    }
+    if (update_err != 0) {
+      // The workspace might be only partially updated, so discard it.
+      workspace_.reset();
+      result->set_solution_result(SolutionResult::kInvalidInput);
+      return;
+    }
+    workspace_->problem = std::move(problem);
+  } else {
+    workspace_ = std::make_unique<Workspace>();
+    workspace_->problem = std::move(problem);
+    workspace_->settings = settings;
+    OSQPData* data = MakeOsqpData(&workspace_->problem);
+    // osqp_setup() copies the data into the workspace.
+    const c_int osqp_setup_err =
+        osqp_setup(&workspace_->work, data, &workspace_->settings);
+    FreeOsqpData(data);
+    if (osqp_setup_err != 0) {
+      workspace_.reset();
+      result->set_solution_result(SolutionResult::kInvalidInput);
+      return;
+    }
+  }
+
+  WarmStartPrimal(prog, initial_guess, workspace_->work);
+  SolveAndExtractResults(prog, workspace_->problem, workspace_->work, result);
+}
+
 }  // namespace solvers
 }  // namespace drake
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -59,9 +60,71 @@ class OsqpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Returns true, because OSQP keeps all of its state in the workspace that
+  /// each solve creates.
+  bool is_thread_safe() const final;
+
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
 };
+
+/**
+ * Solves a sequence of QPs that share the same structure with OSQP, keeping
+ * the OSQP workspace (including the factorization of its KKT matrix) alive
+ * between the solves. This is intended for applications such as model
+ * predictive control, where a program with the same structure but different
+ * data is solved at every control tick.
+ *
+ * Two programs have the same structure if they have the same number of
+ * decision variables, the same sparsity pattern of the quadratic cost Hessian P
+ * and of the linear constraint matrix A (after stacking the costs and
+ * constraints in the order that they were added to the program; entries that
+ * are exactly zero are not part of the pattern), and the same solver options.
+ * When the program passed to Solve() has the same structure as the previously
+ * solved one, the workspace is updated in place with the new linear cost,
+ * constraint bounds and (if they changed) the values of P and A, and the solve
+ * is warm started from the previous primal and dual solution. Otherwise, a new
+ * workspace is set up from scratch, exactly as OsqpSolver does.
+ *
+ * If the initial guess (either passed to Solve() or stored in the program) has
+ * no NaN entries, then it overrides the previous primal solution as the warm
+ * start.
+ *
+ * The results (including the OsqpSolverDetails) are reported with the id of
+ * OsqpSolver. Unlike most solvers, an instance of this class is stateful; it
+ * must not be used from multiple threads concurrently.
+ */
+class PersistentOsqpSolver final : public SolverBase {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PersistentOsqpSolver)
+
+  /// Type of details stored in MathematicalProgramResult.
+  using Details = OsqpSolverDetails;
+
+  PersistentOsqpSolver();
+  ~PersistentOsqpSolver() final;
+
+  /// Returns true iff the most recent call to Solve() updated the existing
+  /// workspace, instead of setting up a new one.
+  bool reused_workspace() const { return reused_workspace_; }
+
+  /// Discards the workspace, so that the next call to Solve() sets up a new
+  /// one.
+  void Reset();
+
+  // A using-declaration adds these methods into our class's Doxygen.
+  using SolverBase::Solve;
+
+ private:
+  // The OSQP workspace, and the data used to set it up.
+  struct Workspace;
+
+  void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
+               const SolverOptions&, MathematicalProgramResult*) const final;
+
+  mutable std::unique_ptr<Workspace> workspace_;
+  mutable bool reused_workspace_{false};
+};
 }  // namespace solvers
 }  // namespace drake
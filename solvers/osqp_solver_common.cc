@@ -25,6 +25,8 @@ SolverId OsqpSolver::id() {
 
 bool OsqpSolver::is_enabled() { return true; }
 
+bool OsqpSolver::is_thread_safe() const { return true; }
+
 namespace {
 // If the program is compatible with this solver, returns true and clears the
 // explanation.  Otherwise, returns false and sets the explanation.  In either
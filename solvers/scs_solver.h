@@ -84,6 +84,10 @@ class ScsSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Returns true, because SCS keeps all of its state in the workspace that
+  /// each solve creates.
+  bool is_thread_safe() const final;
+
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
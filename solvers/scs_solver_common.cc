@@ -22,6 +22,8 @@ SolverId ScsSolver::id() {
 
 bool ScsSolver::is_enabled() { return true; }
 
+bool ScsSolver::is_thread_safe() const { return true; }
+
 namespace {
 // If the program is compatible with this solver, returns true and clears the
 // explanation.  Otherwise, returns false and sets the explanation.  In either
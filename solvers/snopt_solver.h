@@ -75,6 +75,10 @@ class SnoptSolver final : public SolverBase  {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Returns true, because each solve has its own SNOPT workspace, and the
+  /// "Print file" units are allocated per thread.
+  bool is_thread_safe() const final;
+
  private:
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
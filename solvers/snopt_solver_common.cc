@@ -22,6 +22,8 @@ SolverId SnoptSolver::id() {
 
 bool SnoptSolver::is_enabled() { return true; }
 
+bool SnoptSolver::is_thread_safe() const { return true; }
+
 bool SnoptSolver::ProgramAttributesSatisfied(const MathematicalProgram& prog) {
   static const never_destroyed<ProgramAttributes> solver_capabilities(
       std::initializer_list<ProgramAttribute>{
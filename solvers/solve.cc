@@ -1,8 +1,11 @@
 #include "drake/solvers/solve.h"
 
 #include <memory>
+#include <unordered_map>
+#include <utility>
 
 #include "drake/common/nice_type_name.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/solver_interface.h"
@@ -31,5 +34,76 @@ MathematicalProgramResult Solve(
 MathematicalProgramResult Solve(const MathematicalProgram& prog) {
   return Solve(prog, {}, {});
 }
+
+std::vector<MathematicalProgramResult> SolveInParallel(
+    const std::vector<const MathematicalProgram*>& progs,
+    const std::vector<std::optional<Eigen::VectorXd>>* initial_guesses,
+    const std::vector<std::optional<SolverOptions>>* solver_options,
+    const std::optional<SolverId>& solver_id, int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  DRAKE_THROW_UNLESS(initial_guesses == nullptr ||
+                     initial_guesses->size() == progs.size());
+  DRAKE_THROW_UNLESS(solver_options == nullptr ||
+                     solver_options->size() == progs.size());
+  const int num_progs = progs.size();
+
+  // Choose the solver for each program on the calling thread, and split the
+  // programs into those whose solver can run concurrently and the others.
+  std::vector<SolverId> solver_ids;
+  solver_ids.reserve(num_progs);
+  std::unordered_map<SolverId, bool> is_thread_safe;
+  std::vector<int> parallel_indices;
+  std::vector<int> serial_indices;
+  for (int i = 0; i < num_progs; ++i) {
+    DRAKE_THROW_UNLESS(progs[i] != nullptr);
+    solver_ids.push_back(solver_id.has_value() ? *solver_id
+                                               : ChooseBestSolver(*progs[i]));
+    auto iter = is_thread_safe.find(solver_ids.back());
+    if (iter == is_thread_safe.end()) {
+      iter = is_thread_safe
+                 .emplace(solver_ids.back(),
+                          MakeSolver(solver_ids.back())->is_thread_safe())
+                 .first;
+    }
+    (iter->second ? parallel_indices : serial_indices).push_back(i);
+  }
+
+  std::vector<MathematicalProgramResult> results(num_progs);
+  const std::optional<Eigen::VectorXd> no_guess;
+  const std::optional<SolverOptions> no_options;
+  // Solves progs[i] with a solver from `solvers`, which holds the instances
+  // made so far by the calling thread.
+  auto solve = [&](int i, std::unordered_map<SolverId,
+                                             std::unique_ptr<SolverInterface>>*
+                              solvers) {
+    std::unique_ptr<SolverInterface>& solver = (*solvers)[solver_ids[i]];
+    if (solver == nullptr) {
+      solver = MakeSolver(solver_ids[i]);
+    }
+    solver->Solve(*progs[i],
+                  initial_guesses != nullptr ? (*initial_guesses)[i] : no_guess,
+                  solver_options != nullptr ? (*solver_options)[i] : no_options,
+                  &results[i]);
+  };
+
+  // Each thread repeatedly claims the next unsolved program, and keeps its own
+  // solver instances.
+  const int num_workers = drake::internal::CalcNumParallelThreads(
+      num_threads, parallel_indices.size());
+  std::vector<std::unordered_map<SolverId, std::unique_ptr<SolverInterface>>>
+      thread_solvers(num_workers);
+  drake::internal::DynamicParallelFor(
+      num_workers, parallel_indices.size(), [&](int thread_num, int k) {
+        solve(parallel_indices[k], &thread_solvers[thread_num]);
+      });
+
+  // The serial programs reuse the solvers made by the calling thread.
+  std::unordered_map<SolverId, std::unique_ptr<SolverInterface>>& solvers =
+      thread_solvers[0];
+  for (const int i : serial_indices) {
+    solve(i, &solvers);
+  }
+  return results;
+}
 }  // namespace solvers
 }  // namespace drake
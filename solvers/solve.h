@@ -42,5 +42,34 @@ MathematicalProgramResult Solve(
     const Eigen::Ref<const Eigen::VectorXd>& initial_guess);
 
 MathematicalProgramResult Solve(const MathematicalProgram& prog);
+
+/**
+ * Solves a batch of independent optimization programs, distributing them over
+ * up to @p num_threads threads, and returns the results in the same order as
+ * the programs.
+ *
+ * Each thread makes its own instances of the solvers that it uses. Programs
+ * whose solver is not thread-safe (see SolverInterface::is_thread_safe()) are
+ * solved one at a time on the calling thread, after the other programs.
+ *
+ * @param progs The programs to solve. None of them may be nullptr.
+ * @param initial_guesses If not nullptr, it must have the same size as
+ * @p progs; `(*initial_guesses)[i]` is the initial guess for `progs[i]`, or
+ * nullopt to use the initial guess stored in `progs[i]`.
+ * @param solver_options If not nullptr, it must have the same size as @p progs;
+ * `(*solver_options)[i]` holds the options (in addition to those stored in the
+ * program) used to solve `progs[i]`, or nullopt for none.
+ * @param solver_id The solver to use for every program. If nullopt, then the
+ * best solver is chosen for each program, as in Solve().
+ * @param num_threads The maximum number of threads to use, including the
+ * calling thread. Must be >= 1. Consider std::thread::hardware_concurrency().
+ *
+ * @throws std::exception if any of the solves throws.
+ */
+std::vector<MathematicalProgramResult> SolveInParallel(
+    const std::vector<const MathematicalProgram*>& progs,
+    const std::vector<std::optional<Eigen::VectorXd>>* initial_guesses,
+    const std::vector<std::optional<SolverOptions>>* solver_options,
+    const std::optional<SolverId>& solver_id, int num_threads);
 }  // namespace solvers
 }  // namespace drake
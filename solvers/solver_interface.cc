@@ -7,5 +7,9 @@ SolverInterface::SolverInterface() = default;
 
 SolverInterface::~SolverInterface() = default;
 
+bool SolverInterface::is_thread_safe() const {
+  return false;
+}
+
 }  // namespace solvers
 }  // namespace drake
@@ -72,6 +72,14 @@ class SolverInterface {
   /// Returns the identifier of this solver.
   virtual SolverId solver_id() const = 0;
 
+  /// Returns true iff separate instances of this solver may be used to solve
+  /// programs concurrently from different threads. (Calling Solve() on the
+  /// same instance from different threads is never guaranteed to be safe.)
+  /// The default implementation returns false; solvers that have been checked
+  /// not to rely on process-wide state opt in by overriding this. For example,
+  /// IPOPT returns false, because its MUMPS linear solver is not thread-safe.
+  virtual bool is_thread_safe() const;
+
   /// Returns true iff the program's attributes are compatible with this
   /// solver's capabilities.
   virtual bool AreProgramAttributesSatisfied(
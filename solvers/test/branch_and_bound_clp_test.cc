@@ -0,0 +1,109 @@
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/solvers/branch_and_bound.h"
+#include "drake/solvers/clp_solver.h"
+
+// These tests use Clp, which is always available (unlike the Gurobi solver in
+// branch_and_bound_test.cc) and is thread-safe.
+
+namespace drake {
+namespace solvers {
+namespace {
+
+// Construct the mixed-integer linear program
+// min x₀ + 2x₁ - 3x₂ - 4x₃ + 4.5x₄ + 1
+// s.t 2x₀ + x₂ + 1.5x₃ + x₄ = 4.5
+//     1 ≤ 2x₀ + 4x₃ + x₄ ≤ 7
+//     -2 ≤ 3x₁ + 2x₂ - 5x₃ + x₄ ≤ 7
+//     -5 ≤ x₁ + x₂ + 2x₃ ≤ 10
+//     -10 ≤ x₁ ≤ 10
+//     x₀, x₂, x₄ are binary variables.
+// The optimal solution is (1, 1/3, 1, 1, 0), with optimal cost -13/3.
+std::unique_ptr<MathematicalProgram> ConstructMathematicalProgram() {
+  auto prog = std::make_unique<MathematicalProgram>();
+  VectorDecisionVariable<5> x;
+  x(0) = symbolic::Variable("x0", symbolic::Variable::Type::BINARY);
+  x(1) = symbolic::Variable("x1", symbolic::Variable::Type::CONTINUOUS);
+  x(2) = symbolic::Variable("x2", symbolic::Variable::Type::BINARY);
+  x(3) = symbolic::Variable("x3", symbolic::Variable::Type::CONTINUOUS);
+  x(4) = symbolic::Variable("x4", symbolic::Variable::Type::BINARY);
+  prog->AddDecisionVariables(x);
+  prog->AddCost(x(0) + 2 * x(1) - 3 * x(2) - 4 * x(3) + 4.5 * x(4) + 1);
+  prog->AddLinearEqualityConstraint(2 * x(0) + x(2) + 1.5 * x(3) + x(4) == 4.5);
+  prog->AddLinearConstraint(2 * x(0) + 4 * x(3) + x(4), 1, 7);
+  prog->AddLinearConstraint(3 * x(1) + 2 * x(2) - 5 * x(3) + x(4), -2, 7);
+  prog->AddLinearConstraint(x(1) + x(2) + 2 * x(3), -5, 10);
+  prog->AddBoundingBoxConstraint(-10, 10, x(1));
+  return prog;
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundClpTest, TestSolveInParallel) {
+  // Clp must be thread-safe, otherwise the child programs are solved serially
+  // and this test would not cover the parallel path.
+  ASSERT_TRUE(ClpSolver().is_thread_safe());
+  auto prog = ConstructMathematicalProgram();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+  Eigen::Matrix<double, 5, 1> x_expected;
+  x_expected << 1, 1.0 / 3, 1, 1, 0;
+  const double tol{1E-6};
+  for (auto pick_node :
+       {MixedIntegerBranchAndBound::NodeSelectionMethod::kDepthFirst,
+        MixedIntegerBranchAndBound::NodeSelectionMethod::kMinLowerBound}) {
+    std::vector<std::unique_ptr<MixedIntegerBranchAndBound>> bnbs;
+    for (int num_threads : {1, 3, 3}) {
+      bnbs.push_back(std::make_unique<MixedIntegerBranchAndBound>(
+          *prog, ClpSolver::id()));
+      MixedIntegerBranchAndBound& bnb = *bnbs.back();
+      bnb.SetNodeSelectionMethod(pick_node);
+      bnb.set_num_threads(num_threads);
+      EXPECT_EQ(bnb.Solve(), SolutionResult::kSolutionFound);
+      EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, tol);
+      EXPECT_TRUE(CompareMatrices(bnb.GetSolution(x), x_expected, tol));
+    }
+    // The parallel solve does not depend on the thread scheduling.
+    ASSERT_EQ(bnbs[1]->solutions().size(), bnbs[2]->solutions().size());
+    for (int i = 0; i < static_cast<int>(bnbs[1]->solutions().size()); ++i) {
+      EXPECT_TRUE(CompareMatrices(bnbs[1]->GetSolution(x, i),
+                                  bnbs[2]->GetSolution(x, i)));
+    }
+    EXPECT_EQ(bnbs[1]->best_lower_bound(), bnbs[2]->best_lower_bound());
+  }
+}
+
+GTEST_TEST(MixedIntegerBranchAndBoundClpTest, TestWarmStartChildren) {
+  auto prog = ConstructMathematicalProgram();
+  for (bool warm_start : {false, true}) {
+    MixedIntegerBranchAndBound bnb(*prog, ClpSolver::id());
+    bnb.SetWarmStartChildrenFromParent(warm_start);
+    int num_children{0};
+    bnb.SetUserDefinedNodeCallbackFunction(
+        [warm_start, &num_children](const MixedIntegerBranchAndBoundNode& node,
+                                    MixedIntegerBranchAndBound*) {
+          if (node.IsRoot()) {
+            return;
+          }
+          ++num_children;
+          const VectorXDecisionVariable& x = node.prog()->decision_variables();
+          const Eigen::VectorXd guess = node.prog()->GetInitialGuess(x);
+          if (warm_start) {
+            // The parent node is only branched if its program was solved.
+            EXPECT_TRUE(CompareMatrices(
+                guess, node.parent()->prog_result()->GetSolution(x)));
+          } else {
+            // The initial guess of the mixed-integer program is unset.
+            EXPECT_TRUE(guess.array().isNaN().all());
+          }
+        });
+    EXPECT_EQ(bnb.Solve(), SolutionResult::kSolutionFound);
+    EXPECT_NEAR(bnb.GetOptimalCost(), -13.0 / 3, 1E-6);
+    EXPECT_GT(num_children, 0);
+  }
+}
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
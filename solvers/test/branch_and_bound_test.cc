@@ -986,6 +986,45 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSteelBlendingProblem) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolveInParallel) {
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+  const double tol{1E-3};
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      std::vector<std::unique_ptr<MixedIntegerBranchAndBound>> bnbs;
+      for (int num_threads : {1, 4, 4}) {
+        bnbs.push_back(std::make_unique<MixedIntegerBranchAndBound>(
+            *prog, GurobiSolver::id()));
+        MixedIntegerBranchAndBound& bnb = *bnbs.back();
+        bnb.SetNodeSelectionMethod(pick_node);
+        bnb.SetVariableSelectionMethod(pick_variable);
+        bnb.set_num_threads(num_threads);
+        EXPECT_EQ(bnb.num_threads(), num_threads);
+        EXPECT_EQ(bnb.Solve(), SolutionResult::kSolutionFound);
+      }
+      // The parallel solves find the same optimal solution as the serial one.
+      for (const auto& bnb : bnbs) {
+        EXPECT_NEAR(bnb->GetOptimalCost(), bnbs[0]->GetOptimalCost(), tol);
+        EXPECT_TRUE(CompareMatrices(bnb->GetSolution(x),
+                                    bnbs[0]->GetSolution(x), tol,
+                                    MatrixCompareType::absolute));
+      }
+      // The parallel solve does not depend on the thread scheduling.
+      ASSERT_EQ(bnbs[1]->solutions().size(), bnbs[2]->solutions().size());
+      for (int i = 0; i < static_cast<int>(bnbs[1]->solutions().size());
+           ++i) {
+        EXPECT_TRUE(CompareMatrices(bnbs[1]->GetSolution(x, i),
+                                    bnbs[2]->GetSolution(x, i)));
+      }
+      EXPECT_EQ(bnbs[1]->best_lower_bound(), bnbs[2]->best_lower_bound());
+    }
+  }
+
+  MixedIntegerBranchAndBound bnb(*prog, GurobiSolver::id());
+  EXPECT_THROW(bnb.set_num_threads(0), std::exception);
+}
+
 void CheckAllIntegralSolution(
     const MixedIntegerBranchAndBound& bnb,
     const Eigen::Ref<const VectorXDecisionVariable>& x,
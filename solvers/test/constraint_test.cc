@@ -1,5 +1,8 @@
 #include "drake/solvers/constraint.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -634,6 +637,83 @@ GTEST_TEST(testConstraint, testExpressionConstraint) {
                0 <= e[0] && e[0] <= 2 && 0 <= e[1] && e[1] <= 2);
 }
 
+// Checks the compiled evaluation of non-polynomial expressions, including the
+// if-then-else expressions in the derivatives of abs and max.
+GTEST_TEST(testConstraint, testExpressionConstraintNonpolynomial) {
+  Variable x0{"x0"};
+  Variable x1{"x1"};
+  Vector2<Expression> e{sin(x0) * exp(x1) + abs(x0),
+                        max(x0, x1) + sqrt(x0 * x0 + x1 * x1)};
+  ExpressionConstraint constraint(e, Vector2d::Zero(), Vector2d::Ones());
+  // The variables are ordered as in vars().
+  const Vector2d x_vars{.3, -.2};
+  const double x0_val = constraint.vars()[0].equal_to(x0) ? x_vars[0]
+                                                          : x_vars[1];
+  const double x1_val = constraint.vars()[0].equal_to(x0) ? x_vars[1]
+                                                          : x_vars[0];
+  const double norm = std::hypot(x0_val, x1_val);
+
+  VectorXd y;
+  constraint.Eval(x_vars, &y);
+  const Vector2d y_expected{
+      std::sin(x0_val) * std::exp(x1_val) + std::abs(x0_val),
+      std::max(x0_val, x1_val) + norm};
+  EXPECT_TRUE(CompareMatrices(y, y_expected, 1e-14));
+
+  // The gradients with respect to (x0, x1).
+  Eigen::Matrix2d dy_dx;
+  // clang-format off
+  dy_dx << std::cos(x0_val) * std::exp(x1_val) + (x0_val > 0 ? 1 : -1),
+           std::sin(x0_val) * std::exp(x1_val),
+           (x0_val > x1_val ? 1 : 0) + x0_val / norm,
+           (x0_val > x1_val ? 0 : 1) + x1_val / norm;
+  // clang-format on
+  if (!constraint.vars()[0].equal_to(x0)) {
+    dy_dx.col(0).swap(dy_dx.col(1));
+  }
+  // Use a gradient which is not the identity to check the chain rule.
+  Eigen::Matrix<double, 2, Eigen::Dynamic> dx_dz(2, 3);
+  // clang-format off
+  dx_dz << 1, 2, 3,
+           4, 5, 6;
+  // clang-format on
+  const AutoDiffVecXd x_autodiff = math::InitializeAutoDiff(x_vars, dx_dz);
+  AutoDiffVecXd y_autodiff;
+  constraint.Eval(x_autodiff, &y_autodiff);
+  EXPECT_TRUE(
+      CompareMatrices(math::ExtractValue(y_autodiff), y_expected, 1e-14));
+  EXPECT_TRUE(CompareMatrices(math::ExtractGradient(y_autodiff), dy_dx * dx_dz,
+                              1e-14));
+}
+
+// Errors that Expression::Evaluate reports are still thrown when the compiled
+// evaluation yields a non-finite result.
+GTEST_TEST(testConstraint, testExpressionConstraintErrors) {
+  Variable x0{"x0"};
+  ExpressionConstraint division(Vector1<Expression>(1 / x0), Vector1d(0),
+                                Vector1d(1));
+  VectorXd y;
+  division.Eval(Vector1d(2), &y);
+  EXPECT_EQ(y[0], 0.5);
+  DRAKE_EXPECT_THROWS_MESSAGE(division.Eval(Vector1d(0), &y),
+                              "Division by zero: 1 / 0\\(1 / x0\\)\n");
+  AutoDiffVecXd y_autodiff;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      division.Eval(math::InitializeAutoDiff(Vector1d(0)), &y_autodiff),
+      "Division by zero: 1 / 0\\(1 / x0\\)\n");
+
+  ExpressionConstraint log_constraint(Vector1<Expression>(log(x0)),
+                                      Vector1d(0), Vector1d(1));
+  EXPECT_THROW(log_constraint.Eval(Vector1d(-1), &y), std::exception);
+
+  // As documented, an error whose effect does not reach the result is not
+  // detected.
+  ExpressionConstraint masked(Vector1<Expression>(1 / (1 / x0)), Vector1d(0),
+                              Vector1d(1));
+  masked.Eval(Vector1d(0), &y);
+  EXPECT_EQ(y[0], 0.0);
+}
+
 // Test that the Eval() method of LinearComplementarityConstraint correctly
 // returns the slack.
 GTEST_TEST(testConstraint, testSimpleLCPConstraintEval) {
@@ -0,0 +1,253 @@
+#include "drake/solvers/fbstab_solver.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/solvers/equality_constrained_qp_solver.h"
+#include "drake/solvers/mathematical_program.h"
+
+namespace drake {
+namespace solvers {
+namespace test {
+namespace {
+
+using Eigen::Matrix2d;
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+using internal::FbstabSolver;
+using internal::FbstabSolverDetails;
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// A double integrator, transcribed the way DirectTranscription does it: the
+// states and inputs at N samples, the dynamics for the first N - 1 samples,
+// and equal inputs at the last two samples. The variables are added in an
+// order that hides the stagewise structure.
+class DoubleIntegratorMpc {
+ public:
+  explicit DoubleIntegratorMpc(int N) : N_(N) {
+    u_ = prog_.NewContinuousVariables(1, N, "u");
+    x_ = prog_.NewContinuousVariables(2, N, "x");
+    const double dt = 0.1;
+    Matrix2d A;
+    A << 1, dt, 0, 1;
+    const Vector2d B(0.5 * dt * dt, dt);
+    for (int k = 0; k < N - 1; ++k) {
+      prog_.AddLinearEqualityConstraint(
+          x_.col(k + 1).cast<symbolic::Expression>() ==
+          A * x_.col(k).cast<symbolic::Expression>() + B * u_(0, k));
+    }
+    prog_.AddLinearEqualityConstraint(u_(0, N - 2) == u_(0, N - 1));
+    for (int k = 0; k < N - 1; ++k) {
+      prog_.AddQuadraticCost(x_(0, k) * x_(0, k) + x_(1, k) * x_(1, k) +
+                             0.1 * u_(0, k) * u_(0, k));
+    }
+    prog_.AddQuadraticCost(10 * x_(0, N - 1) * x_(0, N - 1) +
+                           10 * x_(1, N - 1) * x_(1, N - 1));
+    prog_.AddLinearConstraint(x_.col(0) == Vector2d(1, -0.5));
+  }
+
+  MathematicalProgram& prog() { return prog_; }
+  const MatrixX<symbolic::Variable>& x() const { return x_; }
+  const MatrixX<symbolic::Variable>& u() const { return u_; }
+
+ private:
+  int N_{};
+  MathematicalProgram prog_;
+  MatrixX<symbolic::Variable> x_;
+  MatrixX<symbolic::Variable> u_;
+};
+
+GTEST_TEST(FbstabSolverTest, UnconstrainedQp) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>("x");
+  prog.AddQuadraticCost(x(0) * x(0) + (x(1) + x(2) - 2) * (x(1) + x(2) - 2));
+  prog.AddLinearCost(4 * x(0) + 5);
+
+  FbstabSolver solver;
+  const MathematicalProgramResult result = solver.Solve(prog);
+  EXPECT_TRUE(result.is_success());
+  const double tol = 1E-6;
+  EXPECT_NEAR(result.GetSolution(x(0)), -2, tol);
+  EXPECT_NEAR(result.GetSolution(x(1)) + result.GetSolution(x(2)), 2, tol);
+  EXPECT_NEAR(result.get_optimal_cost(), 1, tol);
+  EXPECT_FALSE(result.get_solver_details<FbstabSolver>().used_riccati);
+}
+
+GTEST_TEST(FbstabSolverTest, DenseQp) {
+  // min x₀² + x₁² + x₀x₁ + x₀ s.t. x₀ + x₁ = 1, x₀ ≥ 0.2, x₁ ≤ 0.9.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddQuadraticCost(x(0) * x(0) + x(1) * x(1) + x(0) * x(1) + x(0));
+  const auto equality = prog.AddLinearEqualityConstraint(x(0) + x(1) == 1);
+  const auto bound = prog.AddBoundingBoxConstraint(0.2, kInf, x(0));
+  const auto inequality = prog.AddLinearConstraint(x(1) <= 0.9);
+
+  FbstabSolver solver;
+  const MathematicalProgramResult result = solver.Solve(prog);
+  EXPECT_TRUE(result.is_success());
+  // On x₀ + x₁ = 1, the cost is x₀² + 1, and the bounds become x₀ ≥ 0.2.
+  EXPECT_TRUE(
+      CompareMatrices(result.GetSolution(x), Vector2d(0.2, 0.8), 1E-6));
+  EXPECT_NEAR(result.get_optimal_cost(), 1.04, 1E-6);
+  // The dual solutions are the derivatives of the optimal cost with respect to
+  // the bounds: of x₁ on x₀ + x₁ = b, of x₀² + 1 with respect to x₀ ≥ b, and
+  // zero for the inactive bound.
+  EXPECT_NEAR(result.GetDualSolution(equality)(0), 1.8, 1E-5);
+  EXPECT_NEAR(result.GetDualSolution(bound)(0), 0.4, 1E-5);
+  EXPECT_NEAR(result.GetDualSolution(inequality)(0), 0, 1E-5);
+}
+
+GTEST_TEST(FbstabSolverTest, MpcWithoutInequalities) {
+  const int N = 20;
+  DoubleIntegratorMpc mpc(N);
+  FbstabSolver solver;
+  const MathematicalProgramResult result = solver.Solve(mpc.prog());
+  EXPECT_TRUE(result.is_success());
+  const FbstabSolverDetails& details =
+      result.get_solver_details<FbstabSolver>();
+  EXPECT_TRUE(details.used_riccati);
+  // The last input is eliminated, which leaves N - 1 steps.
+  EXPECT_EQ(details.horizon, N - 1);
+  EXPECT_EQ(details.num_states, 2);
+  EXPECT_EQ(details.num_inputs, 1);
+
+  // Compare with the analytic solution of the equality constrained QP.
+  SolverOptions options;
+  options.SetOption(FbstabSolver::id(), "abs_tol", 1E-10);
+  const MathematicalProgramResult accurate =
+      solver.Solve(mpc.prog(), {}, options);
+  EXPECT_TRUE(accurate.is_success());
+  EqualityConstrainedQPSolver qp_solver;
+  const MathematicalProgramResult expected = qp_solver.Solve(mpc.prog());
+  ASSERT_TRUE(expected.is_success());
+  const double tol = 1E-8;
+  EXPECT_TRUE(CompareMatrices(accurate.GetSolution(mpc.x()),
+                              expected.GetSolution(mpc.x()), tol));
+  EXPECT_TRUE(CompareMatrices(accurate.GetSolution(mpc.u()),
+                              expected.GetSolution(mpc.u()), tol));
+  EXPECT_NEAR(accurate.get_optimal_cost(), expected.get_optimal_cost(), tol);
+}
+
+GTEST_TEST(FbstabSolverTest, MpcWithInequalities) {
+  const int N = 30;
+  // The same problem with input limits and a soft state constraint, once with
+  // the stagewise structure, and once with an (inactive) rate limit on the
+  // first input that couples two stages.
+  MathematicalProgramResult results[2];
+  MatrixXd x_sol[2];
+  MatrixXd u_sol[2];
+  VectorXd bound_dual[2];
+  VectorXd soft_dual[2];
+  VectorXd dynamics_dual[2];
+  for (int i = 0; i < 2; ++i) {
+    DoubleIntegratorMpc mpc(N);
+    MathematicalProgram& prog = mpc.prog();
+    const auto input_limits = prog.AddBoundingBoxConstraint(-1, 1, mpc.u());
+    // Soft constraint x₁ ≥ -0.2 with one slack variable per sample.
+    auto slack = prog.NewContinuousVariables(N, "s");
+    prog.AddBoundingBoxConstraint(0, kInf, slack);
+    std::vector<Binding<LinearConstraint>> soft_constraints;
+    for (int k = 0; k < N; ++k) {
+      soft_constraints.push_back(
+          prog.AddLinearConstraint(mpc.x()(1, k) + slack(k) >= -0.2));
+      prog.AddQuadraticCost(100 * slack(k) * slack(k));
+    }
+    if (i == 1) {
+      prog.AddLinearConstraint(mpc.u()(0, 1) - mpc.u()(0, 0) <= 100);
+    }
+    FbstabSolver solver;
+    results[i] = solver.Solve(prog);
+    EXPECT_TRUE(results[i].is_success());
+    x_sol[i] = results[i].GetSolution(mpc.x());
+    u_sol[i] = results[i].GetSolution(mpc.u());
+    bound_dual[i] = results[i].GetDualSolution(input_limits);
+    soft_dual[i].resize(N);
+    for (int k = 0; k < N; ++k) {
+      soft_dual[i](k) = results[i].GetDualSolution(soft_constraints[k])(0);
+    }
+    // The dynamics of the first step.
+    dynamics_dual[i] =
+        results[i].GetDualSolution(prog.linear_equality_constraints()[0]);
+  }
+  EXPECT_TRUE(results[0].get_solver_details<FbstabSolver>().used_riccati);
+  EXPECT_FALSE(results[1].get_solver_details<FbstabSolver>().used_riccati);
+  // The input limit is active.
+  EXPECT_NEAR(u_sol[0](0, 0), 1, 1E-6);
+  EXPECT_TRUE(CompareMatrices(x_sol[0], x_sol[1], 1E-5));
+  EXPECT_TRUE(CompareMatrices(u_sol[0], u_sol[1], 1E-5));
+  EXPECT_NEAR(results[0].get_optimal_cost(), results[1].get_optimal_cost(),
+              1E-5);
+  // Relaxing the active upper input limit decreases the cost.
+  EXPECT_LT(bound_dual[0](0), 0);
+  // The dual solutions agree between the Riccati and the dense solves.
+  EXPECT_TRUE(CompareMatrices(bound_dual[0], bound_dual[1], 1E-4));
+  EXPECT_TRUE(CompareMatrices(soft_dual[0], soft_dual[1], 1E-4));
+  EXPECT_TRUE(CompareMatrices(dynamics_dual[0], dynamics_dual[1], 1E-4));
+}
+
+GTEST_TEST(FbstabSolverTest, MpcInitialGuess) {
+  DoubleIntegratorMpc mpc(20);
+  FbstabSolver solver;
+  const MathematicalProgramResult cold = solver.Solve(mpc.prog());
+  ASSERT_TRUE(cold.is_success());
+  const MathematicalProgramResult warm =
+      solver.Solve(mpc.prog(), cold.GetSolution(), {});
+  ASSERT_TRUE(warm.is_success());
+  EXPECT_TRUE(warm.get_solver_details<FbstabSolver>().used_riccati);
+  EXPECT_LE(warm.get_solver_details<FbstabSolver>().newton_iters,
+            cold.get_solver_details<FbstabSolver>().newton_iters);
+  EXPECT_TRUE(
+      CompareMatrices(warm.GetSolution(), cold.GetSolution(), 1E-6));
+}
+
+GTEST_TEST(FbstabSolverTest, MpcInfeasible) {
+  DoubleIntegratorMpc mpc(10);
+  // The initial state violates this bound.
+  mpc.prog().AddBoundingBoxConstraint(2, kInf, mpc.x()(0, 0));
+  FbstabSolver solver;
+  const MathematicalProgramResult result = solver.Solve(mpc.prog());
+  EXPECT_EQ(result.get_solution_result(),
+            SolutionResult::kInfeasibleConstraints);
+  EXPECT_EQ(result.get_optimal_cost(),
+            MathematicalProgram::kGlobalInfeasibleCost);
+}
+
+GTEST_TEST(FbstabSolverTest, Options) {
+  DoubleIntegratorMpc mpc(10);
+  FbstabSolver solver;
+  SolverOptions options;
+  options.SetOption(solver.id(), "max_prox_iters", 1);
+  options.SetOption(solver.id(), "max_newton_iters", 1);
+  MathematicalProgramResult result = solver.Solve(mpc.prog(), {}, options);
+  EXPECT_EQ(result.get_solution_result(), SolutionResult::kIterationLimit);
+
+  options.SetOption(solver.id(), "bad_option", 1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(solver.Solve(mpc.prog(), {}, options),
+                              ".*bad_option.*");
+}
+
+GTEST_TEST(FbstabSolverTest, ProgramAttributes) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>("x");
+  prog.AddLinearCost(x(0));
+  EXPECT_FALSE(FbstabSolver::ProgramAttributesSatisfied(prog));
+  EXPECT_NE(FbstabSolver::UnsatisfiedProgramAttributes(prog).find(
+                "QuadraticCost is required"),
+            std::string::npos);
+  prog.AddQuadraticCost(-x(1) * x(1));
+  EXPECT_FALSE(FbstabSolver::ProgramAttributesSatisfied(prog));
+  EXPECT_NE(FbstabSolver::UnsatisfiedProgramAttributes(prog).find(
+                "non-convex"),
+            std::string::npos);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace solvers
+}  // namespace drake
@@ -1,9 +1,15 @@
 #include "drake/solvers/ipopt_solver.h"
 
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/filesystem.h"
 #include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/test/linear_program_examples.h"
 #include "drake/solvers/test/mathematical_program_test_util.h"
@@ -213,6 +219,67 @@ GTEST_TEST(IpoptSolverTest, TestNonconvexQP) {
   }
 }
 
+// A constraint xᵢ² ≤ i + 1 whose gradient is diagonal, as declared by its
+// gradient sparsity pattern.
+class DiagonalSquaredConstraint : public Constraint {
+ public:
+  explicit DiagonalSquaredConstraint(int num_vars)
+      : Constraint(num_vars, num_vars,
+                   Eigen::VectorXd::Constant(
+                       num_vars, -std::numeric_limits<double>::infinity()),
+                   Eigen::VectorXd::LinSpaced(num_vars, 1, num_vars)) {
+    std::vector<std::pair<int, int>> pattern;
+    for (int i = 0; i < num_vars; ++i) {
+      pattern.emplace_back(i, i);
+    }
+    SetGradientSparsityPattern(pattern);
+  }
+
+ private:
+  template <typename T>
+  void DoEvalGeneric(const Eigen::Ref<const VectorX<T>>& x,
+                     VectorX<T>* y) const {
+    *y = x.array().square().matrix();
+  }
+
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
+              VectorX<symbolic::Expression>* y) const override {
+    DoEvalGeneric<symbolic::Expression>(x.cast<symbolic::Expression>(), y);
+  }
+};
+
+// Checks the sparse constraint Jacobian, with both a gradient sparsity pattern
+// on a nonlinear constraint and sparse linear constraints.
+GTEST_TEST(IpoptSolverTest, SparseConstraintJacobian) {
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(4);
+  // The binding's variables are a permutation of a subset of x.
+  prog.AddConstraint(std::make_shared<DiagonalSquaredConstraint>(3),
+                     Vector3<symbolic::Variable>(x(2), x(0), x(3)));
+  prog.AddLinearConstraint(x(1) == 2 * x(0));
+  prog.AddLinearConstraint(x(0) - x(3) >= -10);
+  prog.AddLinearCost(x(0) + x(2) + x(3));
+
+  IpoptSolver solver;
+  if (solver.available()) {
+    const MathematicalProgramResult result = solver.Solve(prog);
+    EXPECT_TRUE(result.is_success());
+    const Eigen::Vector4d x_expected(-std::sqrt(2), -2 * std::sqrt(2), -1,
+                                     -std::sqrt(3));
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x), x_expected, 1E-6));
+  }
+}
+
 /* Tests the solver's processing of the verbosity options. With multiple ways
  to request verbosity (common options and solver-specific options), we simply
  apply a smoke test that none of the means causes runtime errors. Note, we
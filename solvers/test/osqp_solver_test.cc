@@ -1,5 +1,7 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <memory>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -351,6 +353,87 @@ GTEST_TEST(OsqpSolverTest, VariableScaling2) {
   }
 }
 
+// Solves a sequence of QPs with the same structure, such as those of a model
+// predictive controller, and checks that the workspace is reused.
+GTEST_TEST(PersistentOsqpSolverTest, Sequence) {
+  // Makes the program
+  //   min (x - x_desired)ᵀ diag(hessian, 1, 1) (x - x_desired)
+  //   s.t. x₀ + x₁ + x₂ = sum, -bound ≤ x ≤ bound.
+  auto make_prog = [](const Eigen::Vector3d& x_desired, double hessian,
+                      double sum, double bound) {
+    auto prog = std::make_unique<MathematicalProgram>();
+    auto x = prog->NewContinuousVariables<3>();
+    const Eigen::Matrix3d Q = Eigen::Vector3d(hessian, 1, 1).asDiagonal();
+    prog->AddQuadraticErrorCost(Q, x_desired, x);
+    prog->AddLinearEqualityConstraint(Eigen::RowVector3d::Ones(), sum, x);
+    prog->AddBoundingBoxConstraint(-bound, bound, x);
+    return prog;
+  };
+
+  OsqpSolver solver;
+  PersistentOsqpSolver dut;
+  if (!dut.available()) {
+    return;
+  }
+  auto check_solve = [&solver, &dut](const MathematicalProgram& prog,
+                                     bool expect_reused,
+                                     const SolverOptions& options = {}) {
+    const MathematicalProgramResult expected =
+        solver.Solve(prog, std::nullopt, options);
+    const MathematicalProgramResult result =
+        dut.Solve(prog, std::nullopt, options);
+    EXPECT_EQ(dut.reused_workspace(), expect_reused);
+    EXPECT_EQ(result.get_solver_id(), OsqpSolver::id());
+    ASSERT_TRUE(result.is_success());
+    const double tol = 1E-6;
+    EXPECT_TRUE(CompareMatrices(result.get_x_val(), expected.get_x_val(), tol));
+    EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(), tol);
+    EXPECT_TRUE(CompareMatrices(result.get_solver_details<OsqpSolver>().y,
+                                expected.get_solver_details<OsqpSolver>().y,
+                                tol));
+  };
+
+  // The first solve sets up the workspace.
+  check_solve(*make_prog(Eigen::Vector3d(1, 2, 3), 1, 1, 2), false);
+  // New linear costs and bounds reuse it.
+  check_solve(*make_prog(Eigen::Vector3d(-1, 0.5, 3), 1, 0.5, 2), true);
+  check_solve(*make_prog(Eigen::Vector3d(-1, 0.5, 3), 1, 0.5, 0.4), true);
+  // So do new values of the Hessian.
+  check_solve(*make_prog(Eigen::Vector3d(-1, 0.5, 3), 4, 0.5, 0.4), true);
+  // New solver options require a new workspace.
+  SolverOptions options;
+  options.SetOption(OsqpSolver::id(), "eps_abs", 1E-6);
+  check_solve(*make_prog(Eigen::Vector3d(-1, 0.5, 3), 4, 0.5, 0.4), false,
+              options);
+  check_solve(*make_prog(Eigen::Vector3d(2, 0.5, 3), 4, 0.5, 0.4), true,
+              options);
+
+  // A program with a different structure requires a new workspace.
+  auto prog = make_prog(Eigen::Vector3d(2, 0.5, 3), 4, 0.5, 0.4);
+  const auto& x = prog->decision_variables();
+  prog->AddLinearConstraint(x(0) - x(1) <= 0.1);
+  check_solve(*prog, false);
+  check_solve(*prog, true);
+
+  // Updating the program in place reuses the workspace.
+  prog->linear_constraints().front().evaluator()->UpdateUpperBound(
+      Vector1d(-0.1));
+  check_solve(*prog, true);
+
+  // An initial guess warm starts the solve.
+  const MathematicalProgramResult result = dut.Solve(*prog);
+  const MathematicalProgramResult warm_started =
+      dut.Solve(*prog, result.get_x_val(), {});
+  EXPECT_TRUE(dut.reused_workspace());
+  EXPECT_TRUE(warm_started.is_success());
+  EXPECT_TRUE(CompareMatrices(warm_started.get_x_val(), result.get_x_val(),
+                              1E-6));
+
+  // After Reset(), the workspace is set up again.
+  dut.Reset();
+  check_solve(*prog, false);
+}
+
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
@@ -1,13 +1,17 @@
 #include "drake/solvers/solve.h"
 
+#include <memory>
 #include <regex>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/equality_constrained_qp_solver.h"
 #include "drake/solvers/gurobi_solver.h"
+#include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/linear_system_solver.h"
 #include "drake/solvers/scs_solver.h"
 #include "drake/solvers/snopt_solver.h"
@@ -56,5 +60,82 @@ GTEST_TEST(SolveTest, TestInitialGuessAndOptions) {
     EXPECT_NEAR(result.GetSolution(x)(0), vars_init(0), 1E-6);
   }
 }
+
+GTEST_TEST(SolveTest, SolveInParallel) {
+  // Make a batch of equality-constrained QPs, each with a different solution.
+  const int num_progs = 20;
+  std::vector<std::unique_ptr<MathematicalProgram>> progs;
+  std::vector<const MathematicalProgram*> prog_ptrs;
+  for (int i = 0; i < num_progs; ++i) {
+    auto prog = std::make_unique<MathematicalProgram>();
+    auto x = prog->NewContinuousVariables<2>();
+    prog->AddQuadraticCost((x(0) - i) * (x(0) - i) + x(1) * x(1));
+    prog->AddLinearEqualityConstraint(x(0) + x(1) == 1);
+    prog_ptrs.push_back(prog.get());
+    progs.push_back(std::move(prog));
+  }
+
+  for (const int num_threads : {1, 4}) {
+    const std::vector<MathematicalProgramResult> results = SolveInParallel(
+        prog_ptrs, nullptr, nullptr, std::nullopt, num_threads);
+    ASSERT_EQ(results.size(), num_progs);
+    for (int i = 0; i < num_progs; ++i) {
+      const MathematicalProgramResult expected = Solve(*progs[i]);
+      EXPECT_TRUE(results[i].is_success());
+      EXPECT_EQ(results[i].get_solver_id(), expected.get_solver_id());
+      EXPECT_TRUE(CompareMatrices(results[i].get_x_val(),
+                                  Eigen::Vector2d(0.5 * i + 0.5, 0.5 - 0.5 * i),
+                                  1E-10));
+    }
+  }
+
+  // Per-program initial guesses and options (where nullopt entries use the
+  // program's own), with a fixed solver.
+  std::vector<std::optional<Eigen::VectorXd>> initial_guesses(num_progs);
+  initial_guesses[3] = Eigen::Vector2d(1, 2);
+  SolverOptions options;
+  options.SetOption(EqualityConstrainedQPSolver::id(),
+                    EqualityConstrainedQPSolver::FeasibilityTolOptionName(),
+                    1E-9);
+  std::vector<std::optional<SolverOptions>> solver_options(num_progs, options);
+  solver_options[5] = std::nullopt;
+  const std::vector<MathematicalProgramResult> results =
+      SolveInParallel(prog_ptrs, &initial_guesses, &solver_options,
+                      EqualityConstrainedQPSolver::id(), 3);
+  for (int i = 0; i < num_progs; ++i) {
+    EXPECT_TRUE(results[i].is_success());
+    EXPECT_EQ(results[i].get_solver_id(), EqualityConstrainedQPSolver::id());
+  }
+
+  // Solvers are only thread-safe if they opt in.
+  EXPECT_TRUE(LinearSystemSolver().is_thread_safe());
+  EXPECT_TRUE(EqualityConstrainedQPSolver().is_thread_safe());
+  EXPECT_TRUE(ScsSolver().is_thread_safe());
+  EXPECT_FALSE(GurobiSolver().is_thread_safe());
+
+  // Programs for solvers that are not thread-safe are solved serially, but
+  // still reported in order.
+  if (IpoptSolver::is_available()) {
+    EXPECT_FALSE(IpoptSolver().is_thread_safe());
+    const std::vector<MathematicalProgramResult> ipopt_results =
+        SolveInParallel(prog_ptrs, nullptr, nullptr, IpoptSolver::id(), 4);
+    for (int i = 0; i < num_progs; ++i) {
+      EXPECT_TRUE(ipopt_results[i].is_success());
+      EXPECT_TRUE(CompareMatrices(ipopt_results[i].get_x_val(),
+                                  results[i].get_x_val(), 1E-6));
+    }
+  }
+
+  // Bad arguments.
+  EXPECT_THROW(SolveInParallel(prog_ptrs, nullptr, nullptr, std::nullopt, 0),
+               std::exception);
+  initial_guesses.pop_back();
+  EXPECT_THROW(SolveInParallel(prog_ptrs, &initial_guesses, nullptr,
+                               std::nullopt, 2),
+               std::exception);
+  prog_ptrs.push_back(nullptr);
+  EXPECT_THROW(SolveInParallel(prog_ptrs, nullptr, nullptr, std::nullopt, 2),
+               std::exception);
+}
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,281 @@
+#include "drake/systems/analysis/batch_simulator.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+
+BatchDynamics::~BatchDynamics() = default;
+
+bool BatchDynamics::CalcBatchTimeDerivatives(
+    const std::vector<const Context<double>*>&, double, const Eigen::MatrixXd&,
+    const Eigen::MatrixXd&, Eigen::MatrixXd*) const {
+  return false;
+}
+
+bool BatchDynamics::CalcBatchDiscreteVariableUpdates(
+    const std::vector<const Context<double>*>&, double, const Eigen::MatrixXd&,
+    const Eigen::MatrixXd&, Eigen::MatrixXd*) const {
+  return false;
+}
+
+BatchSimulator::BatchSimulator(const System<double>& system, int num_copies,
+                               double time_step,
+                               const std::string& integration_scheme)
+    : system_(system),
+      batch_dynamics_(dynamic_cast<const BatchDynamics*>(&system)),
+      time_step_(time_step),
+      integration_scheme_(integration_scheme) {
+  DRAKE_THROW_UNLESS(num_copies >= 1);
+  DRAKE_THROW_UNLESS(time_step > 0.0);
+  if (integration_scheme != "explicit_euler" &&
+      integration_scheme != "runge_kutta2") {
+    throw std::logic_error(fmt::format(
+        "BatchSimulator: unsupported integration scheme '{}'; use "
+        "'explicit_euler' or 'runge_kutta2'.",
+        integration_scheme));
+  }
+
+  for (int i = 0; i < num_copies; ++i) {
+    contexts_.push_back(system.CreateDefaultContext());
+    const_contexts_.push_back(contexts_.back().get());
+  }
+  const Context<double>& context = *contexts_[0];
+  if (context.num_abstract_states() > 0) {
+    throw std::logic_error(fmt::format(
+        "BatchSimulator: System '{}' has abstract state, which cannot be "
+        "simulated in a batch.",
+        system.GetSystemName()));
+  }
+
+  // Only the periodic discrete updates have a batched equivalent.
+  std::unique_ptr<CompositeEventCollection<double>> events =
+      system.AllocateCompositeEventCollection();
+  system.GetPerStepEvents(context, events.get());
+  bool has_periodic_discrete_updates = false;
+  bool has_periodic_unrestricted_updates = false;
+  for (const auto& [timing, periodic_events] : system.GetPeriodicEvents()) {
+    for (const Event<double>* event : periodic_events) {
+      if (dynamic_cast<const DiscreteUpdateEvent<double>*>(event)) {
+        has_periodic_discrete_updates = true;
+      }
+      if (dynamic_cast<const UnrestrictedUpdateEvent<double>*>(event)) {
+        has_periodic_unrestricted_updates = true;
+      }
+    }
+  }
+  if (events->HasDiscreteUpdateEvents() ||
+      events->HasUnrestrictedUpdateEvents() ||
+      has_periodic_unrestricted_updates) {
+    throw std::logic_error(fmt::format(
+        "BatchSimulator: System '{}' has per-step or unrestricted update "
+        "events, which cannot be simulated in a batch.",
+        system.GetSystemName()));
+  }
+
+  if (context.num_discrete_state_groups() > 0 &&
+      has_periodic_discrete_updates) {
+    const std::optional<PeriodicEventData> timing =
+        system.GetUniquePeriodicDiscreteUpdateAttribute();
+    if (!timing.has_value() || timing->offset_sec() != 0.0) {
+      throw std::logic_error(fmt::format(
+          "BatchSimulator: the periodic discrete updates of System '{}' must "
+          "share a single period, with zero offset.",
+          system.GetSystemName()));
+    }
+    discrete_period_ = timing->period_sec();
+
+    // Find the events that are due at every update by asking for the next
+    // timed events from just before time zero, skipping past any publish
+    // events that come sooner.
+    discrete_events_ = system.AllocateCompositeEventCollection();
+    std::unique_ptr<Context<double>> scratch = context.Clone();
+    double time = -discrete_period_;
+    while (!discrete_events_->HasDiscreteUpdateEvents()) {
+      scratch->SetTime(time);
+      time = system.CalcNextUpdateTime(*scratch, discrete_events_.get());
+      DRAKE_DEMAND(time <= 0.0);
+    }
+    discrete_scratch_ = system.AllocateDiscreteVariables();
+  }
+
+  const int num_continuous = context.num_continuous_states();
+  int num_discrete = 0;
+  for (int g = 0; g < context.num_discrete_state_groups(); ++g) {
+    num_discrete += context.get_discrete_state(g).size();
+  }
+  xc_.resize(num_copies, num_continuous);
+  xd_.resize(num_copies, num_discrete);
+  xd_next_.resize(num_copies, num_discrete);
+  k1_.resize(num_copies, num_continuous);
+  k2_.resize(num_copies, num_continuous);
+  xc_row_.resize(num_continuous);
+  xd_row_.resize(num_discrete);
+}
+
+BatchSimulator::~BatchSimulator() = default;
+
+const Context<double>& BatchSimulator::get_context(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_copies());
+  return *contexts_[i];
+}
+
+Context<double>& BatchSimulator::get_mutable_context(int i) {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_copies());
+  return *contexts_[i];
+}
+
+void BatchSimulator::AdvanceTo(double boundary_time) {
+  double time = contexts_[0]->get_time();
+  for (const auto& context : contexts_) {
+    if (context->get_time() != time) {
+      throw std::logic_error(
+          "BatchSimulator::AdvanceTo(): all copies must start at the same "
+          "time.");
+    }
+  }
+  DRAKE_THROW_UNLESS(boundary_time >= time);
+  used_batch_time_derivatives_ = false;
+  used_batch_discrete_updates_ = false;
+  GatherStates();
+
+  const double kInf = std::numeric_limits<double>::infinity();
+  // Like Simulator, we perform the discrete updates that are due at the
+  // start time (unless a previous call already did), but not those due at the
+  // boundary time.
+  int64_t update_index = 0;
+  double next_update_time = kInf;
+  if (discrete_period_ > 0.0) {
+    update_index = static_cast<int64_t>(std::ceil(time / discrete_period_));
+    next_update_time = update_index * discrete_period_;
+    if (next_update_time == last_update_time_) {
+      next_update_time = ++update_index * discrete_period_;
+    }
+  }
+
+  while (true) {
+    if (time == next_update_time) {
+      UpdateDiscreteStates(time);
+      last_update_time_ = time;
+      next_update_time = ++update_index * discrete_period_;
+    }
+
+    if (time < boundary_time) {
+      // Choose the step the way IntegratorBase does: stretch it by up to 1% to
+      // reach an update, but never step past the boundary.
+      double target_time = next_update_time;
+      bool reached_boundary = false;
+      if (boundary_time < target_time) {
+        target_time = boundary_time;
+        reached_boundary = true;
+      }
+      if (xc_.cols() > 0) {
+        if ((reached_boundary && time + time_step_ < target_time) ||
+            (!reached_boundary && time + time_step_ * 1.01 < target_time)) {
+          target_time = time + time_step_;
+        }
+        Step(time, target_time - time);
+      }
+      time = target_time;
+    }
+    if (time >= boundary_time) break;
+  }
+
+  ScatterStates(time);
+}
+
+void BatchSimulator::Step(double time, double h) {
+  CalcDerivatives(time, xc_, &k1_);
+  xc_ += h * k1_;
+  if (integration_scheme_ == "runge_kutta2") {
+    // The same sequence of operations as RungeKutta2Integrator::DoStep().
+    CalcDerivatives(time + h, xc_, &k2_);
+    xc_ += (h / 2) * k2_;
+    xc_ += (-h / 2) * k1_;
+  }
+}
+
+void BatchSimulator::GatherStates() {
+  for (int i = 0; i < num_copies(); ++i) {
+    const Context<double>& context = *contexts_[i];
+    context.get_continuous_state_vector().CopyToPreSizedVector(&xc_row_);
+    xc_.row(i) = xc_row_.transpose();
+    int offset = 0;
+    for (int g = 0; g < context.num_discrete_state_groups(); ++g) {
+      const BasicVector<double>& group = context.get_discrete_state(g);
+      xd_.row(i).segment(offset, group.size()) = group.value().transpose();
+      offset += group.size();
+    }
+  }
+}
+
+void BatchSimulator::ScatterStates(double time) {
+  for (int i = 0; i < num_copies(); ++i) {
+    LoadContext(i, time, xc_, xd_);
+  }
+}
+
+void BatchSimulator::LoadContext(int i, double time,
+                                 const Eigen::MatrixXd& xc,
+                                 const Eigen::MatrixXd& xd) {
+  Context<double>& context = *contexts_[i];
+  xc_row_ = xc.row(i).transpose();
+  context.SetTimeAndContinuousState(time, xc_row_);
+  int offset = 0;
+  for (int g = 0; g < context.num_discrete_state_groups(); ++g) {
+    const int size = context.get_discrete_state(g).size();
+    xd_row_.head(size) = xd.row(i).segment(offset, size).transpose();
+    context.SetDiscreteState(g, xd_row_.head(size));
+    offset += size;
+  }
+}
+
+void BatchSimulator::CalcDerivatives(double time, const Eigen::MatrixXd& xc,
+                                     Eigen::MatrixXd* xcdot) {
+  if (batch_dynamics_ != nullptr &&
+      batch_dynamics_->CalcBatchTimeDerivatives(const_contexts_, time, xc,
+                                                xd_, xcdot)) {
+    used_batch_time_derivatives_ = true;
+    return;
+  }
+  for (int i = 0; i < num_copies(); ++i) {
+    LoadContext(i, time, xc, xd_);
+    system_.EvalTimeDerivatives(*contexts_[i])
+        .get_vector()
+        .CopyToPreSizedVector(&xc_row_);
+    xcdot->row(i) = xc_row_.transpose();
+  }
+}
+
+void BatchSimulator::UpdateDiscreteStates(double time) {
+  if (batch_dynamics_ != nullptr &&
+      batch_dynamics_->CalcBatchDiscreteVariableUpdates(const_contexts_, time,
+                                                        xc_, xd_, &xd_next_)) {
+    used_batch_discrete_updates_ = true;
+  } else {
+    for (int i = 0; i < num_copies(); ++i) {
+      LoadContext(i, time, xc_, xd_);
+      system_.CalcDiscreteVariableUpdates(
+          *contexts_[i], discrete_events_->get_discrete_update_events(),
+          discrete_scratch_.get());
+      int offset = 0;
+      for (int g = 0; g < discrete_scratch_->num_groups(); ++g) {
+        const VectorX<double>& group = discrete_scratch_->value(g);
+        xd_next_.row(i).segment(offset, group.size()) = group.transpose();
+        offset += group.size();
+      }
+    }
+  }
+  xd_.swap(xd_next_);
+}
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+
+/// An optional interface that a System<double> may implement (in addition to
+/// deriving from System<double>) to evaluate its dynamics for many copies of
+/// its state at once. BatchSimulator checks for this interface with a
+/// `dynamic_cast` and, when present, calls it in place of evaluating each
+/// copy's Context in turn.
+///
+/// The states are stored as "struct of arrays": row `i` of each matrix holds
+/// the state of copy `i`, and (because Eigen matrices are column major) each
+/// state variable is contiguous across the copies. The continuous state
+/// columns are ordered as in ContinuousState::CopyToVector(), and the discrete
+/// state columns are the discrete state groups, concatenated in order.
+///
+/// The `contexts` hold the parameters and fixed input port values of each
+/// copy. Their time and state are *not* up to date and must not be used; use
+/// the `time` and state matrices instead.
+class BatchDynamics {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchDynamics)
+
+  virtual ~BatchDynamics();
+
+  /// Computes the time derivatives of all copies into @p derivatives (which
+  /// is presized to match @p continuous_states). Returns false if this system
+  /// does not provide a batched implementation; in that case BatchSimulator
+  /// evaluates each copy's System::EvalTimeDerivatives() instead. The default
+  /// implementation returns false.
+  virtual bool CalcBatchTimeDerivatives(
+      const std::vector<const Context<double>*>& contexts, double time,
+      const Eigen::MatrixXd& continuous_states,
+      const Eigen::MatrixXd& discrete_states,
+      Eigen::MatrixXd* derivatives) const;
+
+  /// Computes the periodic discrete update of all copies into
+  /// @p next_discrete_states (which is presized to match
+  /// @p discrete_states). Returns false if this system does not provide a
+  /// batched implementation; in that case BatchSimulator dispatches each
+  /// copy's periodic discrete update events instead. The default
+  /// implementation returns false.
+  virtual bool CalcBatchDiscreteVariableUpdates(
+      const std::vector<const Context<double>*>& contexts, double time,
+      const Eigen::MatrixXd& continuous_states,
+      const Eigen::MatrixXd& discrete_states,
+      Eigen::MatrixXd* next_discrete_states) const;
+
+ protected:
+  BatchDynamics() = default;
+};
+
+/// Simulates many copies of the same System<double> in lock step, e.g., for
+/// parameter sweeps or reinforcement learning rollouts where each copy has
+/// its own parameters, initial state, and fixed input values.
+///
+/// All copies share the same time and take the same fixed-size steps, so the
+/// simulator keeps their states side by side in struct-of-arrays matrices (see
+/// BatchDynamics) and evaluates the dynamics of all copies at each stage
+/// before moving on. Systems that implement BatchDynamics evaluate all copies
+/// with one call; otherwise, each copy's Context is loaded from the state
+/// matrices and evaluated in turn.
+///
+/// For systems that are supported, the results match (up to roundoff) those
+/// of one Simulator per copy using a fixed-step ExplicitEulerIntegrator or
+/// RungeKutta2Integrator (selected with the same names as
+/// SimulatorConfig::integration_scheme) with maximum step size `time_step`:
+/// - Continuous state is integrated with steps of `time_step`, shortened (or
+///   stretched by at most 1%) to land on discrete update times and the
+///   AdvanceTo() boundary.
+/// - Discrete state is updated by periodic discrete update events, which must
+///   all share a single period with zero offset.
+///
+/// Publish events and witness functions are ignored. Systems with abstract
+/// state, unrestricted update events, or discrete update events that are not
+/// periodic are rejected.
+class BatchSimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchSimulator)
+
+  /// Creates a simulator for @p num_copies copies of @p system, each with a
+  /// default Context (see get_mutable_context()). The @p system must outlive
+  /// this simulator.
+  /// @throws std::exception if @p num_copies or @p time_step is not positive,
+  /// if @p integration_scheme is not "explicit_euler" or "runge_kutta2", or
+  /// if @p system is not supported (see class documentation).
+  BatchSimulator(const System<double>& system, int num_copies,
+                 double time_step,
+                 const std::string& integration_scheme = "runge_kutta2");
+
+  ~BatchSimulator();
+
+  /// Advances all copies to time @p boundary_time. The state of each copy is
+  /// read from (and, on return, written back to) its Context.
+  /// @throws std::exception if the copies' Contexts have different times, or
+  /// if @p boundary_time is before that time.
+  void AdvanceTo(double boundary_time);
+
+  const System<double>& get_system() const { return system_; }
+
+  int num_copies() const { return static_cast<int>(contexts_.size()); }
+
+  double time_step() const { return time_step_; }
+
+  const std::string& integration_scheme() const { return integration_scheme_; }
+
+  /// Returns the Context of copy @p i.
+  const Context<double>& get_context(int i) const;
+
+  /// Returns the Context of copy @p i, e.g., to set its parameters, initial
+  /// state, or fixed input port values before calling AdvanceTo().
+  Context<double>& get_mutable_context(int i);
+
+  /// Returns whether the system's BatchDynamics provided the derivatives (or
+  /// discrete updates) during the most recent AdvanceTo(), rather than
+  /// each copy being evaluated in turn.
+  bool used_batch_time_derivatives() const {
+    return used_batch_time_derivatives_;
+  }
+  bool used_batch_discrete_updates() const {
+    return used_batch_discrete_updates_;
+  }
+
+ private:
+  // Takes one step of size h from time, updating xc_.
+  void Step(double time, double h);
+
+  // Copies the states of all Contexts into xc_ and xd_, and vice versa.
+  void GatherStates();
+  void ScatterStates(double time);
+
+  // Loads time and the state of copy i from xc and xd into its Context.
+  void LoadContext(int i, double time, const Eigen::MatrixXd& xc,
+                   const Eigen::MatrixXd& xd);
+
+  // Computes the derivatives of all copies at time and state (xc, xd_).
+  void CalcDerivatives(double time, const Eigen::MatrixXd& xc,
+                       Eigen::MatrixXd* xcdot);
+
+  // Replaces xd_ with its periodic discrete update at time.
+  void UpdateDiscreteStates(double time);
+
+  const System<double>& system_;
+  const BatchDynamics* const batch_dynamics_;
+  const double time_step_;
+  const std::string integration_scheme_;
+
+  std::vector<std::unique_ptr<Context<double>>> contexts_;
+  std::vector<const Context<double>*> const_contexts_;
+
+  // The period of the discrete updates, or zero if there is no discrete
+  // state. The events are those to dispatch at each update. The last update
+  // time keeps AdvanceTo() from repeating an update it already performed.
+  double discrete_period_{0.0};
+  double last_update_time_{std::numeric_limits<double>::quiet_NaN()};
+  std::unique_ptr<CompositeEventCollection<double>> discrete_events_;
+  std::unique_ptr<DiscreteValues<double>> discrete_scratch_;
+
+  // The states of all copies (one row per copy), and scratch matrices for the
+  // integration stages.
+  Eigen::MatrixXd xc_;
+  Eigen::MatrixXd xd_;
+  Eigen::MatrixXd xd_next_;
+  Eigen::MatrixXd k1_;
+  Eigen::MatrixXd k2_;
+  Eigen::VectorXd xc_row_;
+  Eigen::VectorXd xd_row_;
+
+  bool used_batch_time_derivatives_{false};
+  bool used_batch_discrete_updates_{false};
+};
+
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
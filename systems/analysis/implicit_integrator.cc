@@ -2,9 +2,13 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/symbolic/expression.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff_gradient.h"
 
@@ -22,6 +26,8 @@ void ImplicitIntegrator<T>::DoResetStatistics() {
 template <class T>
 void ImplicitIntegrator<T>::DoReset() {
   J_.resize(0, 0);
+  jacobian_sparsity_.reset();
+  jacobian_contexts_.clear();
   DoResetCachedJacobianRelatedMatrices();
   // Call any Reset() provided by child integrator classes.
   DoImplicitIntegratorReset();
@@ -30,14 +36,16 @@ void ImplicitIntegrator<T>::DoReset() {
 template <class T>
 void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
     const System<T>& system, const T& t, const VectorX<T>& xt,
-    const Context<T>& context, MatrixX<T>* J) {
+    const Context<T>& context, MatrixX<T>* J,
+    const JacobianSparsity* sparsity) {
   DRAKE_LOGGER_DEBUG("  ImplicitIntegrator Compute Autodiff Jacobian t={}", t);
   // TODO(antequ): Investigate how to refactor this method to use
   // math::jacobian(), if possible.
 
   // Create AutoDiff versions of the state vector.
   // Set the size of the derivatives and prepare for Jacobian calculation.
-  VectorX<AutoDiffXd> a_xt = math::InitializeAutoDiff(xt);
+  VectorX<AutoDiffXd> a_xt = sparsity != nullptr ?
+      InitializeColoredAutoDiff(xt, *sparsity) : math::InitializeAutoDiff(xt);
 
   // Get the system and the context in AutoDiffable format. Inputs must also
   // be copied to the context used by the AutoDiff'd system (which is
@@ -60,6 +68,10 @@ void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
   const VectorX<AutoDiffXd> result =
       this->EvalTimeDerivatives(*adiff_system, *adiff_context).CopyToVector();
 
+  if (sparsity != nullptr) {
+    ExtractColoredJacobian(result, *sparsity, J);
+    return;
+  }
   *J = math::ExtractGradient(result);
 
   // Sometimes the system's derivatives f(t, x) do not depend on its states, for
@@ -72,10 +84,74 @@ void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
   }
 }
 
+template <class T>
+void ImplicitIntegrator<T>::ForEachJacobianColumn(
+    const System<T>& system, int n, Context<T>* context,
+    const std::function<void(int, Context<T>*)>& column) {
+  // Counts the derivative evaluations the same way as EvalTimeDerivatives():
+  // by the changes of the serial number of the cached derivatives.
+  const CacheEntry& derivatives_entry =
+      system.get_time_derivatives_cache_entry();
+  const auto num_evaluations = [&derivatives_entry](
+                                   const Context<T>& column_context) {
+    return derivatives_entry.get_cache_entry_value(column_context)
+        .serial_number();
+  };
+
+  const int num_threads = std::min(num_jacobian_threads_, n);
+  if (num_threads <= 1) {
+    const int64_t evaluations_before = num_evaluations(*context);
+    for (int i = 0; i < n; ++i) {
+      column(i, context);
+    }
+    this->add_derivative_evaluations(num_evaluations(*context) -
+                                     evaluations_before);
+    return;
+  }
+
+  // Bring one context per thread up to date with `context`.
+  while (static_cast<int>(jacobian_contexts_.size()) < num_threads) {
+    jacobian_contexts_.push_back(context->Clone());
+  }
+  std::vector<int64_t> evaluations_before(num_threads);
+  for (int k = 0; k < num_threads; ++k) {
+    Context<T>& column_context = *jacobian_contexts_[k];
+    column_context.SetTimeStateAndParametersFrom(*context);
+    for (int port = 0; port < context->num_input_ports(); ++port) {
+      const FixedInputPortValue* value =
+          context->MaybeGetFixedInputPortValue(port);
+      if (value == nullptr) {
+        continue;
+      }
+      // Fix the port once per context, and then only copy the value, which
+      // keeps the existing FixedInputPortValue and its dependency tracker.
+      FixedInputPortValue* column_value =
+          column_context.MaybeGetMutableFixedInputPortValue(port);
+      if (column_value == nullptr) {
+        column_context.FixInputPort(port, value->get_value());
+      } else {
+        column_value->GetMutableData()->SetFrom(value->get_value());
+      }
+    }
+    evaluations_before[k] = num_evaluations(column_context);
+  }
+
+  // Each thread repeatedly claims the next column.
+  drake::internal::DynamicParallelFor(
+      num_threads, n, [this, &column](int thread_num, int i) {
+        column(i, jacobian_contexts_[thread_num].get());
+      });
+
+  for (int k = 0; k < num_threads; ++k) {
+    this->add_derivative_evaluations(
+        num_evaluations(*jacobian_contexts_[k]) - evaluations_before[k]);
+  }
+}
+
 template <class T>
 void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
-    const System<T>&, const T& t, const VectorX<T>& xt, Context<T>* context,
-    MatrixX<T>* J) {
+    const System<T>& system, const T& t, const VectorX<T>& xt,
+    Context<T>* context, MatrixX<T>* J) {
   using std::abs;
 
   // Set epsilon to the square root of machine precision.
@@ -96,9 +172,10 @@ void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
   context->SetTimeAndContinuousState(t, xt);
   const VectorX<T> f = this->EvalTimeDerivatives(*context).CopyToVector();
 
-  // Compute the Jacobian.
-  VectorX<T> xt_prime = xt;
-  for (int i = 0; i < n; ++i) {
+  // Compute the Jacobian, one column at a time (possibly concurrently, in
+  // which case each column uses its own context, whose time is already t).
+  ForEachJacobianColumn(system, n, context, [&](int i,
+                                                Context<T>* column_context) {
     // Compute a good increment to the dimension using approximately 1/eps
     // digits of precision. Note that if |xt| is large, the increment will
     // be large as well. If |xt| is small, the increment will be no smaller
@@ -117,25 +194,25 @@ void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
     // x and dx differ by an exactly representable number. See p. 192 of
     // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
     //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
+    VectorX<T> xt_prime = xt;
     xt_prime(i) = xt(i) + dxi;
     dxi = xt_prime(i) - xt(i);
 
     // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
     //              Switch to a method that invalides just the relevant
     //              partition, and ideally modify only the one changed element.
-    // Compute f' and set the relevant column of the Jacobian matrix.
-    context->SetTimeAndContinuousState(t, xt_prime);
-    J->col(i) = (this->EvalTimeDerivatives(*context).CopyToVector() - f) / dxi;
-
-    // Reset xt' to xt.
-    xt_prime(i) = xt(i);
-  }
+    // Compute f' and set the relevant column of the Jacobian matrix. The
+    // evaluation is counted by ForEachJacobianColumn().
+    column_context->SetContinuousState(xt_prime);
+    J->col(i) =
+        (system.EvalTimeDerivatives(*column_context).CopyToVector() - f) / dxi;
+  });
 }
 
 template <class T>
 void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
-    const System<T>&, const T& t, const VectorX<T>& xt, Context<T>* context,
-    MatrixX<T>* J) {
+    const System<T>& system, const T& t, const VectorX<T>& xt,
+    Context<T>* context, MatrixX<T>* J) {
   using std::abs;
 
   // Cube root of machine precision (indicated by theory) seems a bit coarse.
@@ -155,9 +232,10 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
   context->SetTimeAndContinuousState(t, xt);
   const VectorX<T> f = this->EvalTimeDerivatives(*context).CopyToVector();
 
-  // Compute the Jacobian.
-  VectorX<T> xt_prime = xt;
-  for (int i = 0; i < n; ++i) {
+  // Compute the Jacobian, one column at a time (possibly concurrently, in
+  // which case each column uses its own context, whose time is already t).
+  ForEachJacobianColumn(system, n, context, [&](int i,
+                                                Context<T>* column_context) {
     // Compute a good increment to the dimension using approximately 1/eps
     // digits of precision. Note that if |xt| is large, the increment will
     // be large as well. If |xt| is small, the increment will be no smaller
@@ -176,43 +254,219 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
     // x and dx differ by an exactly representable number. See p. 192 of
     // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
     //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
+    VectorX<T> xt_prime = xt;
     xt_prime(i) = xt(i) + dxi;
     const T dxi_plus = xt_prime(i) - xt(i);
 
     // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
     //              Switch to a method that invalides just the relevant
     //              partition, and ideally modify only the one changed element.
-    // Compute f(x+dx).
-    context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_plus = this->EvalTimeDerivatives(*context).CopyToVector();
+    // Compute f(x+dx). The evaluations are counted by ForEachJacobianColumn().
+    column_context->SetContinuousState(xt_prime);
+    VectorX<T> fprime_plus =
+        system.EvalTimeDerivatives(*column_context).CopyToVector();
 
     // Update xt' again, minimizing the effect of roundoff error.
     xt_prime(i) = xt(i) - dxi;
     const T dxi_minus = xt(i) - xt_prime(i);
 
     // Compute f(x-dx).
-    context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_minus = this->EvalTimeDerivatives(
-        *context).CopyToVector();
+    column_context->SetContinuousState(xt_prime);
+    VectorX<T> fprime_minus =
+        system.EvalTimeDerivatives(*column_context).CopyToVector();
 
     // Set the Jacobian column.
     J->col(i) = (fprime_plus - fprime_minus) / (dxi_plus + dxi_minus);
+  });
+}
+
+template <class T>
+ImplicitIntegrator<T>::JacobianSparsity::JacobianSparsity(
+    const MatrixX<bool>& pattern) {
+  DRAKE_THROW_UNLESS(pattern.rows() == pattern.cols());
+  const int n = pattern.cols();
+  rows_.resize(n);
+  std::vector<std::vector<int>> columns_of_row(n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      if (pattern(i, j)) {
+        rows_[j].push_back(i);
+        columns_of_row[i].push_back(j);
+      }
+    }
+  }
+
+  // Give each column the smallest color that is not used by any of the
+  // (already colored) columns that share a nonzero row with it. The entry
+  // `forbidden[c] == j` marks color c as unavailable to column j.
+  color_.assign(n, -1);
+  std::vector<int> forbidden;
+  for (int j = 0; j < n; ++j) {
+    for (int i : rows_[j]) {
+      for (int k : columns_of_row[i]) {
+        if (color_[k] >= 0) forbidden[color_[k]] = j;
+      }
+    }
+    int c = 0;
+    while (c < static_cast<int>(forbidden.size()) && forbidden[c] == j) ++c;
+    if (c == static_cast<int>(forbidden.size())) {
+      forbidden.push_back(-1);
+      columns_.emplace_back();
+    }
+    color_[j] = c;
+    columns_[c].push_back(j);
+  }
+}
+
+template <class T>
+VectorX<T> ImplicitIntegrator<T>::PerturbForSparsityProbe(const VectorX<T>& x) {
+  using std::abs;
+  // Perturb every variable by a different amount, so that Jacobian entries are
+  // unlikely to vanish at both states by coincidence.
+  const double golden_ratio = 0.5 * (1 + std::sqrt(5.0));
+  VectorX<T> x_probe = x;
+  for (int i = 0; i < x.size(); ++i) {
+    const double u = 0.5 + 0.5 * std::fmod(golden_ratio * (i + 1), 1.0);
+    x_probe(i) += 1e-3 * (1 + abs(x(i))) * u;
+  }
+  return x_probe;
+}
+
+template <class T>
+MatrixX<bool> ImplicitIntegrator<T>::ProbeJacobianPattern(
+    const std::function<MatrixX<T>(const VectorX<T>&)>& calc_dense_jacobian,
+    const VectorX<T>& x) {
+  const int n = x.size();
+  const MatrixX<T> J = calc_dense_jacobian(x);
+  const MatrixX<T> J_probe = calc_dense_jacobian(PerturbForSparsityProbe(x));
+  DRAKE_DEMAND(J.rows() == n && J.cols() == n);
+  MatrixX<bool> pattern(n, n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      pattern(i, j) = (J(i, j) != 0.0 || J_probe(i, j) != 0.0);
+    }
+  }
+  return pattern;
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeColoredDiffJacobian(
+    const std::function<void(const VectorX<T>&, VectorX<T>*)>& f,
+    const VectorX<T>& x, const JacobianSparsity& sparsity, bool central,
+    MatrixX<T>* J) {
+  using std::abs;
+  const int n = x.size();
+  DRAKE_DEMAND(sparsity.size() == n);
+
+  // Use the same increments as ComputeForwardDiffJacobian() and
+  // ComputeCentralDiffJacobian().
+  const double eps = central ?
+      std::pow(std::numeric_limits<double>::epsilon(), 5.0/12) :
+      std::sqrt(std::numeric_limits<double>::epsilon());
+
+  J->setZero(n, n);
+  VectorX<T> f0;
+  if (!central) f(x, &f0);
+  VectorX<T> x_prime = x;
+  VectorX<T> f_plus, f_minus;
+  VectorX<T> dx_plus(n), dx_minus(n);
+  for (int c = 0; c < sparsity.num_colors(); ++c) {
+    const std::vector<int>& columns = sparsity.columns(c);
+    for (int j : columns) {
+      const T abs_xj = abs(x(j));
+      const T dxj = (abs_xj <= 1) ? T(eps) : T(eps * abs_xj);
+      // Minimize the effect of roundoff error, as in
+      // ComputeForwardDiffJacobian().
+      x_prime(j) = x(j) + dxj;
+      dx_plus(j) = x_prime(j) - x(j);
+    }
+    f(x_prime, &f_plus);
+    if (central) {
+      for (int j : columns) {
+        const T abs_xj = abs(x(j));
+        const T dxj = (abs_xj <= 1) ? T(eps) : T(eps * abs_xj);
+        x_prime(j) = x(j) - dxj;
+        dx_minus(j) = x(j) - x_prime(j);
+      }
+      f(x_prime, &f_minus);
+    }
+
+    // Each row is only affected by one of the perturbed columns.
+    for (int j : columns) {
+      for (int i : sparsity.rows(j)) {
+        (*J)(i, j) = central ?
+            T((f_plus(i) - f_minus(i)) / (dx_plus(j) + dx_minus(j))) :
+            T((f_plus(i) - f0(i)) / dx_plus(j));
+      }
+      x_prime(j) = x(j);
+    }
+  }
+}
 
-    // Reset xt' to xt.
-    xt_prime(i) = xt(i);
+template <class T>
+VectorX<AutoDiffXd> ImplicitIntegrator<T>::InitializeColoredAutoDiff(
+    const VectorX<double>& x, const JacobianSparsity& sparsity) {
+  DRAKE_DEMAND(sparsity.size() == x.size());
+  VectorX<AutoDiffXd> a_x(x.size());
+  for (int j = 0; j < x.size(); ++j) {
+    a_x(j).value() = x(j);
+    a_x(j).derivatives() =
+        Eigen::VectorXd::Unit(sparsity.num_colors(), sparsity.color(j));
+  }
+  return a_x;
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ExtractColoredJacobian(
+    const VectorX<AutoDiffXd>& f, const JacobianSparsity& sparsity,
+    MatrixX<T>* J) {
+  J->setZero(f.size(), sparsity.size());
+  for (int j = 0; j < sparsity.size(); ++j) {
+    for (int i : sparsity.rows(j)) {
+      // Derivatives of constant entries may be empty.
+      const Eigen::VectorXd& derivatives = f(i).derivatives();
+      if (derivatives.size() > 0) {
+        (*J)(i, j) = derivatives(sparsity.color(j));
+      }
+    }
   }
 }
 
 template <class T>
 void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
     const MatrixX<T>& iteration_matrix) {
-  LU_.compute(iteration_matrix);
   matrix_factored_ = true;
+  if (use_sparse_factorization_) {
+    Eigen::SparseMatrix<double> sparse = iteration_matrix.sparseView();
+    sparse.makeCompressed();
+    // Reuse the symbolic analysis if the nonzero pattern is unchanged.
+    const bool same_pattern =
+        sparse_matrix_.rows() == sparse.rows() &&
+        sparse_matrix_.nonZeros() == sparse.nonZeros() &&
+        std::equal(sparse.outerIndexPtr(),
+                   sparse.outerIndexPtr() + sparse.outerSize() + 1,
+                   sparse_matrix_.outerIndexPtr()) &&
+        std::equal(sparse.innerIndexPtr(),
+                   sparse.innerIndexPtr() + sparse.nonZeros(),
+                   sparse_matrix_.innerIndexPtr());
+    if (sparse_LU_ == nullptr) {
+      sparse_LU_ =
+          std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<double>>>();
+    }
+    if (!same_pattern) sparse_LU_->analyzePattern(sparse);
+    sparse_LU_->factorize(sparse);
+    sparse_matrix_ = std::move(sparse);
+    sparse_factored_ = (sparse_LU_->info() == Eigen::Success);
+    if (sparse_factored_) return;
+  }
+  sparse_factored_ = false;
+  LU_.compute(iteration_matrix);
 }
 
 template <class T>
 VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(
     const VectorX<T>& b) const {
+  if (sparse_factored_) return sparse_LU_->solve(b);
   return LU_.solve(b);
 }
 
@@ -297,21 +551,36 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   const System<T>& system = this->get_system();
 
   // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
-  [this, context, &system, &t, &x]() {
+  if (!use_sparse_jacobian_) {
+    ComputeDenseJacobian(system, t, x, context, &J_);
+  } else {
+    // The evaluations needed to find the sparsity pattern are counted as
+    // Jacobian function evaluations.
+    if (!jacobian_sparsity_.has_value() ||
+        jacobian_sparsity_->size() != x.size()) {
+      jacobian_sparsity_.emplace(CalcJacobianPattern(system, t, x, context));
+    }
+    const JacobianSparsity& sparsity = *jacobian_sparsity_;
     switch (jacobian_scheme_) {
       case JacobianComputationScheme::kForwardDifference:
-        ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
-        break;
-
-      case JacobianComputationScheme::kCentralDifference:
-        ComputeCentralDiffJacobian(system, t, x, &*context, &J_);
+      case JacobianComputationScheme::kCentralDifference: {
+        const auto f = [this, context](const VectorX<T>& x_eval,
+                                       VectorX<T>* f_eval) {
+          context->SetContinuousState(x_eval);
+          *f_eval = this->EvalTimeDerivatives(*context).CopyToVector();
+        };
+        ComputeColoredDiffJacobian(
+            f, x, sparsity,
+            jacobian_scheme_ == JacobianComputationScheme::kCentralDifference,
+            &J_);
         break;
+      }
 
       case JacobianComputationScheme::kAutomatic:
-        ComputeAutoDiffJacobian(system, t, x, *context, &J_);
+        ComputeAutoDiffJacobian(system, t, x, *context, &J_, &sparsity);
         break;
     }
-  }();
+  }
 
   // Use the new number of ODE evaluations to determine the number of Jacobian
   // evaluations.
@@ -328,6 +597,79 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   return J_;
 }
 
+template <class T>
+void ImplicitIntegrator<T>::ComputeDenseJacobian(
+    const System<T>& system, const T& t, const VectorX<T>& xt,
+    Context<T>* context, MatrixX<T>* J) {
+  switch (jacobian_scheme_) {
+    case JacobianComputationScheme::kForwardDifference:
+      ComputeForwardDiffJacobian(system, t, xt, context, J);
+      break;
+
+    case JacobianComputationScheme::kCentralDifference:
+      ComputeCentralDiffJacobian(system, t, xt, context, J);
+      break;
+
+    case JacobianComputationScheme::kAutomatic:
+      ComputeAutoDiffJacobian(system, t, xt, *context, J);
+      break;
+  }
+}
+
+template <class T>
+MatrixX<bool> ImplicitIntegrator<T>::CalcJacobianPattern(
+    const System<T>& system, const T& t, const VectorX<T>& xt,
+    Context<T>* context) {
+  const int n = xt.size();
+  if constexpr (std::is_same_v<T, double>) {
+    // Find the variables that each time derivative depends on symbolically.
+    // Any failure (e.g., inputs that cannot be converted, or a computation
+    // that does not support symbolic::Expression) falls back to probing.
+    try {
+      const std::unique_ptr<System<symbolic::Expression>> symbolic_system =
+          system.ToSymbolicMaybe();
+      if (symbolic_system != nullptr) {
+        std::unique_ptr<Context<symbolic::Expression>> symbolic_context =
+            symbolic_system->CreateDefaultContext();
+        symbolic_context->SetTimeStateAndParametersFrom(*context);
+        symbolic_system->FixInputPortsFrom(system, *context,
+                                           symbolic_context.get());
+        VectorX<symbolic::Expression> x_symbolic(n);
+        std::unordered_map<symbolic::Variable, int> index;
+        for (int j = 0; j < n; ++j) {
+          const symbolic::Variable x_j(fmt::format("x{}", j));
+          x_symbolic(j) = x_j;
+          index.emplace(x_j, j);
+        }
+        symbolic_context->SetContinuousState(x_symbolic);
+        const VectorX<symbolic::Expression> f =
+            symbolic_system->EvalTimeDerivatives(*symbolic_context)
+                .CopyToVector();
+        MatrixX<bool> pattern = MatrixX<bool>::Constant(n, n, false);
+        for (int i = 0; i < n; ++i) {
+          for (const symbolic::Variable& var : f(i).GetVariables()) {
+            const auto iter = index.find(var);
+            if (iter != index.end()) pattern(i, iter->second) = true;
+          }
+        }
+        return pattern;
+      }
+    } catch (const std::exception& e) {
+      DRAKE_LOGGER_DEBUG(
+          "  ImplicitIntegrator symbolic sparsity detection failed: {}",
+          e.what());
+    }
+  }
+
+  return ProbeJacobianPattern(
+      [this, &system, &t, context](const VectorX<T>& x_probe) {
+        MatrixX<T> J;
+        ComputeDenseJacobian(system, t, x_probe, context, &J);
+        return J;
+      },
+      xt);
+}
+
 template <class T>
 void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
     const T& t, const VectorX<T>& xt, const T& h,
@@ -339,6 +681,7 @@ void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
 
   // Return immediately if full-Newton is not in use.
   if (!get_use_full_newton()) return;
+  iteration_matrix->set_use_sparse_factorization(use_sparse_jacobian_);
 
   // Compute the initial Jacobian and iteration matrices and factor them.
   MatrixX<T>& J = get_mutable_jacobian();
@@ -356,6 +699,7 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
     typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
+  iteration_matrix->set_use_sparse_factorization(use_sparse_jacobian_);
   MatrixX<T>& J = get_mutable_jacobian();
   if (!get_reuse() || J.rows() == 0 || IsBadJacobian(J)) {
     J = CalcJacobian(t, xt);
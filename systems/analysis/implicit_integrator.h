@@ -1,11 +1,16 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
@@ -123,6 +128,58 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   JacobianComputationScheme get_jacobian_computation_scheme() const {
     return jacobian_scheme_;
   }
+
+  /// Sets whether the integrator exploits the sparsity of the Jacobian matrix
+  /// (default is `false`). This pays off for systems with many state
+  /// variables, each of whose time derivatives depends on few of them (e.g.,
+  /// many loosely coupled bodies, or a finite element discretization).
+  ///
+  /// In this mode, the sparsity pattern of the Jacobian matrix is determined
+  /// on its first computation: symbolically if the System supports
+  /// symbolic::Expression (and T is `double`), and otherwise by computing
+  /// dense Jacobian matrices at the current state and at a perturbed state
+  /// (an entry is assumed to be zero if it is zero at both). The columns of
+  /// the Jacobian matrix are then grouped into "colors" of columns that have no
+  /// nonzero row in common, and every later Jacobian matrix is computed with
+  /// one derivative evaluation per color (two for central differencing), or
+  /// one AutoDiff derivative direction per color, instead of one per state
+  /// variable. For T = `double`, the iteration matrices are also factored with
+  /// a sparse LU factorization, whose symbolic analysis is reused for as long
+  /// as the nonzero pattern of the iteration matrix does not change.
+  ///
+  /// @warning When the sparsity pattern is found by probing, a Jacobian entry
+  ///          that happens to be zero at both probed states is treated as zero
+  ///          for the rest of the simulation.
+  /// @note The sparsity pattern is discarded by Reset().
+  void set_use_sparse_jacobian(bool flag) { use_sparse_jacobian_ = flag; }
+
+  /// Gets whether the integrator exploits the sparsity of the Jacobian matrix.
+  /// @see set_use_sparse_jacobian()
+  bool get_use_sparse_jacobian() const { return use_sparse_jacobian_; }
+
+  /// Sets the number of threads that compute the columns of a (dense) finite
+  /// difference Jacobian matrix concurrently (default is 1, i.e., serially).
+  /// With more than one thread, the integrator keeps a clone of its Context
+  /// for each thread, whose time, state, parameters and fixed input port
+  /// values are copied from the integrator's Context before every Jacobian
+  /// computation. Every column is computed exactly as it is serially, so the
+  /// Jacobian matrix does not depend on the number of threads.
+  ///
+  /// The System must support evaluating its time derivatives concurrently in
+  /// separate Contexts (as Drake's Systems do). This has no effect on
+  /// automatic differentiation, on the sparse Jacobian mode (see
+  /// set_use_sparse_jacobian()), or on the velocity Jacobian of
+  /// VelocityImplicitEulerIntegrator.
+  /// @throws std::exception if `num_threads` is less than one.
+  void set_num_jacobian_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    num_jacobian_threads_ = num_threads;
+  }
+
+  /// Gets the number of threads that compute the columns of a finite
+  /// difference Jacobian matrix.
+  /// @see set_num_jacobian_threads()
+  int get_num_jacobian_threads() const { return num_jacobian_threads_; }
   /// @}
 
   /// @name Cumulative statistics functions.
@@ -230,8 +287,28 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     /// Returns whether the iteration matrix has been set and factored.
     bool matrix_factored() const { return matrix_factored_; }
 
+    /// Sets whether SetAndFactorIterationMatrix() stores the iteration matrix
+    /// as a sparse matrix and uses a sparse LU factorization. This is ignored
+    /// for T = AutoDiffXd.
+    void set_use_sparse_factorization(bool flag) {
+      use_sparse_factorization_ = flag;
+    }
+
    private:
     bool matrix_factored_{false};
+    bool use_sparse_factorization_{false};
+
+    // Whether the last factorization is sparse_LU_ (rather than LU_). A
+    // singular sparse factorization falls back to the dense one.
+    bool sparse_factored_{false};
+
+    // The last iteration matrix factored with sparse_LU_, whose nonzero
+    // pattern is compared to the next one to decide whether the symbolic
+    // analysis of sparse_LU_ can be reused. The factorization is allocated on
+    // first use (and held by pointer, since Eigen's sparse solvers are not
+    // movable).
+    Eigen::SparseMatrix<double> sparse_matrix_;
+    std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>>> sparse_LU_;
 
     // A simple LU factorization is all that is needed for ImplicitIntegrator
     // templated on scalar type `double`; robustness in the solve
@@ -383,6 +460,71 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   /// the child class should use this to reset its cached matrices.
   virtual void DoResetCachedJacobianRelatedMatrices() {}
 
+  /// The sparsity pattern of a square Jacobian matrix, together with a
+  /// partition of its columns into "colors": groups of columns that have no
+  /// nonzero row in common. The columns of one color can be computed together
+  /// with a single perturbation of all their variables. The colors are
+  /// found with a greedy algorithm, which is optimal for banded matrices.
+  class JacobianSparsity {
+   public:
+    /// Constructs the sparsity pattern from the entries of `pattern` that are
+    /// `true`.
+    explicit JacobianSparsity(const MatrixX<bool>& pattern);
+
+    /// Returns the number of columns.
+    int size() const { return static_cast<int>(color_.size()); }
+
+    int num_colors() const { return static_cast<int>(columns_.size()); }
+
+    /// Returns the color of column `j`.
+    int color(int j) const { return color_[j]; }
+
+    /// Returns the rows of the nonzero entries of column `j`.
+    const std::vector<int>& rows(int j) const { return rows_[j]; }
+
+    /// Returns the columns of color `c`.
+    const std::vector<int>& columns(int c) const { return columns_[c]; }
+
+   private:
+    std::vector<std::vector<int>> rows_;
+    std::vector<int> color_;
+    std::vector<std::vector<int>> columns_;
+  };
+
+  /// Returns `x` with every entry perturbed by a small, different (but
+  /// deterministic) amount, for use by ProbeJacobianPattern().
+  static VectorX<T> PerturbForSparsityProbe(const VectorX<T>& x);
+
+  /// Returns the sparsity pattern of the Jacobian matrix of a function of `x`
+  /// by calling `calc_dense_jacobian` at `x` and at PerturbForSparsityProbe(x);
+  /// an entry is nonzero if it is nonzero in either of the two Jacobian
+  /// matrices.
+  static MatrixX<bool> ProbeJacobianPattern(
+      const std::function<MatrixX<T>(const VectorX<T>&)>& calc_dense_jacobian,
+      const VectorX<T>& x);
+
+  /// Computes the Jacobian matrix `J` of `f` at `x` by forward differencing
+  /// (or, if `central` is true, central differencing), perturbing all of the
+  /// variables of one color of `sparsity` at once. The entries outside of the
+  /// sparsity pattern are set to zero.
+  static void ComputeColoredDiffJacobian(
+      const std::function<void(const VectorX<T>&, VectorX<T>*)>& f,
+      const VectorX<T>& x, const JacobianSparsity& sparsity, bool central,
+      MatrixX<T>* J);
+
+  /// Returns `x` as a vector of AutoDiff variables with one derivative per
+  /// color of `sparsity`, in which x(j) has a unit derivative with respect to
+  /// its color.
+  static VectorX<AutoDiffXd> InitializeColoredAutoDiff(
+      const VectorX<double>& x, const JacobianSparsity& sparsity);
+
+  /// Recovers the Jacobian matrix `J` from the derivatives of `f` with
+  /// respect to the colors of InitializeColoredAutoDiff(). The entries outside
+  /// of the sparsity pattern are set to zero.
+  static void ExtractColoredJacobian(const VectorX<AutoDiffXd>& f,
+                                     const JacobianSparsity& sparsity,
+                                     MatrixX<T>* J);
+
   /// Checks to see whether a Jacobian matrix is "bad" (has any NaN or
   /// Inf values) and needs to be recomputed. A divergent Newton-Raphson
   /// iteration can cause the state to overflow, which is how the Jacobian can
@@ -447,14 +589,40 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   // @param xt the continuous state around which to compute the Jacobian matrix.
   // @param context the Context of the system, at time and continuous state
   //        unknown.
+  // @param sparsity if non-null, the AutoDiff derivatives are taken with
+  //        respect to its colors rather than to each state variable.
   // @param[out] J the Jacobian matrix around time and state `(t, xt)`.
   // @post The continuous state will be indeterminate on return.
   void ComputeAutoDiffJacobian(const System<T>& system, const T& t,
-      const VectorX<T>& xt, const Context<T>& context, MatrixX<T>* J);
+      const VectorX<T>& xt, const Context<T>& context, MatrixX<T>* J,
+      const JacobianSparsity* sparsity = nullptr);
 
   /// @copydoc IntegratorBase::DoStep()
   virtual bool DoImplicitIntegratorStep(const T& h) = 0;
 
+  // Calls `column(i, column_context)` for every column i in [0, n) of a finite
+  // difference Jacobian matrix, where `column_context` is `context`, or, with
+  // more than one Jacobian thread, one of the clones in jacobian_contexts_
+  // (which are first updated to match `context`). `column` may change the
+  // continuous state of `column_context`, and must only write to column i of
+  // the Jacobian matrix. The derivative evaluations in `column` are added to
+  // the statistics.
+  void ForEachJacobianColumn(
+      const System<T>& system, int n, Context<T>* context,
+      const std::function<void(int, Context<T>*)>& column);
+
+  // Computes the dense Jacobian matrix `J` with the selected Jacobian scheme.
+  // The arguments are the same as for ComputeForwardDiffJacobian().
+  void ComputeDenseJacobian(const System<T>& system, const T& t,
+      const VectorX<T>& xt, Context<T>* context, MatrixX<T>* J);
+
+  // Computes the sparsity pattern of the Jacobian matrix of the ordinary
+  // differential equations around time and state `(t, xt)`, as documented in
+  // set_use_sparse_jacobian(). The arguments are the same as for
+  // ComputeForwardDiffJacobian().
+  MatrixX<bool> CalcJacobianPattern(const System<T>& system, const T& t,
+      const VectorX<T>& xt, Context<T>* context);
+
   // Methods for derived classes to increment the factorization and Jacobian
   // evaluation counts.
   void increment_num_iter_factorizations() {
@@ -500,6 +668,18 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   // The last computed Jacobian matrix.
   MatrixX<T> J_;
 
+  // Whether the Jacobian sparsity is exploited, see set_use_sparse_jacobian().
+  bool use_sparse_jacobian_{false};
+
+  // The sparsity pattern of J_, computed by the first CalcJacobian() in sparse
+  // mode.
+  std::optional<JacobianSparsity> jacobian_sparsity_;
+
+  // The number of threads for finite difference Jacobian matrices, and the
+  // clones of the integrator's context that they use (allocated on demand).
+  int num_jacobian_threads_{1};
+  std::vector<std::unique_ptr<Context<T>>> jacobian_contexts_;
+
   // Indicates whether the Jacobian matrix is fresh. We say the Jacobian is
   // "fresh" if it was last computed at a state (t0, x0) from the beginning of
   // the current step. This indicates to MaybeFreshenMatrices that it should
@@ -530,7 +710,8 @@ template <>
 inline void ImplicitIntegrator<AutoDiffXd>::
     ComputeAutoDiffJacobian(const System<AutoDiffXd>&,
       const AutoDiffXd&, const VectorX<AutoDiffXd>&,
-      const Context<AutoDiffXd>&, MatrixX<AutoDiffXd>*) {
+      const Context<AutoDiffXd>&, MatrixX<AutoDiffXd>*,
+      const JacobianSparsity*) {
         throw std::runtime_error("AutoDiff'd Jacobian not supported from "
                                      "AutoDiff'd ImplicitIntegrator");
 }
@@ -560,6 +741,16 @@ ImplicitIntegrator<AutoDiffXd>::IterationMatrix::Solve(
   return QR_.solve(b);
 }
 
+// The AutoDiff derivatives of an AutoDiff'd state are not supported, as in
+// ComputeAutoDiffJacobian() above.
+template <>
+inline VectorX<AutoDiffXd>
+ImplicitIntegrator<AutoDiffXd>::InitializeColoredAutoDiff(
+    const VectorX<double>&, const JacobianSparsity&) {
+  throw std::runtime_error("AutoDiff'd Jacobian not supported from "
+                           "AutoDiff'd ImplicitIntegrator");
+}
+
 }  // namespace systems
 }  // namespace drake
 
@@ -62,6 +62,9 @@ SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
   if (!context_)
     throw std::logic_error("Initialize(): Context has not been set.");
 
+  std::optional<SystemProfiler::ActiveScope> profile;
+  if (profiling_enabled_) profile.emplace(&profiler_);
+
   // Record the current time so we can restore it later (see below).
   // *Don't* use a reference here!
   const T current_time = context_->get_time();
@@ -189,6 +192,9 @@ void Simulator<T>::HandlePublish(
 
 template <typename T>
 SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
+  std::optional<SystemProfiler::ActiveScope> profile;
+  if (profiling_enabled_) profile.emplace(&profiler_);
+
   if (!initialization_done_) {
     const SimulatorStatus initialize_status = Initialize();
     if (!initialize_status.succeeded())
@@ -19,6 +19,7 @@
 #include "drake/systems/analysis/simulator_status.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
+#include "drake/systems/framework/system_profiler.h"
 #include "drake/systems/framework/witness_function.h"
 
 namespace drake {
@@ -532,6 +533,24 @@ class Simulator {
   /// enabled. By default, returns false.
   bool get_publish_every_time_step() const { return publish_every_time_step_; }
 
+  /// Sets whether Initialize() and AdvanceTo() record which System
+  /// computations (cache entries, time derivatives, and event handlers) take
+  /// the time, with the profiler returned by get_profiler(). Disabled by
+  /// default; see SystemProfiler for the (small) overhead when enabled.
+  void set_profiling_enabled(bool enabled) { profiling_enabled_ = enabled; }
+
+  /// Returns true if the set_profiling_enabled() option has been enabled.
+  bool get_profiling_enabled() const { return profiling_enabled_; }
+
+  /// Returns the profiler that records the System computations while profiling
+  /// is enabled, e.g., to print its GetSummary() or WriteChromeTrace(). Its
+  /// statistics accumulate over calls to AdvanceTo() until it is cleared (see
+  /// get_mutable_profiler()).
+  const SystemProfiler& get_profiler() const { return profiler_; }
+
+  /// Returns a mutable reference to the profiler, e.g., to Clear() it.
+  SystemProfiler& get_mutable_profiler() { return profiler_; }
+
   /// Returns a const reference to the internally-maintained Context holding the
   /// most recent step in the trajectory. This is suitable for publishing or
   /// extracting information about this trajectory step. Do not call this method
@@ -801,6 +820,9 @@ class Simulator {
 
   bool publish_at_initialization_{SimulatorConfig{}.publish_every_time_step};
 
+  bool profiling_enabled_{false};
+  SystemProfiler profiler_;
+
   // These are recorded at initialization or statistics reset.
   double initial_simtime_{nan()};  // Simulated time at start of period.
   TimePoint initial_realtime_;     // Real time at start of period.
@@ -159,6 +159,11 @@ void PrintSimulatorStatistics(const Simulator<T>& simulator) {
                  implicit_integrator->get_num_newton_raphson_iterations());
     }
   }
+
+  if (simulator.get_profiling_enabled()) {
+    fmt::print("\nProfile of System computations (see SystemProfiler):\n{}",
+               simulator.get_profiler().GetSummary());
+  }
 }
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
@@ -6,7 +6,9 @@ namespace drake {
 namespace systems {
 
 /// This method outputs to stdout relevant simulation statistics for a
-/// simulator that advanced the state of a system forward in time.
+/// simulator that advanced the state of a system forward in time, including
+/// its profiler's summary if profiling was enabled
+/// (see Simulator::set_profiling_enabled()).
 /// @param[in] simulator
 ///   The simulator to output statistics for.
 template <typename T>
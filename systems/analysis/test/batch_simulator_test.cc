@@ -0,0 +1,291 @@
+#include "drake/systems/analysis/batch_simulator.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/analysis/simulator_config_functions.h"
+#include "drake/systems/analysis/test_utilities/spring_mass_damper_chain_system.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/primitives/gain.h"
+#include "drake/systems/primitives/integrator.h"
+#include "drake/systems/primitives/zero_order_hold.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+// A damped pendulum θ̈ = -sin(θ) - bθ̇, with the damping b as a numeric
+// parameter, and a discrete state that samples the energy periodically. It
+// evaluates its dynamics one copy at a time or (when batched is true) through
+// BatchDynamics, and counts the unbatched derivative evaluations.
+class SampledPendulum final : public LeafSystem<double>, public BatchDynamics {
+ public:
+  static constexpr double kPeriod = 0.05;
+
+  explicit SampledPendulum(bool batched) : batched_(batched) {
+    DeclareContinuousState(1, 1, 0);
+    DeclareDiscreteState(1);
+    DeclareNumericParameter(BasicVector<double>(Vector1d(0.1)));
+    DeclarePeriodicDiscreteUpdateEvent(kPeriod, 0.0,
+                                       &SampledPendulum::SampleEnergy);
+  }
+
+  int num_derivative_evaluations() const { return num_evaluations_; }
+
+  bool CalcBatchTimeDerivatives(
+      const std::vector<const Context<double>*>& contexts, double,
+      const MatrixXd& continuous_states, const MatrixXd&,
+      MatrixXd* derivatives) const final {
+    if (!batched_) return false;
+    VectorXd damping(contexts.size());
+    for (int i = 0; i < damping.size(); ++i) {
+      damping(i) = contexts[i]->get_numeric_parameter(0)[0];
+    }
+    derivatives->col(0) = continuous_states.col(1);
+    derivatives->col(1) =
+        -continuous_states.col(0).array().sin() -
+        damping.array() * continuous_states.col(1).array();
+    return true;
+  }
+
+  bool CalcBatchDiscreteVariableUpdates(
+      const std::vector<const Context<double>*>&, double,
+      const MatrixXd& continuous_states, const MatrixXd&,
+      MatrixXd* next_discrete_states) const final {
+    if (!batched_) return false;
+    next_discrete_states->col(0) =
+        0.5 * continuous_states.col(1).array().square() + 1.0 -
+        continuous_states.col(0).array().cos();
+    return true;
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    ++num_evaluations_;
+    const VectorXd x = context.get_continuous_state_vector().CopyToVector();
+    const double b = context.get_numeric_parameter(0)[0];
+    derivatives->SetFromVector(
+        Eigen::Vector2d(x(1), -std::sin(x(0)) - b * x(1)));
+  }
+
+  EventStatus SampleEnergy(const Context<double>& context,
+                           DiscreteValues<double>* next) const {
+    const VectorXd x = context.get_continuous_state_vector().CopyToVector();
+    next->set_value(Vector1d(0.5 * x(1) * x(1) + 1.0 - std::cos(x(0))));
+    return EventStatus::Succeeded();
+  }
+
+  const bool batched_;
+  mutable int num_evaluations_{0};
+};
+
+// Sets the state (and, for SampledPendulum, the parameters) of copy i.
+void SetCopyState(int i, Context<double>* context) {
+  VectorXd x = context->get_continuous_state_vector().CopyToVector();
+  for (int j = 0; j < x.size(); ++j) {
+    x(j) = std::sin(1.0 + i + 2.0 * j);
+  }
+  context->SetContinuousState(x);
+  if (context->num_numeric_parameter_groups() > 0) {
+    context->get_mutable_numeric_parameter(0)[0] = 0.1 * (i + 1);
+  }
+}
+
+// Returns the discrete state groups of the context, concatenated.
+VectorXd CopyDiscreteState(const Context<double>& context) {
+  std::vector<double> values;
+  for (int g = 0; g < context.num_discrete_state_groups(); ++g) {
+    const VectorXd& group = context.get_discrete_state(g).value();
+    values.insert(values.end(), group.data(), group.data() + group.size());
+  }
+  return Eigen::Map<VectorXd>(values.data(), values.size());
+}
+
+// Simulates each copy with its own Simulator and returns the final
+// continuous (and discrete) state of every copy, one row per copy.
+void SimulateIndependently(const System<double>& system, int num_copies,
+                           double time_step, const std::string& scheme,
+                           const std::vector<double>& boundary_times,
+                           MatrixXd* xc, MatrixXd* xd) {
+  for (int i = 0; i < num_copies; ++i) {
+    Simulator<double> simulator(system);
+    SimulatorConfig config;
+    config.integration_scheme = scheme;
+    config.max_step_size = time_step;
+    config.use_error_control = false;
+    ApplySimulatorConfig(config, &simulator);
+    SetCopyState(i, &simulator.get_mutable_context());
+    simulator.Initialize();
+    for (double boundary_time : boundary_times) {
+      simulator.AdvanceTo(boundary_time);
+    }
+    const Context<double>& context = simulator.get_context();
+    const VectorXd xc_i = context.get_continuous_state_vector().CopyToVector();
+    const VectorXd xd_i = CopyDiscreteState(context);
+    xc->resize(num_copies, xc_i.size());
+    xd->resize(num_copies, xd_i.size());
+    xc->row(i) = xc_i.transpose();
+    xd->row(i) = xd_i.transpose();
+  }
+}
+
+// Simulates the copies with a BatchSimulator, and returns their final states
+// like SimulateIndependently() does.
+void SimulateBatch(BatchSimulator* batch,
+                   const std::vector<double>& boundary_times, MatrixXd* xc,
+                   MatrixXd* xd) {
+  for (int i = 0; i < batch->num_copies(); ++i) {
+    SetCopyState(i, &batch->get_mutable_context(i));
+  }
+  for (double boundary_time : boundary_times) {
+    batch->AdvanceTo(boundary_time);
+  }
+  for (int i = 0; i < batch->num_copies(); ++i) {
+    const Context<double>& context = batch->get_context(i);
+    EXPECT_EQ(context.get_time(), boundary_times.back());
+    const VectorXd xc_i = context.get_continuous_state_vector().CopyToVector();
+    const VectorXd xd_i = CopyDiscreteState(context);
+    xc->resize(batch->num_copies(), xc_i.size());
+    xd->resize(batch->num_copies(), xd_i.size());
+    xc->row(i) = xc_i.transpose();
+    xd->row(i) = xd_i.transpose();
+  }
+}
+
+class BatchSimulatorTest : public ::testing::TestWithParam<std::string> {};
+
+// A purely continuous system, advanced to boundaries that are not multiples of
+// the time step.
+TEST_P(BatchSimulatorTest, ContinuousMatchesSimulator) {
+  const test::SpringMassDamperChainSystem<double> system(3, 4.0, 0.1);
+  const int num_copies = 5;
+  const double h = 0.01;
+  const std::vector<double> boundary_times{0.1234, 0.1234, 0.5};
+
+  MatrixXd xc_expected, xd_expected;
+  SimulateIndependently(system, num_copies, h, GetParam(), boundary_times,
+                        &xc_expected, &xd_expected);
+  BatchSimulator batch(system, num_copies, h, GetParam());
+  MatrixXd xc, xd;
+  SimulateBatch(&batch, boundary_times, &xc, &xd);
+  EXPECT_TRUE(CompareMatrices(xc, xc_expected, 1e-14));
+  EXPECT_FALSE(batch.used_batch_time_derivatives());
+}
+
+// A continuous integrator in feedback through a zero-order hold, so that the
+// copies have both continuous and discrete state. One boundary coincides with
+// a discrete update time, which must be updated only once.
+TEST_P(BatchSimulatorTest, HybridDiagramMatchesSimulator) {
+  const double period = 0.25;
+  DiagramBuilder<double> builder;
+  auto* integrator = builder.AddSystem<Integrator<double>>(2);
+  auto* hold = builder.AddSystem<ZeroOrderHold<double>>(period, 2);
+  auto* gain = builder.AddSystem<Gain<double>>(-1.0, 2);
+  builder.Connect(integrator->get_output_port(), hold->get_input_port());
+  builder.Connect(hold->get_output_port(), gain->get_input_port());
+  builder.Connect(gain->get_output_port(), integrator->get_input_port());
+  const std::unique_ptr<Diagram<double>> diagram = builder.Build();
+
+  const int num_copies = 3;
+  const double h = 0.1;
+  const std::vector<double> boundary_times{2 * period, 2 * period, 1.1};
+
+  MatrixXd xc_expected, xd_expected;
+  SimulateIndependently(*diagram, num_copies, h, GetParam(), boundary_times,
+                        &xc_expected, &xd_expected);
+  BatchSimulator batch(*diagram, num_copies, h, GetParam());
+  MatrixXd xc, xd;
+  SimulateBatch(&batch, boundary_times, &xc, &xd);
+  EXPECT_TRUE(CompareMatrices(xc, xc_expected, 1e-14));
+  EXPECT_TRUE(CompareMatrices(xd, xd_expected, 1e-14));
+  EXPECT_FALSE(batch.used_batch_discrete_updates());
+}
+
+// A system that implements BatchDynamics gives the same results as its
+// unbatched implementation, without evaluating the copies one at a time.
+TEST_P(BatchSimulatorTest, BatchDynamics) {
+  const int num_copies = 4;
+  const double h = 0.02;
+  const std::vector<double> boundary_times{0.33, 20 * SampledPendulum::kPeriod,
+                                           1.234};
+
+  const SampledPendulum unbatched(false);
+  MatrixXd xc_expected, xd_expected;
+  SimulateIndependently(unbatched, num_copies, h, GetParam(), boundary_times,
+                        &xc_expected, &xd_expected);
+
+  const SampledPendulum batched(true);
+  BatchSimulator batch(batched, num_copies, h, GetParam());
+  MatrixXd xc, xd;
+  SimulateBatch(&batch, boundary_times, &xc, &xd);
+  EXPECT_TRUE(batch.used_batch_time_derivatives());
+  EXPECT_TRUE(batch.used_batch_discrete_updates());
+  EXPECT_EQ(batched.num_derivative_evaluations(), 0);
+  EXPECT_TRUE(CompareMatrices(xc, xc_expected, 1e-12));
+  EXPECT_TRUE(CompareMatrices(xd, xd_expected, 1e-12));
+
+  // The same system, evaluated one copy at a time.
+  BatchSimulator fallback(unbatched, num_copies, h, GetParam());
+  SimulateBatch(&fallback, boundary_times, &xc, &xd);
+  EXPECT_FALSE(fallback.used_batch_time_derivatives());
+  EXPECT_FALSE(fallback.used_batch_discrete_updates());
+  EXPECT_TRUE(CompareMatrices(xc, xc_expected, 1e-14));
+  EXPECT_TRUE(CompareMatrices(xd, xd_expected, 1e-14));
+}
+
+INSTANTIATE_TEST_SUITE_P(Schemes, BatchSimulatorTest,
+                         ::testing::Values("explicit_euler", "runge_kutta2"));
+
+// A system with abstract state.
+class AbstractStateSystem final : public LeafSystem<double> {
+ public:
+  AbstractStateSystem() { DeclareAbstractState(Value<int>(0)); }
+};
+
+GTEST_TEST(BatchSimulatorErrorTest, Unsupported) {
+  const SampledPendulum pendulum(true);
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchSimulator(pendulum, 0, 0.1),
+                              ".*num_copies >= 1.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchSimulator(pendulum, 1, 0.0),
+                              ".*time_step > 0.0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchSimulator(pendulum, 1, 0.1, "radau3"),
+                              ".*unsupported integration scheme 'radau3'.*");
+
+  const AbstractStateSystem abstract_state;
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchSimulator(abstract_state, 1, 0.1),
+                              ".*abstract state.*");
+
+  DiagramBuilder<double> builder;
+  builder.AddSystem<ZeroOrderHold<double>>(0.1, 1);
+  builder.AddSystem<ZeroOrderHold<double>>(0.3, 1);
+  const std::unique_ptr<Diagram<double>> two_periods = builder.Build();
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchSimulator(*two_periods, 1, 0.1),
+                              ".*single period, with zero offset.*");
+
+  BatchSimulator batch(pendulum, 2, 0.1);
+  batch.get_mutable_context(1).SetTime(1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(batch.AdvanceTo(2.0),
+                              ".*must start at the same time.*");
+  batch.get_mutable_context(0).SetTime(1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(batch.AdvanceTo(0.5),
+                              ".*boundary_time >= time.*");
+}
+
+}  // namespace
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -2,8 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/analysis/test_utilities/spring_mass_damper_chain_system.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_system.h"
+#include "drake/systems/analysis/test_utilities/stiff_double_mass_spring_system.h"
+#include "drake/systems/framework/leaf_system.h"
 
+using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
 namespace drake {
@@ -21,7 +26,9 @@ class DummyImplicitIntegrator final : public ImplicitIntegrator<double> {
   bool supports_error_estimation() const override { return false; }
   int get_error_estimate_order() const override { return 0; }
 
+  using ImplicitIntegrator<double>::CalcJacobian;
   using ImplicitIntegrator<double>::IsUpdateZero;
+  using ImplicitIntegrator<double>::JacobianSparsity;
 
   // Returns whether DoResetCachedMatrices() has been called.
   bool get_has_reset_cached_matrices() {
@@ -135,6 +142,157 @@ GTEST_TEST(ImplicitIntegratorTest, SetComputationSchemeResetsCachedMatrices) {
             ImplicitIntegrator<double>
             ::JacobianComputationScheme::kAutomatic);
 }
+
+GTEST_TEST(ImplicitIntegratorTest, JacobianSparsityColoring) {
+  using JacobianSparsity = DummyImplicitIntegrator::JacobianSparsity;
+
+  // A tridiagonal pattern needs three colors.
+  const int n = 7;
+  MatrixX<bool> tridiagonal = MatrixX<bool>::Constant(n, n, false);
+  for (int i = 0; i < n; ++i) {
+    for (int j = std::max(i - 1, 0); j <= std::min(i + 1, n - 1); ++j) {
+      tridiagonal(i, j) = true;
+    }
+  }
+  const JacobianSparsity banded(tridiagonal);
+  EXPECT_EQ(banded.size(), n);
+  EXPECT_EQ(banded.num_colors(), 3);
+  for (int j = 0; j < n; ++j) {
+    EXPECT_EQ(banded.color(j), j % 3);
+  }
+  EXPECT_EQ(banded.rows(0), std::vector<int>({0, 1}));
+  EXPECT_EQ(banded.rows(3), std::vector<int>({2, 3, 4}));
+  EXPECT_EQ(banded.columns(1), std::vector<int>({1, 4}));
+
+  // A single dense row couples all of the columns.
+  MatrixX<bool> arrow = MatrixX<bool>::Identity(n, n);
+  arrow.row(0).setConstant(true);
+  EXPECT_EQ(JacobianSparsity(arrow).num_colors(), n);
+
+  // A diagonal pattern needs a single color.
+  EXPECT_EQ(JacobianSparsity(MatrixX<bool>::Identity(n, n)).num_colors(), 1);
+}
+
+// Checks that the sparse Jacobian matrix matches the dense one, both when the
+// sparsity pattern is found symbolically (the chain supports
+// symbolic::Expression) and when it is found by probing.
+GTEST_TEST(ImplicitIntegratorTest, SparseJacobian) {
+  using JacobianScheme = ImplicitIntegrator<double>::JacobianComputationScheme;
+  const analysis::test::SpringMassDamperChainSystem<double> chain(
+      10 /* num_masses */, 100.0 /* spring constant */,
+      1.0 /* damping constant */);
+  const analysis::test::StiffDoubleMassSpringSystem<double> double_spring;
+  for (const System<double>* system :
+       std::initializer_list<const System<double>*>{&chain, &double_spring}) {
+    std::unique_ptr<Context<double>> context = system->CreateDefaultContext();
+    VectorXd x = VectorXd::LinSpaced(system->num_continuous_states(), -1, 1);
+    for (JacobianScheme scheme : {JacobianScheme::kForwardDifference,
+                                  JacobianScheme::kCentralDifference,
+                                  JacobianScheme::kAutomatic}) {
+      // The double spring supports neither symbolic::Expression nor AutoDiff.
+      if (system == &double_spring && scheme == JacobianScheme::kAutomatic) {
+        continue;
+      }
+      DummyImplicitIntegrator dense_integrator(*system, context.get());
+      dense_integrator.set_jacobian_computation_scheme(scheme);
+      const MatrixXd J_dense = dense_integrator.CalcJacobian(0.0, x);
+
+      DummyImplicitIntegrator sparse_integrator(*system, context.get());
+      sparse_integrator.set_jacobian_computation_scheme(scheme);
+      sparse_integrator.set_use_sparse_jacobian(true);
+      // The first call also finds the sparsity pattern.
+      sparse_integrator.CalcJacobian(0.0, x);
+      const int64_t num_evaluations_before =
+          sparse_integrator.get_num_derivative_evaluations_for_jacobian();
+      const MatrixXd J_sparse = sparse_integrator.CalcJacobian(0.0, x);
+      EXPECT_TRUE(CompareMatrices(J_sparse, J_dense, 1e-14));
+      if (system == &chain && scheme == JacobianScheme::kForwardDifference) {
+        // The q columns need three colors, as for a tridiagonal matrix, and
+        // so do the v columns, each of which shares a row with five q
+        // columns. With the unperturbed evaluation, that is 7 evaluations
+        // rather than 21. Finding the pattern symbolically took none.
+        EXPECT_EQ(num_evaluations_before, 7);
+        EXPECT_EQ(
+            sparse_integrator.get_num_derivative_evaluations_for_jacobian() -
+                num_evaluations_before,
+            7);
+      }
+    }
+  }
+}
+
+// Checks that computing the finite difference Jacobian matrix with several
+// threads gives exactly the same matrix and statistics as computing it
+// serially.
+GTEST_TEST(ImplicitIntegratorTest, ParallelJacobian) {
+  using JacobianScheme = ImplicitIntegrator<double>::JacobianComputationScheme;
+  const analysis::test::SpringMassDamperChainSystem<double> chain(
+      25 /* num_masses */, 100.0 /* spring constant */,
+      1.0 /* damping constant */);
+  std::unique_ptr<Context<double>> context = chain.CreateDefaultContext();
+  const VectorXd x = VectorXd::LinSpaced(chain.num_continuous_states(), -1, 1);
+  for (JacobianScheme scheme : {JacobianScheme::kForwardDifference,
+                                JacobianScheme::kCentralDifference}) {
+    DummyImplicitIntegrator serial_integrator(chain, context.get());
+    serial_integrator.set_jacobian_computation_scheme(scheme);
+    EXPECT_EQ(serial_integrator.get_num_jacobian_threads(), 1);
+    const MatrixXd J_serial = serial_integrator.CalcJacobian(0.5, x);
+
+    DummyImplicitIntegrator parallel_integrator(chain, context.get());
+    parallel_integrator.set_jacobian_computation_scheme(scheme);
+    parallel_integrator.set_num_jacobian_threads(4);
+    EXPECT_EQ(parallel_integrator.get_num_jacobian_threads(), 4);
+    for (int i = 0; i < 2; ++i) {
+      // The second time reuses the cloned contexts.
+      const MatrixXd J_parallel = parallel_integrator.CalcJacobian(0.5, x);
+      EXPECT_TRUE(CompareMatrices(J_parallel, J_serial, 0.0));
+    }
+    EXPECT_EQ(
+        parallel_integrator.get_num_derivative_evaluations_for_jacobian(),
+        2 * serial_integrator.get_num_derivative_evaluations_for_jacobian());
+    // The integrator's context is restored.
+    EXPECT_EQ(context->get_time(), 0.0);
+  }
+
+  DummyImplicitIntegrator integrator(chain, context.get());
+  EXPECT_THROW(integrator.set_num_jacobian_threads(0), std::exception);
+}
+
+// ẋ = -u ⊙ x, whose Jacobian matrix -diag(u) depends on the input.
+class InputScaledDecay final : public LeafSystem<double> {
+ public:
+  explicit InputScaledDecay(int n) {
+    DeclareVectorInputPort("u", n);
+    DeclareContinuousState(n);
+  }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<double>& context,
+                             ContinuousState<double>* derivatives) const final {
+    const VectorXd& u = get_input_port(0).Eval(context);
+    const VectorXd x = context.get_continuous_state_vector().CopyToVector();
+    derivatives->SetFromVector(-u.cwiseProduct(x));
+  }
+};
+
+// With several threads, the Jacobian matrix uses the current value of a fixed
+// input port, also after the cloned contexts were created.
+GTEST_TEST(ImplicitIntegratorTest, ParallelJacobianFixedInput) {
+  const InputScaledDecay system(6);
+  std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  FixedInputPortValue& input =
+      system.get_input_port(0).FixValue(context.get(), VectorXd::Ones(6));
+  DummyImplicitIntegrator integrator(system, context.get());
+  integrator.set_num_jacobian_threads(3);
+  const VectorXd x = VectorXd::LinSpaced(6, -1, 1);
+  for (double scale : {1.0, 2.0, 3.0}) {
+    const VectorXd u = scale * VectorXd::LinSpaced(6, 1, 2);
+    input.GetMutableVectorData<double>()->SetFromVector(u);
+    const MatrixXd J = integrator.CalcJacobian(0.0, x);
+    EXPECT_TRUE(CompareMatrices(J, MatrixXd((-u).asDiagonal()), 1e-6));
+  }
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
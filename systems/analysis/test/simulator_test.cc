@@ -156,6 +156,46 @@ GTEST_TEST(SimulatorTest, NoContinuousStateYieldsSingleStep) {
   EXPECT_EQ(simulator.get_num_steps_taken(), 1);
 }
 
+// Tests that the simulator records its System computations only while
+// profiling is enabled.
+GTEST_TEST(SimulatorTest, Profiling) {
+  DiagramBuilder<double> builder;
+  auto* source = builder.AddSystem<ConstantVectorSource<double>>(1.0);
+  source->set_name("source");
+  auto* integrator = builder.AddSystem<Integrator<double>>(1);
+  integrator->set_name("integrator");
+  builder.Connect(*source, *integrator);
+  auto diagram = builder.Build();
+  diagram->set_name("diagram");
+
+  Simulator<double> simulator(*diagram);
+  simulator.reset_integrator<RungeKutta2Integrator<double>>(0.01);
+  EXPECT_FALSE(simulator.get_profiling_enabled());
+  simulator.AdvanceTo(0.1);
+  EXPECT_TRUE(simulator.get_profiler().GetStatistics().empty());
+
+  simulator.set_profiling_enabled(true);
+  EXPECT_TRUE(simulator.get_profiling_enabled());
+  simulator.AdvanceTo(0.2);
+  simulator.set_profiling_enabled(false);
+  simulator.AdvanceTo(0.3);
+
+  // RK2 computes the derivatives twice per step.
+  int64_t num_integrator_derivatives = 0;
+  for (const auto& stats : simulator.get_profiler().GetStatistics()) {
+    if (stats.system_pathname == "::diagram::integrator" &&
+        stats.category == SystemProfiler::Category::kTimeDerivatives) {
+      num_integrator_derivatives = stats.num_computations;
+    }
+  }
+  EXPECT_EQ(num_integrator_derivatives, 2 * 10);
+  EXPECT_NE(simulator.get_profiler().GetSummary().find("::diagram::source"),
+            std::string::npos);
+
+  simulator.get_mutable_profiler().Clear();
+  EXPECT_EQ(simulator.get_profiler().num_trace_events(), 0);
+}
+
 // Tests ability of simulation to identify the proper number of witness function
 // triggerings going from negative to non-negative witness function evaluation
 // using a Diagram. This particular example uses an empty system and a clock as
@@ -5,11 +5,13 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/systems/analysis/implicit_integrator.h"
 #include "drake/systems/analysis/test_utilities/discontinuous_spring_mass_damper_system.h"
 #include "drake/systems/analysis/test_utilities/linear_scalar_system.h"
 #include "drake/systems/analysis/test_utilities/robertson_system.h"
+#include "drake/systems/analysis/test_utilities/spring_mass_damper_chain_system.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_damper_system.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_system.h"
 #include "drake/systems/analysis/test_utilities/stationary_system.h"
@@ -1089,6 +1091,49 @@ TYPED_TEST_P(ImplicitIntegratorTest, LinearTest) {
   }
 }
 
+// Verifies that exploiting the sparsity of the Jacobian matrix gives the same
+// solution as the dense Jacobian matrix, for every Jacobian computation scheme,
+// and that it reduces the number of derivative evaluations spent on numerical
+// Jacobian matrices.
+TYPED_TEST_P(ImplicitIntegratorTest, SparseJacobian) {
+  using Integrator = TypeParam;
+  using JacobianScheme = typename Integrator::JacobianComputationScheme;
+  const analysis::test::SpringMassDamperChainSystem<double> chain(
+      20 /* num_masses */, 100.0 /* spring constant */,
+      1.0 /* damping constant */);
+  for (JacobianScheme scheme : {JacobianScheme::kForwardDifference,
+                                JacobianScheme::kCentralDifference,
+                                JacobianScheme::kAutomatic}) {
+    VectorX<double> x_final[2];
+    int64_t num_jacobian_evaluations[2];
+    int64_t num_jacobian_function_evaluations[2];
+    for (bool sparse : {false, true}) {
+      std::unique_ptr<Context<double>> context = chain.CreateDefaultContext();
+      chain.SetDisplacedState(context.get());
+      Integrator integrator(chain, context.get());
+      integrator.set_jacobian_computation_scheme(scheme);
+      integrator.set_use_sparse_jacobian(sparse);
+      EXPECT_EQ(integrator.get_use_sparse_jacobian(), sparse);
+      integrator.set_reuse(false);
+      integrator.set_maximum_step_size(1e-2);
+      integrator.set_fixed_step_mode(true);
+      integrator.Initialize();
+      integrator.IntegrateWithMultipleStepsToTime(0.5);
+      x_final[sparse] = context->get_continuous_state_vector().CopyToVector();
+      num_jacobian_evaluations[sparse] =
+          integrator.get_num_jacobian_evaluations();
+      num_jacobian_function_evaluations[sparse] =
+          integrator.get_num_derivative_evaluations_for_jacobian();
+    }
+    EXPECT_TRUE(CompareMatrices(x_final[true], x_final[false], 1e-8));
+    EXPECT_EQ(num_jacobian_evaluations[true], num_jacobian_evaluations[false]);
+    if (scheme != JacobianScheme::kAutomatic) {
+      EXPECT_LT(2 * num_jacobian_function_evaluations[true],
+                num_jacobian_function_evaluations[false]);
+    }
+  }
+}
+
 TYPED_TEST_P(ImplicitIntegratorTest, DoubleSpringMassDamperNoReuse) {
   this->DoubleSpringMassDamperTest(kNoReuse);
 }
@@ -1140,7 +1185,8 @@ TYPED_TEST_P(ImplicitIntegratorTest, SpringMassStepAccuracyEffectsReuse) {
 REGISTER_TYPED_TEST_SUITE_P(
     ImplicitIntegratorTest, Reuse, FullNewton, MiscAPINoReuse, MiscAPIReuse,
     Stationary, Robertson, FixedStepThrowsOnMultiStep, ContextAccess,
-    AccuracyEstAndErrorControl, LinearTest, DoubleSpringMassDamperNoReuse,
+    AccuracyEstAndErrorControl, LinearTest, SparseJacobian,
+    DoubleSpringMassDamperNoReuse,
     DoubleSpringMassDamperReuse, SpringMassDamperStiffNoReuse,
     SpringMassDamperStiffReuse, DiscontinuousSpringMassDamperNoReuse,
     DiscontinuousSpringMassDamperReuse, SpringMassStepNoReuse,
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cmath>
+
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace test {
+
+/// A chain of n unit point masses, connected to each other and (at both
+/// ends) to the walls by identical springs and dampers. The system of ODEs
+/// follows:<pre>
+/// ẍᵢ = -k (2xᵢ - xᵢ₋₁ - xᵢ₊₁) - b (2ẋᵢ - ẋᵢ₋₁ - ẋᵢ₊₁)
+/// </pre>
+/// where x₀ = xₙ₊₁ = 0 are the walls, k is the spring constant, and b is the
+/// damping constant. The Jacobian matrix of the time derivatives is sparse
+/// (every block is tridiagonal), which makes this system useful for testing
+/// sparse Jacobian computations in implicit integrators.
+template <class T>
+class SpringMassDamperChainSystem : public LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SpringMassDamperChainSystem)
+
+  SpringMassDamperChainSystem(int num_masses, double spring_constant,
+                              double damping_constant)
+      : LeafSystem<T>(SystemTypeTag<SpringMassDamperChainSystem>{}),
+        num_masses_(num_masses),
+        spring_constant_(spring_constant),
+        damping_constant_(damping_constant) {
+    this->DeclareContinuousState(num_masses /* num_q */,
+                                 num_masses /* num_v */, 0 /* num_z */);
+  }
+
+  /// Scalar-converting copy constructor. See @ref system_scalar_conversion.
+  template <typename U>
+  explicit SpringMassDamperChainSystem(
+      const SpringMassDamperChainSystem<U>& other)
+      : SpringMassDamperChainSystem(other.num_masses(),
+                                    other.spring_constant(),
+                                    other.damping_constant()) {}
+
+  int num_masses() const { return num_masses_; }
+  double spring_constant() const { return spring_constant_; }
+  double damping_constant() const { return damping_constant_; }
+
+  /// Sets the masses to a non-equilibrium state: mass i is displaced by
+  /// sin(i) and is at rest.
+  void SetDisplacedState(Context<T>* context) const {
+    VectorX<T> x = VectorX<T>::Zero(2 * num_masses_);
+    for (int i = 0; i < num_masses_; ++i) {
+      x(i) = std::sin(static_cast<double>(i + 1));
+    }
+    context->SetContinuousState(x);
+  }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const override {
+    const VectorX<T> x = context.get_continuous_state_vector().CopyToVector();
+    const int n = num_masses_;
+    VectorX<T> xdot(2 * n);
+    xdot.head(n) = x.tail(n);
+    for (int i = 0; i < n; ++i) {
+      // Returns the position (or velocity) of mass j, or zero for the walls.
+      auto at = [&x, n](int offset, int j) {
+        return (j < 0 || j >= n) ? T(0) : x(offset + j);
+      };
+      xdot(n + i) =
+          -spring_constant_ * (2 * at(0, i) - at(0, i - 1) - at(0, i + 1)) -
+          damping_constant_ * (2 * at(n, i) - at(n, i - 1) - at(n, i + 1));
+    }
+    derivatives->SetFromVector(xdot);
+  }
+
+  const int num_masses_;
+  const double spring_constant_;
+  const double damping_constant_;
+};
+
+}  // namespace test
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
@@ -62,6 +62,7 @@ void VelocityImplicitEulerIntegrator<T>::DoInitialize() {
 
   // Reset the Jacobian matrix (so that recomputation is forced).
   this->Jy_vie_.resize(0, 0);
+  velocity_jacobian_sparsity_.reset();
 }
 
 template <class T>
@@ -90,6 +91,41 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
   // Get the existing number of ODE evaluations.
   int64_t existing_ODE_evals = this->get_num_derivative_evaluations();
 
+  if (!this->get_use_sparse_jacobian()) {
+    ComputeVelocityJacobian(t, h, y, qk, qn, nullptr, Jy);
+  } else {
+    // Find the sparsity pattern by probing; the evaluations needed for that
+    // are counted as Jacobian function evaluations. The positions are
+    // perturbed for the second probe too, since N(q) can have zero entries
+    // at particular configurations (e.g., the identity quaternion).
+    if (!velocity_jacobian_sparsity_.has_value() ||
+        velocity_jacobian_sparsity_->size() != y.size()) {
+      const VectorX<T> qk_probe =
+          ImplicitIntegrator<T>::PerturbForSparsityProbe(qk);
+      MatrixX<T> J, J_probe;
+      ComputeVelocityJacobian(t, h, y, qk, qn, nullptr, &J);
+      ComputeVelocityJacobian(
+          t, h, ImplicitIntegrator<T>::PerturbForSparsityProbe(y), qk_probe,
+          qn, nullptr, &J_probe);
+      velocity_jacobian_sparsity_.emplace(
+          (J.array() != 0.0 || J_probe.array() != 0.0).matrix());
+    }
+    ComputeVelocityJacobian(t, h, y, qk, qn, &*velocity_jacobian_sparsity_,
+                            Jy);
+  }
+
+  // Use the new number of ODE evaluations to determine the number of ODE
+  // evaluations used in computing Jacobians.
+  this->increment_jacobian_computation_derivative_evaluations(
+      this->get_num_derivative_evaluations() - existing_ODE_evals);
+}
+
+template <class T>
+void VelocityImplicitEulerIntegrator<T>::ComputeVelocityJacobian(
+    const T& t, const T& h, const VectorX<T>& y, const VectorX<T>& qk,
+    const VectorX<T>& qn,
+    const typename ImplicitIntegrator<T>::JacobianSparsity* sparsity,
+    MatrixX<T>* Jy) {
   // Compute the Jacobian using the selected computation scheme.
   if (this->get_jacobian_computation_scheme() ==
       ImplicitIntegrator<T>::JacobianComputationScheme::kForwardDifference ||
@@ -105,10 +141,16 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
               this->ComputeLOfY(t, y_state, qk, qn, h, this->qdot_.get());
         };
 
+    const bool central = this->get_jacobian_computation_scheme() ==
+        ImplicitIntegrator<T>::JacobianComputationScheme::kCentralDifference;
+    if (sparsity != nullptr) {
+      ImplicitIntegrator<T>::ComputeColoredDiffJacobian(l_of_y, y, *sparsity,
+                                                        central, Jy);
+      return;
+    }
+
     const math::NumericalGradientOption numerical_gradient_method(
-        (this->get_jacobian_computation_scheme() ==
-        ImplicitIntegrator<T>::JacobianComputationScheme::kCentralDifference) ?
-        math::NumericalGradientMethod::kCentral :
+        central ? math::NumericalGradientMethod::kCentral :
         math::NumericalGradientMethod::kForward);
 
     // Compute Jy by passing ℓ(y) to math::ComputeNumericalGradient().
@@ -125,21 +167,17 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
       this->get_jacobian_computation_scheme() ==
       ImplicitIntegrator<T>::JacobianComputationScheme::kAutomatic) {
     // Compute the Jacobian using automatic differentiation.
-    this->ComputeAutoDiffVelocityJacobian(t, h, y, qk, qn, Jy);
+    this->ComputeAutoDiffVelocityJacobian(t, h, y, qk, qn, Jy, sparsity);
   } else {
     throw new std::logic_error("Invalid Jacobian computation scheme.");
   }
-
-  // Use the new number of ODE evaluations to determine the number of ODE
-  // evaluations used in computing Jacobians.
-  this->increment_jacobian_computation_derivative_evaluations(
-      this->get_num_derivative_evaluations() - existing_ODE_evals);
 }
 
 template <class T>
 void VelocityImplicitEulerIntegrator<T>::ComputeAutoDiffVelocityJacobian(
     const T& t, const T& h, const VectorX<T>& y, const VectorX<T>& qk,
-    const VectorX<T>& qn, MatrixX<T>* Jy) {
+    const VectorX<T>& qn, MatrixX<T>* Jy,
+    const typename ImplicitIntegrator<T>::JacobianSparsity* sparsity) {
   DRAKE_LOGGER_DEBUG(
       "VelocityImplicitEulerIntegrator ComputeAutoDiffVelocityJacobian "
       "{}-Jacobian t={}", y.size(), t);
@@ -165,13 +203,19 @@ void VelocityImplicitEulerIntegrator<T>::ComputeAutoDiffVelocityJacobian(
   }
 
   // Initialize an AutoDiff version of the variable y.
-  VectorX<AutoDiffXd> y_ad = math::InitializeAutoDiff(y);
+  VectorX<AutoDiffXd> y_ad = sparsity != nullptr ?
+      ImplicitIntegrator<T>::InitializeColoredAutoDiff(y, *sparsity) :
+      math::InitializeAutoDiff(y);
 
   // Evaluate the AutoDiff system with y_ad.
   const VectorX<AutoDiffXd> result = this->ComputeLOfY(
       t, y_ad, qk, qn, h, this->qdot_ad_.get(),
       *(this->system_ad_), this->context_ad_.get());
 
+  if (sparsity != nullptr) {
+    ImplicitIntegrator<T>::ExtractColoredJacobian(result, *sparsity, Jy);
+    return;
+  }
   *Jy = math::ExtractGradient(result);
 
   // Sometimes ℓ(y) does not depend on, for example, when ℓ(y) is a constant or
@@ -198,6 +242,8 @@ bool VelocityImplicitEulerIntegrator<T>::MaybeFreshenVelocityMatrices(
     MatrixX<T>* Jy) {
   DRAKE_DEMAND(Jy != nullptr);
   DRAKE_DEMAND(iteration_matrix != nullptr);
+  iteration_matrix->set_use_sparse_factorization(
+      this->get_use_sparse_jacobian());
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
   if (!this->get_reuse() || Jy->rows() == 0 || this->IsBadJacobian(*Jy)) {
@@ -275,6 +321,8 @@ void VelocityImplicitEulerIntegrator<T>::FreshenVelocityMatricesIfFullNewton(
 
   // Return immediately if full-Newton is not in use.
   if (!this->get_use_full_newton()) return;
+  iteration_matrix->set_use_sparse_factorization(
+      this->get_use_sparse_jacobian());
 
   // Compute the initial Jacobian and iteration matrices and factor them.
   CalcVelocityJacobian(t, h, y, qk, qn, Jy);
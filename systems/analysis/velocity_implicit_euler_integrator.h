@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <stdexcept>
 
 #include "drake/common/autodiff.h"
@@ -328,6 +329,7 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   void DoResetCachedJacobianRelatedMatrices() final {
       Jy_vie_.resize(0, 0);
       iteration_matrix_vie_ = {};
+      velocity_jacobian_sparsity_.reset();
   }
 
   void DoResetImplicitIntegratorStatistics() final;
@@ -430,6 +432,17 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
                             const VectorX<T>& qk, const VectorX<T>& qn,
                             MatrixX<T>* Jy);
 
+  // Computes Jₗ(y) with the selected Jacobian computation scheme, for
+  // CalcVelocityJacobian(). The arguments are the same as for
+  // CalcVelocityJacobian(), plus:
+  // @param sparsity if non-null, the sparsity pattern of Jₗ(y), whose column
+  //        coloring is used to compute Jₗ(y) with fewer evaluations of ℓ(y).
+  void ComputeVelocityJacobian(
+      const T& t, const T& h, const VectorX<T>& y, const VectorX<T>& qk,
+      const VectorX<T>& qn,
+      const typename ImplicitIntegrator<T>::JacobianSparsity* sparsity,
+      MatrixX<T>* Jy);
+
   // Uses automatic differentiation to compute the Jacobian, Jₗ(y), of the
   // function ℓ(y), used in this integrator's residual computation, with
   // respect to y, where y = (v,z). This Jacobian is then defined as:
@@ -446,13 +459,15 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   //        ℓ(y).
   // @param qn refers to qⁿ, the initial position used in ℓ(y).
   // @param [out] Jy is the Jacobian matrix, Jₗ(y).
+  // @param sparsity if non-null, the AutoDiff derivatives are taken with
+  //        respect to its colors rather than to each entry of y.
   // @note The context's time will be set to t, and its continuous state will
   //       be indeterminate on return.
-  void ComputeAutoDiffVelocityJacobian(const T& t, const T& h,
-                                       const VectorX<T>& y,
-                                       const VectorX<T>& qk,
-                                       const VectorX<T>& qn,
-                                       MatrixX<T>* Jy);
+  void ComputeAutoDiffVelocityJacobian(
+      const T& t, const T& h, const VectorX<T>& y, const VectorX<T>& qk,
+      const VectorX<T>& qn, MatrixX<T>* Jy,
+      const typename ImplicitIntegrator<T>::JacobianSparsity* sparsity =
+          nullptr);
 
   // Computes necessary matrices (Jacobian and iteration matrix) for
   // Newton-Raphson (NR) iterations, as necessary. This method is based off of
@@ -640,6 +655,11 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   // The last computed velocity+misc Jacobian matrix.
   MatrixX<T> Jy_vie_;
 
+  // The sparsity pattern of Jy_vie_, computed by the first
+  // CalcVelocityJacobian() when the sparse Jacobian is in use.
+  std::optional<typename ImplicitIntegrator<T>::JacobianSparsity>
+      velocity_jacobian_sparsity_;
+
   // Various statistics.
   int64_t num_nr_iterations_{0};
 
@@ -662,7 +682,8 @@ inline void VelocityImplicitEulerIntegrator<AutoDiffXd>::
                                     const VectorX<AutoDiffXd>&,
                                     const VectorX<AutoDiffXd>&,
                                     const VectorX<AutoDiffXd>&,
-                                    MatrixX<AutoDiffXd>*) {
+                                    MatrixX<AutoDiffXd>*,
+                                    const JacobianSparsity*) {
   throw std::runtime_error("AutoDiff'd Jacobian not supported for "
                            "AutoDiff'd VelocityImplicitEulerIntegrator");
 }
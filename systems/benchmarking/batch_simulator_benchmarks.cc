@@ -0,0 +1,152 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/systems/analysis/batch_simulator.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/analysis/simulator_config_functions.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/tools/performance/fixture_common.h"
+
+/* Compares simulating many copies of a small system in lock step with
+BatchSimulator against simulating each copy with its own Simulator. */
+
+namespace drake {
+namespace systems {
+namespace analysis {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+// A damped pendulum θ̈ = -sin(θ) - bθ̇, with the damping b as a numeric
+// parameter, whose BatchDynamics can be turned off.
+class Pendulum final : public LeafSystem<double>, public BatchDynamics {
+ public:
+  explicit Pendulum(bool batched) : batched_(batched) {
+    DeclareContinuousState(1, 1, 0);
+    DeclareNumericParameter(BasicVector<double>(Vector1d(0.1)));
+  }
+
+  bool CalcBatchTimeDerivatives(
+      const std::vector<const Context<double>*>& contexts, double,
+      const MatrixXd& continuous_states, const MatrixXd&,
+      MatrixXd* derivatives) const final {
+    if (!batched_) return false;
+    damping_.resize(contexts.size());
+    for (int i = 0; i < damping_.size(); ++i) {
+      damping_(i) = contexts[i]->get_numeric_parameter(0)[0];
+    }
+    derivatives->col(0) = continuous_states.col(1);
+    derivatives->col(1) =
+        -continuous_states.col(0).array().sin() -
+        damping_.array() * continuous_states.col(1).array();
+    return true;
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    const VectorBase<double>& x = context.get_continuous_state_vector();
+    const double b = context.get_numeric_parameter(0)[0];
+    derivatives->get_mutable_vector().SetAtIndex(0, x[1]);
+    derivatives->get_mutable_vector().SetAtIndex(
+        1, -std::sin(x[0]) - b * x[1]);
+  }
+
+  const bool batched_;
+  mutable VectorXd damping_;
+};
+
+// Sets the initial conditions and damping of copy i.
+void SetCopy(int i, Context<double>* context) {
+  context->SetTime(0.0);
+  context->SetContinuousState(Eigen::Vector2d(1.0 + 0.001 * i, 0.0));
+  context->get_mutable_numeric_parameter(0)[0] = 0.1 + 0.0001 * i;
+}
+
+// The argument is the number of copies, each simulated for one second with
+// fixed steps of 1 ms using the second order Runge-Kutta method.
+class BatchFixture : public benchmark::Fixture {
+ public:
+  BatchFixture() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+ protected:
+  static constexpr double kTimeStep = 1e-3;
+  static constexpr double kDuration = 1.0;
+
+  // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+  void RunBatch(bool batched, benchmark::State& state) {
+    const Pendulum pendulum(batched);
+    BatchSimulator simulator(pendulum, state.range(0), kTimeStep,
+                             "runge_kutta2");
+    for (auto _ : state) {
+      for (int i = 0; i < simulator.num_copies(); ++i) {
+        SetCopy(i, &simulator.get_mutable_context(i));
+      }
+      simulator.AdvanceTo(kDuration);
+    }
+  }
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(BatchFixture, IndependentSimulators)(
+    benchmark::State& state) {
+  const Pendulum pendulum(false);
+  SimulatorConfig config;
+  config.integration_scheme = "runge_kutta2";
+  config.max_step_size = kTimeStep;
+  config.use_error_control = false;
+  std::vector<std::unique_ptr<Simulator<double>>> simulators;
+  for (int i = 0; i < state.range(0); ++i) {
+    simulators.push_back(std::make_unique<Simulator<double>>(pendulum));
+    ApplySimulatorConfig(config, simulators.back().get());
+  }
+  for (auto _ : state) {
+    for (int i = 0; i < static_cast<int>(simulators.size()); ++i) {
+      SetCopy(i, &simulators[i]->get_mutable_context());
+      simulators[i]->Initialize();
+      simulators[i]->AdvanceTo(kDuration);
+    }
+  }
+}
+BENCHMARK_REGISTER_F(BatchFixture, IndependentSimulators)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(BatchFixture, BatchSimulatorPerCopy)(
+    benchmark::State& state) {
+  RunBatch(false, state);
+}
+BENCHMARK_REGISTER_F(BatchFixture, BatchSimulatorPerCopy)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(BatchFixture, BatchSimulatorBatched)(
+    benchmark::State& state) {
+  RunBatch(true, state);
+}
+BENCHMARK_REGISTER_F(BatchFixture, BatchSimulatorBatched)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(1)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000);
+
+}  // namespace
+}  // namespace analysis
+}  // namespace systems
+}  // namespace drake
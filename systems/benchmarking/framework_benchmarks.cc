@@ -1,6 +1,9 @@
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/primitives/pass_through.h"
 #include "drake/tools/performance/fixture_common.h"
 
@@ -62,6 +65,179 @@ BENCHMARK_F(BasicFixture, PassThrough3)(benchmark::State& state) {
   }
 }
 
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(BasicFixture, PassThroughChain100)(benchmark::State& state) {
+  // A deep diagram, as left by model composition, in which a signal passes
+  // through a long chain of PassThroughs between its producer and consumer.
+  const int n = 7;
+  auto* producer = builder_->AddSystem<PassThrough<double>>(n);
+  builder_->ExportInput(producer->get_input_port());
+  const System<double>* previous = producer;
+  for (int i = 0; i < 100; ++i) {
+    auto* next = builder_->AddSystem<PassThrough<double>>(n);
+    builder_->Cascade(*previous, *next);
+    previous = next;
+  }
+  builder_->ExportOutput(previous->get_output_port(0));
+  Build();
+
+  Eigen::VectorXd value = Eigen::VectorXd::Constant(n, 22.2);
+  auto& input = diagram_->get_input_port().FixValue(context_.get(), value);
+  auto& output = diagram_->get_output_port();
+
+  for (auto _ : state) {
+    // As above, the input changes on every tick.
+    input.GetMutableData();
+    output.Eval(*context_);
+  }
+}
+
+// A stand-in for systems like MultibodyPlant and SceneGraph whose contexts
+// hold a little numeric state and large abstract values that are rarely
+// written.
+class BigAbstractValuesSystem final : public LeafSystem<double> {
+ public:
+  BigAbstractValuesSystem() {
+    this->DeclareContinuousState(7, 7, 0);
+    this->DeclareAbstractState(
+        Value<std::vector<double>>(std::vector<double>(10'000, 1.0)));
+    this->DeclareAbstractParameter(
+        Value<std::vector<double>>(std::vector<double>(100'000, 1.0)));
+  }
+};
+
+class CloneFixture : public BasicFixture {
+ public:
+  using BasicFixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    BasicFixture::SetUp(state);
+    for (int i = 0; i < 4; ++i) {
+      builder_->AddSystem<BigAbstractValuesSystem>();
+    }
+    Build();
+  }
+
+  // Mimics a rollout step, which only changes the numeric state.
+  void Step(Context<double>* context) {
+    context->SetTime(context->get_time() + 0.01);
+    context->get_mutable_continuous_state_vector()[0] += 1.0;
+  }
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(CloneFixture, Clone)(benchmark::State& state) {
+  for (auto _ : state) {
+    auto clone = context_->Clone();
+    Step(clone.get());
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(CloneFixture, CloneCopyOnWrite)(benchmark::State& state) {
+  for (auto _ : state) {
+    auto clone = context_->CloneCopyOnWrite();
+    Step(clone.get());
+  }
+}
+
+// Both restore benchmarks copy the same data (time and state) back from a
+// snapshot; they only differ in how the snapshot was taken.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(CloneFixture, RestoreState)(benchmark::State& state) {
+  auto saved = context_->Clone();
+  for (auto _ : state) {
+    Step(context_.get());
+    context_->SetTime(saved->get_time());
+    context_->SetStateFrom(*saved);
+  }
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(CloneFixture, RestoreStateCopyOnWrite)(benchmark::State& state) {
+  auto saved = context_->CloneCopyOnWrite();
+  for (auto _ : state) {
+    Step(context_.get());
+    context_->SetTime(saved->get_time());
+    context_->SetStateFrom(*saved);
+  }
+}
+
+// A controller with one periodic discrete update, as in a multi-rate diagram
+// of many sensors and controllers. Unless `only_periodic` is false, it lets
+// its Diagram predict its update times from its periodic event timing.
+class PeriodicSystem final : public LeafSystem<double> {
+ public:
+  explicit PeriodicSystem(double period, bool only_periodic = true) {
+    this->DeclareDiscreteState(1);
+    this->DeclarePeriodicDiscreteUpdateEvent(period, 0.0,
+                                             &PeriodicSystem::Update);
+    if (only_periodic) {
+      this->DeclareOnlyPeriodicUpdateTimes();
+    }
+  }
+
+ private:
+  void Update(const Context<double>&, DiscreteValues<double>*) const {}
+};
+
+class PeriodicFixture : public BasicFixture {
+ protected:
+  // Builds the diagram, then measures CalcNextUpdateTime() at successive
+  // update times.
+  // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+  void BuildAndMeasureCalcNextUpdateTime(benchmark::State& state) {
+    Build();
+    auto events = diagram_->AllocateCompositeEventCollection();
+
+    // Contexts at successive update times, so that the loop doesn't measure
+    // SetTime().
+    std::vector<std::unique_ptr<Context<double>>> contexts;
+    for (int i = 0; i < 60; ++i) {
+      contexts.push_back(context_->Clone());
+      context_->SetTime(
+          diagram_->CalcNextUpdateTime(*context_, events.get()));
+    }
+    size_t k = 0;
+    for (auto _ : state) {
+      diagram_->CalcNextUpdateTime(*contexts[k], events.get());
+      k = (k + 1) % contexts.size();
+    }
+  }
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(PeriodicFixture, CalcNextUpdateTime300Periodic)(
+    benchmark::State& state) {
+  // Five rates shared by 300 subsystems.
+  for (int i = 0; i < 300; ++i) {
+    builder_->AddSystem<PeriodicSystem>(0.001 * (1 + i % 5));
+  }
+  BuildAndMeasureCalcNextUpdateTime(state);
+}
+
+// The Diagram finds the next periodic update time by scanning its distinct
+// event timings. The next two cases bound what a priority queue of timings
+// could save: here every one of the 300 subsystems has its own rate, so the
+// scan is as long as it can be, and the case after it asks each subsystem
+// instead, as when none of them declare only periodic update times.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(PeriodicFixture, CalcNextUpdateTime300DistinctPeriodic)(
+    benchmark::State& state) {
+  for (int i = 0; i < 300; ++i) {
+    builder_->AddSystem<PeriodicSystem>(0.001 * (1 + 0.01 * i));
+  }
+  BuildAndMeasureCalcNextUpdateTime(state);
+}
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(PeriodicFixture, CalcNextUpdateTime300DistinctUnscheduled)(
+    benchmark::State& state) {
+  for (int i = 0; i < 300; ++i) {
+    builder_->AddSystem<PeriodicSystem>(0.001 * (1 + 0.01 * i), false);
+  }
+  BuildAndMeasureCalcNextUpdateTime(state);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
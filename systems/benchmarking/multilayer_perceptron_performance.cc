@@ -4,9 +4,15 @@
 
  time bazel-bin/systems/primitives/multilayer_perceptron_performance \
   --batch_size=1000 --iterations=10
+
+ Each method reports its throughput in batch columns per second; compare e.g.
+ --num_threads=1 and --num_threads=4 with --batch_size=100000.
 */
 
+#include <chrono>
+
 #include "systems/primitives/multilayer_perceptron.h"
+#include <fmt/format.h>
 #include <gflags/gflags.h>
 
 namespace drake {
@@ -21,6 +27,9 @@ using Eigen::VectorXd;
 DEFINE_int32(batch_size, 2, "Number of batch evaluations.");
 DEFINE_int32(width, 256, "Number of units in each hidden layer.");
 DEFINE_int32(iterations, 2, "Number of times to call the method.");
+DEFINE_int32(num_threads, 1,
+             "Number of threads for the batch methods; see "
+             "MultilayerPerceptron::set_num_batch_threads().");
 DEFINE_string(method, "all",
               "Restrict the run to one API method.\n"
               "[--method={all,backprop,output,output_gradient}]\n"
@@ -35,6 +44,7 @@ int do_main() {
   const int num_inputs{10};
   // Use 1 output so that we can call BatchOutput with gradients.
   MultilayerPerceptron<double> mlp({num_inputs, FLAGS_width, FLAGS_width, 1});
+  mlp.set_num_batch_threads(FLAGS_num_threads);
 
   auto context = mlp.CreateDefaultContext();
   RandomGenerator generator(243);
@@ -46,20 +56,34 @@ int do_main() {
   RowVectorXd Yd = RowVectorXd::Ones(FLAGS_batch_size);
   MatrixXd dYdX(num_inputs, FLAGS_batch_size);
 
-  if (FLAGS_method == "backprop" || FLAGS_method == "all") {
+  // Calls `method` FLAGS_iterations times and prints the throughput.
+  const auto measure = [](const std::string& name, const auto& method) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
     for (int i = 0; i < FLAGS_iterations; ++i) {
-      mlp.BackpropagationMeanSquaredError(*context, X, Yd, &dloss_dparams);
+      method();
     }
+    const double seconds =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    fmt::print("{}: {:.3g} s, {:.4g} columns/s\n", name, seconds,
+               static_cast<double>(FLAGS_batch_size) * FLAGS_iterations /
+                   seconds);
+  };
+
+  if (FLAGS_method == "backprop" || FLAGS_method == "all") {
+    measure("backprop", [&]() {
+      mlp.BackpropagationMeanSquaredError(*context, X, Yd, &dloss_dparams);
+    });
   }
   if (FLAGS_method == "output" || FLAGS_method == "all") {
-    for (int i = 0; i < FLAGS_iterations; ++i) {
+    measure("output", [&]() {
       mlp.BatchOutput(*context, X, &Y);
-    }
+    });
   }
   if (FLAGS_method == "output_gradient" || FLAGS_method == "all") {
-    for (int i = 0; i < FLAGS_iterations; ++i) {
+    measure("output_gradient", [&]() {
       mlp.BatchOutput(*context, X, &Y, &dYdX);
-    }
+    });
   }
   return 0;
 }
@@ -1,19 +1,28 @@
 #include "drake/systems/framework/abstract_values.h"
 
+#include <atomic>
 #include <utility>
 
 namespace drake {
 namespace systems {
+namespace {
+
+// The number of live ScopedCopyOnWriteClone objects on this thread.
+thread_local int copy_on_write_clone_depth = 0;
+
+}  // namespace
 
 AbstractValues::~AbstractValues() {}
 
 AbstractValues::AbstractValues() {}
 
 AbstractValues::AbstractValues(
-    std::vector<std::unique_ptr<AbstractValue>>&& data)
-    : owned_data_(std::move(data)) {
-  for (auto& datum : owned_data_) {
+    std::vector<std::unique_ptr<AbstractValue>>&& data) {
+  owned_data_.reserve(data.size());
+  data_.reserve(data.size());
+  for (auto& datum : data) {
     data_.push_back(datum.get());
+    owned_data_.push_back(std::move(datum));
   }
 }
 
@@ -26,36 +35,153 @@ AbstractValues::AbstractValues(std::unique_ptr<AbstractValue> datum)
   owned_data_.push_back(std::move(datum));
 }
 
-int AbstractValues::size() const { return static_cast<int>(data_.size()); }
+std::unique_ptr<AbstractValues> AbstractValues::MakeSpanningView(
+    const std::vector<AbstractValues*>& sources) {
+  auto result = std::make_unique<AbstractValues>();
+  for (AbstractValues* source : sources) {
+    DRAKE_DEMAND(source != nullptr);
+    for (int i = 0; i < source->size(); ++i) {
+      result->spanned_.emplace_back(source, i);
+    }
+  }
+  return result;
+}
+
+int AbstractValues::size() const {
+  return static_cast<int>(spanned_.empty() ? data_.size() : spanned_.size());
+}
 
 const AbstractValue& AbstractValues::get_value(int index) const {
   DRAKE_ASSERT(index >= 0 && index < size());
+  if (!spanned_.empty()) {
+    const auto& [source, source_index] = spanned_[index];
+    return source->get_value(source_index);
+  }
   DRAKE_ASSERT(data_[index] != nullptr);
   return *data_[index];
 }
 
 AbstractValue& AbstractValues::get_mutable_value(int index) {
   DRAKE_ASSERT(index >= 0 && index < size());
+  if (!spanned_.empty()) {
+    const auto& [source, source_index] = spanned_[index];
+    return source->get_mutable_value(source_index);
+  }
+  Unshare(index);
+  DRAKE_ASSERT(data_[index] != nullptr);
+  return *data_[index];
+}
+
+const AbstractValue& AbstractValues::get_unshared_value(int index) const {
+  DRAKE_ASSERT(index >= 0 && index < size());
+  if (!spanned_.empty()) {
+    const auto& [source, source_index] = spanned_[index];
+    return source->get_unshared_value(source_index);
+  }
+  Unshare(index);
+  DRAKE_ASSERT(data_[index] != nullptr);
+  return *data_[index];
+}
+
+const AbstractValue& AbstractValues::get_unshared_value(
+    int index,
+    const std::function<std::unique_ptr<AbstractValue>(const AbstractValue&)>&
+        make_copy) const {
+  DRAKE_ASSERT(index >= 0 && index < size());
+  DRAKE_DEMAND(make_copy != nullptr);
+  if (!spanned_.empty()) {
+    const auto& [source, source_index] = spanned_[index];
+    return source->get_unshared_value(source_index, make_copy);
+  }
+  Unshare(index, make_copy);
   DRAKE_ASSERT(data_[index] != nullptr);
   return *data_[index];
 }
 
+bool AbstractValues::is_shared(int index) const {
+  DRAKE_ASSERT(index >= 0 && index < size());
+  if (!spanned_.empty()) {
+    const auto& [source, source_index] = spanned_[index];
+    return source->is_shared(source_index);
+  }
+  return !owned_data_.empty() && owned_data_[index].use_count() > 1;
+}
+
+void AbstractValues::Unshare(
+    int index,
+    const std::function<std::unique_ptr<AbstractValue>(const AbstractValue&)>&
+        make_copy) const {
+  if (owned_data_.empty()) {
+    return;
+  }
+  std::shared_ptr<AbstractValue>& owned = owned_data_[index];
+  if (owned.use_count() > 1) {
+    owned = make_copy ? make_copy(*owned) : owned->Clone();
+    DRAKE_DEMAND(owned != nullptr);
+    data_[index] = owned.get();
+  } else {
+    // Another AbstractValues may have just released its share of this
+    // element on another thread; make sure its reads of the element happen
+    // before our writes.
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+}
+
 void AbstractValues::SetFrom(const AbstractValues& other) {
   DRAKE_ASSERT(size() == other.size());
   for (int i = 0; i < size(); i++) {
-    DRAKE_ASSERT(data_[i] != nullptr);
-    data_[i]->SetFrom(other.get_value(i));
+    const AbstractValue& source = other.get_value(i);
+    if (&source == &get_value(i)) {
+      continue;
+    }
+    get_mutable_value(i).SetFrom(source);
   }
 }
 
 std::unique_ptr<AbstractValues> AbstractValues::Clone() const {
-  std::vector<std::unique_ptr<AbstractValue>> cloned_data;
-  cloned_data.reserve(data_.size());
-  for (const AbstractValue* datum : data_) {
-    cloned_data.push_back(datum->Clone());
+  const bool share = internal::ScopedCopyOnWriteClone::is_active();
+  auto result = std::make_unique<AbstractValues>();
+  result->data_.reserve(size());
+  result->owned_data_.reserve(size());
+  for (int i = 0; i < size(); ++i) {
+    std::shared_ptr<AbstractValue> datum;
+    if (share) {
+      datum = FindOwner(i);
+    }
+    if (datum == nullptr) {
+      datum = get_value(i).Clone();
+    }
+    result->data_.push_back(datum.get());
+    result->owned_data_.push_back(std::move(datum));
   }
-  return std::make_unique<AbstractValues>(std::move(cloned_data));
+  return result;
+}
+
+std::shared_ptr<AbstractValue> AbstractValues::FindOwner(int index) const {
+  if (!spanned_.empty()) {
+    const auto& [source, source_index] = spanned_[index];
+    return source->FindOwner(source_index);
+  }
+  if (owned_data_.empty()) {
+    return nullptr;
+  }
+  return owned_data_[index];
+}
+
+namespace internal {
+
+ScopedCopyOnWriteClone::ScopedCopyOnWriteClone() {
+  ++copy_on_write_clone_depth;
+}
+
+ScopedCopyOnWriteClone::~ScopedCopyOnWriteClone() {
+  --copy_on_write_clone_depth;
+}
+
+bool ScopedCopyOnWriteClone::is_active() {
+  return copy_on_write_clone_depth > 0;
 }
 
+}  // namespace internal
 }  // namespace systems
 }  // namespace drake
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
@@ -37,6 +39,15 @@ class AbstractValues {
   /// @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
   explicit AbstractValues(std::unique_ptr<AbstractValue> datum);
 
+  /// (Internal use only) Returns an AbstractValues that does not own the
+  /// underlying data, and whose elements are all of the elements of each of
+  /// the given @p sources, in order. Unlike a view made from pointers, this
+  /// view continues to refer to the right value when a source replaces one of
+  /// its elements, as happens when a copy-on-write element is first written.
+  /// The sources must outlive the result.
+  static std::unique_ptr<AbstractValues> MakeSpanningView(
+      const std::vector<AbstractValues*>& sources);
+
   virtual ~AbstractValues();
 
   /// Returns the number of elements of AbstractValues.
@@ -47,28 +58,89 @@ class AbstractValues {
   const AbstractValue& get_value(int index) const;
 
   /// Returns the element of AbstractValues at the given @p index, or aborts if
-  /// the index is out-of-bounds.
+  /// the index is out-of-bounds. If the element is shared with a copy-on-write
+  /// clone, this AbstractValues first replaces it with its own copy.
   AbstractValue& get_mutable_value(int index);
 
+  /// (Advanced) Returns the element at the given @p index like get_value(),
+  /// but first replaces it with a private copy if it is shared with a
+  /// copy-on-write clone. Code that updates data held in `mutable` members of
+  /// a value through const access (e.g., caches kept inside the value) must
+  /// obtain the value this way so that the update is not seen by other
+  /// Contexts.
+  const AbstractValue& get_unshared_value(int index) const;
+
+  /// (Advanced) Like get_unshared_value(int), but if the element is shared,
+  /// its private copy is `make_copy(shared_element)` instead of a Clone() of
+  /// the shared element. This lets a value that is being unshared for
+  /// copy-on-write keep sharing the parts of the shared element that it won't
+  /// change, which an ordinary copy must not do.
+  const AbstractValue& get_unshared_value(
+      int index,
+      const std::function<std::unique_ptr<AbstractValue>(const AbstractValue&)>&
+          make_copy) const;
+
+  /// Returns true if the element at the given @p index is currently shared
+  /// with another AbstractValues as the result of a copy-on-write clone.
+  bool is_shared(int index) const;
+
   /// Copies all of the AbstractValues in @p other into this. Asserts if the
-  /// two are not equal in size.
+  /// two are not equal in size. Elements that are the very same object in
+  /// both (as for a copy-on-write clone that has not yet written them) are
+  /// skipped.
   /// @throws std::exception if any of the elements are of incompatible type.
   void SetFrom(const AbstractValues& other);
 
   /// Returns a deep copy of all the data in this AbstractValues. The clone
   /// will own its own data. This is true regardless of whether the data being
-  /// cloned had ownership of its data or not.
+  /// cloned had ownership of its data or not. While an
+  /// internal::ScopedCopyOnWriteClone is alive on the calling thread, owned
+  /// elements are instead shared with the clone until either one writes them.
   std::unique_ptr<AbstractValues> Clone() const;
 
  private:
+  // Returns the owning pointer of the element at `index`, following spanning
+  // views to their sources, or nullptr if no AbstractValues owns it.
+  std::shared_ptr<AbstractValue> FindOwner(int index) const;
+
+  // Replaces the owned element at `index` with a private copy if it is
+  // currently shared. The copy is made by `make_copy`, or by Clone() if
+  // `make_copy` is null.
+  void Unshare(
+      int index,
+      const std::function<std::unique_ptr<AbstractValue>(const AbstractValue&)>&
+          make_copy = nullptr) const;
+
   // Pointers to the data. If the data is owned, these pointers are equal to
-  // the pointers in owned_data_.
-  std::vector<AbstractValue*> data_;
-  // Owned pointers to the data. The only purpose of these pointers is to
-  // maintain ownership. They may be populated at construction time, and are
-  // never accessed thereafter.
-  std::vector<std::unique_ptr<AbstractValue>> owned_data_;
+  // the pointers in owned_data_. Unused for spanning views. These are mutable
+  // so that get_unshared_value() can replace a shared element.
+  mutable std::vector<AbstractValue*> data_;
+  // Owned pointers to the data. Owned elements are shared with other
+  // AbstractValues only by copy-on-write cloning, and are replaced by private
+  // copies before being written.
+  mutable std::vector<std::shared_ptr<AbstractValue>> owned_data_;
+  // For spanning views, the (source, index) of each element.
+  std::vector<std::pair<AbstractValues*, int>> spanned_;
 };
 
+namespace internal {
+
+/* While an instance of this class is alive, AbstractValues::Clone() calls on
+the same thread share owned elements copy-on-write rather than deep copying
+them. This is used to implement Context::CloneCopyOnWrite(). Instances may be
+nested. */
+class ScopedCopyOnWriteClone {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedCopyOnWriteClone)
+
+  ScopedCopyOnWriteClone();
+  ~ScopedCopyOnWriteClone();
+
+  /* Returns true if an instance is alive on the calling thread. */
+  static bool is_active();
+};
+
+}  // namespace internal
+
 }  // namespace systems
 }  // namespace drake
@@ -63,6 +63,13 @@ void CacheEntry::CheckValidAbstractValue(const ContextBase& context,
   }
 }
 
+void CacheEntry::RecordCacheHit() const {
+  SystemProfiler* const profiler = SystemProfiler::GetActive();
+  if (profiler != nullptr) {
+    profiler->RecordCacheHit(this, *owning_system_, description_);
+  }
+}
+
 std::string CacheEntry::FormatName(const char* api) const {
   return "System '" + owning_system_->GetSystemPathname() + "' (" +
       NiceTypeName::RemoveNamespaces(owning_system_->GetSystemType()) +
@@ -99,6 +99,12 @@ std::unique_ptr<Context<T>> Context<T>::Clone() const {
   return dynamic_pointer_cast_or_throw<Context<T>>(ContextBase::Clone());
 }
 
+template <typename T>
+std::unique_ptr<Context<T>> Context<T>::CloneCopyOnWrite() const {
+  const internal::ScopedCopyOnWriteClone share_abstract_values;
+  return Clone();
+}
+
 template <typename T>
 std::unique_ptr<State<T>> Context<T>::CloneState() const {
   auto result = DoCloneState();
@@ -463,6 +463,22 @@ class Context : public ContextBase {
     SetStateAndParametersFromHelper(source, change_event);
   }
 
+  /** Copies all state in `source`, where numerical values are of type `U`, to
+  `this` context. Unlike SetStateAndParametersFrom(), parameters are left
+  alone, so computations that depend only on parameters remain valid. Abstract
+  state values that `this` still shares with `source` (see
+  CloneCopyOnWrite()) are not copied at all. This is intended for cheaply
+  restoring a context to a saved state, e.g., between branching rollouts.
+  Time and accuracy are unchanged in `this` context, which means that this
+  method can be called on a subcontext. Sends out of date notifications for
+  all state-dependent computations in `this` context. */
+  template <typename U>
+  void SetStateFrom(const Context<U>& source) {
+    const int64_t change_event = this->start_new_change_event();
+    PropagateBulkChange(change_event, &Context<T>::NoteAllStateChanged);
+    do_access_mutable_state().SetFrom(source.get_state());
+  }
+
   // Allow access to the base class method (takes an AbstractValue).
   using ContextBase::FixInputPort;
 
@@ -689,6 +705,29 @@ class Context : public ContextBase {
   // a more convenient type.
   std::unique_ptr<Context<T>> Clone() const;
 
+  /** Returns a copy of this Context that shares all abstract state and
+  abstract parameter values (e.g., SceneGraph's GeometryState) with this one
+  until either context writes them, at which point the writer makes its own
+  copy. Everything else (time, accuracy, numeric state and parameters, fixed
+  input port values, and the cache) is copied as in Clone(). Cloning is
+  therefore much cheaper than Clone() for contexts with large abstract values
+  that are mostly only read, as in sampling-based planning or tree-search
+  rollouts that only change the numeric state.
+
+  Values are written through get_mutable_abstract_state(),
+  get_mutable_abstract_parameter() and the like. Code that modifies `mutable`
+  members of an abstract value through a const reference must first obtain
+  that value with AbstractValues::get_unshared_value(). References to abstract
+  values obtained before a write may refer to the shared copy.
+
+  Subject to that caveat, the copy and this Context may be used on different
+  threads, as long as no shared value is changed through a const reference
+  without first being unshared. SceneGraph follows that rule: its pose updates,
+  proximity queries and rendering unshare the GeometryState wherever they
+  change it or its engines.
+  @throws std::exception if this is not the root context. */
+  std::unique_ptr<Context<T>> CloneCopyOnWrite() const;
+
   /** Returns a deep copy of this Context's State. */
   std::unique_ptr<State<T>> CloneState() const;
 
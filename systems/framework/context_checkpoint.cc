@@ -0,0 +1,520 @@
+#include "drake/systems/framework/context_checkpoint.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace systems {
+namespace {
+
+// The checkpoint format. All integers and doubles are in host byte order, and
+// every field starts at a multiple of 8 bytes so that doubles can be read in
+// place from a memory-mapped file:
+//
+//   char[8] magic, uint32 version, uint32 byte order mark,
+//   double time, uint64 has_accuracy, double accuracy,
+//   uint64 nq, uint64 nv, uint64 nz, double[nq + nv + nz] xc,
+//   vectors: discrete state groups,
+//   vectors: numeric parameters,
+//   abstract values: abstract state,
+//   abstract values: abstract parameters.
+//
+// A list of vectors is a uint64 count followed by, for each vector, a uint64
+// size and its elements. A list of abstract values is a uint64 count followed
+// by, for each value, a string with its type name, a uint64 that is 1 if the
+// value was saved and 0 if it was ignored, and (if saved) a string with its
+// bytes. A string is a uint64 size followed by its bytes, padded with zeros
+// to a multiple of 8 bytes.
+constexpr char kMagic[8] = {'D', 'R', 'K', 'C', 'T', 'X', 'C', 'K'};
+constexpr uint32_t kByteOrderMark = 0x01020304;
+
+class Writer {
+ public:
+  explicit Writer(std::string* out) : out_(out) {}
+
+  template <typename T>
+  void WritePod(const T& value) {
+    static_assert(sizeof(T) % 8 == 0);
+    out_->append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void WriteSize(size_t size) { WritePod(static_cast<uint64_t>(size)); }
+
+  void WriteVector(const Eigen::Ref<const VectorX<double>>& values) {
+    WriteSize(values.size());
+    WriteDoubles(values);
+  }
+
+  void WriteDoubles(const Eigen::Ref<const VectorX<double>>& values) {
+    out_->append(reinterpret_cast<const char*>(values.data()),
+                 values.size() * sizeof(double));
+  }
+
+  void WriteString(std::string_view bytes) {
+    WriteSize(bytes.size());
+    out_->append(bytes);
+    Pad();
+  }
+
+  // Writes a string whose bytes are appended by `append`.
+  void WriteString(const std::function<void(std::string*)>& append) {
+    const size_t size_offset = out_->size();
+    WriteSize(0);
+    const size_t begin = out_->size();
+    append(out_);
+    const uint64_t size = out_->size() - begin;
+    std::memcpy(out_->data() + size_offset, &size, sizeof(size));
+    Pad();
+  }
+
+ private:
+  void Pad() { out_->append((8 - out_->size() % 8) % 8, '\0'); }
+
+  std::string* const out_;
+};
+
+// Reads the fields of a checkpoint in place, checking that they are all
+// within the data.
+class Reader {
+ public:
+  explicit Reader(std::string_view data) : data_(data) {}
+
+  template <typename T>
+  T ReadPod() {
+    T result;
+    std::memcpy(&result, Take(sizeof(T)), sizeof(T));
+    return result;
+  }
+
+  size_t ReadSize() {
+    const uint64_t size = ReadPod<uint64_t>();
+    if (size > data_.size()) {
+      Throw("a size is larger than the whole checkpoint");
+    }
+    return size;
+  }
+
+  Eigen::Map<const VectorX<double>, Eigen::Unaligned> ReadDoubles(
+      size_t count) {
+    if (count > data_.size() / sizeof(double)) {
+      Throw("a vector is larger than the whole checkpoint");
+    }
+    const char* doubles = Take(count * sizeof(double));
+    return Eigen::Map<const VectorX<double>, Eigen::Unaligned>(
+        reinterpret_cast<const double*>(doubles), count);
+  }
+
+  std::string_view ReadString() {
+    const size_t size = ReadSize();
+    std::string_view result(Take(size), size);
+    Take((8 - size % 8) % 8);
+    return result;
+  }
+
+  bool at_end() const { return offset_ == data_.size(); }
+
+  [[noreturn]] static void Throw(std::string_view problem) {
+    throw std::runtime_error(
+        fmt::format("ContextCheckpointer: invalid checkpoint: {}.", problem));
+  }
+
+ private:
+  const char* Take(size_t size) {
+    if (size > data_.size() - offset_) {
+      Throw("the data ends unexpectedly");
+    }
+    const char* result = data_.data() + offset_;
+    offset_ += size;
+    return result;
+  }
+
+  const std::string_view data_;
+  size_t offset_{0};
+};
+
+// A saved abstract value; `bytes` is nullopt if the value was ignored.
+struct SavedValue {
+  std::string_view type_name;
+  std::optional<std::string_view> bytes;
+};
+
+// The contents of a checkpoint, referring to (not copying) its data.
+struct Checkpoint {
+  double time{};
+  std::optional<double> accuracy;
+  int nq{}, nv{}, nz{};
+  std::optional<Eigen::Map<const VectorX<double>, Eigen::Unaligned>> xc;
+  std::vector<Eigen::Map<const VectorX<double>, Eigen::Unaligned>> xd;
+  std::vector<Eigen::Map<const VectorX<double>, Eigen::Unaligned>> pn;
+  std::vector<SavedValue> xa;
+  std::vector<SavedValue> pa;
+};
+
+std::vector<Eigen::Map<const VectorX<double>, Eigen::Unaligned>> ReadVectors(
+    Reader* reader) {
+  std::vector<Eigen::Map<const VectorX<double>, Eigen::Unaligned>> result;
+  const size_t count = reader->ReadSize();
+  for (size_t i = 0; i < count; ++i) {
+    result.push_back(reader->ReadDoubles(reader->ReadSize()));
+  }
+  return result;
+}
+
+std::vector<SavedValue> ReadValues(Reader* reader) {
+  std::vector<SavedValue> result;
+  const size_t count = reader->ReadSize();
+  for (size_t i = 0; i < count; ++i) {
+    SavedValue value;
+    value.type_name = reader->ReadString();
+    const uint64_t saved = reader->ReadPod<uint64_t>();
+    if (saved > 1) {
+      Reader::Throw("an abstract value has a bad saved flag");
+    }
+    if (saved) {
+      value.bytes = reader->ReadString();
+    }
+    result.push_back(value);
+  }
+  return result;
+}
+
+Checkpoint Parse(std::string_view data) {
+  Reader reader(data);
+  const auto magic = reader.ReadPod<std::array<char, 8>>();
+  if (std::memcmp(magic.data(), kMagic, sizeof(kMagic)) != 0) {
+    Reader::Throw("it does not start with the checkpoint marker");
+  }
+  const auto version = reader.ReadPod<uint32_t>();
+  if (version != ContextCheckpointer::kVersion) {
+    Reader::Throw(fmt::format("it has version {} but only version {} can be "
+                              "read",
+                              version, ContextCheckpointer::kVersion));
+  }
+  if (reader.ReadPod<uint32_t>() != kByteOrderMark) {
+    Reader::Throw("it was written by a machine with a different byte order");
+  }
+  Checkpoint result;
+  result.time = reader.ReadPod<double>();
+  const bool has_accuracy = reader.ReadPod<uint64_t>() != 0;
+  const double accuracy = reader.ReadPod<double>();
+  if (has_accuracy) {
+    result.accuracy = accuracy;
+  }
+  const size_t nq = reader.ReadSize();
+  const size_t nv = reader.ReadSize();
+  const size_t nz = reader.ReadSize();
+  result.nq = nq;
+  result.nv = nv;
+  result.nz = nz;
+  result.xc.emplace(reader.ReadDoubles(nq + nv + nz));
+  result.xd = ReadVectors(&reader);
+  result.pn = ReadVectors(&reader);
+  result.xa = ReadValues(&reader);
+  result.pa = ReadValues(&reader);
+  if (!reader.at_end()) {
+    Reader::Throw("there is unexpected data at the end");
+  }
+  return result;
+}
+
+[[noreturn]] void ThrowMismatch(std::string_view what, int64_t saved,
+                                int64_t actual) {
+  throw std::runtime_error(fmt::format(
+      "ContextCheckpointer: the checkpoint has {} {} but the Context has {}; "
+      "was it saved from a different System?",
+      saved, what, actual));
+}
+
+void CheckValues(std::string_view what, const std::vector<SavedValue>& saved,
+                 const AbstractValues& values) {
+  if (static_cast<int>(saved.size()) != values.size()) {
+    ThrowMismatch(what, saved.size(), values.size());
+  }
+  for (int i = 0; i < values.size(); ++i) {
+    const std::string type_name = values.get_value(i).GetNiceTypeName();
+    if (saved[i].type_name != type_name) {
+      throw std::runtime_error(fmt::format(
+          "ContextCheckpointer: {} {} has type {} in the checkpoint but {} in "
+          "the Context.",
+          what, i, saved[i].type_name, type_name));
+    }
+  }
+}
+
+// Closes a file descriptor and unmaps a mapping when destroyed.
+class MappedFile {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MappedFile)
+
+  explicit MappedFile(const std::filesystem::path& filename) {
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error(fmt::format(
+          "ContextCheckpointer: failed to open '{}': {}", filename.string(),
+          std::strerror(errno)));
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+      const std::string message = std::strerror(errno);
+      ::close(fd);
+      throw std::runtime_error(fmt::format(
+          "ContextCheckpointer: failed to stat '{}': {}", filename.string(),
+          message));
+    }
+    size_ = info.st_size;
+    if (size_ > 0) {
+      void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        const std::string message = std::strerror(errno);
+        ::close(fd);
+        throw std::runtime_error(fmt::format(
+            "ContextCheckpointer: failed to map '{}': {}", filename.string(),
+            message));
+      }
+      data_ = static_cast<const char*>(data);
+    }
+    ::close(fd);
+  }
+
+  ~MappedFile() {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<char*>(data_), size_);
+    }
+  }
+
+  std::string_view data() const { return std::string_view(data_, size_); }
+
+ private:
+  const char* data_{nullptr};
+  size_t size_{0};
+};
+
+}  // namespace
+
+ContextCheckpointer::ContextCheckpointer() = default;
+
+ContextCheckpointer::~ContextCheckpointer() = default;
+
+void ContextCheckpointer::ThrowBadValueSize(const std::string& type_name,
+                                            size_t actual, size_t expected) {
+  throw std::runtime_error(fmt::format(
+      "ContextCheckpointer: a saved {} has {} bytes instead of {}.", type_name,
+      actual, expected));
+}
+
+const ContextCheckpointer::Codec& ContextCheckpointer::GetCodec(
+    const AbstractValue& value) const {
+  const auto iter = codecs_.find(std::type_index(value.type_info()));
+  if (iter == codecs_.end()) {
+    throw std::logic_error(fmt::format(
+        "ContextCheckpointer: no way to save abstract values of type {} has "
+        "been registered; use RegisterAbstractValueType(), "
+        "RegisterTriviallyCopyableType(), or IgnoreAbstractValueType().",
+        value.GetNiceTypeName()));
+  }
+  return iter->second;
+}
+
+std::string ContextCheckpointer::Serialize(
+    const Context<double>& context) const {
+  std::string result;
+  Writer writer(&result);
+  writer.WritePod(kMagic);
+  writer.WritePod(std::array<uint32_t, 2>{kVersion, kByteOrderMark});
+  writer.WritePod(context.get_time());
+  writer.WritePod(uint64_t{context.get_accuracy().has_value()});
+  writer.WritePod(context.get_accuracy().value_or(0.0));
+
+  const ContinuousState<double>& xc = context.get_continuous_state();
+  writer.WriteSize(xc.get_generalized_position().size());
+  writer.WriteSize(xc.get_generalized_velocity().size());
+  writer.WriteSize(xc.get_misc_continuous_state().size());
+  writer.WriteDoubles(xc.CopyToVector());
+
+  writer.WriteSize(context.num_discrete_state_groups());
+  for (int i = 0; i < context.num_discrete_state_groups(); ++i) {
+    writer.WriteVector(context.get_discrete_state(i).value());
+  }
+  writer.WriteSize(context.num_numeric_parameter_groups());
+  for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+    writer.WriteVector(context.get_numeric_parameter(i).value());
+  }
+
+  for (const AbstractValues* values :
+       {&context.get_abstract_state(),
+        &context.get_parameters().get_abstract_parameters()}) {
+    writer.WriteSize(values->size());
+    for (int i = 0; i < values->size(); ++i) {
+      const AbstractValue& value = values->get_value(i);
+      const Codec& codec = GetCodec(value);
+      writer.WriteString(value.GetNiceTypeName());
+      writer.WritePod(uint64_t{codec.save != nullptr});
+      if (codec.save != nullptr) {
+        writer.WriteString([&](std::string* out) {
+          codec.save(value, out);
+        });
+      }
+    }
+  }
+  return result;
+}
+
+void ContextCheckpointer::Deserialize(std::string_view data,
+                                      Context<double>* context) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  const Checkpoint checkpoint = Parse(data);
+
+  // Check everything before changing anything.
+  const ContinuousState<double>& xc = context->get_continuous_state();
+  if (checkpoint.nq != xc.get_generalized_position().size() ||
+      checkpoint.nv != xc.get_generalized_velocity().size() ||
+      checkpoint.nz != xc.get_misc_continuous_state().size()) {
+    throw std::runtime_error(fmt::format(
+        "ContextCheckpointer: the checkpoint has continuous state sizes "
+        "(q, v, z) = ({}, {}, {}) but the Context has ({}, {}, {}); was it "
+        "saved from a different System?",
+        checkpoint.nq, checkpoint.nv, checkpoint.nz,
+        xc.get_generalized_position().size(),
+        xc.get_generalized_velocity().size(),
+        xc.get_misc_continuous_state().size()));
+  }
+  if (static_cast<int>(checkpoint.xd.size()) !=
+      context->num_discrete_state_groups()) {
+    ThrowMismatch("discrete state groups", checkpoint.xd.size(),
+                  context->num_discrete_state_groups());
+  }
+  for (int i = 0; i < context->num_discrete_state_groups(); ++i) {
+    if (checkpoint.xd[i].size() != context->get_discrete_state(i).size()) {
+      ThrowMismatch(fmt::format("elements in discrete state group {}", i),
+                    checkpoint.xd[i].size(),
+                    context->get_discrete_state(i).size());
+    }
+  }
+  if (static_cast<int>(checkpoint.pn.size()) !=
+      context->num_numeric_parameter_groups()) {
+    ThrowMismatch("numeric parameter groups", checkpoint.pn.size(),
+                  context->num_numeric_parameter_groups());
+  }
+  for (int i = 0; i < context->num_numeric_parameter_groups(); ++i) {
+    if (checkpoint.pn[i].size() != context->get_numeric_parameter(i).size()) {
+      ThrowMismatch(fmt::format("elements in numeric parameter group {}", i),
+                    checkpoint.pn[i].size(),
+                    context->get_numeric_parameter(i).size());
+    }
+  }
+  CheckValues("abstract state", checkpoint.xa, context->get_abstract_state());
+  CheckValues("abstract parameter", checkpoint.pa,
+              context->get_parameters().get_abstract_parameters());
+
+  // Abstract values are loaded into copies first, so that a load function
+  // that throws leaves the context unchanged.
+  auto load_values = [this](const std::vector<SavedValue>& saved,
+                            const AbstractValues& values) {
+    std::vector<std::unique_ptr<AbstractValue>> result(saved.size());
+    for (int i = 0; i < values.size(); ++i) {
+      const AbstractValue& value = values.get_value(i);
+      const Codec& codec = GetCodec(value);
+      if (codec.load == nullptr || !saved[i].bytes.has_value()) {
+        continue;
+      }
+      result[i] = value.Clone();
+      codec.load(*saved[i].bytes, result[i].get());
+    }
+    return result;
+  };
+  const std::vector<std::unique_ptr<AbstractValue>> xa =
+      load_values(checkpoint.xa, context->get_abstract_state());
+  const std::vector<std::unique_ptr<AbstractValue>> pa = load_values(
+      checkpoint.pa, context->get_parameters().get_abstract_parameters());
+
+  context->SetTime(checkpoint.time);
+  context->SetAccuracy(checkpoint.accuracy);
+  context->get_mutable_continuous_state_vector().SetFromVector(*checkpoint.xc);
+  if (context->num_discrete_state_groups() > 0) {
+    DiscreteValues<double>& xd = context->get_mutable_discrete_state();
+    for (int i = 0; i < xd.num_groups(); ++i) {
+      xd.get_mutable_vector(i).SetFromVector(checkpoint.xd[i]);
+    }
+  }
+  for (int i = 0; i < context->num_numeric_parameter_groups(); ++i) {
+    context->get_mutable_numeric_parameter(i).SetFromVector(checkpoint.pn[i]);
+  }
+  if (std::any_of(xa.begin(), xa.end(), [](const auto& x) { return !!x; })) {
+    AbstractValues& values = context->get_mutable_abstract_state();
+    for (int i = 0; i < values.size(); ++i) {
+      if (xa[i] != nullptr) {
+        values.get_mutable_value(i).SetFrom(*xa[i]);
+      }
+    }
+  }
+  for (int i = 0; i < static_cast<int>(pa.size()); ++i) {
+    if (pa[i] != nullptr) {
+      context->get_mutable_abstract_parameter(i).SetFrom(*pa[i]);
+    }
+  }
+}
+
+void ContextCheckpointer::Write(const Context<double>& context,
+                                const std::filesystem::path& filename) const {
+  const std::string data = Serialize(context);
+  std::filesystem::path temp_filename = filename;
+  temp_filename += ".tmp";
+  {
+    std::ofstream out(temp_filename, std::ios::binary | std::ios::trunc);
+    out.write(data.data(), data.size());
+    out.close();
+    if (!out.good()) {
+      throw std::runtime_error(fmt::format(
+          "ContextCheckpointer: failed to write '{}'.",
+          temp_filename.string()));
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(temp_filename, filename, error);
+  if (error) {
+    throw std::runtime_error(fmt::format(
+        "ContextCheckpointer: failed to rename '{}' to '{}': {}",
+        temp_filename.string(), filename.string(), error.message()));
+  }
+}
+
+void ContextCheckpointer::Read(const std::filesystem::path& filename,
+                               Context<double>* context) const {
+  const MappedFile file(filename);
+  Deserialize(file.data(), context);
+}
+
+std::function<EventStatus(const Context<double>&)>
+ContextCheckpointer::MakeSimulatorMonitor(std::filesystem::path filename,
+                                          double period) const {
+  DRAKE_THROW_UNLESS(period > 0);
+  auto next_time = std::make_shared<double>(
+      -std::numeric_limits<double>::infinity());
+  return [checkpointer = *this, filename = std::move(filename), period,
+          next_time](const Context<double>& context) {
+    if (context.get_time() >= *next_time) {
+      checkpointer.Write(context, filename);
+      *next_time = context.get_time() + period;
+    }
+    return EventStatus::Succeeded();
+  };
+}
+
+}  // namespace systems
+}  // namespace drake
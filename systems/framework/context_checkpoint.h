@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/common/value.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/event_status.h"
+
+namespace drake {
+namespace systems {
+
+/** Saves the values in a Context<double> to a compact, versioned binary
+checkpoint, and restores them into a Context for the same System. This lets a
+long simulation be restarted from where it left off, rather than re-simulated
+from the beginning, and lets many jobs start from one saved state.
+
+A checkpoint holds the time, accuracy, continuous state, discrete state,
+abstract state, numeric parameters, and abstract parameters of the whole
+Context. For a Diagram, these are the values of every subsystem in the
+Diagram's order. Fixed input port values and cached results are not saved;
+cached results are recomputed after a restore. Integrator state (e.g. the
+current step size) lives in the Simulator rather than the Context and is not
+saved either, so a restarted simulation matches the original closely but not
+necessarily bit for bit.
+
+The framework cannot serialize abstract values by itself, so every abstract
+value type in the Context must be registered with the checkpointer before
+saving, in one of three ways:
+
+- RegisterAbstractValueType() with functions that save and load the value;
+- RegisterTriviallyCopyableType() for types saved as their bytes; or
+- IgnoreAbstractValueType() for types that are not saved and are left
+  unchanged by a restore. Use this for values that are fully determined by how
+  the System was built, e.g., SceneGraph's GeometryState when no geometry is
+  added or changed during the simulation.
+
+For example, to save a checkpoint every minute of simulated time:
+@code
+ContextCheckpointer checkpointer;
+checkpointer.IgnoreAbstractValueType<geometry::GeometryState<double>>();
+simulator.set_monitor(
+    checkpointer.MakeSimulatorMonitor("/tmp/sim.ckpt", 60.0));
+simulator.AdvanceTo(3600);
+
+// Later, perhaps in another process, with the same Diagram:
+checkpointer.Read("/tmp/sim.ckpt", &simulator.get_mutable_context());
+simulator.Initialize();
+simulator.AdvanceTo(7200);
+@endcode
+
+Numbers are stored in the byte order of the machine that wrote them, so
+checkpoints should be read on the same kind of machine. Read() memory-maps the
+file and copies values directly out of the mapping. */
+class ContextCheckpointer {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ContextCheckpointer)
+
+  /** The current version of the checkpoint format. Deserialize() rejects
+  checkpoints of any other version. */
+  static constexpr uint32_t kVersion = 1;
+
+  /** Constructs a checkpointer with no abstract value types registered. */
+  ContextCheckpointer();
+
+  ~ContextCheckpointer();
+
+  /** Registers how to save and load abstract values of type `V`. `save`
+  appends the bytes of a value to the given string. `load` sets a value from
+  the bytes that `save` produced, and should throw if they are invalid.
+  Replaces any earlier registration for `V`. */
+  template <typename V>
+  void RegisterAbstractValueType(
+      std::function<void(const V&, std::string*)> save,
+      std::function<void(std::string_view, V*)> load) {
+    DRAKE_THROW_UNLESS(save != nullptr);
+    DRAKE_THROW_UNLESS(load != nullptr);
+    Codec codec;
+    codec.save = [save = std::move(save)](const AbstractValue& value,
+                                          std::string* out) {
+      save(value.get_value<V>(), out);
+    };
+    codec.load = [load = std::move(load)](std::string_view bytes,
+                                          AbstractValue* value) {
+      load(bytes, &value->get_mutable_value<V>());
+    };
+    codecs_[std::type_index(typeid(V))] = std::move(codec);
+  }
+
+  /** Registers a trivially copyable type `V` whose values are saved as their
+  bytes. */
+  template <typename V>
+  void RegisterTriviallyCopyableType() {
+    static_assert(std::is_trivially_copyable_v<V>);
+    RegisterAbstractValueType<V>(
+        [](const V& value, std::string* out) {
+          out->append(reinterpret_cast<const char*>(&value), sizeof(V));
+        },
+        [](std::string_view bytes, V* value) {
+          if (bytes.size() != sizeof(V)) {
+            ThrowBadValueSize(NiceTypeName::Get<V>(), bytes.size(), sizeof(V));
+          }
+          std::memcpy(value, bytes.data(), sizeof(V));
+        });
+  }
+
+  /** Registers type `V` as one whose values are not saved and are left
+  unchanged by a restore. */
+  template <typename V>
+  void IgnoreAbstractValueType() {
+    codecs_[std::type_index(typeid(V))] = Codec{};
+  }
+
+  /** Returns the checkpoint of `context` as bytes.
+  @throws std::exception if the context holds an abstract value whose type has
+  not been registered. */
+  std::string Serialize(const Context<double>& context) const;
+
+  /** Restores `context` from the checkpoint `data` made by Serialize() or
+  Write(). The whole checkpoint is checked before `context` is changed, so on
+  error `context` is left unchanged.
+  @throws std::exception if `data` is not a valid checkpoint of this version,
+  or does not match the sizes and abstract value types of `context`.
+  @pre `context` is a root context. */
+  void Deserialize(std::string_view data, Context<double>* context) const;
+
+  /** Writes the checkpoint of `context` to `filename`. The file is written
+  under a temporary name and then renamed, so that a crash while writing does
+  not destroy an earlier checkpoint.
+  @throws std::exception as for Serialize(), or if the file cannot be
+  written. */
+  void Write(const Context<double>& context,
+             const std::filesystem::path& filename) const;
+
+  /** Restores `context` from the checkpoint file `filename`, as for
+  Deserialize().
+  @throws std::exception as for Deserialize(), or if the file cannot be
+  read. */
+  void Read(const std::filesystem::path& filename,
+            Context<double>* context) const;
+
+  /** Returns a function for Simulator::set_monitor() that writes a checkpoint
+  to `filename` (replacing the previous one) whenever the simulated time has
+  advanced by at least `period` seconds since the last checkpoint it wrote.
+  The first checkpoint is written at the first step. The function keeps its
+  own copy of this checkpointer's registrations.
+  @pre period > 0 */
+  std::function<EventStatus(const Context<double>&)> MakeSimulatorMonitor(
+      std::filesystem::path filename, double period) const;
+
+ private:
+  // How to save and load one abstract value type. A default-constructed Codec
+  // marks an ignored type.
+  struct Codec {
+    std::function<void(const AbstractValue&, std::string*)> save;
+    std::function<void(std::string_view, AbstractValue*)> load;
+  };
+
+  [[noreturn]] static void ThrowBadValueSize(const std::string& type_name,
+                                             size_t actual, size_t expected);
+
+  const Codec& GetCodec(const AbstractValue& value) const;
+
+  std::unordered_map<std::type_index, Codec> codecs_;
+};
+
+}  // namespace systems
+}  // namespace drake
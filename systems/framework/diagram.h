@@ -325,6 +325,13 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
       const std::type_info& destination_type) const final;
 
  private:
+  // Calls CalcNextUpdateTime() on the scheduled subsystem `index`, whose
+  // periodic events are due at `expected_time`, and throws if it reports a
+  // different time. When `events` is null, the events are discarded.
+  void CalcScheduledSubsystemNextUpdateTime(
+      const DiagramContext<T>& context, SubsystemIndex index,
+      const T& expected_time, CompositeEventCollection<T>* events) const;
+
   std::unique_ptr<AbstractValue> DoAllocateInput(
       const InputPort<T>& input_port) const final;
 
@@ -536,11 +543,51 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   // The map of subsystem inputs to inputs of this Diagram.
   std::map<InputPortLocator, InputPortIndex> input_port_map_;
 
+  // A shortcut past output ports declared by System::DeclareOutputPortAlias():
+  // the input ports along the way, from downstream to upstream, and the output
+  // port that is the original source of their values.
+  struct AliasedConnection {
+    std::vector<std::pair<SubsystemIndex, InputPortIndex>> aliased_inputs;
+    OutputPortLocator source;
+  };
+
+  // The connected subsystem input ports whose upstream output port is an
+  // alias of a connected input port, with the shortcut to the source of the
+  // value. Dependency tracking still follows connection_map_; only evaluation
+  // takes the shortcut.
+  std::map<InputPortLocator, AliasedConnection> aliased_connections_;
+
   // The index of a cache entry that stores a buffer of time data for use in
   // managing events. It is only used in DoCalcNextUpdateTime(), but is
   // allocated as a cache entry to avoid heap operations during simulation.
+  // It has one element per entry of unscheduled_subsystems_.
   CacheIndex event_times_buffer_cache_index_{};
 
+  // A subsystem in periodic_schedule_, with its events for one timing. When
+  // the subsystem has several timings, `events` is empty and the subsystem
+  // itself is asked for its events, so that they are in the order it would
+  // give them.
+  struct ScheduledSubsystem {
+    SubsystemIndex index;
+    std::vector<const Event<T>*> events;
+  };
+
+  // The subsystems sharing one periodic event timing (offset and period), for
+  // the subsystems whose update times are predicted by periodic_schedule_.
+  struct PeriodicScheduleEntry {
+    PeriodicEventData timing;
+    std::vector<ScheduledSubsystem> subsystems;
+  };
+
+  // The subsystems for which HasOnlyPeriodicUpdateTimes() is true, grouped by
+  // event timing, so that DoCalcNextUpdateTime() computes one next event time
+  // per distinct timing rather than asking each subsystem. A subsystem with
+  // several timings appears in several entries.
+  std::vector<PeriodicScheduleEntry> periodic_schedule_;
+
+  // The subsystems that DoCalcNextUpdateTime() asks at every call, in order.
+  std::vector<SubsystemIndex> unscheduled_subsystems_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
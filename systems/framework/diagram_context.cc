@@ -157,7 +157,7 @@ void DiagramContext<T>::MakeState() {
 template <typename T>
 void DiagramContext<T>::MakeParameters() {
   std::vector<BasicVector<T>*> numeric_params;
-  std::vector<AbstractValue*> abstract_params;
+  std::vector<AbstractValues*> abstract_params;
   for (auto& subcontext : contexts_) {
     // Using `access` here to avoid sending invalidations.
     Parameters<T>& subparams =
@@ -165,15 +165,13 @@ void DiagramContext<T>::MakeParameters() {
     for (int i = 0; i < subparams.num_numeric_parameter_groups(); ++i) {
       numeric_params.push_back(&subparams.get_mutable_numeric_parameter(i));
     }
-    for (int i = 0; i < subparams.num_abstract_parameters(); ++i) {
-      abstract_params.push_back(&subparams.get_mutable_abstract_parameter(i));
-    }
+    abstract_params.push_back(&subparams.get_mutable_abstract_parameters());
   }
   auto params = std::make_unique<Parameters<T>>();
   params->set_numeric_parameters(
       std::make_unique<DiscreteValues<T>>(numeric_params));
   params->set_abstract_parameters(
-      std::make_unique<AbstractValues>(abstract_params));
+      AbstractValues::MakeSpanningView(abstract_params));
   params->set_system_id(this->get_system_id());
   this->init_parameters(std::move(params));
 }
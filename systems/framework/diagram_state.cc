@@ -19,17 +19,14 @@ void DiagramState<T>::Finalize() {
   std::vector<ContinuousState<T>*> sub_xcs;
   sub_xcs.reserve(num_substates());
   std::vector<DiscreteValues<T>*> sub_xds;
-  std::vector<AbstractValue*> sub_xas;
+  std::vector<AbstractValues*> sub_xas;
   for (State<T>* substate : substates_) {
     // Continuous
     sub_xcs.push_back(&substate->get_mutable_continuous_state());
     // Discrete
     sub_xds.push_back(&substate->get_mutable_discrete_state());
     // Abstract (no substructure)
-    AbstractValues& xa = substate->get_mutable_abstract_state();
-    for (int i_xa = 0; i_xa < xa.size(); ++i_xa) {
-      sub_xas.push_back(&xa.get_mutable_value(i_xa));
-    }
+    sub_xas.push_back(&substate->get_mutable_abstract_state());
   }
 
   // This State consists of a continuous, discrete, and abstract state, each
@@ -41,7 +38,7 @@ void DiagramState<T>::Finalize() {
       std::make_unique<DiagramContinuousState<T>>(sub_xcs));
   this->set_discrete_state(
       std::make_unique<DiagramDiscreteValues<T>>(sub_xds));
-  this->set_abstract_state(std::make_unique<AbstractValues>(sub_xas));
+  this->set_abstract_state(AbstractValues::MakeSpanningView(sub_xas));
 }
 
 }  // namespace systems
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <unordered_set>
 #include <utility>
 
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/value.h"
 #include "drake/systems/framework/context.h"
@@ -270,6 +272,35 @@ class PeriodicEventData : public EventData {
   /// Sets the time after zero when this event should first occur.
   void set_offset_sec(double offset_sec) { offset_sec_ = offset_sec; }
 
+  /// Returns the first time strictly after @p current_time_sec at which this
+  /// event occurs.
+  /// @pre period_sec() > 0 and offset_sec() >= 0.
+  template <typename T>
+  T CalcNextEventTime(const T& current_time_sec) const {
+    const double period = period_sec_;
+    DRAKE_ASSERT(period > 0);
+    const double offset = offset_sec_;
+    DRAKE_ASSERT(offset >= 0);
+
+    // If the first sample time hasn't arrived yet, then that is the next
+    // sample time.
+    if (current_time_sec < offset) {
+      return offset;
+    }
+
+    // Compute the index in the sequence of samples for the next time to
+    // sample, which should be greater than the present time.
+    using std::ceil;
+    const T offset_time = current_time_sec - offset;
+    const T next_k = ceil(offset_time / period);
+    T next_t = offset + next_k * period;
+    if (next_t <= current_time_sec) {
+      next_t = offset + (next_k + 1) * period;
+    }
+    DRAKE_ASSERT(next_t > current_time_sec);
+    return next_t;
+  }
+
  private:
   [[nodiscard]] EventData* DoClone() const override {
     PeriodicEventData* clone = new PeriodicEventData;
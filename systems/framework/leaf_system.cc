@@ -12,39 +12,6 @@
 namespace drake {
 namespace systems {
 
-namespace {
-
-// Returns the next sample time for the given @p attribute.
-template <typename T>
-T GetNextSampleTime(
-    const PeriodicEventData& attribute,
-    const T& current_time_sec) {
-  const double period = attribute.period_sec();
-  DRAKE_ASSERT(period > 0);
-  const double offset = attribute.offset_sec();
-  DRAKE_ASSERT(offset >= 0);
-
-  // If the first sample time hasn't arrived yet, then that is the next
-  // sample time.
-  if (current_time_sec < offset) {
-    return offset;
-  }
-
-  // Compute the index in the sequence of samples for the next time to sample,
-  // which should be greater than the present time.
-  using std::ceil;
-  const T offset_time = current_time_sec - offset;
-  const T next_k = ceil(offset_time / period);
-  T next_t = offset + next_k * period;
-  if (next_t <= current_time_sec) {
-    next_t = offset + (next_k + 1) * period;
-  }
-  DRAKE_ASSERT(next_t > current_time_sec);
-  return next_t;
-}
-
-}  // namespace
-
 template <typename T>
 LeafSystem<T>::~LeafSystem() {}
 
@@ -370,7 +337,7 @@ void LeafSystem<T>::DoCalcNextUpdateTime(
   for (const auto& event_pair : periodic_events_) {
     const PeriodicEventData& event_data = event_pair.first;
     const Event<T>* const event = event_pair.second.get();
-    const T t = GetNextSampleTime(event_data, context.get_time());
+    const T t = event_data.CalcNextEventTime(context.get_time());
     if (t < min_time) {
       min_time = t;
       next_events = {event};
@@ -817,6 +784,11 @@ std::map<PeriodicEventData, std::vector<const Event<T>*>,
   return periodic_events_map;
 }
 
+template <typename T>
+bool LeafSystem<T>::DoHasOnlyPeriodicUpdateTimes() const {
+  return only_periodic_update_times_ && !periodic_events_.empty();
+}
+
 template <typename T>
 void LeafSystem<T>::DispatchPublishHandler(
     const Context<T>& context,
@@ -274,6 +274,20 @@ class LeafSystem : public System<T> {
   @pre `period_sec` > 0 and `offset_sec` ≥ 0. */
   //@{
 
+  /** (Advanced) Declares that this System's timed events are exactly its
+  declared periodic events, i.e., that it doesn't override
+  DoCalcNextUpdateTime() to add timed events of its own. A Diagram containing
+  this System then computes the System's next update times from the timings
+  of its periodic events, and only calls CalcNextUpdateTime() on it when one
+  of them is due (see System::HasOnlyPeriodicUpdateTimes()). That saves work
+  in Diagrams of many periodic Systems that share a few rates.
+
+  Only call this from the constructor of a class that no subclass can
+  customize DoCalcNextUpdateTime() for, such as a `final` class. In
+  assert-enabled builds, a Diagram throws if the System reports an update time
+  that differs from the one implied by its periodic events. */
+  void DeclareOnlyPeriodicUpdateTimes() { only_periodic_update_times_ = true; }
+
   /** Declares that a Publish event should occur periodically and that it should
   invoke the given event handler method. The handler should be a class
   member function (method) with this signature:
@@ -1905,6 +1919,8 @@ class LeafSystem : public System<T> {
   std::map<PeriodicEventData, std::vector<const Event<T>*>,
       PeriodicEventDataComparator> DoGetPeriodicEvents() const override;
 
+  bool DoHasOnlyPeriodicUpdateTimes() const final;
+
   // Calls DoPublish.
   // Assumes @param events is an instance of LeafEventCollection, throws
   // std::bad_cast otherwise.
@@ -2003,6 +2019,10 @@ class LeafSystem : public System<T> {
                         std::unique_ptr<Event<T>>>>
       periodic_events_;
 
+  // Whether the timed events of this system are exactly its periodic events;
+  // see DeclareOnlyPeriodicUpdateTimes().
+  bool only_periodic_update_times_{false};
+
   // Update or Publish events declared by this system for every simulator
   // major time step.
   LeafCompositeEventCollection<T> per_step_events_;
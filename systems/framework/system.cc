@@ -10,6 +10,7 @@
 #include <fmt/format.h>
 
 #include "drake/common/unused.h"
+#include "drake/systems/framework/system_profiler.h"
 #include "drake/systems/framework/system_visitor.h"
 
 namespace drake {
@@ -178,10 +179,31 @@ bool System<T>::HasDirectFeedthrough(int input_port, int output_port) const {
   return false;
 }
 
+template <typename T>
+std::optional<InputPortIndex> System<T>::GetAliasedInputPortIndex(
+    OutputPortIndex output_port) const {
+  const auto it = output_port_aliases_.find(output_port);
+  if (it == output_port_aliases_.end()) return std::nullopt;
+  return it->second;
+}
+
+template <typename T>
+void System<T>::DeclareOutputPortAlias(OutputPortIndex output_port,
+                                       InputPortIndex input_port) {
+  DRAKE_THROW_UNLESS(output_port >= 0 &&
+                     output_port < this->num_output_ports());
+  DRAKE_THROW_UNLESS(input_port >= 0 && input_port < this->num_input_ports());
+  const bool inserted =
+      output_port_aliases_.emplace(output_port, input_port).second;
+  DRAKE_THROW_UNLESS(inserted);
+}
+
 template <typename T>
 void System<T>::Publish(const Context<T>& context,
                         const EventCollection<PublishEvent<T>>& events) const {
   ValidateContext(context);
+  SystemProfiler::ScopedComputation profile(SystemProfiler::Category::kPublish,
+                                            this, *this, "Publish");
   DispatchPublishHandler(context, events);
 }
 
@@ -245,6 +267,9 @@ void System<T>::CalcTimeDerivatives(const Context<T>& context,
   DRAKE_DEMAND(derivatives != nullptr);
   ValidateContext(context);
   ValidateCreatedForThisSystem(derivatives);
+  SystemProfiler::ScopedComputation profile(
+      SystemProfiler::Category::kTimeDerivatives, this, *this,
+      "CalcTimeDerivatives");
   DoCalcTimeDerivatives(context, derivatives);
 }
 
@@ -274,6 +299,9 @@ void System<T>::CalcDiscreteVariableUpdates(
     DiscreteValues<T>* discrete_state) const {
   ValidateContext(context);
   ValidateCreatedForThisSystem(discrete_state);
+  SystemProfiler::ScopedComputation profile(
+      SystemProfiler::Category::kDiscreteUpdate, this, *this,
+      "CalcDiscreteVariableUpdates");
 
   DispatchDiscreteVariableUpdateHandler(context, events, discrete_state);
 }
@@ -305,6 +333,9 @@ void System<T>::CalcUnrestrictedUpdate(
   const int continuous_state_dim = state->get_continuous_state().size();
   const int discrete_state_dim = state->get_discrete_state().num_groups();
   const int abstract_state_dim = state->get_abstract_state().size();
+  SystemProfiler::ScopedComputation profile(
+      SystemProfiler::Category::kUnrestrictedUpdate, this, *this,
+      "CalcUnrestrictedUpdate");
 
   DispatchUnrestrictedUpdateHandler(context, events, state);
 
@@ -174,6 +174,15 @@ class System : public SystemBase {
   bool HasDirectFeedthrough(int input_port, int output_port) const;
 
   using SystemBase::GetDirectFeedthroughs;
+
+  /** (Advanced) Returns the index of the input port whose value the given
+  output port always reproduces exactly when that input port has a value, or
+  nullopt if no such input port was declared. A Diagram uses this to give
+  input ports connected to @p output_port the value of the input port's
+  source directly, without calculating @p output_port.
+  @see DeclareOutputPortAlias() */
+  std::optional<InputPortIndex> GetAliasedInputPortIndex(
+      OutputPortIndex output_port) const;
   //@}
 
   //----------------------------------------------------------------------------
@@ -667,6 +676,18 @@ class System : public SystemBase {
   std::map<PeriodicEventData, std::vector<const Event<T>*>,
     PeriodicEventDataComparator> GetPeriodicEvents() const;
 
+  /** (Advanced) Returns true if this System has periodic events and
+  CalcNextUpdateTime() always reports exactly the next time and events implied
+  by GetPeriodicEvents(). A Diagram predicts the next update times of such
+  subsystems from their event timings, rather than calling
+  CalcNextUpdateTime() on each of them at every step. This is false for
+  Diagrams. For a LeafSystem, it is true when periodic events have been
+  declared and the LeafSystem opted in with
+  LeafSystem::DeclareOnlyPeriodicUpdateTimes(). */
+  bool HasOnlyPeriodicUpdateTimes() const {
+    return DoHasOnlyPeriodicUpdateTimes();
+  }
+
   /** Utility method that computes for _every_ output port i the value y(i) that
   should result from the current contents of the given Context. Note that
   individual output port values can be calculated using
@@ -1383,6 +1404,21 @@ class System : public SystemBase {
       std::variant<std::string, UseDefaultName> name, PortDataType type,
       int size, std::optional<RandomDistribution> random_type = std::nullopt);
 
+  /** Declares that whenever input port @p input_port has a value, output port
+  @p output_port has an identical value, i.e., the output port's calculation
+  only copies that input. A Diagram then evaluates the input ports connected
+  to @p output_port by evaluating the source of @p input_port, which saves
+  the calculation and the copy.
+
+  Only declare this when the downstream ports may receive the upstream value
+  exactly as it is: the two ports must have the same value type, and a vector
+  output port must have a plain BasicVector as its model value rather than a
+  subclass of it.
+  @throws std::exception if either port does not exist or @p output_port
+  already has an aliased input port. */
+  void DeclareOutputPortAlias(OutputPortIndex output_port,
+                              InputPortIndex input_port);
+
   //@}
 
   /** Adds an already-created constraint to the list of constraints for this
@@ -1471,6 +1507,12 @@ class System : public SystemBase {
       std::vector<const Event<T>*>, PeriodicEventDataComparator>
     DoGetPeriodicEvents() const = 0;
 
+  /** Override this method to report whether this System's next update times
+  are fully described by its periodic events.
+  @see HasOnlyPeriodicUpdateTimes() for details.
+  @note The default implementation returns false. */
+  virtual bool DoHasOnlyPeriodicUpdateTimes() const { return false; }
+
   /** Implement this method to return any events to be handled before the
   simulator integrates the system's continuous state at each time step.
   @p events is cleared in the public non-virtual GetPerStepEvents()
@@ -1736,6 +1778,10 @@ class System : public SystemBase {
   CacheIndex kinetic_energy_cache_index_;
   CacheIndex conservative_power_cache_index_;
   CacheIndex nonconservative_power_cache_index_;
+
+  // The output ports declared by DeclareOutputPortAlias(), with the input port
+  // that each one reproduces.
+  std::map<OutputPortIndex, InputPortIndex> output_port_aliases_;
 };
 
 }  // namespace systems
@@ -0,0 +1,220 @@
+#include "drake/systems/framework/system_profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+std::atomic<int> g_num_active_system_profilers{0};
+}  // namespace internal
+
+namespace {
+
+thread_local SystemProfiler* g_active_profiler = nullptr;
+
+const char* GetCategoryName(SystemProfiler::Category category) {
+  switch (category) {
+    case SystemProfiler::Category::kCacheEntry:
+      return "cache entry";
+    case SystemProfiler::Category::kTimeDerivatives:
+      return "time derivatives";
+    case SystemProfiler::Category::kPublish:
+      return "publish";
+    case SystemProfiler::Category::kDiscreteUpdate:
+      return "discrete update";
+    case SystemProfiler::Category::kUnrestrictedUpdate:
+      return "unrestricted update";
+  }
+  DRAKE_UNREACHABLE();
+}
+
+// Escapes a string for use within double quotes in JSON.
+std::string EscapeJson(const std::string& text) {
+  std::string result;
+  result.reserve(text.size());
+  for (const char c : text) {
+    if (c == '"' || c == '\\') {
+      result.push_back('\\');
+      result.push_back(c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      result += fmt::format("\\u{:04x}", static_cast<int>(c));
+    } else {
+      result.push_back(c);
+    }
+  }
+  return result;
+}
+
+double ToMicroseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}  // namespace
+
+SystemProfiler::SystemProfiler() : epoch_(Clock::now()) {}
+
+SystemProfiler::~SystemProfiler() = default;
+
+void SystemProfiler::Clear() {
+  DRAKE_THROW_UNLESS(open_.empty());
+  epoch_ = Clock::now();
+  indices_.clear();
+  statistics_.clear();
+  trace_.clear();
+}
+
+std::vector<SystemProfiler::Statistics> SystemProfiler::GetStatistics()
+    const {
+  std::vector<Statistics> result = statistics_;
+  std::stable_sort(result.begin(), result.end(),
+                   [](const Statistics& a, const Statistics& b) {
+                     return a.self_time > b.self_time;
+                   });
+  return result;
+}
+
+std::string SystemProfiler::GetSummary(int max_rows) const {
+  const std::vector<Statistics> statistics = GetStatistics();
+  double total_self_time = 0.0;
+  for (const Statistics& stats : statistics) {
+    total_self_time += stats.self_time;
+  }
+  std::ostringstream out;
+  out << fmt::format("{:<40} {:<30} {:<20} {:>10} {:>10} {:>6} {:>11} {:>11} "
+                     "{:>6}\n",
+                     "System", "Computation", "Category", "Evals", "Computed",
+                     "Hit %", "Total (ms)", "Self (ms)", "Self %");
+  const int num_rows =
+      std::min(max_rows, static_cast<int>(statistics.size()));
+  for (int i = 0; i < num_rows; ++i) {
+    const Statistics& stats = statistics[i];
+    const double hit_percent =
+        stats.num_evaluations == 0
+            ? 0.0
+            : 100.0 * (stats.num_evaluations - stats.num_computations) /
+                  stats.num_evaluations;
+    const double self_percent =
+        total_self_time == 0.0 ? 0.0
+                               : 100.0 * stats.self_time / total_self_time;
+    out << fmt::format(
+        "{:<40} {:<30} {:<20} {:>10} {:>10} {:>6.1f} {:>11.3f} {:>11.3f} "
+        "{:>6.1f}\n",
+        stats.system_pathname, stats.name, GetCategoryName(stats.category),
+        stats.num_evaluations, stats.num_computations, hit_percent,
+        1e3 * stats.total_time, 1e3 * stats.self_time, self_percent);
+  }
+  if (num_rows < static_cast<int>(statistics.size())) {
+    out << fmt::format("({} more rows omitted)\n",
+                       statistics.size() - num_rows);
+  }
+  return out.str();
+}
+
+std::string SystemProfiler::GetChromeTrace() const {
+  std::ostringstream out;
+  out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  for (size_t i = 0; i < trace_.size(); ++i) {
+    const TraceEvent& event = trace_[i];
+    const Statistics& stats = statistics_[event.index];
+    out << (i == 0 ? "\n" : ",\n");
+    out << fmt::format(
+        "{{\"name\": \"{}\", \"cat\": \"{}\", \"ph\": \"X\", \"ts\": {:.3f}, "
+        "\"dur\": {:.3f}, \"pid\": 1, \"tid\": 1, "
+        "\"args\": {{\"system\": \"{}\"}}}}",
+        EscapeJson(stats.system_pathname + " " + stats.name),
+        GetCategoryName(stats.category), ToMicroseconds(event.start),
+        ToMicroseconds(event.duration), EscapeJson(stats.system_pathname));
+  }
+  out << "\n]}\n";
+  return out.str();
+}
+
+void SystemProfiler::WriteChromeTrace(const std::string& filename) const {
+  std::ofstream file(filename);
+  if (!file) {
+    throw std::runtime_error(fmt::format(
+        "SystemProfiler: could not open '{}' for writing.", filename));
+  }
+  file << GetChromeTrace();
+}
+
+void SystemProfiler::set_max_trace_events(int max_trace_events) {
+  DRAKE_THROW_UNLESS(max_trace_events >= 0);
+  max_trace_events_ = max_trace_events;
+}
+
+SystemProfiler::ActiveScope::ActiveScope(SystemProfiler* profiler)
+    : previous_(g_active_profiler) {
+  DRAKE_THROW_UNLESS(profiler != nullptr);
+  g_active_profiler = profiler;
+  ++internal::g_num_active_system_profilers;
+}
+
+SystemProfiler::ActiveScope::~ActiveScope() {
+  --internal::g_num_active_system_profilers;
+  g_active_profiler = previous_;
+}
+
+SystemProfiler* SystemProfiler::GetActiveOnThisThread() {
+  return g_active_profiler;
+}
+
+int SystemProfiler::FindOrAdd(Category category, const void* key,
+                              const internal::SystemMessageInterface& system,
+                              std::string_view name) {
+  const auto [iter, inserted] = indices_.emplace(
+      Key{key, category}, static_cast<int>(statistics_.size()));
+  if (inserted) {
+    Statistics stats;
+    stats.system_pathname = system.GetSystemPathname();
+    stats.name = std::string(name);
+    stats.category = category;
+    statistics_.push_back(std::move(stats));
+  }
+  return iter->second;
+}
+
+void SystemProfiler::RecordCacheHit(
+    const void* key, const internal::SystemMessageInterface& system,
+    std::string_view name) {
+  ++statistics_[FindOrAdd(Category::kCacheEntry, key, system, name)]
+        .num_evaluations;
+}
+
+void SystemProfiler::Begin(Category category, const void* key,
+                           const internal::SystemMessageInterface& system,
+                           std::string_view name) {
+  const int index = FindOrAdd(category, key, system, name);
+  open_.push_back(OpenComputation{index, Clock::now()});
+}
+
+void SystemProfiler::End() {
+  const Clock::time_point end = Clock::now();
+  DRAKE_DEMAND(!open_.empty());
+  const OpenComputation computation = open_.back();
+  open_.pop_back();
+  const Clock::duration duration = end - computation.start;
+  Statistics& stats = statistics_[computation.index];
+  ++stats.num_evaluations;
+  ++stats.num_computations;
+  stats.total_time += std::chrono::duration<double>(duration).count();
+  stats.self_time += std::chrono::duration<double>(
+      duration - computation.children).count();
+  if (!open_.empty()) {
+    open_.back().children += duration;
+  }
+  if (static_cast<int>(trace_.size()) < max_trace_events_) {
+    trace_.push_back(
+        TraceEvent{computation.index, computation.start - epoch_, duration});
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
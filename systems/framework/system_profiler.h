@@ -0,0 +1,201 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/framework_common.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+// The number of SystemProfiler::ActiveScope objects that exist (in any
+// thread). Checking this before looking for the current thread's profiler
+// keeps the cost of the instrumentation negligible while nothing is profiled.
+extern std::atomic<int> g_num_active_system_profilers;
+}  // namespace internal
+
+/** Records which System computations take the time in a simulation: the
+number of evaluations, cache hits and misses, and time spent in each cache
+entry (including output ports and time derivatives), in CalcTimeDerivatives(),
+and in each kind of event handler, per System. The results are available as
+statistics, as a summary table, and as a trace in the Chrome trace event
+format (which chrome://tracing and the Perfetto UI can display).
+
+The instrumentation is always compiled in, but records only while a profiler is
+made active on the current thread with an ActiveScope; Simulator does that
+when profiling is enabled (see Simulator::set_profiling_enabled()).
+Computations on other threads are not recorded.
+
+Times are "total" (including the time spent in nested profiled computations,
+e.g., the input port evaluations that a cache entry's Calc() function makes)
+and "self" (excluding them). The self times of all computations add up to the
+total time spent in the framework's computations. */
+class SystemProfiler {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SystemProfiler)
+
+  /** The kinds of computations that are recorded. */
+  enum class Category {
+    kCacheEntry,
+    kTimeDerivatives,
+    kPublish,
+    kDiscreteUpdate,
+    kUnrestrictedUpdate,
+  };
+
+  /** The statistics of one computation of one System. */
+  struct Statistics {
+    /** The pathname of the System (see SystemBase::GetSystemPathname()). */
+    std::string system_pathname;
+    /** The cache entry description, or the name of the System method. */
+    std::string name;
+    Category category{};
+    /** The number of evaluations. For cache entries, this is the number of
+    cache hits plus the number of computations; otherwise every evaluation is
+    a computation. */
+    int64_t num_evaluations{};
+    int64_t num_computations{};
+    /** Time spent computing, in seconds, including (total) and excluding
+    (self) nested computations. */
+    double total_time{};
+    double self_time{};
+  };
+
+  SystemProfiler();
+  ~SystemProfiler();
+
+  /** Discards all recorded statistics and trace events. */
+  void Clear();
+
+  /** Returns the statistics of all recorded computations, in decreasing order
+  of self time. */
+  std::vector<Statistics> GetStatistics() const;
+
+  /** Returns a table of the statistics, in decreasing order of self time,
+  with at most `max_rows` rows. */
+  std::string GetSummary(int max_rows = 30) const;
+
+  /** Returns the recorded computations in the Chrome trace event JSON format,
+  with one complete ("X") event per computation and times relative to the
+  construction (or last Clear()) of this profiler. */
+  std::string GetChromeTrace() const;
+
+  /** Writes GetChromeTrace() to the given file.
+  @throws std::exception if the file cannot be written. */
+  void WriteChromeTrace(const std::string& filename) const;
+
+  /** The trace keeps at most this many events (1'000'000 by default), to
+  bound its memory use; the statistics keep counting beyond it. */
+  int max_trace_events() const { return max_trace_events_; }
+  void set_max_trace_events(int max_trace_events);
+
+  /** Returns the number of trace events recorded. */
+  int num_trace_events() const { return static_cast<int>(trace_.size()); }
+
+  /** Makes a profiler active on the current thread for the lifetime of this
+  object, restoring the previously active profiler (if any) on destruction. */
+  class ActiveScope {
+   public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ActiveScope)
+    explicit ActiveScope(SystemProfiler* profiler);
+    ~ActiveScope();
+
+   private:
+    SystemProfiler* const previous_;
+  };
+
+  /** (Internal use only) Returns the profiler that is active on the current
+  thread, or nullptr. */
+  static SystemProfiler* GetActive() {
+    if (internal::g_num_active_system_profilers.load(
+            std::memory_order_relaxed) == 0) {
+      return nullptr;
+    }
+    return GetActiveOnThisThread();
+  }
+
+  /** (Internal use only) Records one computation of the active profiler (if
+  any) that lasts for the lifetime of this object. The `key` identifies the
+  computation within `system` (for cache entries, the CacheEntry). */
+  class ScopedComputation {
+   public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedComputation)
+    ScopedComputation(Category category, const void* key,
+                      const internal::SystemMessageInterface& system,
+                      std::string_view name)
+        : profiler_(GetActive()) {
+      if (profiler_ != nullptr) profiler_->Begin(category, key, system, name);
+    }
+    ~ScopedComputation() {
+      if (profiler_ != nullptr) profiler_->End();
+    }
+
+   private:
+    SystemProfiler* const profiler_;
+  };
+
+  /** (Internal use only) Records a cache hit of the given cache entry. */
+  void RecordCacheHit(const void* key,
+                      const internal::SystemMessageInterface& system,
+                      std::string_view name);
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Key {
+    const void* key;
+    Category category;
+    bool operator==(const Key& other) const {
+      return key == other.key && category == other.category;
+    }
+  };
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return std::hash<const void*>()(key.key) ^
+             static_cast<size_t>(key.category);
+    }
+  };
+
+  // A computation that has begun but not ended.
+  struct OpenComputation {
+    int index;
+    Clock::time_point start;
+    Clock::duration children{};
+  };
+
+  struct TraceEvent {
+    int index;
+    Clock::duration start;
+    Clock::duration duration;
+  };
+
+  static SystemProfiler* GetActiveOnThisThread();
+
+  // Returns the index into statistics_ of the given computation, adding it
+  // if it's new.
+  int FindOrAdd(Category category, const void* key,
+                const internal::SystemMessageInterface& system,
+                std::string_view name);
+
+  void Begin(Category category, const void* key,
+             const internal::SystemMessageInterface& system,
+             std::string_view name);
+  void End();
+
+  Clock::time_point epoch_;
+  std::unordered_map<Key, int, KeyHash> indices_;
+  std::vector<Statistics> statistics_;
+  std::vector<OpenComputation> open_;
+  std::vector<TraceEvent> trace_;
+  int max_trace_events_{1'000'000};
+};
+
+}  // namespace systems
+}  // namespace drake
@@ -47,6 +47,82 @@ TEST_F(AbstractStateTest, Clone) {
   EXPECT_EQ(76, UnpackIntValue(clone->get_value(1)));
 }
 
+TEST_F(AbstractStateTest, CopyOnWriteClone) {
+  AbstractValues xa(std::move(data_));
+  std::unique_ptr<AbstractValues> clone;
+  {
+    const internal::ScopedCopyOnWriteClone share;
+    clone = xa.Clone();
+  }
+  EXPECT_EQ(&xa.get_value(0), &clone->get_value(0));
+  EXPECT_TRUE(xa.is_shared(0));
+  EXPECT_TRUE(clone->is_shared(1));
+
+  // Writing to one element replaces only that element, leaving the original
+  // alone.
+  clone->get_mutable_value(0).set_value<int>(1);
+  EXPECT_EQ(1, UnpackIntValue(clone->get_value(0)));
+  EXPECT_EQ(42, UnpackIntValue(xa.get_value(0)));
+  EXPECT_FALSE(xa.is_shared(0));
+  EXPECT_EQ(&xa.get_value(1), &clone->get_value(1));
+
+  // An unshared value is also a private copy.
+  const AbstractValue& unshared = xa.get_unshared_value(1);
+  EXPECT_NE(&unshared, &clone->get_value(1));
+  EXPECT_EQ(76, UnpackIntValue(unshared));
+
+  // Without the scope, clones are deep.
+  std::unique_ptr<AbstractValues> deep = xa.Clone();
+  EXPECT_FALSE(xa.is_shared(0));
+  EXPECT_NE(&xa.get_value(0), &deep->get_value(0));
+}
+
+// The private copy of a shared element can be made by the caller.
+TEST_F(AbstractStateTest, UnsharedValueWithCopyFunction) {
+  AbstractValues xa(std::move(data_));
+  std::unique_ptr<AbstractValues> clone;
+  {
+    const internal::ScopedCopyOnWriteClone share;
+    clone = xa.Clone();
+  }
+  int num_copies = 0;
+  const auto make_copy = [&num_copies](const AbstractValue& shared) {
+    ++num_copies;
+    return PackValue(UnpackIntValue(shared) + 1);
+  };
+  EXPECT_EQ(77, UnpackIntValue(clone->get_unshared_value(1, make_copy)));
+  EXPECT_EQ(num_copies, 1);
+  EXPECT_EQ(76, UnpackIntValue(xa.get_value(1)));
+  EXPECT_FALSE(xa.is_shared(1));
+
+  // An element that isn't shared is not copied.
+  EXPECT_EQ(77, UnpackIntValue(clone->get_unshared_value(1, make_copy)));
+  EXPECT_EQ(num_copies, 1);
+}
+
+TEST_F(AbstractStateTest, SpanningView) {
+  AbstractValues first(std::move(data_));
+  AbstractValues second(PackValue<int>(1000));
+  std::unique_ptr<AbstractValues> view =
+      AbstractValues::MakeSpanningView({&first, &second});
+  ASSERT_EQ(3, view->size());
+  EXPECT_EQ(42, UnpackIntValue(view->get_value(0)));
+  EXPECT_EQ(1000, UnpackIntValue(view->get_value(2)));
+
+  // Writes through the view reach the source, even after a copy-on-write
+  // element is replaced.
+  std::unique_ptr<AbstractValues> clone;
+  {
+    const internal::ScopedCopyOnWriteClone share;
+    clone = view->Clone();
+  }
+  EXPECT_EQ(&clone->get_value(1), &first.get_value(1));
+  view->get_mutable_value(1).set_value<int>(2);
+  EXPECT_EQ(2, UnpackIntValue(first.get_value(1)));
+  EXPECT_EQ(&view->get_value(1), &first.get_value(1));
+  EXPECT_EQ(76, UnpackIntValue(clone->get_value(1)));
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
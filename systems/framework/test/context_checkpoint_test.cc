@@ -0,0 +1,197 @@
+#include "drake/systems/framework/context_checkpoint.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// A value that is not saved in checkpoints.
+struct Model {
+  int id{};
+};
+
+// A system with every kind of value a Context can hold.
+class Everything final : public LeafSystem<double> {
+ public:
+  explicit Everything(int num_discrete) {
+    DeclareContinuousState(1, 1, 1);
+    DeclareDiscreteState(num_discrete);
+    DeclareAbstractState(Value<int>(0));
+    DeclareAbstractState(Value<std::string>("default"));
+    DeclareNumericParameter(BasicVector<double>(2));
+    DeclareAbstractParameter(Value<Model>(Model{}));
+  }
+};
+
+class ContextCheckpointTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    builder.AddSystem<Everything>(2);
+    builder.AddSystem<Everything>(3);
+    diagram_ = builder.Build();
+
+    checkpointer_.RegisterTriviallyCopyableType<int>();
+    checkpointer_.RegisterAbstractValueType<std::string>(
+        [](const std::string& value, std::string* out) {
+          out->append(value);
+        },
+        [](std::string_view bytes, std::string* value) {
+          *value = bytes;
+        });
+    checkpointer_.IgnoreAbstractValueType<Model>();
+  }
+
+  // Returns a context whose values all differ from the defaults.
+  std::unique_ptr<Context<double>> MakeChangedContext() const {
+    auto context = diagram_->CreateDefaultContext();
+    context->SetTime(3600.5);
+    context->SetAccuracy(1e-4);
+    context->SetContinuousState(
+        Eigen::VectorXd::LinSpaced(6, 1.0, 6.0));
+    for (int i = 0; i < context->num_discrete_state_groups(); ++i) {
+      context->get_mutable_discrete_state(i).SetFromVector(
+          Eigen::VectorXd::Constant(context->get_discrete_state(i).size(),
+                                    10.0 + i));
+    }
+    context->SetAbstractState<int>(0, 7);
+    context->SetAbstractState<std::string>(1, "first");
+    context->SetAbstractState<int>(2, 8);
+    context->SetAbstractState<std::string>(3, "second with a longer value");
+    context->get_mutable_numeric_parameter(1).SetFromVector(
+        Eigen::Vector2d(-1.0, -2.0));
+    context->get_mutable_abstract_parameter(0).set_value<Model>(Model{22});
+    return context;
+  }
+
+  void ExpectRestored(const Context<double>& expected,
+                      const Context<double>& actual) const {
+    EXPECT_EQ(actual.get_time(), expected.get_time());
+    EXPECT_EQ(actual.get_accuracy(), expected.get_accuracy());
+    EXPECT_TRUE(CompareMatrices(
+        actual.get_continuous_state_vector().CopyToVector(),
+        expected.get_continuous_state_vector().CopyToVector()));
+    for (int i = 0; i < expected.num_discrete_state_groups(); ++i) {
+      EXPECT_TRUE(CompareMatrices(actual.get_discrete_state(i).value(),
+                                  expected.get_discrete_state(i).value()));
+    }
+    EXPECT_EQ(actual.get_abstract_state<int>(0), 7);
+    EXPECT_EQ(actual.get_abstract_state<std::string>(1), "first");
+    EXPECT_EQ(actual.get_abstract_state<int>(2), 8);
+    EXPECT_EQ(actual.get_abstract_state<std::string>(3),
+              "second with a longer value");
+    EXPECT_TRUE(CompareMatrices(actual.get_numeric_parameter(1).value(),
+                                Eigen::Vector2d(-1.0, -2.0)));
+  }
+
+  std::unique_ptr<Diagram<double>> diagram_;
+  ContextCheckpointer checkpointer_;
+};
+
+TEST_F(ContextCheckpointTest, SerializeRoundTrip) {
+  const auto saved = MakeChangedContext();
+  const std::string data = checkpointer_.Serialize(*saved);
+  EXPECT_EQ(data.size() % 8, 0);
+
+  auto restored = diagram_->CreateDefaultContext();
+  checkpointer_.Deserialize(data, restored.get());
+  ExpectRestored(*saved, *restored);
+
+  // The ignored abstract parameter is left alone.
+  EXPECT_EQ(restored->get_abstract_parameter(0).get_value<Model>().id, 0);
+}
+
+TEST_F(ContextCheckpointTest, FileRoundTrip) {
+  const auto saved = MakeChangedContext();
+  const std::string filename = temp_directory() + "/context.ckpt";
+  checkpointer_.Write(*saved, filename);
+  auto restored = diagram_->CreateDefaultContext();
+  checkpointer_.Read(filename, restored.get());
+  ExpectRestored(*saved, *restored);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      checkpointer_.Read(temp_directory() + "/no_such.ckpt", restored.get()),
+      ".*failed to open.*");
+}
+
+TEST_F(ContextCheckpointTest, UnregisteredType) {
+  ContextCheckpointer empty;
+  DRAKE_EXPECT_THROWS_MESSAGE(empty.Serialize(*MakeChangedContext()),
+                              ".*no way to save abstract values of type int.*");
+}
+
+TEST_F(ContextCheckpointTest, InvalidData) {
+  const auto saved = MakeChangedContext();
+  const std::string data = checkpointer_.Serialize(*saved);
+  auto context = diagram_->CreateDefaultContext();
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      checkpointer_.Deserialize("not a checkpoint", context.get()),
+      ".*does not start with the checkpoint marker.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      checkpointer_.Deserialize(data.substr(0, data.size() - 8),
+                                context.get()),
+      ".*ends unexpectedly.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      checkpointer_.Deserialize(data + std::string(8, '\0'), context.get()),
+      ".*unexpected data at the end.*");
+  std::string future = data;
+  future[8] = 2;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      checkpointer_.Deserialize(future, context.get()),
+      ".*has version 2 but only version 1 can be read.*");
+
+  // Nothing was changed by the failures.
+  EXPECT_EQ(context->get_time(), 0.0);
+}
+
+TEST_F(ContextCheckpointTest, DifferentSystem) {
+  const std::string data = checkpointer_.Serialize(*MakeChangedContext());
+  DiagramBuilder<double> builder;
+  builder.AddSystem<Everything>(2);
+  builder.AddSystem<Everything>(4);
+  auto other = builder.Build();
+  auto context = other->CreateDefaultContext();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      checkpointer_.Deserialize(data, context.get()),
+      ".*has 3 elements in discrete state group 1 but the Context has 4.*");
+  EXPECT_EQ(context->get_time(), 0.0);
+}
+
+TEST_F(ContextCheckpointTest, SimulatorMonitor) {
+  const std::string filename = temp_directory() + "/monitor.ckpt";
+  const auto monitor = checkpointer_.MakeSimulatorMonitor(filename, 1.0);
+  auto context = MakeChangedContext();
+  auto restored = diagram_->CreateDefaultContext();
+
+  // The first call always writes.
+  context->SetTime(0.25);
+  EXPECT_EQ(monitor(*context).severity(), EventStatus::kSucceeded);
+  checkpointer_.Read(filename, restored.get());
+  EXPECT_EQ(restored->get_time(), 0.25);
+
+  // Less than a period later, nothing is written.
+  context->SetTime(1.0);
+  EXPECT_EQ(monitor(*context).severity(), EventStatus::kSucceeded);
+  checkpointer_.Read(filename, restored.get());
+  EXPECT_EQ(restored->get_time(), 0.25);
+
+  context->SetTime(1.25);
+  EXPECT_EQ(monitor(*context).severity(), EventStatus::kSucceeded);
+  checkpointer_.Read(filename, restored.get());
+  EXPECT_EQ(restored->get_time(), 1.25);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
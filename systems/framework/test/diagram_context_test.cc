@@ -747,6 +747,68 @@ TEST_F(DiagramContextTest, Clone) {
   }
 }
 
+TEST_F(DiagramContextTest, CloneCopyOnWrite) {
+  auto clone = dynamic_pointer_cast<DiagramContext<double>>(
+      context_->CloneCopyOnWrite());
+  ASSERT_TRUE(clone != nullptr);
+  VerifyClonedState(clone->get_state());
+  VerifyClonedParameters(clone->get_parameters());
+
+  // The abstract values are shared, but numeric values are not.
+  EXPECT_EQ(&clone->get_abstract_state().get_value(0),
+            &context_->get_abstract_state().get_value(0));
+  EXPECT_TRUE(clone->get_abstract_state().is_shared(0));
+  EXPECT_EQ(&clone->get_abstract_parameter(0),
+            &context_->get_abstract_parameter(0));
+  EXPECT_NE(&clone->get_continuous_state_vector(),
+            &context_->get_continuous_state_vector());
+
+  // Writing to the clone gives it its own copy, in both the diagram and the
+  // subsystem contexts, and leaves the original alone.
+  clone->get_mutable_abstract_state<int>(0) = 12345;
+  clone->get_mutable_abstract_parameter(0).set_value<int>(101);
+  EXPECT_FALSE(clone->get_abstract_state().is_shared(0));
+  EXPECT_EQ(clone->get_abstract_state<int>(0), 12345);
+  EXPECT_EQ(clone->GetSubsystemContext(SubsystemIndex(5))
+                .get_abstract_state<int>(0),
+            12345);
+  EXPECT_EQ(clone->GetSubsystemContext(SubsystemIndex(7))
+                .get_abstract_parameter(0).get_value<int>(),
+            101);
+  VerifyClonedState(context_->get_state());
+  VerifyClonedParameters(context_->get_parameters());
+
+  // Clones of clones share with each other too.
+  std::unique_ptr<Context<double>> grandchild = clone->CloneCopyOnWrite();
+  EXPECT_EQ(&grandchild->get_abstract_parameter(0),
+            &clone->get_abstract_parameter(0));
+}
+
+// SetStateFrom() restores state but not parameters, and notifies only
+// state-dependent computations.
+TEST_F(DiagramContextTest, SetStateFrom) {
+  std::unique_ptr<Context<double>> saved = context_->CloneCopyOnWrite();
+  context_->SetContinuousState(Eigen::Vector2d(0.125, 7.5));
+  context_->get_mutable_discrete_state(0)[0] = -1.;
+  context_->get_mutable_abstract_state<int>(0) = 12345;
+  context_->get_mutable_numeric_parameter(0).SetAtIndex(0, -2.);
+
+  auto p_before = SaveNotifications(SystemBase::all_parameters_ticket());
+  auto x_before = SaveNotifications(SystemBase::all_state_ticket());
+  auto xa_before = SaveNotifications(SystemBase::xa_ticket());
+
+  context_->SetStateFrom(*saved);
+
+  VerifyClonedState(context_->get_state());
+  EXPECT_EQ(context_->get_numeric_parameter(0)[0], -2.);
+  VerifyNotifications("SetStateFrom: p", {},  // None.
+                      SystemBase::all_parameters_ticket(), &p_before);
+  VerifyNotifications("SetStateFrom: x",
+                      SystemBase::all_state_ticket(), &x_before);
+  VerifyNotifications("SetStateFrom: xa", has_abstract_state(),
+                      SystemBase::xa_ticket(), &xa_before);
+}
+
 TEST_F(DiagramContextTest, CloneState) {
   std::unique_ptr<State<double>> state = context_->CloneState();
   // Verify that the state was copied.
@@ -20,8 +20,10 @@
 #include "drake/systems/primitives/adder.h"
 #include "drake/systems/primitives/constant_value_source.h"
 #include "drake/systems/primitives/constant_vector_source.h"
+#include "drake/systems/primitives/demultiplexer.h"
 #include "drake/systems/primitives/gain.h"
 #include "drake/systems/primitives/integrator.h"
+#include "drake/systems/primitives/pass_through.h"
 #include "drake/systems/primitives/zero_order_hold.h"
 
 using Eigen::Vector2d;
@@ -3194,6 +3196,7 @@ class MyEventTestSystem : public LeafSystem<double> {
   MyEventTestSystem(const std::string& name, double p) {
     if (p > 0) {
       DeclarePeriodicPublishEvent(p, 0.0, &MyEventTestSystem::PublishPeriodic);
+      DeclareOnlyPeriodicUpdateTimes();
 
       // Verify that no periodic discrete updates are registered.
       EXPECT_FALSE(this->GetUniquePeriodicDiscreteUpdateAttribute());
@@ -3309,6 +3312,176 @@ GTEST_TEST(MyEventTest, MyEventTestDiagram) {
   EXPECT_EQ(sys[4]->get_per_step_count(), 1);
 }
 
+// A system with a periodic publish event that also overrides
+// DoCalcNextUpdateTime() to add a one-time publish "alarm". It can wrongly
+// declare that its update times are only periodic, to test the check of that
+// declaration.
+class AlarmSystem : public LeafSystem<double> {
+ public:
+  AlarmSystem(double period, double alarm_time, bool declare_only_periodic)
+      : alarm_time_(alarm_time) {
+    DeclarePeriodicPublishEvent(period, 0.0, &AlarmSystem::Noop);
+    if (declare_only_periodic) {
+      DeclareOnlyPeriodicUpdateTimes();
+    }
+  }
+
+ private:
+  void Noop(const Context<double>&) const {}
+
+  void DoCalcNextUpdateTime(const Context<double>& context,
+                            CompositeEventCollection<double>* events,
+                            double* time) const final {
+    LeafSystem<double>::DoCalcNextUpdateTime(context, events, time);
+    if (context.get_time() < alarm_time_ && alarm_time_ < *time) {
+      events->Clear();
+      *time = alarm_time_;
+      PublishEvent<double> event(TriggerType::kTimed);
+      event.AddToComposite(events);
+    }
+  }
+
+  const double alarm_time_;
+};
+
+// Tests that the Diagram's schedule of periodic-only subsystems reports the
+// same times and events as asking every subsystem would.
+GTEST_TEST(MyEventTest, PeriodicSchedule) {
+  DiagramBuilder<double> builder;
+  const auto* a = builder.AddSystem<MyEventTestSystem>("a", 0.2);
+  const auto* b = builder.AddSystem<MyEventTestSystem>("b", 0.3);
+  const auto* alarm = builder.AddSystem<AlarmSystem>(0.2, 0.25, false);
+  const auto* per_step = builder.AddSystem<MyEventTestSystem>("c", 0.0);
+  auto dut = builder.Build();
+
+  EXPECT_TRUE(a->HasOnlyPeriodicUpdateTimes());
+  EXPECT_TRUE(b->HasOnlyPeriodicUpdateTimes());
+  EXPECT_FALSE(alarm->HasOnlyPeriodicUpdateTimes());
+  EXPECT_FALSE(per_step->HasOnlyPeriodicUpdateTimes());
+  EXPECT_FALSE(dut->HasOnlyPeriodicUpdateTimes());
+
+  auto context = dut->CreateDefaultContext();
+  auto events = dut->AllocateCompositeEventCollection();
+  const auto& diagram_events =
+      dynamic_cast<const DiagramCompositeEventCollection<double>&>(*events);
+  auto has_events = [&](const System<double>* system) {
+    return diagram_events
+        .get_subevent_collection(dut->GetSystemIndexOrAbort(system))
+        .HasEvents();
+  };
+
+  // At each time, the next update time and which subsystems have events.
+  EXPECT_EQ(dut->CalcNextUpdateTime(*context, events.get()), 0.2);
+  EXPECT_TRUE(has_events(a));
+  EXPECT_FALSE(has_events(b));
+  EXPECT_TRUE(has_events(alarm));
+  EXPECT_FALSE(has_events(per_step));
+
+  context->SetTime(0.2);
+  EXPECT_EQ(dut->CalcNextUpdateTime(*context, events.get()), 0.25);
+  EXPECT_FALSE(has_events(a));
+  EXPECT_FALSE(has_events(b));
+  EXPECT_TRUE(has_events(alarm));
+
+  context->SetTime(0.25);
+  EXPECT_EQ(dut->CalcNextUpdateTime(*context, events.get()), 0.3);
+  EXPECT_FALSE(has_events(a));
+  EXPECT_TRUE(has_events(b));
+  EXPECT_FALSE(has_events(alarm));
+
+  context->SetTime(0.3);
+  EXPECT_EQ(dut->CalcNextUpdateTime(*context, events.get()), 0.4);
+  EXPECT_TRUE(has_events(a));
+  EXPECT_FALSE(has_events(b));
+  EXPECT_TRUE(has_events(alarm));
+}
+
+// A LeafSystem with periodic events that customizes DoCalcNextUpdateTime()
+// keeps its custom timed events without declaring anything.
+GTEST_TEST(MyEventTest, CustomNextUpdateTime) {
+  DiagramBuilder<double> builder;
+  const auto* alarm = builder.AddSystem<AlarmSystem>(0.2, 0.3, false);
+  auto dut = builder.Build();
+  auto context = dut->CreateDefaultContext();
+  auto events = dut->AllocateCompositeEventCollection();
+  const auto& alarm_events =
+      dynamic_cast<const DiagramCompositeEventCollection<double>&>(*events)
+          .get_subevent_collection(dut->GetSystemIndexOrAbort(alarm));
+  EXPECT_EQ(dut->CalcNextUpdateTime(*context, events.get()), 0.2);
+  EXPECT_TRUE(alarm_events.HasEvents());
+  context->SetTime(0.25);
+  EXPECT_EQ(dut->CalcNextUpdateTime(*context, events.get()), 0.3);
+  EXPECT_TRUE(alarm_events.HasEvents());
+  context->SetTime(0.3);
+  EXPECT_EQ(dut->CalcNextUpdateTime(*context, events.get()), 0.4);
+}
+
+// In assert-enabled builds, a LeafSystem that wrongly declares only periodic
+// update times is caught when its reported time disagrees with its periodic
+// events.
+GTEST_TEST(MyEventTest, WrongOnlyPeriodicUpdateTimes) {
+  if (!kDrakeAssertIsArmed) {
+    return;
+  }
+  DiagramBuilder<double> builder;
+  builder.AddSystem<AlarmSystem>(0.2, 0.3, true)->set_name("alarm");
+  auto dut = builder.Build();
+  auto context = dut->CreateDefaultContext();
+  auto events = dut->AllocateCompositeEventCollection();
+  EXPECT_EQ(dut->CalcNextUpdateTime(*context, events.get()), 0.2);
+  context->SetTime(0.25);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut->CalcNextUpdateTime(*context, events.get()),
+      ".*system '::_::alarm' reported an update time.*"
+      "must not call DeclareOnlyPeriodicUpdateTimes.*");
+}
+
+// An input port connected through output ports that alias their inputs (a
+// PassThrough, a Gain of one, and a single-output Demultiplexer) gets the
+// value of the original source directly, unless an aliased input port has a
+// fixed value.
+GTEST_TEST(OutputPortAliasTest, ConnectedChain) {
+  DiagramBuilder<double> builder;
+  auto* source = builder.AddSystem<ConstantVectorSource<double>>(
+      Eigen::Vector2d(1.0, 2.0));
+  auto* pass = builder.AddSystem<PassThrough<double>>(2);
+  auto* unit_gain = builder.AddSystem<Gain<double>>(1.0, 2);
+  auto* demux = builder.AddSystem<Demultiplexer<double>>(std::vector<int>{2});
+  auto* sink = builder.AddSystem<Gain<double>>(2.0, 2);
+  builder.Cascade(*source, *pass);
+  builder.Cascade(*pass, *unit_gain);
+  builder.Cascade(*unit_gain, *demux);
+  builder.Cascade(*demux, *sink);
+  builder.ExportOutput(sink->get_output_port());
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  const auto& output = diagram->get_output_port();
+
+  EXPECT_EQ(output.Eval(*context), Eigen::Vector2d(2.0, 4.0));
+  const auto& source_context = source->GetMyContextFromRoot(*context);
+  const auto& sink_context = sink->GetMyContextFromRoot(*context);
+  EXPECT_EQ(&sink->get_input_port().Eval<BasicVector<double>>(sink_context),
+            &source->get_output_port().Eval<BasicVector<double>>(
+                source_context));
+  const auto& pass_output =
+      dynamic_cast<const LeafOutputPort<double>&>(pass->get_output_port());
+  EXPECT_TRUE(pass_output.cache_entry().is_out_of_date(
+      pass->GetMyContextFromRoot(*context)));
+
+  // Changes upstream still reach the sink.
+  source->get_mutable_source_value(
+      &source->GetMyMutableContextFromRoot(context.get()))
+      .SetFromVector(Eigen::Vector2d(3.0, 4.0));
+  EXPECT_EQ(output.Eval(*context), Eigen::Vector2d(6.0, 8.0));
+
+  // A fixed value partway along the chain takes precedence, as it would
+  // without the shortcut.
+  unit_gain->get_input_port().FixValue(
+      &unit_gain->GetMyMutableContextFromRoot(context.get()),
+      Eigen::Vector2d(5.0, 6.0));
+  EXPECT_EQ(output.Eval(*context), Eigen::Vector2d(10.0, 12.0));
+}
+
 template <typename T>
 class ConstraintTestSystem : public LeafSystem<T> {
  public:
@@ -0,0 +1,209 @@
+#include "drake/systems/framework/system_profiler.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Category = SystemProfiler::Category;
+
+// Outputs the square of time.
+class Source final : public LeafSystem<double> {
+ public:
+  Source() {
+    DeclareVectorOutputPort("y", 1, &Source::CalcOutput);
+  }
+
+ private:
+  void CalcOutput(const Context<double>& context,
+                  BasicVector<double>* output) const {
+    (*output)[0] = context.get_time() * context.get_time();
+  }
+};
+
+// Integrates its input, samples its state, and publishes.
+class Sink final : public LeafSystem<double> {
+ public:
+  Sink() {
+    DeclareVectorInputPort("u", 1);
+    DeclareContinuousState(1);
+    DeclareDiscreteState(1);
+    DeclareForcedDiscreteUpdateEvent(&Sink::Sample);
+    DeclareForcedPublishEvent(&Sink::Print);
+  }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<double>& context,
+                             ContinuousState<double>* derivatives) const final {
+    (*derivatives)[0] = get_input_port(0).Eval(context)[0];
+  }
+
+  EventStatus Sample(const Context<double>& context,
+                     DiscreteValues<double>* next) const {
+    next->set_value(context.get_continuous_state_vector().CopyToVector());
+    return EventStatus::Succeeded();
+  }
+
+  EventStatus Print(const Context<double>&) const {
+    return EventStatus::Succeeded();
+  }
+};
+
+class SystemProfilerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    auto* source = builder.AddSystem<Source>();
+    source->set_name("source");
+    auto* sink = builder.AddSystem<Sink>();
+    sink->set_name("sink");
+    builder.Connect(*source, *sink);
+    diagram_ = builder.Build();
+    diagram_->set_name("diagram");
+    context_ = diagram_->CreateDefaultContext();
+  }
+
+  // Returns the statistics of the given computation, or fails.
+  SystemProfiler::Statistics Find(const std::string& system_pathname,
+                                  Category category,
+                                  const std::string& name) const {
+    for (const auto& stats : profiler_.GetStatistics()) {
+      if (stats.system_pathname == system_pathname &&
+          stats.category == category && stats.name == name) {
+        return stats;
+      }
+    }
+    ADD_FAILURE() << "No statistics for " << system_pathname << " " << name;
+    return {};
+  }
+
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+  SystemProfiler profiler_;
+};
+
+TEST_F(SystemProfilerTest, Statistics) {
+  {
+    SystemProfiler::ActiveScope scope(&profiler_);
+    EXPECT_EQ(SystemProfiler::GetActive(), &profiler_);
+    context_->SetTime(2.0);
+    diagram_->EvalTimeDerivatives(*context_);
+    diagram_->EvalTimeDerivatives(*context_);
+    std::unique_ptr<DiscreteValues<double>> discrete =
+        diagram_->AllocateDiscreteVariables();
+    diagram_->CalcDiscreteVariableUpdates(*context_, discrete.get());
+    diagram_->Publish(*context_);
+  }
+  EXPECT_EQ(SystemProfiler::GetActive(), nullptr);
+
+  // The second evaluation of the derivatives is a cache hit.
+  const auto xcdot = Find("::diagram", Category::kCacheEntry,
+                          "time derivatives");
+  EXPECT_EQ(xcdot.num_evaluations, 2);
+  EXPECT_EQ(xcdot.num_computations, 1);
+
+  // The Diagram's derivatives computation calls the Sink's, which evaluates
+  // the Source's output port.
+  const auto diagram_derivatives = Find(
+      "::diagram", Category::kTimeDerivatives, "CalcTimeDerivatives");
+  const auto sink_derivatives = Find(
+      "::diagram::sink", Category::kTimeDerivatives, "CalcTimeDerivatives");
+  const auto output = Find("::diagram::source", Category::kCacheEntry,
+                           "output port 0(y) cache");
+  EXPECT_EQ(sink_derivatives.num_computations, 1);
+  EXPECT_EQ(output.num_computations, 1);
+  EXPECT_GE(xcdot.total_time, diagram_derivatives.total_time);
+  EXPECT_GE(diagram_derivatives.total_time, sink_derivatives.total_time);
+  EXPECT_GE(sink_derivatives.total_time, output.total_time);
+  EXPECT_LE(sink_derivatives.self_time,
+            sink_derivatives.total_time - output.total_time + 1e-12);
+
+  EXPECT_EQ(Find("::diagram::sink", Category::kDiscreteUpdate,
+                 "CalcDiscreteVariableUpdates").num_computations, 1);
+  EXPECT_EQ(Find("::diagram::sink", Category::kPublish, "Publish")
+                .num_computations, 1);
+
+  // Every computation is traced; the cache hit is not.
+  int num_computations = 0;
+  for (const auto& stats : profiler_.GetStatistics()) {
+    num_computations += stats.num_computations;
+    EXPECT_GE(stats.total_time, stats.self_time);
+  }
+  EXPECT_EQ(profiler_.num_trace_events(), num_computations);
+
+  // Nothing is recorded without an active scope.
+  diagram_->Publish(*context_);
+  EXPECT_EQ(profiler_.num_trace_events(), num_computations);
+
+  profiler_.Clear();
+  EXPECT_TRUE(profiler_.GetStatistics().empty());
+  EXPECT_EQ(profiler_.num_trace_events(), 0);
+}
+
+TEST_F(SystemProfilerTest, Output) {
+  {
+    SystemProfiler::ActiveScope scope(&profiler_);
+    diagram_->EvalTimeDerivatives(*context_);
+  }
+
+  const std::string summary = profiler_.GetSummary();
+  EXPECT_NE(summary.find("Self (ms)"), std::string::npos);
+  EXPECT_NE(summary.find("::diagram::sink"), std::string::npos);
+  EXPECT_NE(summary.find("time derivatives"), std::string::npos);
+  EXPECT_NE(profiler_.GetSummary(1).find("more rows omitted"),
+            std::string::npos);
+
+  const std::string trace = profiler_.GetChromeTrace();
+  EXPECT_EQ(trace.find("{\"displayTimeUnit\": \"ms\", \"traceEvents\": ["), 0);
+  EXPECT_NE(trace.find("\"name\": \"::diagram::source output port 0(y) "
+                       "cache\", \"cat\": \"cache entry\", \"ph\": \"X\""),
+            std::string::npos);
+  EXPECT_NE(trace.find("\"args\": {\"system\": \"::diagram::sink\"}"),
+            std::string::npos);
+
+  const std::string filename = temp_directory() + "/trace.json";
+  profiler_.WriteChromeTrace(filename);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      profiler_.WriteChromeTrace(temp_directory() + "/no/such/trace.json"),
+      ".*could not open.*");
+}
+
+TEST_F(SystemProfilerTest, MaxTraceEvents) {
+  profiler_.set_max_trace_events(2);
+  SystemProfiler::ActiveScope scope(&profiler_);
+  diagram_->EvalTimeDerivatives(*context_);
+  EXPECT_EQ(profiler_.num_trace_events(), 2);
+  EXPECT_EQ(Find("::diagram::source", Category::kCacheEntry,
+                 "output port 0(y) cache").num_computations, 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(profiler_.set_max_trace_events(-1),
+                              ".*max_trace_events >= 0.*");
+}
+
+GTEST_TEST(SystemProfilerScopeTest, Nesting) {
+  SystemProfiler outer;
+  SystemProfiler inner;
+  EXPECT_EQ(SystemProfiler::GetActive(), nullptr);
+  {
+    SystemProfiler::ActiveScope outer_scope(&outer);
+    {
+      SystemProfiler::ActiveScope inner_scope(&inner);
+      EXPECT_EQ(SystemProfiler::GetActive(), &inner);
+    }
+    EXPECT_EQ(SystemProfiler::GetActive(), &outer);
+  }
+  EXPECT_EQ(SystemProfiler::GetActive(), nullptr);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
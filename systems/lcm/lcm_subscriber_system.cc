@@ -71,14 +71,18 @@ LcmSubscriberSystem::~LcmSubscriberSystem() {
 systems::EventStatus LcmSubscriberSystem::ProcessMessageAndStoreToAbstractState(
     const Context<double>&, State<double>* state) const {
   AbstractValues& abstract_state = state->get_mutable_abstract_state();
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  if (!received_message_.empty()) {
+  const std::shared_ptr<const ReceivedMessage> received =
+      std::atomic_load(&received_message_);
+  if (received == nullptr) {
+    return systems::EventStatus::Succeeded();
+  }
+  if (!received->bytes.empty()) {
     serializer_->Deserialize(
-        received_message_.data(), received_message_.size(),
+        received->bytes.data(), received->bytes.size(),
         &abstract_state.get_mutable_value(kStateIndexMessage));
   }
   abstract_state.get_mutable_value(kStateIndexMessageCount)
-      .get_mutable_value<int>() = received_message_count_;
+      .get_mutable_value<int>() = received->count;
 
   return systems::EventStatus::Succeeded();
 }
@@ -100,10 +104,7 @@ void LcmSubscriberSystem::DoCalcNextUpdateTime(
 
   // Do nothing unless we have a new message.
   const int last_message_count = GetMessageCount(context);
-  const int received_message_count = [this]() {
-    std::unique_lock<std::mutex> lock(received_message_mutex_);
-    return received_message_count_;
-  }();
+  const int received_message_count = received_message_count_.load();
   if (last_message_count == received_message_count) {
     return;
   }
@@ -140,10 +141,20 @@ void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
 
   const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
   const uint8_t* const rbuf_end = rbuf_begin + size;
-  std::lock_guard<std::mutex> lock(received_message_mutex_);
-  received_message_.clear();
-  received_message_.insert(received_message_.begin(), rbuf_begin, rbuf_end);
-  received_message_count_++;
+  // We are the only writer, so there is no read-modify-write race here.
+  const int count = received_message_count_.load() + 1;
+  std::shared_ptr<const ReceivedMessage> received(
+      new ReceivedMessage{{rbuf_begin, rbuf_end}, count});
+
+  // Publish the message before its count, so that anyone who observes the new
+  // count will also find (at least) this message.
+  std::atomic_store(&received_message_, std::move(received));
+  received_message_count_.store(count);
+
+  // Wake up WaitForMessage().  Taking the mutex (even briefly) ensures that a
+  // waiter cannot miss this notification between checking its predicate and
+  // going to sleep.
+  { std::lock_guard<std::mutex> lock(received_message_mutex_); }
   received_message_condition_variable_.notify_all();
 }
 
@@ -155,10 +166,10 @@ int LcmSubscriberSystem::WaitForMessage(
   using Duration = Clock::duration;
   using TimePoint = Clock::time_point;
 
-  // The message buffer and counter are updated in HandleMessage(), which is
-  // a callback function invoked by a different thread owned by the
-  // drake::lcm::DrakeLcmInterface instance passed to the constructor. Thus,
-  // for thread safety, these need to be properly protected by a mutex.
+  // The message and counter are published by HandleMessage(), which is a
+  // callback function invoked by a different thread owned by the
+  // drake::lcm::DrakeLcmInterface instance passed to the constructor. They are
+  // safe to read without a lock; the mutex only serves the condition variable.
   std::unique_lock<std::mutex> lock(received_message_mutex_);
 
   // Predicate to handle spurious wakeup -- in other words, we can stop if we
@@ -185,21 +196,24 @@ int LcmSubscriberSystem::WaitForMessage(
     DRAKE_ASSERT(TimePoint::max() - duration > Clock::now());
     if (!received_message_condition_variable_.wait_for(lock, duration,
                                                        message_received)) {
-      return received_message_count_;
+      return received_message_count_.load();
     }
   }
+  lock.unlock();
 
+  const std::shared_ptr<const ReceivedMessage> received =
+      std::atomic_load(&received_message_);
+  DRAKE_DEMAND(received != nullptr);
   if (message) {
-      serializer_->Deserialize(
-          received_message_.data(), received_message_.size(), message);
+    serializer_->Deserialize(
+        received->bytes.data(), received->bytes.size(), message);
   }
 
-  return received_message_count_;
+  return received->count;
 }
 
 int LcmSubscriberSystem::GetInternalMessageCount() const {
-  std::unique_lock<std::mutex> lock(received_message_mutex_);
-  return received_message_count_;
+  return received_message_count_.load();
 }
 
 }  // namespace lcm
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -136,17 +137,27 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   // Will be non-null iff our output port is abstract-valued.
   const std::unique_ptr<SerializerInterface> serializer_;
 
-  // The mutex that guards received_message_ and received_message_count_.
-  mutable std::mutex received_message_mutex_;
-
-  // A condition variable that's signaled every time the handler is called.
-  mutable std::condition_variable received_message_condition_variable_;
+  // The most recently received LCM message, together with its sequence
+  // number (i.e., the value of received_message_count_ once it arrived).
+  struct ReceivedMessage {
+    std::vector<uint8_t> bytes;
+    int count{};
+  };
 
-  // The bytes of the most recently received LCM message.
-  std::vector<uint8_t> received_message_;
+  // The latest message, published by HandleMessage() and read by everyone
+  // else.  It must only be accessed via std::atomic_load / atomic_store; the
+  // pointee is immutable, so readers need no lock to deserialize it.
+  std::shared_ptr<const ReceivedMessage> received_message_;
 
   // A message counter that's incremented every time the handler is called.
-  int received_message_count_{0};
+  // It is atomic so that polling for new messages (which happens on every
+  // simulator step) stays cheap.
+  std::atomic<int> received_message_count_{0};
+
+  // Only used by WaitForMessage() to block until the handler has been called;
+  // neither the message nor the counter is guarded by it.
+  mutable std::mutex received_message_mutex_;
+  mutable std::condition_variable received_message_condition_variable_;
 
   // When we are destroyed, our subscription will be automatically removed
   // (if the DrakeLcmInterface supports removal).
@@ -32,6 +32,10 @@ Demultiplexer<T>::Demultiplexer(const std::vector<int>& output_ports_sizes)
           this->CopyToOutput(context, OutputPortIndex(i), vector);
         });
   }
+  // A single output port copies the whole input.
+  if (num_output_ports == 1) {
+    this->DeclareOutputPortAlias(OutputPortIndex(0), InputPortIndex(0));
+  }
 }
 
 template <typename T>
@@ -33,6 +33,7 @@ DiscreteDerivative<T>::DiscreteDerivative(int num_inputs, double time_step,
     this->DeclareDiscreteState(1);
   }
   this->DeclarePeriodicDiscreteUpdate(time_step_);
+  this->DeclareOnlyPeriodicUpdateTimes();
 }
 
 template <typename T>
@@ -50,6 +50,7 @@ DiscreteTimeDelay<T>::DiscreteTimeDelay(
     this->DeclarePeriodicUnrestrictedUpdateEvent(
         update_sec_, 0., &DiscreteTimeDelay::SaveInputAbstractValueToBuffer);
   }
+  this->DeclareOnlyPeriodicUpdateTimes();
 }
 
 template <typename T>
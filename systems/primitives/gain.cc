@@ -15,7 +15,12 @@ Gain<T>::Gain(double k, int size) : Gain(Eigen::VectorXd::Ones(size) * k) {}
 template <typename T>
 Gain<T>::Gain(const Eigen::VectorXd& k)
     : VectorSystem<T>(SystemTypeTag<Gain>{}, k.size(), k.size()),
-      k_(k) {}
+      k_(k) {
+  // A gain of one copies its input, so a Diagram may skip it.
+  if ((k_.array() == 1.0).all()) {
+    this->DeclareOutputPortAlias(OutputPortIndex(0), InputPortIndex(0));
+  }
+}
 
 template <typename T>
 template <typename U>
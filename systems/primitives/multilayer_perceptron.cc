@@ -1,8 +1,10 @@
 #include "drake/systems/primitives/multilayer_perceptron.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/parallel_for.h"
 #include "drake/systems/framework/basic_vector.h"
 
 namespace drake {
@@ -23,6 +25,48 @@ struct CalcLayersData {
   std::vector<VectorX<T>> Xn;
 };
 
+// The workspace for BatchOutput and Backpropagation. The matrices for each
+// layer have one column per column of the batch.
+template <typename T>
+struct BackPropData {
+  explicit BackPropData(int n)
+      : Wx_plus_b(n),
+        Xn(n),
+        dXn_dWx_plus_b(n),
+        dloss_dXn(n),
+        dloss_dWx_plus_b(n) {}
+
+  // Sizes the matrices for a batch of `batch_size` columns. This only
+  // allocates memory when the batch size has changed.
+  void Resize(const std::vector<int>& layers, bool has_input_features,
+              int batch_size, bool gradients) {
+    const int num_weights = Xn.size();
+    if (has_input_features) {
+      input_features.resize(layers[0], batch_size);
+    }
+    for (int i = 0; i < num_weights; ++i) {
+      Wx_plus_b[i].resize(layers[i + 1], batch_size);
+      Xn[i].resize(layers[i + 1], batch_size);
+      if (gradients) {
+        dXn_dWx_plus_b[i].resize(layers[i + 1], batch_size);
+        dloss_dXn[i].resize(layers[i + 1], batch_size);
+        dloss_dWx_plus_b[i].resize(layers[i + 1], batch_size);
+      }
+    }
+  }
+
+  std::vector<MatrixX<T>> Wx_plus_b;
+  std::vector<MatrixX<T>> Xn;
+  std::vector<MatrixX<T>> dXn_dWx_plus_b;
+  std::vector<MatrixX<T>> dloss_dXn;
+  std::vector<MatrixX<T>> dloss_dWx_plus_b;
+  MatrixX<T> input_features;
+  MatrixX<T> dloss_dinput_features;
+  // The gradients of the loss with respect to the parameters summed over the
+  // blocks of thread k + 1 (thread 0 sums directly into the output).
+  std::vector<VectorX<T>> thread_dloss_dparams;
+};
+
 }  // namespace internal
 
 namespace {
@@ -43,56 +87,65 @@ const std::vector<int>& RejectEmpty(const std::vector<int>& arg) {
   return arg;
 }
 
-template <typename T>
-struct BackPropData {
-  explicit BackPropData(int n)
-      : Wx(n),
-        Wx_plus_b(n),
-        Xn(n),
-        dXn_dWx_plus_b(n),
-        dloss_dXn(n),
-        dloss_dWx_plus_b(n),
-        dloss_dW(n),
-        dloss_db(n) {}
+// The number of columns of a batch that are passed through all of the layers
+// of the network together. The activations of a block of a hidden layer with
+// 256 units then take 128 KiB, which fits in the L2 cache.
+constexpr int kBatchBlockSize = 64;
 
-  std::vector<MatrixX<T>> Wx;
-  std::vector<MatrixX<T>> Wx_plus_b;
-  std::vector<MatrixX<T>> Xn;
-  std::vector<MatrixX<T>> dXn_dWx_plus_b;
-  std::vector<MatrixX<T>> dloss_dXn;
-  std::vector<MatrixX<T>> dloss_dWx_plus_b;
-  std::vector<MatrixX<T>> dloss_dW;
-  std::vector<VectorX<T>> dloss_db;
-  MatrixX<T> input_features;
-  MatrixX<T> dloss_dinput_features;
-};
+// Returns the number of blocks in a batch of `batch_size` columns.
+int CalcNumBatchBlocks(int batch_size) {
+  return (batch_size + kBatchBlockSize - 1) / kBatchBlockSize;
+}
+
+// Returns the number of threads that process a batch of `batch_size` columns,
+// so that each thread has at least one block.
+int CalcNumBatchThreads(int num_threads, int batch_size) {
+  return drake::internal::CalcNumParallelThreads(
+      num_threads, CalcNumBatchBlocks(batch_size));
+}
+
+// Calls block(k, start, cols) for each block of (at most) kBatchBlockSize
+// consecutive columns of a batch of `batch_size` columns. The blocks are split
+// into `num_threads` runs of consecutive blocks, and `k` is the index of the
+// thread that processes the run.
+template <typename Block>
+void ForEachBatchBlock(int num_threads, int batch_size, const Block& block) {
+  drake::internal::StaticParallelFor(
+      num_threads, CalcNumBatchBlocks(batch_size), [&](int k, int b) {
+        const int start = b * kBatchBlockSize;
+        block(k, start, std::min(kBatchBlockSize, batch_size - start));
+      });
+}
 
 template <typename T, int cols>
 void Activation(
     PerceptronActivationType type,
     const Eigen::Ref<const Eigen::Matrix<T, Eigen::Dynamic, cols>>& X,
-    Eigen::Matrix<T, Eigen::Dynamic, cols>* Y,
-    Eigen::Matrix<T, Eigen::Dynamic, cols>* dYdX = nullptr) {
-  Y->resize(X.rows(), X.cols());
-  if (dYdX) {
-    dYdX->resize(X.rows(), X.cols());
+    Eigen::Ref<Eigen::Matrix<T, Eigen::Dynamic, cols>> Y) {
+  DRAKE_ASSERT(Y.rows() == X.rows() && Y.cols() == X.cols());
+  if (type == kTanh) {
+    Y = X.array().tanh().matrix();
+  } else if (type == kReLU) {
+    Y = X.array().max(0.0).matrix();
+  } else {
+    DRAKE_DEMAND(type == kIdentity);
+    Y = X;
   }
+}
+
+template <typename T, int cols>
+void ActivationGradient(
+    PerceptronActivationType type,
+    const Eigen::Ref<const Eigen::Matrix<T, Eigen::Dynamic, cols>>& X,
+    Eigen::Ref<Eigen::Matrix<T, Eigen::Dynamic, cols>> dYdX) {
+  DRAKE_ASSERT(dYdX.rows() == X.rows() && dYdX.cols() == X.cols());
   if (type == kTanh) {
-    *Y = X.array().tanh().matrix();
-    if (dYdX) {
-      dYdX->noalias() = (1.0 - X.array().tanh().square()).matrix();
-    }
+    dYdX = (1.0 - X.array().tanh().square()).matrix();
   } else if (type == kReLU) {
-    *Y = X.array().max(0.0).matrix();
-    if (dYdX) {
-      dYdX->noalias() = (X.array() <= 0).select(0 * X, 1);
-    }
+    dYdX = (X.array() <= 0).select(0 * X, 1);
   } else {
     DRAKE_DEMAND(type == kIdentity);
-    *Y = X;
-    if (dYdX) {
-      dYdX->setConstant(1.0);
-    }
+    dYdX.setConstant(1.0);
   }
 }
 
@@ -167,7 +220,7 @@ MultilayerPerceptron<T>::MultilayerPerceptron(
       "calc_layers", calc_layers_data, &MultilayerPerceptron<T>::CalcLayers);
 
   // Declare cache entry for Backpropagation:
-  BackPropData<T> backprop_data(num_weights_);
+  internal::BackPropData<T> backprop_data(num_weights_);
   backprop_cache_ = &this->DeclareCacheEntry(
       "backprop", ValueProducer(backprop_data, &ValueProducer::NoopCalc));
 }
@@ -179,7 +232,9 @@ MultilayerPerceptron<T>::MultilayerPerceptron(
     : MultilayerPerceptron<T>(
           other.use_sin_cos_for_input_,
           std::vector<int>(other.layers().begin() + 1, other.layers().end()),
-          other.activation_types_) {}
+          other.activation_types_) {
+  num_batch_threads_ = other.num_batch_threads_;
+}
 
 template <typename T>
 const VectorX<T>& MultilayerPerceptron<T>::GetParameters(
@@ -306,55 +361,68 @@ T MultilayerPerceptron<T>::Backpropagation(
   this->ValidateContext(context);
   DRAKE_DEMAND(X.rows() == this->get_input_port().size());
   DRAKE_DEMAND(dloss_dparams->rows() == num_parameters_);
-  BackPropData<T>& data =
+  internal::BackPropData<T>& data =
       backprop_cache_->get_mutable_cache_entry_value(context)
-          .template GetMutableValueOrThrow<BackPropData<T>>();
-  // Forward pass:
-  if (has_input_features_) {
-    CalcInputFeatures(X, &data.input_features);
-    data.Wx[0].noalias() = GetWeights(context, 0) * data.input_features;
-  } else {
-    data.Wx[0].noalias() = GetWeights(context, 0) * X;
-  }
-  data.Wx_plus_b[0].noalias() = data.Wx[0].colwise() + GetBiases(context, 0);
-  Activation<T, Eigen::Dynamic>(activation_types_[0], data.Wx_plus_b[0],
-                                &data.Xn[0], &data.dXn_dWx_plus_b[0]);
-  for (int i = 1; i < num_weights_; ++i) {
-    data.Wx[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
-    data.Wx_plus_b[i].noalias() = data.Wx[i].colwise() + GetBiases(context, i);
-    Activation<T, Eigen::Dynamic>(activation_types_[i], data.Wx_plus_b[i],
-                                  &data.Xn[i], &data.dXn_dWx_plus_b[i]);
+          .template GetMutableValueOrThrow<internal::BackPropData<T>>();
+  const int batch_size = X.cols();
+  const int num_threads = CalcNumBatchThreads(num_batch_threads_, batch_size);
+  data.Resize(layers_, has_input_features_, batch_size, true);
+  data.thread_dloss_dparams.resize(num_threads - 1);
+  for (VectorX<T>& thread_dloss_dparams : data.thread_dloss_dparams) {
+    thread_dloss_dparams.resize(num_parameters_);
   }
-  data.dloss_dXn[num_weights_ - 1].resize(layers_[num_weights_], X.cols());
+  // Forward pass:
+  ForEachBatchBlock(num_threads, batch_size,
+                    [this, &context, &X, &data](int, int start, int cols) {
+                      CalcBatchLayers(context, X, start, cols, true, &data);
+                    });
   data.dloss_dXn[num_weights_ - 1].setConstant(
       std::numeric_limits<typename Eigen::NumTraits<T>::Literal>::quiet_NaN());
   const T l =
       loss(data.Xn[num_weights_ - 1], &data.dloss_dXn[num_weights_ - 1]);
-  // Backward pass:
-  for (int i = num_weights_ - 1; i >= 0; --i) {
-    data.dloss_dWx_plus_b[i] =
-        (data.dloss_dXn[i].array() * data.dXn_dWx_plus_b[i].array()).matrix();
-    data.dloss_dW[i].resize(layers_[i + 1], layers_[i]);
-    data.dloss_dW[i].setZero();
-    for (int j = 0; j < X.cols(); ++j) {
+  // Backward pass. Each thread sums the gradients for its blocks, with one
+  // matrix-matrix product per block for each layer's weights.
+  const auto backward = [this, &context, &X, &data, dloss_dparams](
+                            int k, int start, int cols) {
+    T* const dloss_dparams_k = k == 0
+                                   ? dloss_dparams->data()
+                                   : data.thread_dloss_dparams[k - 1].data();
+    for (int i = num_weights_ - 1; i >= 0; --i) {
+      auto dloss_dWx_plus_b = data.dloss_dWx_plus_b[i].middleCols(start, cols);
+      dloss_dWx_plus_b =
+          (data.dloss_dXn[i].middleCols(start, cols).array() *
+           data.dXn_dWx_plus_b[i].middleCols(start, cols).array())
+              .matrix();
+      Eigen::Map<MatrixX<T>> dloss_dW(dloss_dparams_k + weight_indices_[i],
+                                      layers_[i + 1], layers_[i]);
       if (i > 0) {
-        data.dloss_dW[i].noalias() +=
-            data.dloss_dWx_plus_b[i].col(j) * data.Xn[i - 1].col(j).transpose();
+        dloss_dW.noalias() +=
+            dloss_dWx_plus_b *
+            data.Xn[i - 1].middleCols(start, cols).transpose();
       } else if (has_input_features_) {
-        data.dloss_dW[i].noalias() += data.dloss_dWx_plus_b[i].col(j) *
-                                      data.input_features.col(j).transpose();
+        dloss_dW.noalias() +=
+            dloss_dWx_plus_b *
+            data.input_features.middleCols(start, cols).transpose();
       } else {
-        data.dloss_dW[i].noalias() +=
-            data.dloss_dWx_plus_b[i].col(j) * X.col(j).transpose();
+        dloss_dW.noalias() +=
+            dloss_dWx_plus_b * X.middleCols(start, cols).transpose();
+      }
+      Eigen::Map<VectorX<T>>(dloss_dparams_k + bias_indices_[i],
+                             layers_[i + 1]) +=
+          dloss_dWx_plus_b.rowwise().sum();
+      if (i > 0) {
+        data.dloss_dXn[i - 1].middleCols(start, cols).noalias() =
+            GetWeights(context, i).transpose() * dloss_dWx_plus_b;
       }
     }
-    SetWeights(dloss_dparams, i, data.dloss_dW[i]);
-    data.dloss_db[i] = data.dloss_dWx_plus_b[i].rowwise().sum();
-    SetBiases(dloss_dparams, i, data.dloss_db[i]);
-    if (i > 0) {
-      data.dloss_dXn[i - 1].noalias() =
-          GetWeights(context, i).transpose() * data.dloss_dWx_plus_b[i];
-    }
+  };
+  dloss_dparams->setZero();
+  for (VectorX<T>& thread_dloss_dparams : data.thread_dloss_dparams) {
+    thread_dloss_dparams.setZero();
+  }
+  ForEachBatchBlock(num_threads, batch_size, backward);
+  for (const VectorX<T>& thread_dloss_dparams : data.thread_dloss_dparams) {
+    *dloss_dparams += thread_dloss_dparams;
   }
   return l;
 }
@@ -391,63 +459,69 @@ void MultilayerPerceptron<T>::BatchOutput(const Context<T>& context,
         "BatchOutput: dYdX != nullptr, but BatchOutput only supports gradients "
         "when the output layer has size 1.");
   }
+  if (gradients) {
+    DRAKE_DEMAND(dYdX->rows() == X.rows());
+    DRAKE_DEMAND(dYdX->cols() == X.cols());
+  }
 
-  BackPropData<T>& data =
+  internal::BackPropData<T>& data =
       backprop_cache_->get_mutable_cache_entry_value(context)
-          .template GetMutableValueOrThrow<BackPropData<T>>();
-  // Forward pass:
-  if (has_input_features_) {
-    CalcInputFeatures(X, &data.input_features);
-    data.Wx[0].noalias() = GetWeights(context, 0) * data.input_features;
-  } else {
-    data.Wx[0].noalias() = GetWeights(context, 0) * X;
+          .template GetMutableValueOrThrow<internal::BackPropData<T>>();
+  const int batch_size = X.cols();
+  data.Resize(layers_, has_input_features_, batch_size, gradients);
+  if (gradients && has_input_features_) {
+    data.dloss_dinput_features.resize(layers_[0], batch_size);
   }
-  data.Wx_plus_b[0].noalias() = data.Wx[0].colwise() + GetBiases(context, 0);
-  Activation<T, Eigen::Dynamic>(activation_types_[0], data.Wx_plus_b[0],
-                                &data.Xn[0],
-                                gradients ? &data.dXn_dWx_plus_b[0] : nullptr);
-  for (int i = 1; i < num_weights_; ++i) {
-    data.Wx[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
-    data.Wx_plus_b[i].noalias() = data.Wx[i].colwise() + GetBiases(context, i);
-    Activation<T, Eigen::Dynamic>(
-        activation_types_[i], data.Wx_plus_b[i], &data.Xn[i],
-        gradients ? &data.dXn_dWx_plus_b[i] : nullptr);
-  }
-  *Y = data.Xn[num_weights_ - 1];
-  if (gradients) {
+  const auto block = [this, &context, &X, Y, dYdX, gradients, &data](
+                         int, int start, int cols) {
+    // Forward pass:
+    CalcBatchLayers(context, X, start, cols, gradients, &data);
+    Y->middleCols(start, cols) =
+        data.Xn[num_weights_ - 1].middleCols(start, cols);
+    if (!gradients) {
+      return;
+    }
     // Backward pass:
     // In order to reuse the cache from Backprop, we take loss ≡ Y.
-    data.dloss_dXn[num_weights_ - 1] = RowVectorX<T>::Constant(X.cols(), 1.0);
+    data.dloss_dXn[num_weights_ - 1].middleCols(start, cols).setConstant(1.0);
     for (int i = num_weights_ - 1; i >= 0; --i) {
-      data.dloss_dWx_plus_b[i] =
-          (data.dloss_dXn[i].array() * data.dXn_dWx_plus_b[i].array()).matrix();
+      auto dloss_dWx_plus_b = data.dloss_dWx_plus_b[i].middleCols(start, cols);
+      dloss_dWx_plus_b =
+          (data.dloss_dXn[i].middleCols(start, cols).array() *
+           data.dXn_dWx_plus_b[i].middleCols(start, cols).array())
+              .matrix();
       if (i > 0) {
-        data.dloss_dXn[i - 1].noalias() =
-            GetWeights(context, i).transpose() * data.dloss_dWx_plus_b[i];
+        data.dloss_dXn[i - 1].middleCols(start, cols).noalias() =
+            GetWeights(context, i).transpose() * dloss_dWx_plus_b;
       } else if (has_input_features_) {
-        data.dloss_dinput_features.noalias() =
-            GetWeights(context, 0).transpose() * data.dloss_dWx_plus_b[0];
+        auto dloss_dinput_features =
+            data.dloss_dinput_features.middleCols(start, cols);
+        dloss_dinput_features.noalias() =
+            GetWeights(context, 0).transpose() * dloss_dWx_plus_b;
+        const auto X_block = X.middleCols(start, cols);
         int feature_row = 0, input_row = 0;
         for (bool use_sin_cos : use_sin_cos_for_input_) {
           if (use_sin_cos) {
-            dYdX->row(input_row) =
-                data.dloss_dinput_features.row(feature_row).array() *
-                    X.row(input_row).array().cos() -
-                data.dloss_dinput_features.row(feature_row + 1).array() *
-                    X.row(input_row).array().sin();
+            dYdX->block(input_row, start, 1, cols) =
+                dloss_dinput_features.row(feature_row).array() *
+                    X_block.row(input_row).array().cos() -
+                dloss_dinput_features.row(feature_row + 1).array() *
+                    X_block.row(input_row).array().sin();
             feature_row += 2;
             ++input_row;
           } else {
-            dYdX->row(input_row++) =
-                data.dloss_dinput_features.row(feature_row++);
+            dYdX->block(input_row++, start, 1, cols) =
+                dloss_dinput_features.row(feature_row++);
           }
         }
       } else {
-        dYdX->noalias() =
-            GetWeights(context, 0).transpose() * data.dloss_dWx_plus_b[i];
+        dYdX->middleCols(start, cols).noalias() =
+            GetWeights(context, 0).transpose() * dloss_dWx_plus_b;
       }
     }
-  }
+  };
+  ForEachBatchBlock(CalcNumBatchThreads(num_batch_threads_, batch_size),
+                    batch_size, block);
 }
 
 template <typename T>
@@ -463,34 +537,67 @@ template <typename T>
 void MultilayerPerceptron<T>::CalcLayers(
     const Context<T>& context, internal::CalcLayersData<T>* data) const {
   if (has_input_features_) {
+    data->input_features.resize(layers_[0], 1);
     CalcInputFeatures(this->get_input_port().Eval(context),
-                      &data->input_features);
+                      data->input_features);
     data->Wx[0].noalias() = GetWeights(context, 0) * data->input_features;
   } else {
     data->Wx[0].noalias() =
         GetWeights(context, 0) * this->get_input_port().Eval(context);
   }
   data->Wx_plus_b[0].noalias() = data->Wx[0].colwise() + GetBiases(context, 0);
-  Activation<T, 1>(activation_types_[0], data->Wx_plus_b[0], &(data->Xn[0]));
+  data->Xn[0].resize(layers_[1]);
+  Activation<T, 1>(activation_types_[0], data->Wx_plus_b[0], data->Xn[0]);
   for (int i = 1; i < num_weights_; ++i) {
     data->Wx[i].noalias() = GetWeights(context, i) * data->Xn[i - 1];
     data->Wx_plus_b[i].noalias() =
         data->Wx[i].colwise() + GetBiases(context, i);
-    Activation<T, 1>(activation_types_[i], data->Wx_plus_b[i], &(data->Xn[i]));
+    data->Xn[i].resize(layers_[i + 1]);
+    Activation<T, 1>(activation_types_[i], data->Wx_plus_b[i], data->Xn[i]);
+  }
+}
+
+template <typename T>
+void MultilayerPerceptron<T>::CalcBatchLayers(
+    const Context<T>& context, const Eigen::Ref<const MatrixX<T>>& X,
+    int start, int cols, bool gradients,
+    internal::BackPropData<T>* data) const {
+  for (int i = 0; i < num_weights_; ++i) {
+    auto Wx_plus_b = data->Wx_plus_b[i].middleCols(start, cols);
+    if (i > 0) {
+      Wx_plus_b.noalias() =
+          GetWeights(context, i) * data->Xn[i - 1].middleCols(start, cols);
+    } else if (has_input_features_) {
+      auto input_features = data->input_features.middleCols(start, cols);
+      CalcInputFeatures(X.middleCols(start, cols), input_features);
+      Wx_plus_b.noalias() = GetWeights(context, 0) * input_features;
+    } else {
+      Wx_plus_b.noalias() = GetWeights(context, 0) * X.middleCols(start, cols);
+    }
+    Wx_plus_b.colwise() += GetBiases(context, i);
+    Activation<T, Eigen::Dynamic>(activation_types_[i], Wx_plus_b,
+                                  data->Xn[i].middleCols(start, cols));
+    if (gradients) {
+      ActivationGradient<T, Eigen::Dynamic>(
+          activation_types_[i], Wx_plus_b,
+          data->dXn_dWx_plus_b[i].middleCols(start, cols));
+    }
   }
 }
 
 template <typename T>
 void MultilayerPerceptron<T>::CalcInputFeatures(
-    const Eigen::Ref<const MatrixX<T>>& X, MatrixX<T>* input_features) const {
-  input_features->resize(layers_[0], X.cols());
+    const Eigen::Ref<const MatrixX<T>>& X,
+    Eigen::Ref<MatrixX<T>> input_features) const {
+  DRAKE_ASSERT(input_features.rows() == layers_[0]);
+  DRAKE_ASSERT(input_features.cols() == X.cols());
   int feature_row = 0, input_row = 0;
   for (bool use_sin_cos : use_sin_cos_for_input_) {
     if (use_sin_cos) {
-      input_features->row(feature_row++) = X.row(input_row).array().sin();
-      input_features->row(feature_row++) = X.row(input_row++).array().cos();
+      input_features.row(feature_row++) = X.row(input_row).array().sin();
+      input_features.row(feature_row++) = X.row(input_row++).array().cos();
     } else {
-      input_features->row(feature_row++) = X.row(input_row++);
+      input_features.row(feature_row++) = X.row(input_row++);
     }
   }
 }
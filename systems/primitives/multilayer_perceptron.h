@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/systems/framework/leaf_system.h"
 
 namespace drake {
@@ -23,6 +24,9 @@ namespace internal {
 template <typename T>
 struct CalcLayersData;
 
+template <typename T>
+struct BackPropData;
+
 }  // namespace internal
 
 /** The MultilayerPerceptron (MLP) is one of the most common forms of neural
@@ -153,6 +157,27 @@ class MultilayerPerceptron final : public LeafSystem<T> {
     return activation_types_[layer];
   }
 
+  /** Sets the number of threads used by BatchOutput() and Backpropagation()
+   (default is 1, i.e., serially). Both methods process the batch in blocks of
+   columns, passing each block through every layer of the network while it is
+   still in cache; with more than one thread, the blocks are split evenly
+   among the threads. BatchOutput() returns exactly the same values for any
+   number of threads. Backpropagation() sums the gradients of each thread's
+   blocks in a fixed order, so its result depends on the number of threads
+   only by rounding.
+
+   Threads are only worthwhile for large batches (thousands of columns); the
+   threads are started on every call.
+   @throws std::exception if `num_threads` is less than one. */
+  void set_num_batch_threads(int num_threads) {
+    DRAKE_THROW_UNLESS(num_threads >= 1);
+    num_batch_threads_ = num_threads;
+  }
+
+  /** Returns the number of threads used by BatchOutput() and
+   Backpropagation(). */
+  int num_batch_threads() const { return num_batch_threads_; }
+
   /** Returns a reference to all of the parameters (weights and biases) as a
    single vector. Use GetWeights and GetBiases to extract the components. */
   const VectorX<T>& GetParameters(const Context<T>& context) const;
@@ -218,13 +243,15 @@ class MultilayerPerceptron final : public LeafSystem<T> {
    Note: The class uses the System Cache to minimize the number of dynamic
    memory allocations for repeated calls to this function with the same sized
    `X`.  Changing the batch size between calls to this method or BatchOutput
-   requires memory allocations.
+   requires memory allocations, as does using more than one thread (see
+   set_num_batch_threads()).
 
    @param X is a batch input, with one input per column.
    @param loss is a scalar loss function, where `Y` is the columnwise batch
    output of the network. It should return the scalar loss and set `dloss_dY`,
    the derivatives of the loss with respect to `Y`, which is pre-allocated to
-   be the same size as `Y`.
+   be the same size as `Y`. It is called once per call to this method, on the
+   calling thread, for the whole batch.
    @param dloss_dparams are the gradients computed. We take the storage as an
    input argument to avoid memory allocations inside the algorithm.
    @returns the calculated loss.
@@ -277,11 +304,19 @@ class MultilayerPerceptron final : public LeafSystem<T> {
   void CalcLayers(const Context<T>& context,
                   internal::CalcLayersData<T>* data) const;
 
+  // Calculates the hidden units in `data` for the columns [start, start +
+  // cols) of the batch input `X`, including the gradients of the activations
+  // when `gradients` is true. `data` must already be sized for the batch.
+  void CalcBatchLayers(const Context<T>& context,
+                       const Eigen::Ref<const MatrixX<T>>& X, int start,
+                       int cols, bool gradients,
+                       internal::BackPropData<T>* data) const;
+
   // Calculates the (potentially batch) feature vector values.  When `X` is
-  // size `num_inputs`-by-`N`, then `Features` is set to size
+  // size `num_inputs`-by-`N`, then `input_features` must be size
   // `layers()[0]`-by-`N`.
   void CalcInputFeatures(const Eigen::Ref<const MatrixX<T>>& X,
-                         MatrixX<T>* input_features) const;
+                         Eigen::Ref<MatrixX<T>> input_features) const;
 
   int num_weights_;     // The number of weight matrices (number of layers -1 ).
   int num_parameters_;  // Total number of parameters.
@@ -289,6 +324,7 @@ class MultilayerPerceptron final : public LeafSystem<T> {
   std::vector<PerceptronActivationType> activation_types_;
   std::vector<bool> use_sin_cos_for_input_{};
   bool has_input_features_{false};
+  int num_batch_threads_{1};
 
   // Stores the position index of each set of weights and biases in the main
   // parameter vector.
@@ -3,6 +3,7 @@
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <typeinfo>
 #include <utility>
 
 #include "drake/common/default_scalars.h"
@@ -44,6 +45,11 @@ Multiplexer<T>::Multiplexer(SystemScalarConverter converter,
   }
   this->DeclareVectorOutputPort(kUseDefaultName, model_vector,
                                 &Multiplexer::CombineInputsToOutput);
+  // With a single plain BasicVector input, the output copies that input.
+  if (input_sizes_.size() == 1 &&
+      typeid(model_vector) == typeid(BasicVector<T>)) {
+    this->DeclareOutputPortAlias(OutputPortIndex(0), InputPortIndex(0));
+  }
 }
 
 template <typename T>
@@ -28,6 +28,9 @@ PassThrough<T>::PassThrough(
         std::bind(&PassThrough::DoCalcAbstractOutput, this, sp::_1, sp::_2),
         {this->all_input_ports_ticket()});
   }
+  // The output is a copy of the input whenever the input has a value, so a
+  // Diagram may connect downstream ports to our input's source directly.
+  this->DeclareOutputPortAlias(OutputPortIndex(0), InputPortIndex(0));
 }
 
 template <typename T>
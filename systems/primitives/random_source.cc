@@ -84,6 +84,7 @@ RandomSource<T>::RandomSource(RandomDistribution distribution,
   this->DeclareAbstractState(Value<SampleGenerator>());
   this->DeclarePeriodicUnrestrictedUpdateEvent(
       sampling_interval_sec, 0., &RandomSource<T>::UpdateSamples);
+  this->DeclareOnlyPeriodicUpdateTimes();
   this->DeclareStateOutputPort("output", discrete_state_index);
 }
 
@@ -143,6 +143,15 @@ TEST_F(DemultiplexerTest, DirectFeedthrough) {
   }
 }
 
+// Only a single output port is a copy of the input.
+TEST_F(DemultiplexerTest, OutputPortAlias) {
+  EXPECT_EQ(demux_->GetAliasedInputPortIndex(OutputPortIndex(0)),
+            std::nullopt);
+  const Demultiplexer<double> single(std::vector<int>{3});
+  EXPECT_EQ(single.GetAliasedInputPortIndex(OutputPortIndex(0)),
+            InputPortIndex(0));
+}
+
 // Tests converting to different scalar types.
 TEST_F(DemultiplexerTest, ToAutoDiff) {
   EXPECT_TRUE(is_autodiffxd_convertible(*demux_, [&](const auto& converted) {
@@ -84,6 +84,16 @@ GTEST_TEST(GainTest, DirectFeedthrough) {
   EXPECT_FALSE(zero_gain->HasAnyDirectFeedthrough());
 }
 
+// Only a gain of one declares that its output copies its input.
+GTEST_TEST(GainTest, OutputPortAlias) {
+  const Gain<double> unit_gain(1.0, 3);
+  EXPECT_EQ(unit_gain.GetAliasedInputPortIndex(OutputPortIndex(0)),
+            InputPortIndex(0));
+  const Gain<double> mixed_gain(Eigen::Vector2d(1.0, 2.0));
+  EXPECT_EQ(mixed_gain.GetAliasedInputPortIndex(OutputPortIndex(0)),
+            std::nullopt);
+}
+
 GTEST_TEST(GainTest, GainAccessorTest) {
   const Vector4<double> gain_values(1.0, 2.0, 3.0, 4.0);
   const auto gain_system = make_unique<Gain<double>>(gain_values);
@@ -338,6 +338,49 @@ GTEST_TEST(MultilayerPerceptronTest, BatchOutputWithGradientsThrows) {
       "gradients when the output layer has size 1.");
 }
 
+GTEST_TEST(MultilayerPerceptronTest, BatchThreads) {
+  MultilayerPerceptron<double> mlp({false, true}, {8, 8, 1},
+                                   {kTanh, kReLU, kIdentity});
+  EXPECT_EQ(mlp.num_batch_threads(), 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(mlp.set_num_batch_threads(0),
+                              ".*num_threads >= 1.*");
+  auto context = mlp.CreateDefaultContext();
+  RandomGenerator generator(243);
+  mlp.SetRandomContext(context.get(), &generator);
+
+  // Use a batch that is split into several blocks, the last one partial.
+  const int N = 300;
+  const MatrixXd X = MatrixXd::Random(2, N);
+  const MatrixXd Y_desired = MatrixXd::Random(1, N);
+  MatrixXd Y(1, N), dYdX(2, N);
+  VectorXd dloss_dparams(mlp.num_parameters());
+  mlp.BatchOutput(*context, X, &Y, &dYdX);
+  const double loss = mlp.BackpropagationMeanSquaredError(
+      *context, X, Y_desired, &dloss_dparams);
+  for (int i = 0; i < N; i += 37) {
+    mlp.get_input_port().FixValue(context.get(), X.col(i));
+    EXPECT_NEAR(Y(0, i), mlp.get_output_port().Eval(*context)[0], 1e-14);
+  }
+
+  for (int num_threads : {2, 3, 8}) {
+    mlp.set_num_batch_threads(num_threads);
+    EXPECT_EQ(mlp.num_batch_threads(), num_threads);
+    MatrixXd Y_threads(1, N), dYdX_threads(2, N);
+    VectorXd dloss_dparams_threads(mlp.num_parameters());
+    mlp.BatchOutput(*context, X, &Y_threads, &dYdX_threads);
+    EXPECT_TRUE(CompareMatrices(Y_threads, Y));
+    EXPECT_TRUE(CompareMatrices(dYdX_threads, dYdX));
+    EXPECT_EQ(mlp.BackpropagationMeanSquaredError(*context, X, Y_desired,
+                                                  &dloss_dparams_threads),
+              loss);
+    EXPECT_TRUE(CompareMatrices(dloss_dparams_threads, dloss_dparams, 1e-14));
+  }
+
+  // Scalar conversion keeps the number of threads.
+  const MultilayerPerceptron<AutoDiffXd> mlp_ad(mlp);
+  EXPECT_EQ(mlp_ad.num_batch_threads(), 8);
+}
+
 GTEST_TEST(MultilayerPerceptronTest, ScalarConversion) {
   MultilayerPerceptron<double> mlp({1, 2, 3, 4}, kReLU);
 
@@ -93,6 +93,17 @@ TEST_F(MultiplexerTest, ModelVectorConstructor) {
   ASSERT_NO_THROW(mux_->get_output_port(0).Eval<MyVector2d>(*context_));
 }
 
+// Only a single plain BasicVector input is copied unchanged to the output.
+TEST_F(MultiplexerTest, OutputPortAlias) {
+  InitializeFromSizes({3});
+  EXPECT_EQ(mux_->GetAliasedInputPortIndex(OutputPortIndex(0)),
+            InputPortIndex(0));
+  InitializeFromSizes({1, 2});
+  EXPECT_EQ(mux_->GetAliasedInputPortIndex(OutputPortIndex(0)), std::nullopt);
+  InitializeFromMyVector();
+  EXPECT_EQ(mux_->GetAliasedInputPortIndex(OutputPortIndex(0)), std::nullopt);
+}
+
 TEST_F(MultiplexerTest, IsStateless) {
   InitializeFromSizes({1});
   EXPECT_EQ(0, context_->num_continuous_states());
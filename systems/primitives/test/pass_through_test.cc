@@ -128,6 +128,12 @@ TEST_P(PassThroughTest, DirectFeedthrough) {
   EXPECT_TRUE(pass_through_->HasAnyDirectFeedthrough());
 }
 
+// Tests that the output is declared to copy the input.
+TEST_P(PassThroughTest, OutputPortAlias) {
+  EXPECT_EQ(pass_through_->GetAliasedInputPortIndex(OutputPortIndex(0)),
+            InputPortIndex(0));
+}
+
 TEST_P(PassThroughTest, ToAutoDiff) {
   EXPECT_TRUE(is_autodiffxd_convertible(*pass_through_));
 }
@@ -32,6 +32,7 @@ ZeroOrderHold<T>::ZeroOrderHold(
         &ZeroOrderHold::LatchInputAbstractValueToState);
     this->DeclareStateOutputPort("y", state_index);
   }
+  this->DeclareOnlyPeriodicUpdateTimes();
 }
 
 template <typename T>
@@ -0,0 +1,48 @@
+#include "drake/systems/sensors/image_to_shared_memory.h"
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+ImageToSharedMemory::ImageToSharedMemory(
+    const std::string& name, int width, int height, double publish_period,
+    int num_slots)
+    : ring_(SharedMemoryImageRing::Create(name, width, height, num_slots)) {
+  DRAKE_THROW_UNLESS(publish_period >= 0.0);
+
+  DeclareAbstractInputPort("color_image", Value<ImageRgba8U>());
+  DeclareAbstractInputPort("depth_image", Value<ImageDepth32F>());
+
+  this->DeclareForcedPublishEvent(&ImageToSharedMemory::PublishFrame);
+  if (publish_period > 0.0) {
+    const double offset = 0.0;
+    this->DeclarePeriodicPublishEvent(
+        publish_period, offset, &ImageToSharedMemory::PublishFrame);
+  } else {
+    this->DeclarePerStepPublishEvent(&ImageToSharedMemory::PublishFrame);
+  }
+
+  set_name("ImageToSharedMemory(" + name + ")");
+}
+
+ImageToSharedMemory::~ImageToSharedMemory() = default;
+
+EventStatus ImageToSharedMemory::PublishFrame(
+    const Context<double>& context) const {
+  const InputPort<double>& color_port = color_image_input_port();
+  const InputPort<double>& depth_port = depth_image_input_port();
+  const ImageRgba8U* color = color_port.HasValue(context)
+                                 ? &color_port.Eval<ImageRgba8U>(context)
+                                 : nullptr;
+  const ImageDepth32F* depth = depth_port.HasValue(context)
+                                   ? &depth_port.Eval<ImageDepth32F>(context)
+                                   : nullptr;
+  ring_->Write(context.get_time(), color, depth);
+  return EventStatus::Succeeded();
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/image.h"
+#include "drake/systems/sensors/shared_memory_image_ring.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/// An %ImageToSharedMemory publishes a color image (ImageRgba8U) and a depth
+/// image (ImageDepth32F) into a SharedMemoryImageRing, so that co-located
+/// processes can receive them (e.g., via SharedMemoryToImages) without the
+/// compression and serialization cost of ImageToLcmImageArrayT and
+/// LcmPublisherSystem.
+///
+/// Either input port may be left disconnected, in which case the published
+/// frames record that image as absent.  The shared memory object is created
+/// when this system is constructed and unlinked when it is destroyed.
+///
+/// Publishing happens on forced publish events and additionally either
+/// periodically (if `publish_period > 0`) or on every simulator step.
+///
+/// @system
+/// name: ImageToSharedMemory
+/// input_ports:
+/// - color_image
+/// - depth_image
+/// @endsystem
+class ImageToSharedMemory final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageToSharedMemory)
+
+  /// Constructs the publisher and creates its shared memory ring.
+  /// See SharedMemoryImageRing::Create() for the meaning of the `name`,
+  /// `width`, `height`, and `num_slots` arguments.
+  /// @param publish_period Period that frames will be published.  If zero,
+  ///   frames are published on every simulator step instead.
+  /// @pre publish_period is non-negative.
+  ImageToSharedMemory(const std::string& name, int width, int height,
+                      double publish_period, int num_slots = 4);
+
+  ~ImageToSharedMemory() final;
+
+  /// Returns the abstract-valued input port for the ImageRgba8U color image.
+  const InputPort<double>& color_image_input_port() const {
+    return this->get_input_port(0);
+  }
+
+  /// Returns the abstract-valued input port for the ImageDepth32F depth image.
+  const InputPort<double>& depth_image_input_port() const {
+    return this->get_input_port(1);
+  }
+
+  /// Returns the ring that this system publishes into.
+  const SharedMemoryImageRing& ring() const { return *ring_; }
+
+ private:
+  EventStatus PublishFrame(const Context<double>& context) const;
+
+  // The ring is logically part of the outside world (like an LCM channel),
+  // so writing to it is not a change to this system's state.
+  const std::unique_ptr<SharedMemoryImageRing> ring_;
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,369 @@
+#include "drake/systems/sensors/shared_memory_image_ring.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+// The first eight bytes of every ring; "DRKIMGRB" in little-endian.
+constexpr uint64_t kMagic = 0x4252474D494B5244ull;
+constexpr uint32_t kVersion = 1;
+constexpr size_t kAlignment = 64;
+constexpr int kMaxReadAttempts = 8;
+
+constexpr size_t RoundUp(size_t value) {
+  return (value + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+// The ring is shared between processes, so its atomics must not rely on any
+// process-local lock.
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(std::atomic<int64_t>::is_always_lock_free);
+
+std::string ErrnoMessage() {
+  return std::strerror(errno);
+}
+
+}  // namespace
+
+struct SharedMemoryImageRing::RingHeader {
+  std::atomic<uint64_t> magic;
+  uint32_t version;
+  int32_t width;
+  int32_t height;
+  int32_t num_slots;
+  uint64_t slot_stride;
+  // The sequence number of the most recently completed frame; zero if none.
+  std::atomic<int64_t> latest;
+};
+
+struct SharedMemoryImageRing::SlotHeader {
+  // A sequence lock: odd while the writer is modifying this slot.
+  std::atomic<uint64_t> lock;
+  int64_t sequence;
+  double time;
+  int32_t color_width;
+  int32_t color_height;
+  int32_t depth_width;
+  int32_t depth_height;
+};
+
+namespace {
+
+constexpr size_t kRingHeaderSize = RoundUp(64);
+constexpr size_t kSlotHeaderSize = RoundUp(64);
+
+size_t ColorCapacity(int width, int height) {
+  return static_cast<size_t>(width) * height * ImageRgba8U::kPixelSize;
+}
+
+size_t DepthCapacity(int width, int height) {
+  return static_cast<size_t>(width) * height * ImageDepth32F::kPixelSize;
+}
+
+size_t SlotStride(int width, int height) {
+  return kSlotHeaderSize + RoundUp(ColorCapacity(width, height)) +
+         RoundUp(DepthCapacity(width, height));
+}
+
+// Resizes `image` to the given size (or to empty), without clearing it when
+// the size is unchanged since the caller will overwrite every pixel anyway.
+template <PixelType kPixelType>
+void ResizeForOverwrite(int width, int height, Image<kPixelType>* image) {
+  if (width == 0 || height == 0) {
+    *image = Image<kPixelType>();
+  } else if (image->width() != width || image->height() != height) {
+    image->resize(width, height);
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<SharedMemoryImageRing> SharedMemoryImageRing::Create(
+    const std::string& name, int width, int height, int num_slots) {
+  DRAKE_THROW_UNLESS(width > 0);
+  DRAKE_THROW_UNLESS(height > 0);
+  DRAKE_THROW_UNLESS(num_slots > 0);
+  static_assert(sizeof(RingHeader) <= kRingHeaderSize);
+  static_assert(sizeof(SlotHeader) <= kSlotHeaderSize);
+
+  const size_t stride = SlotStride(width, height);
+  const size_t size = kRingHeaderSize + stride * num_slots;
+
+  // Replace any existing object of the same name with a new one, rather than
+  // truncating it: readers that still have the old object mapped would fault
+  // (SIGBUS) on any access beyond its truncated size.
+  if (::shm_unlink(name.c_str()) != 0 && errno != ENOENT) {
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: could not replace '{}': {}", name,
+        ErrnoMessage()));
+  }
+  const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: could not create '{}': {}", name,
+        ErrnoMessage()));
+  }
+  if (::ftruncate(fd, size) != 0) {
+    const std::string message = ErrnoMessage();
+    ::close(fd);
+    ::shm_unlink(name.c_str());
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: could not resize '{}' to {} bytes: {}", name,
+        size, message));
+  }
+  void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    const std::string message = ErrnoMessage();
+    ::shm_unlink(name.c_str());
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: could not map '{}': {}", name, message));
+  }
+
+  // The freshly-created object is zero-filled, so every slot lock starts
+  // out even (unlocked) and `latest` starts out as zero (no frames).
+  auto* header = new (data) RingHeader;
+  header->version = kVersion;
+  header->width = width;
+  header->height = height;
+  header->num_slots = num_slots;
+  header->slot_stride = stride;
+  header->latest.store(0, std::memory_order_relaxed);
+  // Readers check the magic number last, so publish it last.
+  header->magic.store(kMagic, std::memory_order_release);
+
+  return std::unique_ptr<SharedMemoryImageRing>(
+      new SharedMemoryImageRing(name, true, data, size));
+}
+
+std::unique_ptr<SharedMemoryImageRing> SharedMemoryImageRing::Open(
+    const std::string& name) {
+  const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: could not open '{}': {}", name,
+        ErrnoMessage()));
+  }
+  struct stat info{};
+  if (::fstat(fd, &info) != 0) {
+    const std::string message = ErrnoMessage();
+    ::close(fd);
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: could not stat '{}': {}", name, message));
+  }
+  const size_t size = info.st_size;
+  if (size < kRingHeaderSize) {
+    ::close(fd);
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: '{}' is too small ({} bytes) to be an image "
+        "ring", name, size));
+  }
+  void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: could not map '{}': {}", name,
+        ErrnoMessage()));
+  }
+
+  // Wrap the mapping right away, so that it's unmapped if we throw below.
+  std::unique_ptr<SharedMemoryImageRing> result(
+      new SharedMemoryImageRing(name, false, data, size));
+  const RingHeader& header = result->header();
+  if (header.magic.load(std::memory_order_acquire) != kMagic) {
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: '{}' is not an image ring", name));
+  }
+  if (header.version != kVersion) {
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: '{}' has version {} but version {} was "
+        "expected", name, header.version, kVersion));
+  }
+  if (header.width <= 0 || header.height <= 0 || header.num_slots <= 0 ||
+      header.slot_stride != SlotStride(header.width, header.height) ||
+      size < kRingHeaderSize + header.slot_stride * header.num_slots) {
+    throw std::runtime_error(fmt::format(
+        "SharedMemoryImageRing: '{}' has a corrupt header", name));
+  }
+  return result;
+}
+
+SharedMemoryImageRing::SharedMemoryImageRing(
+    std::string name, bool is_writer, void* data, size_t size)
+    : name_(std::move(name)), is_writer_(is_writer), data_(data), size_(size) {
+  DRAKE_DEMAND(data_ != nullptr);
+}
+
+SharedMemoryImageRing::~SharedMemoryImageRing() {
+  ::munmap(data_, size_);
+  if (is_writer_) {
+    ::shm_unlink(name_.c_str());
+  }
+}
+
+const SharedMemoryImageRing::RingHeader& SharedMemoryImageRing::header()
+    const {
+  return *static_cast<const RingHeader*>(data_);
+}
+
+SharedMemoryImageRing::RingHeader& SharedMemoryImageRing::mutable_header() {
+  DRAKE_DEMAND(is_writer_);
+  return *static_cast<RingHeader*>(data_);
+}
+
+uint8_t* SharedMemoryImageRing::slot(int64_t sequence) const {
+  const RingHeader& ring = header();
+  return static_cast<uint8_t*>(data_) + kRingHeaderSize +
+         (sequence % ring.num_slots) * ring.slot_stride;
+}
+
+int SharedMemoryImageRing::width() const {
+  return header().width;
+}
+
+int SharedMemoryImageRing::height() const {
+  return header().height;
+}
+
+int SharedMemoryImageRing::num_slots() const {
+  return header().num_slots;
+}
+
+int64_t SharedMemoryImageRing::latest_sequence() const {
+  return header().latest.load(std::memory_order_acquire);
+}
+
+int64_t SharedMemoryImageRing::Write(
+    double time, const ImageRgba8U* color, const ImageDepth32F* depth) {
+  DRAKE_THROW_UNLESS(is_writer_);
+  RingHeader& ring = mutable_header();
+  for (const auto& [image_width, image_height] :
+       {std::pair(color ? color->width() : 0, color ? color->height() : 0),
+        std::pair(depth ? depth->width() : 0, depth ? depth->height() : 0)}) {
+    if (image_width > ring.width || image_height > ring.height) {
+      throw std::logic_error(fmt::format(
+          "SharedMemoryImageRing: cannot write a {}x{} image into '{}' "
+          "whose capacity is {}x{}", image_width, image_height, name_,
+          ring.width, ring.height));
+    }
+  }
+
+  // We are the only writer, so a relaxed load of our own counter suffices.
+  const int64_t sequence = ring.latest.load(std::memory_order_relaxed) + 1;
+  uint8_t* const bytes = slot(sequence);
+  auto* slot_header = reinterpret_cast<SlotHeader*>(bytes);
+  uint8_t* const color_bytes = bytes + kSlotHeaderSize;
+  uint8_t* const depth_bytes =
+      color_bytes + RoundUp(ColorCapacity(ring.width, ring.height));
+
+  // Mark the slot as being written (odd), so that concurrent readers of this
+  // slot will discard whatever they copy.
+  const uint64_t lock = slot_header->lock.load(std::memory_order_relaxed);
+  slot_header->lock.store(lock + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot_header->sequence = sequence;
+  slot_header->time = time;
+  slot_header->color_width = color ? color->width() : 0;
+  slot_header->color_height = color ? color->height() : 0;
+  slot_header->depth_width = depth ? depth->width() : 0;
+  slot_header->depth_height = depth ? depth->height() : 0;
+  if (color && color->size() > 0) {
+    std::memcpy(color_bytes, color->at(0, 0),
+                ColorCapacity(color->width(), color->height()));
+  }
+  if (depth && depth->size() > 0) {
+    std::memcpy(depth_bytes, depth->at(0, 0),
+                DepthCapacity(depth->width(), depth->height()));
+  }
+
+  // Unlock the slot (even), then announce the new frame.
+  slot_header->lock.store(lock + 2, std::memory_order_release);
+  ring.latest.store(sequence, std::memory_order_release);
+  return sequence;
+}
+
+bool SharedMemoryImageRing::ReadLatest(
+    int64_t* sequence, double* time, ImageRgba8U* color,
+    ImageDepth32F* depth) const {
+  DRAKE_THROW_UNLESS(sequence != nullptr);
+  DRAKE_THROW_UNLESS(time != nullptr);
+  const RingHeader& ring = header();
+  for (int attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+    const int64_t latest = ring.latest.load(std::memory_order_acquire);
+    if (latest == 0) {
+      return false;
+    }
+    const uint8_t* const bytes = slot(latest);
+    const auto* slot_header = reinterpret_cast<const SlotHeader*>(bytes);
+    const uint8_t* const color_bytes = bytes + kSlotHeaderSize;
+    const uint8_t* const depth_bytes =
+        color_bytes + RoundUp(ColorCapacity(ring.width, ring.height));
+
+    const uint64_t lock_before =
+        slot_header->lock.load(std::memory_order_acquire);
+    if (lock_before % 2 != 0) {
+      continue;
+    }
+    const int64_t slot_sequence = slot_header->sequence;
+    const double slot_time = slot_header->time;
+    const int color_width = slot_header->color_width;
+    const int color_height = slot_header->color_height;
+    const int depth_width = slot_header->depth_width;
+    const int depth_height = slot_header->depth_height;
+    // A torn header could hold garbage sizes; never trust them for copying.
+    if (slot_sequence != latest ||
+        color_width < 0 || color_width > ring.width ||
+        color_height < 0 || color_height > ring.height ||
+        depth_width < 0 || depth_width > ring.width ||
+        depth_height < 0 || depth_height > ring.height) {
+      continue;
+    }
+    if (color != nullptr) {
+      ResizeForOverwrite(color_width, color_height, color);
+      if (color->size() > 0) {
+        std::memcpy(color->at(0, 0), color_bytes,
+                    ColorCapacity(color_width, color_height));
+      }
+    }
+    if (depth != nullptr) {
+      ResizeForOverwrite(depth_width, depth_height, depth);
+      if (depth->size() > 0) {
+        std::memcpy(depth->at(0, 0), depth_bytes,
+                    DepthCapacity(depth_width, depth_height));
+      }
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t lock_after =
+        slot_header->lock.load(std::memory_order_relaxed);
+    if (lock_before != lock_after) {
+      continue;
+    }
+    *sequence = slot_sequence;
+    *time = slot_time;
+    return true;
+  }
+  return false;
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/// A fixed-capacity ring of color (ImageRgba8U) and depth (ImageDepth32F)
+/// frames stored in a POSIX shared memory object, for moving camera images
+/// between co-located processes without serializing them into LCM messages.
+///
+/// There is exactly one writer per ring (the process that called Create()),
+/// and any number of readers (processes that called Open()).  The ring is
+/// lock-free: each slot is guarded by a sequence lock, and the ring header
+/// holds the sequence number of the most recently completed frame.  A writer
+/// never waits for readers; a reader that is lapped by the writer while
+/// copying a frame detects the torn read and retries with the newest frame.
+///
+/// Every frame stored in the ring must fit within the `width` x `height`
+/// capacity given to Create(); smaller images are allowed.
+///
+/// Data is copied exactly once on each side: from the writer's images
+/// directly into the shared memory slot, and from the slot directly into the
+/// reader's images.  There is no compression or serialization.
+class SharedMemoryImageRing final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SharedMemoryImageRing)
+
+  /// Creates the shared memory object named `name` and returns the writer for
+  /// it.  Any existing object of the same name is unlinked and replaced by a
+  /// new one; readers that still have the old object open are unaffected, but
+  /// must Open() the name again to see the new writer's frames.  The shared
+  /// memory object is unlinked when the returned writer is destroyed.
+  /// @param name The POSIX shared memory name, e.g., "/drake_camera0".  It
+  ///   must begin with a '/' and contain no other slashes.
+  /// @param width The maximum width of any image written to the ring.
+  /// @param height The maximum height of any image written to the ring.
+  /// @param num_slots The number of frames in the ring.
+  /// @throws std::exception if the arguments are invalid or the shared memory
+  ///   object cannot be created.
+  static std::unique_ptr<SharedMemoryImageRing> Create(
+      const std::string& name, int width, int height, int num_slots = 4);
+
+  /// Opens the existing shared memory object named `name` (as previously
+  /// passed to Create()) and returns a reader for it.
+  /// @throws std::exception if the object does not exist or is not a valid
+  ///   image ring.
+  static std::unique_ptr<SharedMemoryImageRing> Open(const std::string& name);
+
+  ~SharedMemoryImageRing();
+
+  /// Returns the shared memory object name.
+  const std::string& name() const { return name_; }
+
+  /// Returns true iff this object was returned by Create().
+  bool is_writer() const { return is_writer_; }
+
+  /// Returns the maximum image width.
+  int width() const;
+
+  /// Returns the maximum image height.
+  int height() const;
+
+  /// Returns the number of frames in the ring.
+  int num_slots() const;
+
+  /// Returns the sequence number of the most recently written frame, or zero
+  /// if no frame has been written yet.  Sequence numbers start at one and
+  /// increase by one for every call to Write().
+  int64_t latest_sequence() const;
+
+  /// Writes a new frame to the ring, overwriting the oldest frame.  Either
+  /// image may be null, in which case the frame records that image as absent.
+  /// @returns the sequence number of the new frame.
+  /// @pre is_writer() is true.
+  /// @throws std::exception if an image is larger than the ring capacity.
+  int64_t Write(double time, const ImageRgba8U* color,
+                const ImageDepth32F* depth);
+
+  /// Copies the most recently written frame into the given images, which are
+  /// resized as necessary.  An image that was absent from the frame is set to
+  /// the empty (zero-sized) image.  Either output pointer may be null, in
+  /// which case that image is not copied.
+  /// @param[out] sequence The sequence number of the frame that was read.
+  /// @param[out] time The time passed to Write() for that frame.
+  /// @returns false if no frame has been written yet (in which case the
+  ///   outputs are unchanged), or if the writer overwrote the frame on every
+  ///   attempt to read it (in which case the image contents are unspecified).
+  bool ReadLatest(int64_t* sequence, double* time, ImageRgba8U* color,
+                  ImageDepth32F* depth) const;
+
+ private:
+  struct RingHeader;
+  struct SlotHeader;
+
+  SharedMemoryImageRing(std::string name, bool is_writer, void* data,
+                        size_t size);
+
+  const RingHeader& header() const;
+  RingHeader& mutable_header();
+  uint8_t* slot(int64_t sequence) const;
+
+  const std::string name_;
+  const bool is_writer_;
+  void* const data_;
+  const size_t size_;
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
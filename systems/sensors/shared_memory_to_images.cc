@@ -0,0 +1,113 @@
+#include "drake/systems/sensors/shared_memory_to_images.h"
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+namespace {
+constexpr int kStateIndexColor = 0;
+constexpr int kStateIndexDepth = 1;
+constexpr int kStateIndexSequence = 2;
+constexpr int kStateIndexTime = 3;
+}  // namespace
+
+SharedMemoryToImages::SharedMemoryToImages(const std::string& name)
+    : ring_(SharedMemoryImageRing::Open(name)) {
+  static_assert(kStateIndexColor == 0, "");
+  const auto color_state_index = DeclareAbstractState(Value<ImageRgba8U>());
+  static_assert(kStateIndexDepth == 1, "");
+  const auto depth_state_index = DeclareAbstractState(Value<ImageDepth32F>());
+  static_assert(kStateIndexSequence == 2, "");
+  DeclareAbstractState(Value<int64_t>(0));
+  static_assert(kStateIndexTime == 3, "");
+  DeclareAbstractState(
+      Value<double>(std::numeric_limits<double>::quiet_NaN()));
+
+  DeclareStateOutputPort("color_image", color_state_index);
+  DeclareStateOutputPort("depth_image", depth_state_index);
+
+  scratch_cache_ = &DeclareCacheEntry(
+      "scratch_images",
+      ValueProducer(ScratchImages{}, &ValueProducer::NoopCalc));
+
+  this->DeclareForcedUnrestrictedUpdateEvent(
+      &SharedMemoryToImages::ReceiveLatestFrame);
+
+  set_name("SharedMemoryToImages(" + name + ")");
+}
+
+SharedMemoryToImages::~SharedMemoryToImages() = default;
+
+int64_t SharedMemoryToImages::GetFrameSequence(
+    const Context<double>& context) const {
+  return context.get_abstract_state<int64_t>(kStateIndexSequence);
+}
+
+double SharedMemoryToImages::GetFrameTime(
+    const Context<double>& context) const {
+  return context.get_abstract_state<double>(kStateIndexTime);
+}
+
+EventStatus SharedMemoryToImages::ReceiveLatestFrame(
+    const Context<double>& context, State<double>* state) const {
+  // Copy from shared memory into scratch images, so that a failed read (e.g.,
+  // when the writer laps us on every attempt) leaves the state untouched.
+  ScratchImages& scratch =
+      scratch_cache_->get_mutable_cache_entry_value(context)
+          .GetMutableValueOrThrow<ScratchImages>();
+  int64_t sequence{};
+  double time{};
+  if (!ring_->ReadLatest(&sequence, &time, &scratch.first, &scratch.second)) {
+    return EventStatus::DidNothing();
+  }
+  // Swap (rather than copy) the new frame into the state, so that the storage
+  // of both the state and the scratch images is reused from frame to frame.
+  AbstractValues& abstract_state = state->get_mutable_abstract_state();
+  std::swap(scratch.first, abstract_state.get_mutable_value(kStateIndexColor)
+                               .get_mutable_value<ImageRgba8U>());
+  std::swap(scratch.second, abstract_state.get_mutable_value(kStateIndexDepth)
+                                .get_mutable_value<ImageDepth32F>());
+  abstract_state.get_mutable_value(kStateIndexSequence)
+      .get_mutable_value<int64_t>() = sequence;
+  abstract_state.get_mutable_value(kStateIndexTime)
+      .get_mutable_value<double>() = time;
+  return EventStatus::Succeeded();
+}
+
+// Adds additional event scheduling to the default implementation:
+// if the ring holds a newer frame, adds an event trigger scheduled
+// for the current time so it will be handled immediately.
+void SharedMemoryToImages::DoCalcNextUpdateTime(
+    const Context<double>& context, CompositeEventCollection<double>* events,
+    double* time) const {
+  // We do not support events other than our own frame timing events.
+  LeafSystem<double>::DoCalcNextUpdateTime(context, events, time);
+  DRAKE_THROW_UNLESS(events->HasEvents() == false);
+  DRAKE_THROW_UNLESS(std::isinf(*time));
+
+  // Do nothing unless we have a new frame.
+  if (ring_->latest_sequence() == GetFrameSequence(context)) {
+    return;
+  }
+
+  UnrestrictedUpdateEvent<double>::UnrestrictedUpdateCallback callback =
+      [this](const Context<double>& c, const UnrestrictedUpdateEvent<double>&,
+             State<double>* s) {
+        this->ReceiveLatestFrame(c, s);
+      };
+
+  // Schedule an update event at the current time.
+  *time = context.get_time();
+  events->get_mutable_unrestricted_update_events().AddEvent(
+      UnrestrictedUpdateEvent<double>(TriggerType::kTimed, callback));
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
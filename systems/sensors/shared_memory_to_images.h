@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/image.h"
+#include "drake/systems/sensors/shared_memory_image_ring.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/// A %SharedMemoryToImages receives frames published into a
+/// SharedMemoryImageRing (e.g., by ImageToSharedMemory in another process) and
+/// outputs the most recent color image as an ImageRgba8U and the most recent
+/// depth image as an ImageDepth32F.  It plays the role of LcmSubscriberSystem
+/// followed by LcmImageArrayToImages, without any decompression or
+/// deserialization.
+///
+/// The most recently received frame is stored in this system's abstract
+/// state.  Whenever the simulator advances and the ring holds a newer frame
+/// than the one in the state, an unrestricted update event copies the newer
+/// frame into the state.  Forced unrestricted update events do the same, which
+/// is useful outside of a Simulator.  Intermediate frames that were published
+/// between two updates are skipped.
+///
+/// If no frame has been received yet, or a frame lacks one of the images, the
+/// corresponding output is the empty (zero-sized) image.
+///
+/// @system
+/// name: SharedMemoryToImages
+/// output_ports:
+/// - color_image
+/// - depth_image
+/// @endsystem
+class SharedMemoryToImages final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SharedMemoryToImages)
+
+  /// Constructs the receiver and opens the shared memory ring named `name`.
+  /// @throws std::exception if the ring does not exist yet; see
+  ///   SharedMemoryImageRing::Open().
+  explicit SharedMemoryToImages(const std::string& name);
+
+  ~SharedMemoryToImages() final;
+
+  /// Returns the abstract-valued output port that contains an ImageRgba8U.
+  const OutputPort<double>& color_image_output_port() const {
+    return this->get_output_port(0);
+  }
+
+  /// Returns the abstract-valued output port that contains an ImageDepth32F.
+  const OutputPort<double>& depth_image_output_port() const {
+    return this->get_output_port(1);
+  }
+
+  /// Returns the sequence number of the frame stored in the given context, or
+  /// zero if no frame has been received yet.
+  int64_t GetFrameSequence(const Context<double>& context) const;
+
+  /// Returns the time stamp of the frame stored in the given context, as
+  /// given by the publisher's clock, or NaN if no frame has been received yet.
+  double GetFrameTime(const Context<double>& context) const;
+
+ private:
+  void DoCalcNextUpdateTime(const Context<double>& context,
+                            CompositeEventCollection<double>* events,
+                            double* time) const final;
+
+  EventStatus ReceiveLatestFrame(const Context<double>& context,
+                                 State<double>* state) const;
+
+  const std::unique_ptr<SharedMemoryImageRing> ring_;
+
+  // Scratch images that frames are read into, before being swapped into the
+  // state only if the read succeeds.
+  using ScratchImages = std::pair<ImageRgba8U, ImageDepth32F>;
+  CacheEntry* scratch_cache_{};
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,52 @@
+#include "drake/systems/sensors/image_to_shared_memory.h"
+
+#include <unistd.h>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+GTEST_TEST(ImageToSharedMemoryTest, Publish) {
+  // (On macOS, shared memory names may have at most 31 characters.)
+  const std::string name = "/drake_itsm_" + std::to_string(::getpid());
+  const ImageToSharedMemory dut(name, 8, 6, 0.1);
+  EXPECT_EQ(dut.num_input_ports(), 2);
+  EXPECT_EQ(dut.color_image_input_port().get_name(), "color_image");
+  EXPECT_EQ(dut.depth_image_input_port().get_name(), "depth_image");
+  EXPECT_EQ(dut.ring().name(), name);
+
+  auto reader = SharedMemoryImageRing::Open(name);
+  auto context = dut.CreateDefaultContext();
+  context->SetTime(1.5);
+  const ImageRgba8U color(8, 6, 99);
+  dut.color_image_input_port().FixValue(context.get(), color);
+
+  // With only the color input connected, the depth image is absent.
+  dut.Publish(*context);
+  int64_t sequence{};
+  double time{};
+  ImageRgba8U color_out;
+  ImageDepth32F depth_out(2, 2);
+  ASSERT_TRUE(reader->ReadLatest(&sequence, &time, &color_out, &depth_out));
+  EXPECT_EQ(sequence, 1);
+  EXPECT_EQ(time, 1.5);
+  EXPECT_EQ(color_out, color);
+  EXPECT_EQ(depth_out.size(), 0);
+
+  const ImageDepth32F depth(4, 3, 2.0f);
+  dut.depth_image_input_port().FixValue(context.get(), depth);
+  dut.Publish(*context);
+  ASSERT_TRUE(reader->ReadLatest(&sequence, &time, &color_out, &depth_out));
+  EXPECT_EQ(sequence, 2);
+  EXPECT_EQ(depth_out, depth);
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
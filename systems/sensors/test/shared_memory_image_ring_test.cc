@@ -0,0 +1,173 @@
+#include "drake/systems/sensors/shared_memory_image_ring.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+// Returns a shared memory name that is unique to this test process.  (On
+// macOS, names may have at most 31 characters.)
+std::string MakeName(const std::string& suffix) {
+  return "/drake_ring_" + std::to_string(::getpid()) + "_" + suffix;
+}
+
+ImageRgba8U MakeColor(int width, int height, uint8_t seed) {
+  ImageRgba8U result(width, height);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      for (int c = 0; c < 4; ++c) {
+        result.at(x, y)[c] = static_cast<uint8_t>(seed + x + 3 * y + 7 * c);
+      }
+    }
+  }
+  return result;
+}
+
+ImageDepth32F MakeDepth(int width, int height, float seed) {
+  ImageDepth32F result(width, height);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      result.at(x, y)[0] = seed + 0.25f * x + 0.5f * y;
+    }
+  }
+  return result;
+}
+
+GTEST_TEST(SharedMemoryImageRingTest, RoundTrip) {
+  const std::string name = MakeName("trip");
+  auto writer = SharedMemoryImageRing::Create(name, 8, 6, 3);
+  auto reader = SharedMemoryImageRing::Open(name);
+  EXPECT_TRUE(writer->is_writer());
+  EXPECT_FALSE(reader->is_writer());
+  EXPECT_EQ(reader->name(), name);
+  EXPECT_EQ(reader->width(), 8);
+  EXPECT_EQ(reader->height(), 6);
+  EXPECT_EQ(reader->num_slots(), 3);
+
+  // Nothing has been written yet.
+  int64_t sequence = -1;
+  double time = -1;
+  ImageRgba8U color;
+  ImageDepth32F depth;
+  EXPECT_EQ(reader->latest_sequence(), 0);
+  EXPECT_FALSE(reader->ReadLatest(&sequence, &time, &color, &depth));
+  EXPECT_EQ(sequence, -1);
+
+  // Write more frames than there are slots; the reader sees the newest one.
+  for (int i = 1; i <= 5; ++i) {
+    const ImageRgba8U expected_color = MakeColor(8, 6, i);
+    const ImageDepth32F expected_depth = MakeDepth(4, 2, i);
+    EXPECT_EQ(writer->Write(0.5 * i, &expected_color, &expected_depth), i);
+    EXPECT_EQ(reader->latest_sequence(), i);
+    ASSERT_TRUE(reader->ReadLatest(&sequence, &time, &color, &depth));
+    EXPECT_EQ(sequence, i);
+    EXPECT_EQ(time, 0.5 * i);
+    EXPECT_EQ(color, expected_color);
+    EXPECT_EQ(depth, expected_depth);
+  }
+
+  // Absent images are read back as empty images.
+  const ImageDepth32F expected_depth = MakeDepth(8, 6, 1.0);
+  EXPECT_EQ(writer->Write(10.0, nullptr, &expected_depth), 6);
+  ASSERT_TRUE(reader->ReadLatest(&sequence, &time, &color, &depth));
+  EXPECT_EQ(color.size(), 0);
+  EXPECT_EQ(depth, expected_depth);
+
+  // Either output may be skipped.
+  ASSERT_TRUE(reader->ReadLatest(&sequence, &time, nullptr, nullptr));
+  EXPECT_EQ(sequence, 6);
+}
+
+// A reader that runs concurrently with the writer (and is often lapped by it)
+// must only ever report frames whose every pixel came from the same Write().
+GTEST_TEST(SharedMemoryImageRingTest, ConcurrentReadsAreNotTorn) {
+  const std::string name = MakeName("torn");
+  const int width = 64;
+  const int height = 48;
+  auto writer = SharedMemoryImageRing::Create(name, width, height, 2);
+  auto reader = SharedMemoryImageRing::Open(name);
+
+  const int num_frames = 20000;
+  std::atomic<bool> done{false};
+  std::thread writer_thread([&writer, &done]() {
+    ImageRgba8U color(width, height);
+    ImageDepth32F depth(width, height);
+    for (int i = 1; i <= num_frames; ++i) {
+      // Every pixel of frame i holds values derived from i alone.
+      std::fill(color.at(0, 0), color.at(0, 0) + color.size(),
+                static_cast<uint8_t>(i));
+      std::fill(depth.at(0, 0), depth.at(0, 0) + depth.size(),
+                static_cast<float>(i));
+      writer->Write(i, &color, &depth);
+    }
+    done = true;
+  });
+
+  int num_reads = 0;
+  int num_torn = 0;
+  int64_t previous = 0;
+  ImageRgba8U color;
+  ImageDepth32F depth;
+  while (!done) {
+    int64_t sequence{};
+    double time{};
+    if (!reader->ReadLatest(&sequence, &time, &color, &depth)) {
+      continue;
+    }
+    ++num_reads;
+    EXPECT_GE(sequence, previous);
+    previous = sequence;
+    const bool consistent =
+        time == sequence &&
+        std::all_of(color.at(0, 0), color.at(0, 0) + color.size(),
+                    [&](uint8_t value) {
+                      return value == static_cast<uint8_t>(sequence);
+                    }) &&
+        std::all_of(depth.at(0, 0), depth.at(0, 0) + depth.size(),
+                    [&](float value) {
+                      return value == static_cast<float>(sequence);
+                    });
+    if (!consistent) {
+      ++num_torn;
+    }
+  }
+  writer_thread.join();
+  EXPECT_GT(num_reads, 0);
+  EXPECT_EQ(num_torn, 0);
+}
+
+GTEST_TEST(SharedMemoryImageRingTest, Errors) {
+  const std::string name = MakeName("errors");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SharedMemoryImageRing::Open(name),
+      ".*could not open.*");
+
+  auto writer = SharedMemoryImageRing::Create(name, 4, 4);
+  const ImageRgba8U too_big(5, 4);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      writer->Write(0.0, &too_big, nullptr),
+      ".*cannot write a 5x4 image.*capacity is 4x4.*");
+
+  auto reader = SharedMemoryImageRing::Open(name);
+  EXPECT_THROW(reader->Write(0.0, nullptr, nullptr), std::exception);
+
+  // The writer unlinks the object when it is destroyed.
+  writer.reset();
+  EXPECT_THROW(SharedMemoryImageRing::Open(name), std::exception);
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,93 @@
+#include "drake/systems/sensors/shared_memory_to_images.h"
+
+#include <unistd.h>
+
+#include <cmath>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/sensors/image_to_shared_memory.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+// Returns a shared memory name that is unique to this test process.  (On
+// macOS, names may have at most 31 characters.)
+std::string MakeName(const std::string& suffix) {
+  return "/drake_smti_" + std::to_string(::getpid()) + "_" + suffix;
+}
+
+GTEST_TEST(SharedMemoryToImagesTest, ForcedUpdate) {
+  const std::string name = MakeName("forced");
+  auto writer = SharedMemoryImageRing::Create(name, 8, 6);
+  const SharedMemoryToImages dut(name);
+  EXPECT_EQ(dut.num_input_ports(), 0);
+  EXPECT_EQ(dut.color_image_output_port().get_name(), "color_image");
+  EXPECT_EQ(dut.depth_image_output_port().get_name(), "depth_image");
+
+  auto context = dut.CreateDefaultContext();
+  EXPECT_EQ(dut.GetFrameSequence(*context), 0);
+  EXPECT_TRUE(std::isnan(dut.GetFrameTime(*context)));
+  EXPECT_EQ(dut.color_image_output_port().Eval<ImageRgba8U>(*context).size(),
+            0);
+
+  const ImageRgba8U color(8, 6, 17);
+  const ImageDepth32F depth(8, 6, 0.75f);
+  writer->Write(2.0, &color, &depth);
+
+  // The output is unchanged until an update happens.
+  EXPECT_EQ(dut.color_image_output_port().Eval<ImageRgba8U>(*context).size(),
+            0);
+  auto state = context->CloneState();
+  dut.CalcUnrestrictedUpdate(*context, state.get());
+  context->get_mutable_state().SetFrom(*state);
+  EXPECT_EQ(dut.GetFrameSequence(*context), 1);
+  EXPECT_EQ(dut.GetFrameTime(*context), 2.0);
+  EXPECT_EQ(dut.color_image_output_port().Eval<ImageRgba8U>(*context), color);
+  EXPECT_EQ(dut.depth_image_output_port().Eval<ImageDepth32F>(*context),
+            depth);
+}
+
+// Publishes through an ImageToSharedMemory and receives in a separate
+// simulation, as a co-located perception process would.
+GTEST_TEST(SharedMemoryToImagesTest, Simulated) {
+  const std::string name = MakeName("sim");
+  const ImageToSharedMemory publisher(name, 4, 4, 0.0);
+  auto publisher_context = publisher.CreateDefaultContext();
+
+  DiagramBuilder<double> builder;
+  const auto* dut = builder.AddSystem<SharedMemoryToImages>(name);
+  auto diagram = builder.Build();
+  Simulator<double> simulator(*diagram);
+  simulator.Initialize();
+  const Context<double>& dut_context =
+      dut->GetMyContextFromRoot(simulator.get_context());
+  EXPECT_EQ(dut->GetFrameSequence(dut_context), 0);
+
+  for (int i = 1; i <= 3; ++i) {
+    const ImageRgba8U color(4, 4, i);
+    publisher.color_image_input_port().FixValue(publisher_context.get(),
+                                                color);
+    publisher_context->SetTime(0.1 * i);
+    publisher.Publish(*publisher_context);
+
+    simulator.AdvanceTo(0.01 * i);
+    EXPECT_EQ(dut->GetFrameSequence(dut_context), i);
+    EXPECT_EQ(dut->GetFrameTime(dut_context), 0.1 * i);
+    EXPECT_EQ(dut->color_image_output_port().Eval<ImageRgba8U>(dut_context),
+              color);
+    EXPECT_EQ(
+        dut->depth_image_output_port().Eval<ImageDepth32F>(dut_context).size(),
+        0);
+  }
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake